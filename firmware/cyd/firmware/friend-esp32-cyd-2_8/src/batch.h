@@ -0,0 +1,160 @@
+#pragma once
+#include <Arduino.h>
+#include "iram.h"
+#include "display_list.h"
+
+// ===== Span batcher: changed spans -> few ILI9341 windows =====
+// Every window costs CASET + PASET + RAMWR (and a transaction) before its first pixel, which dominates
+// for the short spans a frame diff produces (AA edge pixels, 21 lip segments x 2 lips). The batcher
+// takes the diff's spans in row order and grows rectangles: spans on a row merge across small gaps,
+// rows merge into the rectangle above when the extra (unchanged) pixels cost less than a new window.
+// Same-colour spans stacked exactly become one fillRect; anything else is pushed as one pixel window
+// composed from the frame's display list.
+namespace Batch {
+
+// ---------- Tunables ----------
+static constexpr int WINDOW_CMD_BYTES = 11;     // CASET(1+4) + PASET(1+4) + RAMWR(1)
+static constexpr int WINDOW_COST      = 32;     // one window in pixel-byte terms: commands + transaction setup
+static constexpr int MAX_WINDOW_PX    = 1024;   // largest composed window (2 KB pixel buffer)
+static constexpr int MAX_RUNS         = 48;     // runs per row
+static constexpr int MAX_RECTS        = 24;     // rectangles open at once
+
+struct Rect {
+  int16_t  x0, x1, y0, y1;
+  uint16_t c;
+  bool     solid;   // one colour, exact column: fillRect
+  bool     hit;     // extended on the current row
+};
+
+// Pixels of `want` (background where no span) over [x0, x1] x [y0, y1], row-major into buf.
+FACE_IRAM(batch) static void compose(const DList::List& want, uint16_t bg, int x0, int x1, int y0, int y1, uint16_t* buf){
+  const int w = x1 - x0 + 1;
+  for (int ry = y0; ry <= y1; ++ry) {
+    uint16_t* row = &buf[(ry - y0) * w];
+    for (int i = 0; i < w; ++i) row[i] = bg;
+    for (const DList::Span* s = want.rowBegin(ry); s != want.rowEnd(ry); ++s) {
+      if (s->x1 < x0) continue;
+      if (s->x0 > x1) break;
+      for (int x = max((int)s->x0, x0); x <= min((int)s->x1, x1); ++x) row[x - x0] = s->c;
+    }
+  }
+}
+
+// Pushes `want` over a whole area, unchanged pixels included, as windows of <= MAX_WINDOW_PX.
+template <class Sink>
+static void pushArea(Sink& out, const DList::List& want, uint16_t bg, int x0, int x1, int y0, int y1){
+  static uint16_t buf[MAX_WINDOW_PX];
+  const int w = x1 - x0 + 1;
+  if (w <= 0) return;
+  const int band = max(1, MAX_WINDOW_PX / w);
+  for (int y = y0; y <= y1; y += band) {
+    const int ye = min(y1, y + band - 1);
+    compose(want, bg, x0, x1, y, ye, buf);
+    out.image(x0, y, w, ye - y + 1, buf);
+  }
+}
+
+// Sink: fill(x, y, w, h, c) and image(x, y, w, h, const uint16_t* px).
+template <class Sink>
+struct Batcher {
+  Sink& out;
+  const DList::List& want;
+  uint16_t bg;
+
+  Rect     rect[MAX_RECTS];
+  int      nRect = 0;
+  DList::Span run[MAX_RUNS];
+  bool     runSolid[MAX_RUNS];
+  int      nRun = 0, y = -1;
+
+  Batcher(Sink& _out, const DList::List& _want, uint16_t _bg) : out(_out), want(_want), bg(_bg) {}
+
+  // DList::diff sink: spans arrive row by row, left to right.
+  inline void span(int sy, int x0, int x1, uint16_t c){
+    if (sy != y) { endRow(); y = sy; }
+    if (nRun) {
+      DList::Span& l = run[nRun - 1];
+      const int gap = x0 - l.x1 - 1;
+      if (2 * gap < WINDOW_COST && x1 - l.x0 + 1 <= MAX_WINDOW_PX) {
+        runSolid[nRun - 1] = runSolid[nRun - 1] && gap == 0 && c == l.c;
+        l.x1 = (int16_t)x1;
+        return;
+      }
+    }
+    if (nRun == MAX_RUNS) drawRun(nRun - 1), --nRun;
+    run[nRun] = { (int16_t)x0, (int16_t)x1, c };
+    runSolid[nRun++] = true;
+  }
+
+  void finish(){
+    endRow();
+    while (nRect) close(nRect - 1);
+  }
+
+private:
+  static inline int area(int x0, int x1, int y0, int y1){ return (x1 - x0 + 1) * (y1 - y0 + 1); }
+
+  FACE_IRAM(batch) void endRow(){
+    if (y < 0) return;
+    for (int i = 0; i < nRect; ++i) rect[i].hit = false;
+
+    for (int i = 0; i < nRun; ++i) {
+      const DList::Span& s = run[i];
+      const int len = s.x1 - s.x0 + 1;
+      int best = -1, bestExtra = INT_MAX;
+      bool bestSolid = false;
+      for (int k = 0; k < nRect; ++k) {
+        const Rect& r = rect[k];
+        if (r.y1 < y - 1) continue;
+        const int nx0 = min((int)r.x0, (int)s.x0), nx1 = max((int)r.x1, (int)s.x1);
+        const int newArea = area(nx0, nx1, r.y0, y);
+        const int extra = newArea - area(r.x0, r.x1, r.y0, r.y1) - len;
+        const bool solid = r.solid && runSolid[i] && r.c == s.c && r.x0 == s.x0 && r.x1 == s.x1 && r.y1 == y - 1;
+        if (!solid && newArea > MAX_WINDOW_PX) continue;
+        if (2 * extra < WINDOW_COST && extra < bestExtra) { best = k; bestExtra = extra; bestSolid = solid; }
+      }
+      if (best >= 0) {
+        Rect& r = rect[best];
+        r.x0 = min(r.x0, s.x0); r.x1 = max(r.x1, s.x1); r.y1 = (int16_t)y;
+        r.solid = bestSolid; r.hit = true;
+      } else {
+        if (nRect == MAX_RECTS) close(0);
+        rect[nRect++] = { s.x0, s.x1, (int16_t)y, (int16_t)y, s.c, runSolid[i], true };
+      }
+    }
+    nRun = 0;
+
+    for (int k = nRect - 1; k >= 0; --k)
+      if (!rect[k].hit) close(k);
+  }
+
+  void close(int k){
+    draw(rect[k]);
+    for (int i = k + 1; i < nRect; ++i) rect[i - 1] = rect[i];
+    --nRect;
+  }
+
+  void drawRun(int i){
+    const DList::Span& s = run[i];
+    draw(Rect{ s.x0, s.x1, (int16_t)y, (int16_t)y, s.c, runSolid[i], false });
+  }
+
+  // Solid rects fill; the rest are composed from the wanted display list (unchanged pixels included).
+  void draw(const Rect& r){
+    const int w = r.x1 - r.x0 + 1, h = r.y1 - r.y0 + 1;
+    if (r.solid) { out.fill(r.x0, r.y0, w, h, r.c); return; }
+    static uint16_t buf[MAX_WINDOW_PX];   // off the loop task's stack
+    compose(want, bg, r.x0, r.x1, r.y0, r.y1, buf);
+    out.image(r.x0, r.y0, w, h, buf);
+  }
+};
+
+// Unbatched path: one window per changed span.
+template <class Sink>
+struct PerSpan {
+  Sink& out;
+  inline void span(int y, int x0, int x1, uint16_t c){ out.fill(x0, y, x1 - x0 + 1, 1, c); }
+  inline void finish(){}
+};
+
+} // namespace Batch
@@ -0,0 +1,68 @@
+#pragma once
+#include <Arduino.h>
+#include "iram.h"
+#include "theme.h"
+#include "display_list.h"
+
+// ===== Caption strip: one line of text in the top band, drawn as part of the face =====
+// Text arrives as a 1bpp bitmap (rasterised once per caption by the caller) and is emitted as spans
+// in the lip colour, so captions go through the same diff as the face. The hardware scroll axis is
+// screen x across the full panel height (see scroll.h), so the strip cannot scroll on its own: a new
+// caption slides in from the right edge in software and the diff pushes only the pixels it changes.
+namespace Caption {
+
+// ---------- Tunables ----------
+static constexpr int TOP                = 2;      // first row of the strip
+static constexpr int ROWS               = 16;     // strip height (Font2)
+static constexpr int MAX_W              = 320;    // screen width
+static constexpr int SLIDE_PX_PER_FRAME = 24;     // ~0.3 s across at 40 FPS
+
+struct Strip {
+  uint8_t bits[ROWS][MAX_W / 8];   // MSB = leftmost pixel
+  int16_t w = 0;                   // text width; 0 = no caption
+  int16_t x = 0, targetX = 0;      // left edge now / at rest
+  bool    leaving = false;         // sliding out; cleared when off screen
+};
+
+// Takes a rasterised line (`stride` bytes per row, ROWS rows) and slides it in from the right.
+static void show(Strip& s, const uint8_t* bits, int stride, int w){
+  for (int y = 0; y < ROWS; ++y) memcpy(s.bits[y], bits + y * stride, min(stride, MAX_W / 8));
+  s.w = (int16_t)constrain(w, 0, MAX_W);
+  s.x = MAX_W;
+  s.targetX = (int16_t)((MAX_W - s.w) / 2);
+  s.leaving = false;
+}
+
+// Slides the current caption out to the left.
+static void hide(Strip& s){
+  if (!s.w) return;
+  s.targetX = (int16_t)-s.w;
+  s.leaving = true;
+}
+
+// Once per frame.
+static void tick(Strip& s){
+  if (!s.w || s.x == s.targetX) return;
+  s.x = (int16_t)(s.x > s.targetX ? max((int)s.targetX, s.x - SLIDE_PX_PER_FRAME)
+                                  : min((int)s.targetX, s.x + SLIDE_PX_PER_FRAME));
+  if (s.leaving && s.x == s.targetX) { s.w = 0; s.leaving = false; }
+}
+
+// Spans of row y, left to right.
+FACE_IRAM(caption) static void emitRow(DList::List& dl, const Strip& s, int y){
+  if (!s.w || y < TOP || y >= TOP + ROWS) return;
+  const uint8_t* row = s.bits[y - TOP];
+  const uint16_t ink = Theme::palette().lip;
+  int run = -1;
+  for (int i = 0; i <= s.w; ++i) {
+    const bool on = i < s.w && (row[i >> 3] & (0x80 >> (i & 7)));
+    if (on && run < 0) run = i;
+    if (!on && run >= 0) {
+      const int x0 = max(0, s.x + run), x1 = min(MAX_W - 1, s.x + i - 1);
+      if (x0 <= x1) dl.fill(x0, x1 - x0 + 1, ink);
+      run = -1;
+    }
+  }
+}
+
+} // namespace Caption
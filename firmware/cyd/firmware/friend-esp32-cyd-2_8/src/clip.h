@@ -0,0 +1,137 @@
+#pragma once
+#include <Arduino.h>
+#include "iram.h"
+
+// ===== Clips: pre-rendered reactions as keyframe spans + per-frame changed runs, read from flash =====
+// Authored as PNG sequences and converted by tools/clip_encode.py into a const array (flash rodata,
+// read in place through the cache; nothing is copied to RAM). A key frame holds the non-background
+// runs of a frame; every other frame only the runs whose colour changed since the previous frame.
+// Decoding walks varints and hands each run straight to the face renderer's sink as a 1-row fill, so
+// playback costs what the frame changes.
+//
+// Layout, little-endian:
+//   0   "CLP1"
+//   4   u16 w, u16 h           clip area
+//   8   u16 frames
+//   10  u8 fps, u8 colours     colours <= 255, colour 0 is the background
+//   12  u16 keyEvery           0: only frame 0 is a key frame
+//   14  u16 reserved
+//   16  u16 palette[colours]   RGB565
+//   ..  u32 offset[frames + 1] frame data, from the start of the clip
+// Frame: u8 kind (KEY / DELTA), then rows: varint dy (rows after the previous listed row, first row
+// counts from -1; 0 ends the frame), varint n (runs; 0 = the previous listed row's runs again), then
+// n runs of varint gap (pixels after the previous run), varint len - 1, u8 colour.
+namespace Clip {
+
+// ---------- Tunables ----------
+static constexpr uint8_t  KEY = 0, DELTA = 1;
+static constexpr int      HEADER_BYTES = 16;
+static constexpr uint32_t MAX_CATCHUP  = 4;     // frames decoded per tick when playback falls behind
+
+struct Info {
+  uint16_t w = 0, h = 0, frames = 0, keyEvery = 0;
+  uint8_t  fps = 0, colours = 0;
+  const uint8_t* base    = nullptr;
+  const uint8_t* palette = nullptr;
+  const uint8_t* offsets = nullptr;
+};
+
+static inline uint16_t rd16(const uint8_t* p){ return (uint16_t)(p[0] | (p[1] << 8)); }
+static inline uint32_t rd32(const uint8_t* p){ return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); }
+
+static inline uint32_t readVar(const uint8_t*& p){
+  uint32_t v = 0; int shift = 0;
+  uint8_t b;
+  do { b = *p++; v |= (uint32_t)(b & 0x7f) << shift; shift += 7; } while (b & 0x80);
+  return v;
+}
+
+// Validates the header and the offset table against `size`.
+static bool open(Info& c, const uint8_t* data, size_t size){
+  if (size < HEADER_BYTES || memcmp(data, "CLP1", 4)) return false;
+  c.base = data;
+  c.w = rd16(data + 4); c.h = rd16(data + 6); c.frames = rd16(data + 8);
+  c.fps = data[10]; c.colours = data[11]; c.keyEvery = rd16(data + 12);
+  c.palette = data + HEADER_BYTES;
+  c.offsets = c.palette + 2 * c.colours;
+  const size_t tableEnd = (size_t)(c.offsets - data) + 4 * ((size_t)c.frames + 1);
+  if (!c.frames || !c.fps || !c.colours || tableEnd > size) return false;
+  return rd32(c.offsets + 4 * c.frames) <= size;
+}
+
+static inline uint16_t colour(const Info& c, uint8_t i){ return rd16(c.palette + 2 * (i < c.colours ? i : 0)); }
+static inline bool isKey(const Info& c, int f){ return f == 0 || (c.keyEvery && f % c.keyEvery == 0); }
+
+// Draws frame f at (ox, oy): fill(x, y, w, h, c). The panel must hold frame f - 1 unless f is a key
+// frame. Returns the runs drawn.
+template <class Sink>
+static uint32_t drawFrame(const Info& c, int f, int ox, int oy, Sink& out){
+  const uint8_t* p = c.base + rd32(c.offsets + 4 * f);
+  const uint8_t kind = *p++;
+  if (kind == KEY) out.fill(ox, oy, c.w, c.h, colour(c, 0));
+  uint32_t runs = 0;
+  int y = -1;
+  const uint8_t* prevRow = nullptr; uint32_t prevN = 0;
+  for (;;) {
+    const uint32_t dy = readVar(p);
+    if (!dy) break;
+    y += dy;
+    uint32_t n = readVar(p);
+    const bool repeat = n == 0;
+    if (repeat) n = prevN;
+    else { prevRow = p; prevN = n; }
+    const uint8_t* q = prevRow;
+    int x = 0;
+    for (uint32_t i = 0; i < n; ++i) {
+      x += readVar(q);
+      const int len = (int)readVar(q) + 1;
+      out.fill(ox + x, oy + y, len, 1, colour(c, *q++));
+      x += len;
+    }
+    if (!repeat) p = q;
+    runs += n;
+  }
+  return runs;
+}
+
+struct Player {
+  Info     clip;
+  int16_t  ox = 0, oy = 0;
+  uint16_t next = 0;          // next frame to draw
+  uint32_t startMs = 0;
+  bool     active = false, loop = false;
+  uint32_t runsLast = 0;      // runs drawn by the last tick
+};
+
+// Starts a clip with its area's top-left at (ox, oy); false if the data is not a clip.
+static bool start(Player& pl, const uint8_t* data, size_t size, int ox, int oy, uint32_t nowMs, bool loop = false){
+  pl.active = open(pl.clip, data, size);
+  pl.ox = (int16_t)ox; pl.oy = (int16_t)oy;
+  pl.next = 0; pl.startMs = nowMs; pl.loop = loop; pl.runsLast = 0;
+  return pl.active;
+}
+
+// Once per display frame: draws the clip frames due by nowMs (at most MAX_CATCHUP; further behind, it
+// skips to the latest due key frame). Returns false once a non-looping clip has ended.
+template <class Sink>
+static bool tick(Player& pl, uint32_t nowMs, Sink& out){
+  if (!pl.active) return false;
+  const Info& c = pl.clip;
+  uint32_t due = (uint32_t)((uint64_t)(nowMs - pl.startMs) * c.fps / 1000) + 1;   // frames shown by now
+  if (due > c.frames) {
+    if (pl.loop && pl.next >= c.frames) { pl.next = 0; pl.startMs = nowMs; due = 1; }   // frame 0 is a key
+    else due = c.frames;
+  }
+  if (due - pl.next > MAX_CATCHUP) {
+    uint32_t k = due - 1;
+    while (k > pl.next && !isKey(c, k)) --k;
+    pl.next = (uint16_t)k;
+  }
+  pl.runsLast = 0;
+  for (uint32_t n = 0; pl.next < due && n < MAX_CATCHUP; ++n)
+    pl.runsLast += drawFrame(c, pl.next++, pl.ox, pl.oy, out);
+  if (pl.next >= c.frames && !pl.loop) pl.active = false;
+  return pl.active;
+}
+
+} // namespace Clip
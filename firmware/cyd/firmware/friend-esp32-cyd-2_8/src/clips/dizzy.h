@@ -0,0 +1,1053 @@
+#pragma once
+#include <Arduino.h>
+
+// Generated by tools/clip_encode.py from dizzy_*.png; do not edit.
+// 96x96, 24 frames @ 20 fps, 4 colours, key every 24: 20912 bytes
+static const uint8_t CLIP_DIZZY[] = {
+  0x43,0x4c,0x50,0x31,0x60,0x00,0x60,0x00,0x18,0x00,0x14,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,
+  0xff,0x7d,0xef,0x29,0x7c,0x00,0x00,0x00,0x32,0x05,0x00,0x00,0xaa,0x08,0x00,0x00,0x26,0x0c,0x00,0x00,
+  0xaa,0x0f,0x00,0x00,0x48,0x13,0x00,0x00,0xf6,0x16,0x00,0x00,0xa8,0x1a,0x00,0x00,0x54,0x1e,0x00,0x00,
+  0x00,0x22,0x00,0x00,0x78,0x25,0x00,0x00,0x16,0x29,0x00,0x00,0x84,0x2c,0x00,0x00,0xea,0x2f,0x00,0x00,
+  0x14,0x33,0x00,0x00,0x18,0x36,0x00,0x00,0x0e,0x39,0x00,0x00,0x14,0x3c,0x00,0x00,0x06,0x3f,0x00,0x00,
+  0xfa,0x41,0x00,0x00,0x16,0x45,0x00,0x00,0x24,0x48,0x00,0x00,0x3c,0x4b,0x00,0x00,0x64,0x4e,0x00,0x00,
+  0xb0,0x51,0x00,0x00,0x00,0x03,0x01,0x29,0x0d,0x03,0x01,0x01,0x24,0x17,0x03,0x01,0x03,0x21,0x07,0x03,
+  0x00,0x0d,0x01,0x00,0x07,0x03,0x01,0x03,0x1e,0x06,0x03,0x01,0x14,0x01,0x00,0x06,0x03,0x01,0x03,0x1c,
+  0x04,0x03,0x03,0x1a,0x01,0x00,0x04,0x03,0x01,0x03,0x1a,0x04,0x03,0x03,0x1e,0x01,0x00,0x04,0x03,0x01,
+  0x03,0x18,0x04,0x03,0x04,0x21,0x01,0x00,0x04,0x03,0x01,0x03,0x17,0x03,0x03,0x04,0x25,0x01,0x00,0x03,
+  0x03,0x01,0x03,0x15,0x03,0x03,0x05,0x28,0x01,0x00,0x03,0x03,0x01,0x04,0x14,0x02,0x03,0x06,0x1a,0x01,
+  0x03,0x0d,0x01,0x00,0x02,0x03,0x01,0x04,0x13,0x02,0x03,0x06,0x14,0x01,0x11,0x07,0x01,0x00,0x02,0x03,
+  0x01,0x04,0x12,0x02,0x03,0x06,0x12,0x01,0x18,0x04,0x01,0x00,0x02,0x03,0x01,0x04,0x10,0x02,0x03,0x07,
+  0x10,0x01,0x1d,0x04,0x01,0x00,0x02,0x03,0x01,0x04,0x0f,0x02,0x03,0x07,0x0f,0x01,0x22,0x02,0x01,0x00,
+  0x02,0x03,0x01,0x04,0x0e,0x02,0x03,0x07,0x0e,0x01,0x25,0x02,0x01,0x00,0x02,0x03,0x01,0x04,0x0e,0x01,
+  0x03,0x07,0x0e,0x01,0x28,0x01,0x01,0x00,0x01,0x03,0x01,0x04,0x0d,0x01,0x03,0x07,0x0e,0x01,0x2b,0x00,
+  0x01,0x00,0x01,0x03,0x01,0x04,0x0c,0x01,0x03,0x08,0x0c,0x01,0x2e,0x00,0x01,0x00,0x01,0x03,0x01,0x03,
+  0x0b,0x02,0x03,0x07,0x0c,0x01,0x30,0x02,0x03,0x01,0x03,0x0a,0x02,0x03,0x08,0x0b,0x01,0x32,0x02,0x03,
+  0x01,0x03,0x0a,0x01,0x03,0x08,0x0b,0x01,0x34,0x01,0x03,0x01,0x03,0x09,0x01,0x03,0x08,0x0c,0x01,0x35,
+  0x01,0x03,0x01,0x03,0x08,0x02,0x03,0x08,0x0b,0x01,0x36,0x02,0x03,0x01,0x03,0x08,0x01,0x03,0x09,0x0a,
+  0x01,0x38,0x01,0x03,0x01,0x03,0x07,0x02,0x03,0x08,0x0b,0x01,0x38,0x02,0x03,0x01,0x03,0x07,0x01,0x03,
+  0x09,0x0a,0x01,0x3a,0x01,0x03,0x01,0x03,0x06,0x02,0x03,0x08,0x0a,0x01,0x3b,0x02,0x03,0x01,0x03,0x06,
+  0x01,0x03,0x09,0x0a,0x01,0x3c,0x01,0x03,0x01,0x04,0x05,0x02,0x03,0x09,0x0a,0x01,0x1a,0x05,0x02,0x1c,
+  0x02,0x03,0x01,0x04,0x05,0x01,0x03,0x0a,0x09,0x01,0x17,0x0d,0x02,0x19,0x01,0x03,0x01,0x04,0x05,0x01,
+  0x03,0x09,0x0a,0x01,0x15,0x11,0x02,0x17,0x01,0x03,0x01,0x04,0x04,0x01,0x03,0x0a,0x0a,0x01,0x14,0x14,
+  0x02,0x16,0x01,0x03,0x01,0x04,0x04,0x01,0x03,0x0a,0x09,0x01,0x14,0x16,0x02,0x15,0x01,0x03,0x01,0x04,
+  0x04,0x01,0x03,0x0a,0x09,0x01,0x13,0x18,0x02,0x14,0x01,0x03,0x01,0x04,0x03,0x02,0x03,0x0a,0x09,0x01,
+  0x12,0x1b,0x02,0x12,0x02,0x03,0x01,0x04,0x03,0x01,0x03,0x0b,0x09,0x01,0x12,0x1c,0x02,0x12,0x01,0x03,
+  0x01,0x04,0x03,0x01,0x03,0x0b,0x09,0x01,0x11,0x1d,0x02,0x12,0x01,0x03,0x01,0x05,0x03,0x01,0x03,0x0b,
+  0x09,0x01,0x11,0x09,0x02,0x05,0x0f,0x02,0x11,0x01,0x03,0x01,0x05,0x03,0x01,0x03,0x0b,0x09,0x01,0x11,
+  0x07,0x02,0x0a,0x0d,0x02,0x10,0x01,0x03,0x01,0x05,0x02,0x01,0x03,0x0c,0x09,0x01,0x11,0x05,0x02,0x0d,
+  0x0d,0x02,0x10,0x01,0x03,0x01,0x05,0x02,0x01,0x03,0x0c,0x09,0x01,0x11,0x05,0x02,0x0f,0x0b,0x02,0x10,
+  0x01,0x03,0x01,0x05,0x02,0x01,0x03,0x0c,0x0a,0x01,0x10,0x04,0x02,0x11,0x0b,0x02,0x0f,0x01,0x03,0x01,
+  0x05,0x02,0x01,0x03,0x0c,0x0a,0x01,0x10,0x04,0x02,0x12,0x0a,0x02,0x0f,0x01,0x03,0x01,0x05,0x02,0x01,
+  0x03,0x0d,0x09,0x01,0x11,0x02,0x02,0x13,0x0b,0x02,0x0e,0x01,0x03,0x01,0x05,0x02,0x01,0x03,0x0d,0x09,
+  0x01,0x11,0x03,0x02,0x13,0x0a,0x02,0x0e,0x01,0x03,0x01,0x05,0x02,0x01,0x03,0x0d,0x0a,0x01,0x12,0x01,
+  0x02,0x14,0x0a,0x02,0x0d,0x01,0x03,0x01,0x05,0x02,0x01,0x03,0x0d,0x0a,0x01,0x14,0x01,0x01,0x12,0x0a,
+  0x02,0x0d,0x01,0x03,0x01,0x05,0x02,0x01,0x03,0x0e,0x0a,0x01,0x13,0x03,0x01,0x11,0x09,0x02,0x0d,0x01,
+  0x03,0x01,0x05,0x02,0x01,0x03,0x0e,0x0b,0x01,0x13,0x02,0x01,0x11,0x09,0x02,0x0d,0x01,0x03,0x01,0x05,
+  0x02,0x01,0x03,0x0f,0x0a,0x01,0x12,0x04,0x01,0x10,0x0a,0x02,0x0c,0x01,0x03,0x01,0x05,0x02,0x01,0x03,
+  0x0f,0x0b,0x01,0x11,0x04,0x01,0x10,0x0a,0x02,0x0c,0x01,0x03,0x01,0x05,0x02,0x01,0x03,0x10,0x0b,0x01,
+  0x0f,0x05,0x01,0x11,0x09,0x02,0x0c,0x01,0x03,0x01,0x05,0x02,0x01,0x03,0x10,0x0d,0x01,0x0d,0x05,0x01,
+  0x11,0x09,0x02,0x0c,0x01,0x03,0x01,0x05,0x03,0x01,0x03,0x10,0x0d,0x01,0x0a,0x07,0x01,0x11,0x09,0x02,
+  0x0b,0x01,0x03,0x01,0x05,0x03,0x01,0x03,0x11,0x0f,0x01,0x05,0x09,0x01,0x11,0x09,0x02,0x0b,0x01,0x03,
+  0x01,0x04,0x03,0x01,0x03,0x12,0x1d,0x01,0x11,0x09,0x02,0x0b,0x01,0x03,0x01,0x04,0x03,0x01,0x03,0x12,
+  0x1c,0x01,0x12,0x09,0x02,0x0b,0x01,0x03,0x01,0x04,0x03,0x02,0x03,0x12,0x1b,0x01,0x12,0x09,0x02,0x0a,
+  0x02,0x03,0x01,0x04,0x04,0x01,0x03,0x14,0x18,0x01,0x13,0x09,0x02,0x0a,0x01,0x03,0x01,0x04,0x04,0x01,
+  0x03,0x15,0x16,0x01,0x14,0x09,0x02,0x0a,0x01,0x03,0x01,0x04,0x04,0x01,0x03,0x16,0x14,0x01,0x14,0x0a,
+  0x02,0x0a,0x01,0x03,0x01,0x04,0x05,0x01,0x03,0x17,0x11,0x01,0x15,0x0a,0x02,0x09,0x01,0x03,0x01,0x04,
+  0x05,0x01,0x03,0x19,0x0d,0x01,0x17,0x09,0x02,0x0a,0x01,0x03,0x01,0x04,0x05,0x02,0x03,0x1c,0x05,0x01,
+  0x1a,0x0a,0x02,0x09,0x02,0x03,0x01,0x03,0x06,0x01,0x03,0x3c,0x0a,0x02,0x09,0x01,0x03,0x01,0x03,0x06,
+  0x02,0x03,0x3b,0x0a,0x02,0x08,0x02,0x03,0x01,0x03,0x07,0x01,0x03,0x3a,0x0a,0x02,0x09,0x01,0x03,0x01,
+  0x03,0x07,0x02,0x03,0x38,0x0b,0x02,0x08,0x02,0x03,0x01,0x03,0x08,0x01,0x03,0x38,0x0a,0x02,0x09,0x01,
+  0x03,0x01,0x03,0x08,0x02,0x03,0x36,0x0b,0x02,0x08,0x02,0x03,0x01,0x03,0x09,0x01,0x03,0x35,0x0c,0x02,
+  0x08,0x01,0x03,0x01,0x03,0x0a,0x01,0x03,0x34,0x0b,0x02,0x08,0x01,0x03,0x01,0x03,0x0a,0x02,0x03,0x32,
+  0x0b,0x02,0x08,0x02,0x03,0x01,0x03,0x0b,0x02,0x03,0x30,0x0c,0x02,0x07,0x02,0x03,0x01,0x04,0x0c,0x01,
+  0x03,0x00,0x00,0x02,0x2e,0x0c,0x02,0x08,0x01,0x03,0x01,0x04,0x0d,0x01,0x03,0x00,0x00,0x02,0x2b,0x0e,
+  0x02,0x07,0x01,0x03,0x01,0x04,0x0e,0x01,0x03,0x00,0x01,0x02,0x28,0x0e,0x02,0x07,0x01,0x03,0x01,0x04,
+  0x0e,0x02,0x03,0x00,0x02,0x02,0x25,0x0e,0x02,0x07,0x02,0x03,0x01,0x04,0x0f,0x02,0x03,0x00,0x02,0x02,
+  0x22,0x0f,0x02,0x07,0x02,0x03,0x01,0x04,0x10,0x02,0x03,0x00,0x04,0x02,0x1d,0x10,0x02,0x07,0x02,0x03,
+  0x01,0x04,0x12,0x02,0x03,0x00,0x04,0x02,0x18,0x12,0x02,0x06,0x02,0x03,0x01,0x04,0x13,0x02,0x03,0x00,
+  0x07,0x02,0x11,0x14,0x02,0x06,0x02,0x03,0x01,0x04,0x14,0x02,0x03,0x00,0x0d,0x02,0x03,0x1a,0x02,0x06,
+  0x02,0x03,0x01,0x03,0x15,0x03,0x03,0x00,0x28,0x02,0x05,0x03,0x03,0x01,0x03,0x17,0x03,0x03,0x00,0x25,
+  0x02,0x04,0x03,0x03,0x01,0x03,0x18,0x04,0x03,0x00,0x21,0x02,0x04,0x04,0x03,0x01,0x03,0x1a,0x04,0x03,
+  0x00,0x1e,0x02,0x03,0x04,0x03,0x01,0x03,0x1c,0x04,0x03,0x00,0x1a,0x02,0x03,0x04,0x03,0x01,0x03,0x1e,
+  0x06,0x03,0x00,0x14,0x02,0x01,0x06,0x03,0x01,0x03,0x21,0x07,0x03,0x00,0x0d,0x02,0x00,0x07,0x03,0x01,
+  0x01,0x24,0x17,0x03,0x01,0x01,0x29,0x0d,0x03,0x00,0x01,0x06,0x01,0x25,0x00,0x01,0x01,0x01,0x21,0x02,
+  0x01,0x01,0x01,0x20,0x01,0x01,0x01,0x01,0x1e,0x02,0x01,0x01,0x01,0x1d,0x01,0x01,0x01,0x02,0x1c,0x01,
+  0x01,0x17,0x08,0x00,0x01,0x02,0x1b,0x01,0x01,0x13,0x12,0x00,0x01,0x02,0x1a,0x01,0x01,0x11,0x19,0x00,
+  0x01,0x02,0x19,0x01,0x01,0x0f,0x1e,0x00,0x01,0x02,0x18,0x01,0x01,0x0e,0x22,0x00,0x01,0x02,0x17,0x01,
+  0x01,0x0e,0x25,0x00,0x01,0x02,0x16,0x01,0x01,0x0d,0x29,0x00,0x01,0x02,0x16,0x00,0x01,0x0d,0x2b,0x00,
+  0x01,0x02,0x15,0x00,0x01,0x0d,0x2d,0x00,0x01,0x02,0x14,0x01,0x01,0x0c,0x2f,0x00,0x01,0x02,0x14,0x00,
+  0x01,0x0c,0x00,0x00,0x01,0x02,0x13,0x01,0x01,0x0b,0x00,0x00,0x01,0x02,0x13,0x00,0x01,0x0b,0x00,0x00,
+  0x01,0x02,0x12,0x00,0x01,0x0b,0x01,0x00,0x01,0x02,0x12,0x00,0x01,0x0a,0x01,0x00,0x01,0x02,0x11,0x01,
+  0x01,0x0a,0x00,0x00,0x01,0x02,0x11,0x00,0x01,0x0a,0x01,0x00,0x01,0x02,0x11,0x00,0x01,0x0a,0x00,0x00,
+  0x01,0x02,0x10,0x00,0x01,0x0a,0x00,0x00,0x01,0x03,0x10,0x00,0x01,0x0a,0x00,0x00,0x19,0x07,0x02,0x01,
+  0x03,0x10,0x00,0x01,0x09,0x01,0x00,0x16,0x0d,0x02,0x01,0x03,0x0f,0x01,0x01,0x09,0x00,0x00,0x15,0x12,
+  0x02,0x01,0x03,0x0f,0x00,0x01,0x0a,0x00,0x00,0x13,0x15,0x02,0x01,0x03,0x0f,0x00,0x01,0x09,0x01,0x00,
+  0x12,0x18,0x02,0x01,0x03,0x0f,0x00,0x01,0x09,0x00,0x00,0x12,0x1a,0x02,0x01,0x03,0x0f,0x00,0x01,0x09,
+  0x00,0x00,0x12,0x1b,0x02,0x01,0x03,0x0f,0x00,0x01,0x09,0x00,0x00,0x11,0x1d,0x02,0x01,0x03,0x0f,0x00,
+  0x01,0x09,0x00,0x00,0x10,0x1f,0x02,0x01,0x05,0x0f,0x00,0x01,0x09,0x00,0x00,0x10,0x00,0x02,0x0a,0x04,
+  0x00,0x0f,0x01,0x02,0x01,0x05,0x0f,0x00,0x01,0x09,0x00,0x00,0x10,0x00,0x02,0x08,0x09,0x00,0x0d,0x01,
+  0x02,0x01,0x05,0x0f,0x00,0x01,0x09,0x00,0x00,0x10,0x00,0x02,0x06,0x0d,0x00,0x0c,0x00,0x02,0x01,0x05,
+  0x0f,0x00,0x01,0x09,0x00,0x00,0x10,0x00,0x02,0x05,0x0f,0x00,0x0c,0x00,0x02,0x01,0x05,0x0f,0x00,0x01,
+  0x09,0x00,0x00,0x10,0x00,0x02,0x05,0x10,0x00,0x0b,0x01,0x02,0x01,0x05,0x0f,0x00,0x01,0x09,0x01,0x00,
+  0x0f,0x00,0x02,0x04,0x12,0x00,0x0b,0x00,0x02,0x01,0x05,0x0f,0x00,0x01,0x0a,0x00,0x00,0x0f,0x00,0x02,
+  0x04,0x13,0x00,0x0a,0x01,0x02,0x01,0x05,0x0f,0x01,0x01,0x09,0x00,0x00,0x10,0x00,0x02,0x16,0x01,0x00,
+  0x0a,0x00,0x02,0x01,0x04,0x10,0x00,0x01,0x09,0x00,0x00,0x14,0x14,0x00,0x0a,0x00,0x02,0x01,0x05,0x10,
+  0x00,0x01,0x0a,0x00,0x00,0x11,0x00,0x02,0x16,0x00,0x00,0x0a,0x00,0x02,0x01,0x05,0x10,0x00,0x01,0x0a,
+  0x00,0x00,0x16,0x00,0x01,0x11,0x00,0x00,0x0a,0x00,0x02,0x01,0x04,0x11,0x00,0x01,0x0a,0x14,0x00,0x14,
+  0x00,0x00,0x09,0x00,0x02,0x01,0x05,0x11,0x00,0x01,0x0a,0x01,0x00,0x16,0x00,0x01,0x10,0x00,0x00,0x09,
+  0x01,0x02,0x01,0x05,0x11,0x01,0x01,0x0a,0x13,0x00,0x04,0x00,0x01,0x0f,0x00,0x00,0x0a,0x00,0x02,0x01,
+  0x05,0x12,0x00,0x01,0x0b,0x12,0x00,0x04,0x00,0x01,0x0f,0x01,0x00,0x09,0x00,0x02,0x01,0x05,0x12,0x01,
+  0x01,0x0b,0x10,0x00,0x05,0x00,0x01,0x10,0x00,0x00,0x09,0x00,0x02,0x01,0x05,0x13,0x00,0x01,0x0c,0x0f,
+  0x00,0x05,0x00,0x01,0x10,0x00,0x00,0x09,0x00,0x02,0x01,0x05,0x14,0x00,0x01,0x0c,0x0d,0x00,0x06,0x00,
+  0x01,0x10,0x00,0x00,0x09,0x00,0x02,0x01,0x05,0x14,0x01,0x01,0x0d,0x09,0x00,0x08,0x00,0x01,0x10,0x00,
+  0x00,0x09,0x00,0x02,0x01,0x05,0x15,0x01,0x01,0x0f,0x04,0x00,0x0a,0x00,0x01,0x10,0x00,0x00,0x09,0x00,
+  0x02,0x01,0x03,0x16,0x1f,0x01,0x10,0x00,0x00,0x09,0x00,0x02,0x01,0x03,0x17,0x1d,0x01,0x11,0x00,0x00,
+  0x09,0x00,0x02,0x01,0x03,0x18,0x1b,0x01,0x12,0x00,0x00,0x09,0x00,0x02,0x01,0x03,0x19,0x1a,0x01,0x12,
+  0x00,0x00,0x09,0x00,0x02,0x01,0x03,0x1a,0x18,0x01,0x12,0x01,0x00,0x09,0x00,0x02,0x01,0x03,0x1c,0x15,
+  0x01,0x13,0x00,0x00,0x0a,0x00,0x02,0x01,0x03,0x1d,0x12,0x01,0x15,0x00,0x00,0x09,0x01,0x02,0x01,0x03,
+  0x20,0x0d,0x01,0x16,0x01,0x00,0x09,0x00,0x02,0x01,0x03,0x23,0x07,0x01,0x19,0x00,0x00,0x0a,0x00,0x02,
+  0x01,0x02,0x44,0x00,0x00,0x0a,0x00,0x02,0x01,0x02,0x43,0x00,0x00,0x0a,0x00,0x02,0x01,0x02,0x42,0x01,
+  0x00,0x0a,0x00,0x02,0x01,0x02,0x42,0x00,0x00,0x0a,0x01,0x02,0x01,0x02,0x41,0x01,0x00,0x0a,0x00,0x02,
+  0x01,0x02,0x40,0x01,0x00,0x0b,0x00,0x02,0x01,0x02,0x40,0x00,0x00,0x0b,0x00,0x02,0x01,0x02,0x3f,0x00,
+  0x00,0x0b,0x01,0x02,0x01,0x02,0x3e,0x00,0x00,0x0c,0x00,0x02,0x01,0x02,0x0e,0x2f,0x00,0x0c,0x01,0x02,
+  0x01,0x02,0x0f,0x2d,0x00,0x0d,0x00,0x02,0x01,0x02,0x10,0x2b,0x00,0x0d,0x00,0x02,0x01,0x02,0x11,0x29,
+  0x00,0x0d,0x01,0x02,0x01,0x02,0x13,0x25,0x00,0x0e,0x01,0x02,0x01,0x02,0x15,0x22,0x00,0x0e,0x01,0x02,
+  0x01,0x02,0x17,0x1e,0x00,0x0f,0x01,0x02,0x01,0x02,0x19,0x19,0x00,0x11,0x01,0x02,0x01,0x02,0x1d,0x12,
+  0x00,0x13,0x01,0x02,0x01,0x02,0x22,0x08,0x00,0x17,0x01,0x02,0x01,0x01,0x41,0x01,0x02,0x01,0x01,0x3f,
+  0x02,0x02,0x01,0x01,0x3e,0x01,0x02,0x01,0x01,0x3c,0x02,0x02,0x01,0x01,0x3a,0x00,0x02,0x00,0x01,0x08,
+  0x01,0x1f,0x00,0x01,0x01,0x01,0x1d,0x00,0x01,0x01,0x02,0x1b,0x01,0x01,0x16,0x0c,0x00,0x01,0x02,0x1a,
+  0x01,0x01,0x13,0x14,0x00,0x01,0x02,0x19,0x01,0x01,0x11,0x1a,0x00,0x01,0x02,0x18,0x01,0x01,0x10,0x1f,
+  0x00,0x01,0x02,0x17,0x01,0x01,0x0f,0x22,0x00,0x01,0x02,0x16,0x01,0x01,0x0e,0x26,0x00,0x01,0x02,0x16,
+  0x00,0x01,0x0d,0x29,0x00,0x01,0x02,0x15,0x00,0x01,0x0d,0x01,0x00,0x01,0x02,0x14,0x01,0x01,0x0c,0x01,
+  0x00,0x01,0x02,0x13,0x01,0x01,0x0c,0x01,0x00,0x01,0x02,0x13,0x00,0x01,0x0c,0x01,0x00,0x01,0x02,0x12,
+  0x01,0x01,0x0b,0x01,0x00,0x01,0x02,0x12,0x00,0x01,0x0b,0x01,0x00,0x01,0x02,0x11,0x01,0x01,0x0a,0x01,
+  0x00,0x01,0x02,0x11,0x00,0x01,0x0b,0x00,0x00,0x01,0x02,0x10,0x01,0x01,0x0a,0x00,0x00,0x01,0x02,0x10,
+  0x00,0x01,0x0a,0x01,0x00,0x01,0x02,0x10,0x00,0x01,0x0a,0x00,0x00,0x01,0x02,0x0f,0x01,0x01,0x09,0x01,
+  0x00,0x01,0x03,0x0f,0x00,0x01,0x0a,0x00,0x00,0x19,0x09,0x02,0x01,0x03,0x0f,0x00,0x01,0x09,0x01,0x00,
+  0x16,0x0f,0x02,0x01,0x03,0x0e,0x01,0x01,0x09,0x00,0x00,0x15,0x13,0x02,0x01,0x03,0x0e,0x00,0x01,0x0a,
+  0x00,0x00,0x14,0x16,0x02,0x01,0x03,0x0e,0x00,0x01,0x09,0x01,0x00,0x13,0x19,0x02,0x01,0x03,0x0e,0x00,
+  0x01,0x09,0x00,0x00,0x13,0x1b,0x02,0x01,0x03,0x0e,0x00,0x01,0x09,0x00,0x00,0x12,0x1d,0x02,0x01,0x03,
+  0x0e,0x00,0x01,0x09,0x00,0x00,0x11,0x1f,0x02,0x01,0x03,0x0e,0x00,0x01,0x09,0x00,0x00,0x11,0x20,0x02,
+  0x01,0x05,0x0d,0x01,0x01,0x09,0x00,0x00,0x10,0x00,0x02,0x0b,0x04,0x00,0x10,0x01,0x02,0x01,0x05,0x0d,
+  0x01,0x01,0x09,0x00,0x00,0x10,0x00,0x02,0x09,0x09,0x00,0x0e,0x01,0x02,0x01,0x05,0x0d,0x01,0x01,0x09,
+  0x00,0x00,0x10,0x00,0x02,0x07,0x0d,0x00,0x0d,0x00,0x02,0x01,0x05,0x0d,0x01,0x01,0x09,0x00,0x00,0x10,
+  0x00,0x02,0x06,0x10,0x00,0x0b,0x01,0x02,0x01,0x05,0x0e,0x00,0x01,0x09,0x00,0x00,0x10,0x00,0x02,0x16,
+  0x01,0x00,0x0b,0x00,0x02,0x01,0x05,0x0e,0x00,0x01,0x09,0x00,0x00,0x10,0x00,0x02,0x05,0x13,0x00,0x0b,
+  0x00,0x02,0x01,0x05,0x0e,0x00,0x01,0x09,0x00,0x00,0x10,0x00,0x02,0x18,0x01,0x00,0x0a,0x01,0x02,0x01,
+  0x04,0x0e,0x00,0x01,0x09,0x01,0x00,0x29,0x01,0x00,0x0a,0x00,0x02,0x01,0x05,0x0e,0x00,0x01,0x0a,0x00,
+  0x00,0x10,0x00,0x02,0x19,0x00,0x00,0x0a,0x00,0x02,0x01,0x05,0x0e,0x01,0x01,0x09,0x00,0x00,0x11,0x00,
+  0x02,0x18,0x01,0x00,0x09,0x01,0x02,0x01,0x05,0x0f,0x00,0x01,0x09,0x01,0x00,0x11,0x00,0x02,0x18,0x00,
+  0x00,0x0a,0x00,0x02,0x01,0x05,0x0f,0x00,0x01,0x0a,0x00,0x00,0x18,0x00,0x01,0x11,0x01,0x00,0x09,0x00,
+  0x02,0x01,0x05,0x0f,0x01,0x01,0x09,0x01,0x00,0x18,0x00,0x01,0x11,0x00,0x00,0x09,0x01,0x02,0x01,0x05,
+  0x10,0x00,0x01,0x0a,0x00,0x00,0x19,0x00,0x01,0x10,0x00,0x00,0x0a,0x00,0x02,0x01,0x04,0x10,0x00,0x01,
+  0x0a,0x01,0x00,0x29,0x01,0x00,0x09,0x00,0x02,0x01,0x05,0x10,0x01,0x01,0x0a,0x01,0x00,0x18,0x00,0x01,
+  0x10,0x00,0x00,0x09,0x00,0x02,0x01,0x05,0x11,0x00,0x01,0x0b,0x13,0x00,0x05,0x00,0x01,0x10,0x00,0x00,
+  0x09,0x00,0x02,0x01,0x05,0x12,0x00,0x01,0x0b,0x01,0x00,0x16,0x00,0x01,0x10,0x00,0x00,0x09,0x00,0x02,
+  0x01,0x05,0x12,0x01,0x01,0x0b,0x10,0x00,0x06,0x00,0x01,0x10,0x00,0x00,0x09,0x01,0x02,0x01,0x05,0x13,
+  0x00,0x01,0x0d,0x0d,0x00,0x07,0x00,0x01,0x10,0x00,0x00,0x09,0x01,0x02,0x01,0x05,0x13,0x01,0x01,0x0e,
+  0x09,0x00,0x09,0x00,0x01,0x10,0x00,0x00,0x09,0x01,0x02,0x01,0x05,0x14,0x01,0x01,0x10,0x04,0x00,0x0b,
+  0x00,0x01,0x10,0x00,0x00,0x09,0x01,0x02,0x01,0x03,0x15,0x20,0x01,0x11,0x00,0x00,0x09,0x00,0x02,0x01,
+  0x03,0x16,0x1f,0x01,0x11,0x00,0x00,0x09,0x00,0x02,0x01,0x03,0x17,0x1d,0x01,0x12,0x00,0x00,0x09,0x00,
+  0x02,0x01,0x03,0x18,0x1b,0x01,0x13,0x00,0x00,0x09,0x00,0x02,0x01,0x03,0x19,0x19,0x01,0x13,0x01,0x00,
+  0x09,0x00,0x02,0x01,0x03,0x1b,0x16,0x01,0x14,0x00,0x00,0x0a,0x00,0x02,0x01,0x03,0x1d,0x13,0x01,0x15,
+  0x00,0x00,0x09,0x01,0x02,0x01,0x03,0x1f,0x0f,0x01,0x16,0x01,0x00,0x09,0x00,0x02,0x01,0x03,0x22,0x09,
+  0x01,0x19,0x00,0x00,0x0a,0x00,0x02,0x01,0x02,0x44,0x01,0x00,0x09,0x01,0x02,0x01,0x02,0x44,0x00,0x00,
+  0x0a,0x00,0x02,0x01,0x02,0x43,0x01,0x00,0x0a,0x00,0x02,0x01,0x02,0x43,0x00,0x00,0x0a,0x01,0x02,0x01,
+  0x02,0x42,0x00,0x00,0x0b,0x00,0x02,0x01,0x02,0x41,0x01,0x00,0x0a,0x01,0x02,0x01,0x02,0x40,0x01,0x00,
+  0x0b,0x00,0x02,0x01,0x02,0x3f,0x01,0x00,0x0b,0x01,0x02,0x01,0x02,0x3e,0x01,0x00,0x0c,0x00,0x02,0x01,
+  0x02,0x3d,0x01,0x00,0x0c,0x01,0x02,0x01,0x02,0x3c,0x01,0x00,0x0c,0x01,0x02,0x01,0x02,0x3b,0x01,0x00,
+  0x0d,0x00,0x02,0x01,0x02,0x12,0x29,0x00,0x0d,0x00,0x02,0x01,0x02,0x13,0x26,0x00,0x0e,0x01,0x02,0x01,
+  0x02,0x15,0x22,0x00,0x0f,0x01,0x02,0x01,0x02,0x16,0x1f,0x00,0x10,0x01,0x02,0x01,0x02,0x19,0x1a,0x00,
+  0x11,0x01,0x02,0x01,0x02,0x1c,0x14,0x00,0x13,0x01,0x02,0x01,0x02,0x20,0x0c,0x00,0x16,0x01,0x02,0x01,
+  0x01,0x42,0x00,0x02,0x01,0x01,0x40,0x00,0x02,0x00,0x01,0x09,0x01,0x32,0x0e,0x00,0x01,0x01,0x2e,0x16,
+  0x00,0x01,0x02,0x19,0x00,0x01,0x11,0x1b,0x00,0x01,0x02,0x17,0x01,0x01,0x10,0x1f,0x00,0x01,0x02,0x16,
+  0x01,0x01,0x0f,0x02,0x00,0x01,0x02,0x16,0x00,0x01,0x0e,0x02,0x00,0x01,0x02,0x15,0x00,0x01,0x0e,0x01,
+  0x00,0x01,0x02,0x14,0x01,0x01,0x0c,0x01,0x00,0x01,0x02,0x13,0x01,0x01,0x0c,0x01,0x00,0x01,0x02,0x13,
+  0x00,0x01,0x0c,0x01,0x00,0x01,0x02,0x12,0x00,0x01,0x0c,0x01,0x00,0x01,0x02,0x11,0x01,0x01,0x0b,0x01,
+  0x00,0x01,0x02,0x11,0x00,0x01,0x0b,0x01,0x00,0x01,0x02,0x10,0x01,0x01,0x0a,0x01,0x00,0x01,0x02,0x10,
+  0x00,0x01,0x0b,0x00,0x00,0x01,0x02,0x0f,0x01,0x01,0x0a,0x01,0x00,0x01,0x02,0x0f,0x00,0x01,0x0a,0x01,
+  0x00,0x01,0x02,0x0f,0x00,0x01,0x0a,0x00,0x00,0x01,0x02,0x0e,0x01,0x01,0x09,0x01,0x00,0x01,0x03,0x0e,
+  0x00,0x01,0x0a,0x00,0x00,0x19,0x0b,0x02,0x01,0x03,0x0e,0x00,0x01,0x0a,0x00,0x00,0x17,0x10,0x02,0x01,
+  0x03,0x0d,0x01,0x01,0x09,0x00,0x00,0x16,0x14,0x02,0x01,0x03,0x0d,0x00,0x01,0x0a,0x00,0x00,0x14,0x18,
+  0x02,0x01,0x03,0x0d,0x00,0x01,0x09,0x01,0x00,0x13,0x1a,0x02,0x01,0x03,0x0d,0x00,0x01,0x09,0x00,0x00,
+  0x13,0x1d,0x02,0x01,0x03,0x0d,0x00,0x01,0x09,0x00,0x00,0x12,0x1f,0x02,0x01,0x03,0x0c,0x01,0x01,0x09,
+  0x00,0x00,0x12,0x20,0x02,0x01,0x03,0x0c,0x01,0x01,0x09,0x00,0x00,0x11,0x22,0x02,0x01,0x05,0x0c,0x01,
+  0x01,0x09,0x00,0x00,0x11,0x00,0x02,0x0b,0x05,0x00,0x10,0x01,0x02,0x01,0x05,0x0c,0x00,0x01,0x09,0x01,
+  0x00,0x10,0x00,0x02,0x0a,0x0a,0x00,0x0e,0x00,0x02,0x01,0x05,0x0c,0x00,0x01,0x09,0x01,0x00,0x10,0x00,
+  0x02,0x08,0x0e,0x00,0x0d,0x00,0x02,0x01,0x05,0x0c,0x00,0x01,0x09,0x01,0x00,0x10,0x00,0x02,0x07,0x10,
+  0x00,0x0c,0x01,0x02,0x01,0x05,0x0c,0x00,0x01,0x0a,0x00,0x00,0x10,0x00,0x02,0x06,0x13,0x00,0x0b,0x00,
+  0x02,0x01,0x05,0x0c,0x01,0x01,0x09,0x00,0x00,0x10,0x00,0x02,0x06,0x14,0x00,0x0a,0x01,0x02,0x01,0x05,
+  0x0c,0x01,0x01,0x09,0x00,0x00,0x10,0x00,0x02,0x05,0x15,0x00,0x0b,0x00,0x02,0x01,0x05,0x0d,0x00,0x01,
+  0x09,0x00,0x00,0x10,0x00,0x02,0x05,0x16,0x00,0x0b,0x00,0x02,0x01,0x05,0x0d,0x00,0x01,0x09,0x00,0x00,
+  0x11,0x00,0x02,0x04,0x17,0x00,0x0a,0x00,0x02,0x01,0x05,0x0d,0x00,0x01,0x09,0x01,0x00,0x10,0x00,0x02,
+  0x04,0x18,0x00,0x09,0x01,0x02,0x01,0x05,0x0d,0x00,0x01,0x0a,0x00,0x00,0x11,0x00,0x02,0x1b,0x00,0x00,
+  0x0a,0x00,0x02,0x01,0x05,0x0d,0x01,0x01,0x09,0x00,0x00,0x12,0x00,0x02,0x03,0x18,0x00,0x09,0x00,0x02,
+  0x01,0x05,0x0e,0x00,0x01,0x09,0x18,0x00,0x03,0x00,0x01,0x12,0x00,0x00,0x09,0x01,0x02,0x01,0x05,0x0e,
+  0x00,0x01,0x0a,0x00,0x00,0x1b,0x00,0x01,0x11,0x00,0x00,0x0a,0x00,0x02,0x01,0x05,0x0e,0x01,0x01,0x09,
+  0x18,0x00,0x04,0x00,0x01,0x10,0x01,0x00,0x09,0x00,0x02,0x01,0x05,0x0f,0x00,0x01,0x0a,0x17,0x00,0x04,
+  0x00,0x01,0x11,0x00,0x00,0x09,0x00,0x02,0x01,0x05,0x0f,0x00,0x01,0x0b,0x16,0x00,0x05,0x00,0x01,0x10,
+  0x00,0x00,0x09,0x00,0x02,0x01,0x05,0x10,0x00,0x01,0x0b,0x15,0x00,0x05,0x00,0x01,0x10,0x00,0x00,0x09,
+  0x01,0x02,0x01,0x05,0x10,0x01,0x01,0x0a,0x14,0x00,0x06,0x00,0x01,0x10,0x00,0x00,0x09,0x01,0x02,0x01,
+  0x05,0x11,0x00,0x01,0x0b,0x13,0x00,0x06,0x00,0x01,0x10,0x00,0x00,0x0a,0x00,0x02,0x01,0x05,0x11,0x01,
+  0x01,0x0c,0x10,0x00,0x07,0x00,0x01,0x10,0x01,0x00,0x09,0x00,0x02,0x01,0x05,0x12,0x00,0x01,0x0d,0x0e,
+  0x00,0x08,0x00,0x01,0x10,0x01,0x00,0x09,0x00,0x02,0x01,0x05,0x13,0x00,0x01,0x0e,0x0a,0x00,0x0a,0x00,
+  0x01,0x10,0x01,0x00,0x09,0x00,0x02,0x01,0x05,0x13,0x01,0x01,0x10,0x05,0x00,0x0b,0x00,0x01,0x11,0x00,
+  0x00,0x09,0x01,0x02,0x01,0x03,0x14,0x22,0x01,0x11,0x00,0x00,0x09,0x01,0x02,0x01,0x03,0x15,0x20,0x01,
+  0x12,0x00,0x00,0x09,0x01,0x02,0x01,0x03,0x16,0x1f,0x01,0x12,0x00,0x00,0x09,0x00,0x02,0x01,0x03,0x17,
+  0x1d,0x01,0x13,0x00,0x00,0x09,0x00,0x02,0x01,0x03,0x19,0x1a,0x01,0x13,0x01,0x00,0x09,0x00,0x02,0x01,
+  0x03,0x1a,0x18,0x01,0x14,0x00,0x00,0x0a,0x00,0x02,0x01,0x03,0x1c,0x14,0x01,0x16,0x00,0x00,0x09,0x01,
+  0x02,0x01,0x03,0x1e,0x10,0x01,0x17,0x00,0x00,0x0a,0x00,0x02,0x01,0x03,0x21,0x0b,0x01,0x19,0x00,0x00,
+  0x0a,0x00,0x02,0x01,0x02,0x45,0x01,0x00,0x09,0x01,0x02,0x01,0x02,0x45,0x00,0x00,0x0a,0x00,0x02,0x01,
+  0x02,0x44,0x01,0x00,0x0a,0x00,0x02,0x01,0x02,0x43,0x01,0x00,0x0a,0x01,0x02,0x01,0x02,0x43,0x00,0x00,
+  0x0b,0x00,0x02,0x01,0x02,0x42,0x01,0x00,0x0a,0x01,0x02,0x01,0x02,0x41,0x01,0x00,0x0b,0x00,0x02,0x01,
+  0x02,0x40,0x01,0x00,0x0b,0x01,0x02,0x01,0x02,0x3f,0x01,0x00,0x0c,0x00,0x02,0x01,0x02,0x3e,0x01,0x00,
+  0x0c,0x00,0x02,0x01,0x02,0x3d,0x01,0x00,0x0c,0x01,0x02,0x01,0x02,0x3c,0x01,0x00,0x0c,0x01,0x02,0x01,
+  0x02,0x3a,0x01,0x00,0x0e,0x00,0x02,0x01,0x02,0x38,0x02,0x00,0x0e,0x00,0x02,0x01,0x02,0x36,0x02,0x00,
+  0x0f,0x01,0x02,0x01,0x02,0x17,0x1f,0x00,0x10,0x01,0x02,0x01,0x02,0x19,0x1b,0x00,0x11,0x00,0x02,0x01,
+  0x01,0x1b,0x16,0x00,0x01,0x01,0x1f,0x0e,0x00,0x00,0x01,0x07,0x01,0x39,0x00,0x00,0x01,0x01,0x31,0x0f,
+  0x00,0x01,0x01,0x2d,0x15,0x00,0x01,0x01,0x2a,0x03,0x00,0x01,0x01,0x28,0x02,0x00,0x01,0x01,0x26,0x02,
+  0x00,0x01,0x01,0x24,0x02,0x00,0x01,0x02,0x15,0x00,0x01,0x0d,0x01,0x00,0x01,0x02,0x13,0x01,0x01,0x0d,
+  0x01,0x00,0x01,0x02,0x12,0x01,0x01,0x0c,0x01,0x00,0x01,0x02,0x12,0x00,0x01,0x0c,0x01,0x00,0x01,0x02,
+  0x11,0x01,0x01,0x0b,0x01,0x00,0x01,0x02,0x11,0x00,0x01,0x0b,0x01,0x00,0x01,0x02,0x10,0x00,0x01,0x0c,
+  0x00,0x00,0x01,0x02,0x0f,0x01,0x01,0x0b,0x00,0x00,0x01,0x02,0x0f,0x00,0x01,0x0b,0x00,0x00,0x01,0x02,
+  0x0e,0x01,0x01,0x0a,0x01,0x00,0x01,0x02,0x0e,0x00,0x01,0x0b,0x00,0x00,0x01,0x02,0x0e,0x00,0x01,0x0a,
+  0x00,0x00,0x01,0x02,0x0d,0x01,0x01,0x0a,0x00,0x00,0x01,0x03,0x0d,0x00,0x01,0x0a,0x00,0x00,0x1a,0x0c,
+  0x02,0x01,0x03,0x0d,0x00,0x01,0x0a,0x00,0x00,0x17,0x11,0x02,0x01,0x03,0x0c,0x01,0x01,0x09,0x01,0x00,
+  0x15,0x16,0x02,0x01,0x03,0x0c,0x00,0x01,0x0a,0x00,0x00,0x15,0x18,0x02,0x01,0x03,0x0c,0x00,0x01,0x0a,
+  0x00,0x00,0x14,0x1b,0x02,0x01,0x03,0x0c,0x00,0x01,0x09,0x00,0x00,0x14,0x1d,0x02,0x01,0x03,0x0b,0x01,
+  0x01,0x09,0x00,0x00,0x13,0x1f,0x02,0x01,0x03,0x0b,0x01,0x01,0x09,0x00,0x00,0x12,0x21,0x02,0x01,0x03,
+  0x0b,0x00,0x01,0x0a,0x00,0x00,0x11,0x23,0x02,0x01,0x05,0x0b,0x00,0x01,0x09,0x01,0x00,0x11,0x00,0x02,
+  0x0c,0x05,0x00,0x11,0x00,0x02,0x01,0x05,0x0b,0x00,0x01,0x09,0x01,0x00,0x11,0x00,0x02,0x09,0x0b,0x00,
+  0x0f,0x00,0x02,0x01,0x05,0x0b,0x00,0x01,0x09,0x00,0x00,0x11,0x00,0x02,0x09,0x0e,0x00,0x0d,0x01,0x02,
+  0x01,0x05,0x0b,0x00,0x01,0x09,0x00,0x00,0x11,0x00,0x02,0x08,0x11,0x00,0x0c,0x01,0x02,0x01,0x05,0x0b,
+  0x00,0x01,0x09,0x00,0x00,0x11,0x00,0x02,0x07,0x13,0x00,0x0c,0x00,0x02,0x01,0x05,0x0b,0x00,0x01,0x09,
+  0x01,0x00,0x10,0x00,0x02,0x06,0x15,0x00,0x0b,0x01,0x02,0x01,0x05,0x0b,0x00,0x01,0x09,0x01,0x00,0x10,
+  0x00,0x02,0x06,0x16,0x00,0x0b,0x00,0x02,0x01,0x05,0x0b,0x00,0x01,0x0a,0x00,0x00,0x10,0x00,0x02,0x1c,
+  0x01,0x00,0x0a,0x01,0x02,0x01,0x05,0x0b,0x01,0x01,0x09,0x00,0x00,0x10,0x00,0x02,0x1d,0x01,0x00,0x0a,
+  0x00,0x02,0x01,0x05,0x0b,0x01,0x01,0x09,0x00,0x00,0x11,0x00,0x02,0x1d,0x00,0x00,0x0a,0x01,0x02,0x01,
+  0x05,0x0c,0x00,0x01,0x09,0x00,0x00,0x11,0x00,0x02,0x1e,0x00,0x00,0x0a,0x00,0x02,0x01,0x05,0x0c,0x00,
+  0x01,0x09,0x01,0x00,0x11,0x00,0x02,0x1d,0x00,0x00,0x0a,0x00,0x02,0x01,0x06,0x0c,0x00,0x01,0x0a,0x00,
+  0x00,0x12,0x00,0x02,0x06,0x02,0x01,0x14,0x00,0x00,0x09,0x01,0x02,0x01,0x06,0x0c,0x01,0x01,0x09,0x00,
+  0x00,0x14,0x02,0x02,0x06,0x00,0x01,0x12,0x00,0x00,0x0a,0x00,0x02,0x01,0x05,0x0d,0x00,0x01,0x0a,0x00,
+  0x00,0x1d,0x00,0x01,0x11,0x01,0x00,0x09,0x00,0x02,0x01,0x05,0x0d,0x00,0x01,0x0a,0x00,0x00,0x1e,0x00,
+  0x01,0x11,0x00,0x00,0x09,0x00,0x02,0x01,0x05,0x0d,0x01,0x01,0x0a,0x00,0x00,0x1d,0x00,0x01,0x11,0x00,
+  0x00,0x09,0x01,0x02,0x01,0x05,0x0e,0x00,0x01,0x0a,0x01,0x00,0x1d,0x00,0x01,0x10,0x00,0x00,0x09,0x01,
+  0x02,0x01,0x05,0x0e,0x01,0x01,0x0a,0x01,0x00,0x1c,0x00,0x01,0x10,0x00,0x00,0x0a,0x00,0x02,0x01,0x05,
+  0x0f,0x00,0x01,0x0b,0x16,0x00,0x06,0x00,0x01,0x10,0x01,0x00,0x09,0x00,0x02,0x01,0x05,0x0f,0x01,0x01,
+  0x0b,0x15,0x00,0x06,0x00,0x01,0x10,0x01,0x00,0x09,0x00,0x02,0x01,0x05,0x10,0x00,0x01,0x0c,0x13,0x00,
+  0x07,0x00,0x01,0x11,0x00,0x00,0x09,0x00,0x02,0x01,0x05,0x10,0x01,0x01,0x0c,0x11,0x00,0x08,0x00,0x01,
+  0x11,0x00,0x00,0x09,0x00,0x02,0x01,0x05,0x11,0x01,0x01,0x0d,0x0e,0x00,0x09,0x00,0x01,0x11,0x00,0x00,
+  0x09,0x00,0x02,0x01,0x05,0x12,0x00,0x01,0x0f,0x0b,0x00,0x09,0x00,0x01,0x11,0x01,0x00,0x09,0x00,0x02,
+  0x01,0x05,0x13,0x00,0x01,0x11,0x05,0x00,0x0c,0x00,0x01,0x11,0x01,0x00,0x09,0x00,0x02,0x01,0x03,0x14,
+  0x23,0x01,0x11,0x00,0x00,0x0a,0x00,0x02,0x01,0x03,0x15,0x21,0x01,0x12,0x00,0x00,0x09,0x01,0x02,0x01,
+  0x03,0x16,0x1f,0x01,0x13,0x00,0x00,0x09,0x01,0x02,0x01,0x03,0x17,0x1d,0x01,0x14,0x00,0x00,0x09,0x00,
+  0x02,0x01,0x03,0x18,0x1b,0x01,0x14,0x00,0x00,0x0a,0x00,0x02,0x01,0x03,0x1a,0x18,0x01,0x15,0x00,0x00,
+  0x0a,0x00,0x02,0x01,0x03,0x1b,0x16,0x01,0x15,0x01,0x00,0x09,0x01,0x02,0x01,0x03,0x1e,0x11,0x01,0x17,
+  0x00,0x00,0x0a,0x00,0x02,0x01,0x03,0x20,0x0c,0x01,0x1a,0x00,0x00,0x0a,0x00,0x02,0x01,0x02,0x46,0x00,
+  0x00,0x0a,0x01,0x02,0x01,0x02,0x46,0x00,0x00,0x0a,0x00,0x02,0x01,0x02,0x45,0x00,0x00,0x0b,0x00,0x02,
+  0x01,0x02,0x44,0x01,0x00,0x0a,0x01,0x02,0x01,0x02,0x44,0x00,0x00,0x0b,0x00,0x02,0x01,0x02,0x43,0x00,
+  0x00,0x0b,0x01,0x02,0x01,0x02,0x42,0x00,0x00,0x0c,0x00,0x02,0x01,0x02,0x41,0x01,0x00,0x0b,0x00,0x02,
+  0x01,0x02,0x40,0x01,0x00,0x0b,0x01,0x02,0x01,0x02,0x3f,0x01,0x00,0x0c,0x00,0x02,0x01,0x02,0x3e,0x01,
+  0x00,0x0c,0x01,0x02,0x01,0x02,0x3c,0x01,0x00,0x0d,0x01,0x02,0x01,0x02,0x3b,0x01,0x00,0x0d,0x00,0x02,
+  0x01,0x01,0x39,0x02,0x00,0x01,0x01,0x37,0x02,0x00,0x01,0x01,0x35,0x02,0x00,0x01,0x01,0x32,0x03,0x00,
+  0x01,0x01,0x1d,0x15,0x00,0x01,0x01,0x1f,0x0f,0x00,0x01,0x01,0x26,0x00,0x00,0x00,0x01,0x06,0x01,0x35,
+  0x05,0x00,0x01,0x01,0x2f,0x0f,0x00,0x01,0x01,0x2c,0x04,0x00,0x01,0x01,0x29,0x03,0x00,0x01,0x01,0x27,
+  0x02,0x00,0x01,0x01,0x25,0x02,0x00,0x01,0x01,0x24,0x01,0x00,0x01,0x01,0x22,0x01,0x00,0x01,0x01,0x21,
+  0x01,0x00,0x01,0x01,0x20,0x01,0x00,0x01,0x01,0x1f,0x00,0x00,0x01,0x02,0x11,0x00,0x01,0x0c,0x00,0x00,
+  0x01,0x02,0x10,0x00,0x01,0x0c,0x00,0x00,0x01,0x02,0x0f,0x01,0x01,0x0b,0x00,0x00,0x01,0x02,0x0f,0x00,
+  0x01,0x0b,0x01,0x00,0x01,0x02,0x0e,0x00,0x01,0x0b,0x01,0x00,0x01,0x02,0x0e,0x00,0x01,0x0a,0x01,0x00,
+  0x01,0x02,0x0d,0x00,0x01,0x0b,0x00,0x00,0x01,0x02,0x0d,0x00,0x01,0x0a,0x01,0x00,0x01,0x03,0x0c,0x01,
+  0x01,0x0a,0x00,0x00,0x1e,0x04,0x02,0x01,0x03,0x0c,0x00,0x01,0x0a,0x01,0x00,0x19,0x0d,0x02,0x01,0x03,
+  0x0c,0x00,0x01,0x0a,0x00,0x00,0x18,0x12,0x02,0x01,0x03,0x0b,0x01,0x01,0x09,0x01,0x00,0x16,0x16,0x02,
+  0x01,0x03,0x0b,0x00,0x01,0x0a,0x00,0x00,0x15,0x1a,0x02,0x01,0x03,0x0b,0x00,0x01,0x0a,0x00,0x00,0x14,
+  0x1d,0x02,0x01,0x03,0x0b,0x00,0x01,0x09,0x01,0x00,0x13,0x1f,0x02,0x01,0x03,0x0a,0x01,0x01,0x09,0x00,
+  0x00,0x13,0x21,0x02,0x01,0x03,0x0a,0x00,0x01,0x0a,0x00,0x00,0x12,0x23,0x02,0x01,0x03,0x0a,0x00,0x01,
+  0x0a,0x00,0x00,0x12,0x24,0x02,0x01,0x05,0x0a,0x00,0x01,0x09,0x01,0x00,0x11,0x00,0x02,0x0d,0x06,0x00,
+  0x10,0x01,0x02,0x01,0x05,0x0a,0x00,0x01,0x09,0x00,0x00,0x12,0x00,0x02,0x0a,0x0c,0x00,0x0e,0x01,0x02,
+  0x01,0x05,0x0a,0x00,0x01,0x09,0x00,0x00,0x11,0x01,0x02,0x09,0x0f,0x00,0x0d,0x01,0x02,0x01,0x05,0x0a,
+  0x00,0x01,0x09,0x00,0x00,0x11,0x00,0x02,0x08,0x13,0x00,0x0c,0x00,0x02,0x01,0x05,0x0a,0x00,0x01,0x09,
+  0x00,0x00,0x11,0x00,0x02,0x08,0x14,0x00,0x0c,0x00,0x02,0x01,0x05,0x0a,0x00,0x01,0x09,0x00,0x00,0x11,
+  0x00,0x02,0x07,0x16,0x00,0x0b,0x01,0x02,0x01,0x05,0x0a,0x00,0x01,0x09,0x00,0x00,0x11,0x00,0x02,0x1d,
+  0x01,0x00,0x0b,0x00,0x02,0x01,0x05,0x0a,0x00,0x01,0x09,0x00,0x00,0x11,0x00,0x02,0x06,0x19,0x00,0x0a,
+  0x01,0x02,0x01,0x05,0x0a,0x00,0x01,0x09,0x01,0x00,0x10,0x00,0x02,0x06,0x19,0x00,0x0b,0x00,0x02,0x01,
+  0x05,0x0a,0x00,0x01,0x09,0x01,0x00,0x10,0x00,0x02,0x06,0x1a,0x00,0x0a,0x01,0x02,0x01,0x05,0x0a,0x00,
+  0x01,0x0a,0x00,0x00,0x11,0x00,0x02,0x05,0x1b,0x00,0x0a,0x00,0x02,0x01,0x05,0x0a,0x01,0x01,0x09,0x00,
+  0x00,0x11,0x00,0x02,0x20,0x00,0x00,0x0a,0x00,0x02,0x01,0x05,0x0b,0x00,0x01,0x09,0x00,0x00,0x12,0x00,
+  0x02,0x05,0x1b,0x00,0x09,0x01,0x02,0x01,0x06,0x0b,0x00,0x01,0x09,0x01,0x00,0x12,0x00,0x02,0x0a,0x00,
+  0x01,0x14,0x00,0x00,0x0a,0x00,0x02,0x01,0x06,0x0b,0x00,0x01,0x0a,0x00,0x00,0x14,0x00,0x02,0x0a,0x00,
+  0x01,0x12,0x01,0x00,0x09,0x00,0x02,0x01,0x05,0x0b,0x01,0x01,0x09,0x1b,0x00,0x05,0x00,0x01,0x12,0x00,
+  0x00,0x09,0x00,0x02,0x01,0x05,0x0c,0x00,0x01,0x0a,0x00,0x00,0x20,0x00,0x01,0x11,0x00,0x00,0x09,0x01,
+  0x02,0x01,0x05,0x0c,0x00,0x01,0x0a,0x1b,0x00,0x05,0x00,0x01,0x11,0x00,0x00,0x0a,0x00,0x02,0x01,0x05,
+  0x0c,0x01,0x01,0x0a,0x1a,0x00,0x06,0x00,0x01,0x10,0x01,0x00,0x09,0x00,0x02,0x01,0x05,0x0d,0x00,0x01,
+  0x0b,0x19,0x00,0x06,0x00,0x01,0x10,0x01,0x00,0x09,0x00,0x02,0x01,0x05,0x0d,0x01,0x01,0x0a,0x19,0x00,
+  0x06,0x00,0x01,0x11,0x00,0x00,0x09,0x00,0x02,0x01,0x05,0x0e,0x00,0x01,0x0b,0x01,0x00,0x1d,0x00,0x01,
+  0x11,0x00,0x00,0x09,0x00,0x02,0x01,0x05,0x0e,0x01,0x01,0x0b,0x16,0x00,0x07,0x00,0x01,0x11,0x00,0x00,
+  0x09,0x00,0x02,0x01,0x05,0x0f,0x00,0x01,0x0c,0x14,0x00,0x08,0x00,0x01,0x11,0x00,0x00,0x09,0x00,0x02,
+  0x01,0x05,0x10,0x00,0x01,0x0c,0x13,0x00,0x08,0x00,0x01,0x11,0x00,0x00,0x09,0x00,0x02,0x01,0x05,0x10,
+  0x01,0x01,0x0d,0x0f,0x00,0x09,0x01,0x01,0x11,0x00,0x00,0x09,0x00,0x02,0x01,0x05,0x11,0x01,0x01,0x0e,
+  0x0c,0x00,0x0a,0x00,0x01,0x12,0x00,0x00,0x09,0x00,0x02,0x01,0x05,0x12,0x01,0x01,0x10,0x06,0x00,0x0d,
+  0x00,0x01,0x11,0x01,0x00,0x09,0x00,0x02,0x01,0x03,0x13,0x24,0x01,0x12,0x00,0x00,0x0a,0x00,0x02,0x01,
+  0x03,0x14,0x23,0x01,0x12,0x00,0x00,0x0a,0x00,0x02,0x01,0x03,0x15,0x21,0x01,0x13,0x00,0x00,0x09,0x01,
+  0x02,0x01,0x03,0x16,0x1f,0x01,0x13,0x01,0x00,0x09,0x00,0x02,0x01,0x03,0x17,0x1d,0x01,0x14,0x00,0x00,
+  0x0a,0x00,0x02,0x01,0x03,0x19,0x1a,0x01,0x15,0x00,0x00,0x0a,0x00,0x02,0x01,0x03,0x1b,0x16,0x01,0x16,
+  0x01,0x00,0x09,0x01,0x02,0x01,0x03,0x1d,0x12,0x01,0x18,0x00,0x00,0x0a,0x00,0x02,0x01,0x03,0x20,0x0d,
+  0x01,0x19,0x01,0x00,0x0a,0x00,0x02,0x01,0x03,0x24,0x04,0x01,0x1e,0x00,0x00,0x0a,0x01,0x02,0x01,0x02,
+  0x46,0x01,0x00,0x0a,0x00,0x02,0x01,0x02,0x46,0x00,0x00,0x0b,0x00,0x02,0x01,0x02,0x45,0x01,0x00,0x0a,
+  0x00,0x02,0x01,0x02,0x44,0x01,0x00,0x0b,0x00,0x02,0x01,0x02,0x43,0x01,0x00,0x0b,0x00,0x02,0x01,0x02,
+  0x43,0x00,0x00,0x0b,0x01,0x02,0x01,0x02,0x42,0x00,0x00,0x0c,0x00,0x02,0x01,0x02,0x41,0x00,0x00,0x0c,
+  0x00,0x02,0x01,0x01,0x40,0x00,0x00,0x01,0x01,0x3e,0x01,0x00,0x01,0x01,0x3d,0x01,0x00,0x01,0x01,0x3c,
+  0x01,0x00,0x01,0x01,0x3a,0x01,0x00,0x01,0x01,0x38,0x02,0x00,0x01,0x01,0x36,0x02,0x00,0x01,0x01,0x33,
+  0x03,0x00,0x01,0x01,0x2f,0x04,0x00,0x01,0x01,0x21,0x0f,0x00,0x01,0x01,0x25,0x05,0x00,0x00,0x01,0x05,
+  0x01,0x33,0x03,0x00,0x01,0x01,0x2e,0x06,0x00,0x01,0x01,0x2b,0x03,0x00,0x01,0x01,0x29,0x02,0x00,0x01,
+  0x01,0x26,0x02,0x00,0x01,0x01,0x25,0x01,0x00,0x01,0x01,0x23,0x01,0x00,0x01,0x01,0x22,0x01,0x00,0x01,
+  0x01,0x20,0x01,0x00,0x01,0x01,0x1f,0x01,0x00,0x01,0x01,0x1e,0x01,0x00,0x01,0x01,0x1d,0x01,0x00,0x01,
+  0x01,0x1c,0x01,0x00,0x01,0x01,0x1b,0x01,0x00,0x01,0x01,0x1a,0x01,0x00,0x01,0x02,0x0e,0x00,0x01,0x0a,
+  0x01,0x00,0x01,0x01,0x19,0x00,0x00,0x01,0x02,0x0d,0x00,0x01,0x0a,0x00,0x00,0x01,0x02,0x0c,0x00,0x01,
+  0x0a,0x01,0x00,0x01,0x03,0x0b,0x01,0x01,0x0a,0x00,0x00,0x1d,0x07,0x02,0x01,0x03,0x0b,0x00,0x01,0x0a,
+  0x01,0x00,0x19,0x0f,0x02,0x01,0x03,0x0b,0x00,0x01,0x0a,0x00,0x00,0x18,0x14,0x02,0x01,0x03,0x0a,0x01,
+  0x01,0x09,0x01,0x00,0x16,0x18,0x02,0x01,0x03,0x0a,0x00,0x01,0x0a,0x00,0x00,0x16,0x1b,0x02,0x01,0x03,
+  0x0a,0x00,0x01,0x0a,0x00,0x00,0x14,0x1e,0x02,0x01,0x03,0x0a,0x00,0x01,0x09,0x01,0x00,0x13,0x21,0x02,
+  0x01,0x03,0x09,0x01,0x01,0x09,0x00,0x00,0x13,0x23,0x02,0x01,0x03,0x09,0x00,0x01,0x0a,0x00,0x00,0x13,
+  0x24,0x02,0x01,0x03,0x09,0x00,0x01,0x09,0x01,0x00,0x12,0x26,0x02,0x01,0x05,0x09,0x00,0x01,0x09,0x01,
+  0x00,0x11,0x01,0x02,0x0c,0x08,0x00,0x10,0x01,0x02,0x01,0x05,0x09,0x00,0x01,0x09,0x00,0x00,0x12,0x00,
+  0x02,0x0b,0x0d,0x00,0x0e,0x01,0x02,0x01,0x05,0x09,0x00,0x01,0x09,0x00,0x00,0x12,0x00,0x02,0x09,0x11,
+  0x00,0x0d,0x00,0x02,0x01,0x05,0x09,0x00,0x01,0x09,0x00,0x00,0x11,0x00,0x02,0x09,0x13,0x00,0x0d,0x00,
+  0x02,0x01,0x05,0x09,0x00,0x01,0x09,0x00,0x00,0x11,0x00,0x02,0x08,0x15,0x00,0x0c,0x01,0x02,0x01,0x05,
+  0x08,0x01,0x01,0x09,0x00,0x00,0x11,0x00,0x02,0x08,0x17,0x00,0x0b,0x00,0x02,0x01,0x05,0x09,0x00,0x01,
+  0x09,0x00,0x00,0x11,0x00,0x02,0x07,0x19,0x00,0x0b,0x00,0x02,0x01,0x05,0x09,0x00,0x01,0x09,0x00,0x00,
+  0x11,0x00,0x02,0x07,0x19,0x00,0x0b,0x01,0x02,0x01,0x05,0x09,0x00,0x01,0x09,0x00,0x00,0x11,0x00,0x02,
+  0x06,0x1b,0x00,0x0b,0x00,0x02,0x01,0x05,0x09,0x00,0x01,0x09,0x00,0x00,0x11,0x00,0x02,0x06,0x1c,0x00,
+  0x0a,0x00,0x02,0x01,0x05,0x09,0x00,0x01,0x09,0x00,0x00,0x11,0x00,0x02,0x06,0x1d,0x00,0x0a,0x00,0x02,
+  0x01,0x05,0x09,0x00,0x01,0x09,0x01,0x00,0x11,0x00,0x02,0x22,0x00,0x00,0x0a,0x00,0x02,0x01,0x05,0x09,
+  0x00,0x01,0x0a,0x00,0x00,0x11,0x00,0x02,0x06,0x1d,0x00,0x09,0x01,0x02,0x01,0x05,0x09,0x01,0x01,0x09,
+  0x00,0x00,0x12,0x00,0x02,0x22,0x00,0x00,0x0a,0x00,0x02,0x01,0x06,0x0a,0x00,0x01,0x09,0x00,0x00,0x13,
+  0x00,0x02,0x0c,0x01,0x01,0x13,0x00,0x00,0x0a,0x00,0x02,0x01,0x06,0x0a,0x00,0x01,0x0a,0x00,0x00,0x13,
+  0x01,0x02,0x0c,0x00,0x01,0x13,0x00,0x00,0x09,0x00,0x02,0x01,0x05,0x0a,0x00,0x01,0x0a,0x00,0x00,0x22,
+  0x00,0x01,0x12,0x00,0x00,0x09,0x01,0x02,0x01,0x05,0x0a,0x01,0x01,0x09,0x1d,0x00,0x06,0x00,0x01,0x11,
+  0x00,0x00,0x0a,0x00,0x02,0x01,0x05,0x0b,0x00,0x01,0x0a,0x00,0x00,0x22,0x00,0x01,0x11,0x01,0x00,0x09,
+  0x00,0x02,0x01,0x05,0x0b,0x00,0x01,0x0a,0x1d,0x00,0x06,0x00,0x01,0x11,0x00,0x00,0x09,0x00,0x02,0x01,
+  0x05,0x0c,0x00,0x01,0x0a,0x1c,0x00,0x06,0x00,0x01,0x11,0x00,0x00,0x09,0x00,0x02,0x01,0x05,0x0c,0x00,
+  0x01,0x0b,0x1b,0x00,0x06,0x00,0x01,0x11,0x00,0x00,0x09,0x00,0x02,0x01,0x05,0x0c,0x01,0x01,0x0b,0x19,
+  0x00,0x07,0x00,0x01,0x11,0x00,0x00,0x09,0x00,0x02,0x01,0x05,0x0d,0x00,0x01,0x0b,0x19,0x00,0x07,0x00,
+  0x01,0x11,0x00,0x00,0x09,0x00,0x02,0x01,0x05,0x0e,0x00,0x01,0x0b,0x17,0x00,0x08,0x00,0x01,0x11,0x00,
+  0x00,0x09,0x01,0x02,0x01,0x05,0x0e,0x01,0x01,0x0c,0x15,0x00,0x08,0x00,0x01,0x11,0x00,0x00,0x09,0x00,
+  0x02,0x01,0x05,0x0f,0x00,0x01,0x0d,0x13,0x00,0x09,0x00,0x01,0x11,0x00,0x00,0x09,0x00,0x02,0x01,0x05,
+  0x10,0x00,0x01,0x0d,0x11,0x00,0x09,0x00,0x01,0x12,0x00,0x00,0x09,0x00,0x02,0x01,0x05,0x10,0x01,0x01,
+  0x0e,0x0d,0x00,0x0b,0x00,0x01,0x12,0x00,0x00,0x09,0x00,0x02,0x01,0x05,0x11,0x01,0x01,0x10,0x08,0x00,
+  0x0c,0x01,0x01,0x11,0x01,0x00,0x09,0x00,0x02,0x01,0x03,0x12,0x26,0x01,0x12,0x01,0x00,0x09,0x00,0x02,
+  0x01,0x03,0x13,0x24,0x01,0x13,0x00,0x00,0x0a,0x00,0x02,0x01,0x03,0x14,0x23,0x01,0x13,0x00,0x00,0x09,
+  0x01,0x02,0x01,0x03,0x15,0x21,0x01,0x13,0x01,0x00,0x09,0x00,0x02,0x01,0x03,0x17,0x1e,0x01,0x14,0x00,
+  0x00,0x0a,0x00,0x02,0x01,0x03,0x18,0x1b,0x01,0x16,0x00,0x00,0x0a,0x00,0x02,0x01,0x03,0x1a,0x18,0x01,
+  0x16,0x01,0x00,0x09,0x01,0x02,0x01,0x03,0x1c,0x14,0x01,0x18,0x00,0x00,0x0a,0x00,0x02,0x01,0x03,0x1f,
+  0x0f,0x01,0x19,0x01,0x00,0x0a,0x00,0x02,0x01,0x03,0x23,0x07,0x01,0x1d,0x00,0x00,0x0a,0x01,0x02,0x01,
+  0x02,0x47,0x01,0x00,0x0a,0x00,0x02,0x01,0x02,0x47,0x00,0x00,0x0a,0x00,0x02,0x01,0x01,0x46,0x00,0x00,
+  0x01,0x02,0x45,0x01,0x00,0x0a,0x00,0x02,0x01,0x01,0x44,0x01,0x00,0x01,0x01,0x43,0x01,0x00,0x01,0x01,
+  0x42,0x01,0x00,0x01,0x01,0x41,0x01,0x00,0x01,0x01,0x40,0x01,0x00,0x01,0x01,0x3f,0x01,0x00,0x01,0x01,
+  0x3e,0x01,0x00,0x01,0x01,0x3c,0x01,0x00,0x01,0x01,0x3b,0x01,0x00,0x01,0x01,0x39,0x01,0x00,0x01,0x01,
+  0x37,0x02,0x00,0x01,0x01,0x34,0x02,0x00,0x01,0x01,0x31,0x03,0x00,0x01,0x01,0x2b,0x06,0x00,0x01,0x01,
+  0x29,0x03,0x00,0x00,0x01,0x05,0x01,0x2d,0x05,0x00,0x01,0x01,0x2a,0x03,0x00,0x01,0x01,0x28,0x02,0x00,
+  0x01,0x01,0x26,0x02,0x00,0x01,0x01,0x24,0x01,0x00,0x01,0x01,0x22,0x02,0x00,0x01,0x01,0x21,0x01,0x00,
+  0x01,0x01,0x1f,0x02,0x00,0x01,0x01,0x1e,0x01,0x00,0x01,0x01,0x1d,0x01,0x00,0x01,0x01,0x1c,0x01,0x00,
+  0x01,0x01,0x1b,0x01,0x00,0x01,0x01,0x1a,0x01,0x00,0x01,0x01,0x19,0x01,0x00,0x01,0x01,0x19,0x00,0x00,
+  0x01,0x01,0x18,0x00,0x00,0x01,0x01,0x17,0x01,0x00,0x01,0x01,0x17,0x00,0x00,0x01,0x02,0x16,0x00,0x00,
+  0x1d,0x09,0x02,0x01,0x02,0x15,0x01,0x00,0x1a,0x10,0x02,0x01,0x02,0x15,0x00,0x00,0x18,0x16,0x02,0x01,
+  0x03,0x0a,0x00,0x01,0x09,0x01,0x00,0x16,0x1a,0x02,0x01,0x02,0x14,0x00,0x00,0x16,0x1c,0x02,0x01,0x03,
+  0x09,0x00,0x01,0x0a,0x00,0x00,0x15,0x1f,0x02,0x01,0x03,0x09,0x00,0x01,0x09,0x01,0x00,0x14,0x21,0x02,
+  0x01,0x03,0x08,0x01,0x01,0x09,0x00,0x00,0x14,0x24,0x02,0x01,0x03,0x08,0x00,0x01,0x0a,0x00,0x00,0x13,
+  0x26,0x02,0x01,0x03,0x08,0x00,0x01,0x09,0x01,0x00,0x12,0x28,0x02,0x01,0x05,0x08,0x00,0x01,0x09,0x00,
+  0x00,0x13,0x00,0x02,0x0d,0x08,0x00,0x11,0x01,0x02,0x01,0x05,0x08,0x00,0x01,0x09,0x00,0x00,0x12,0x00,
+  0x02,0x0c,0x0d,0x00,0x0f,0x00,0x02,0x01,0x05,0x07,0x01,0x01,0x09,0x00,0x00,0x12,0x00,0x02,0x0a,0x11,
+  0x00,0x0e,0x00,0x02,0x01,0x05,0x07,0x01,0x01,0x09,0x00,0x00,0x11,0x01,0x02,0x09,0x14,0x00,0x0c,0x01,
+  0x02,0x01,0x05,0x07,0x01,0x01,0x09,0x00,0x00,0x11,0x00,0x02,0x09,0x16,0x00,0x0c,0x01,0x02,0x01,0x05,
+  0x07,0x01,0x01,0x09,0x00,0x00,0x11,0x00,0x02,0x08,0x18,0x00,0x0c,0x00,0x02,0x01,0x05,0x07,0x00,0x01,
+  0x0a,0x00,0x00,0x11,0x00,0x02,0x08,0x19,0x00,0x0b,0x01,0x02,0x01,0x05,0x07,0x01,0x01,0x09,0x00,0x00,
+  0x11,0x00,0x02,0x07,0x1b,0x00,0x0b,0x00,0x02,0x01,0x05,0x07,0x01,0x01,0x09,0x00,0x00,0x11,0x00,0x02,
+  0x07,0x1c,0x00,0x0b,0x00,0x02,0x01,0x05,0x07,0x01,0x01,0x09,0x00,0x00,0x11,0x00,0x02,0x23,0x01,0x00,
+  0x0a,0x00,0x02,0x01,0x05,0x07,0x01,0x01,0x09,0x00,0x00,0x11,0x00,0x02,0x24,0x00,0x00,0x0a,0x01,0x02,
+  0x01,0x05,0x08,0x00,0x01,0x09,0x00,0x00,0x11,0x00,0x02,0x25,0x00,0x00,0x0a,0x00,0x02,0x01,0x05,0x08,
+  0x00,0x01,0x09,0x00,0x00,0x12,0x00,0x02,0x06,0x1e,0x00,0x0a,0x01,0x02,0x01,0x05,0x08,0x00,0x01,0x09,
+  0x01,0x00,0x11,0x00,0x02,0x25,0x00,0x00,0x0a,0x00,0x02,0x01,0x07,0x08,0x00,0x01,0x0a,0x00,0x00,0x12,
+  0x00,0x02,0x06,0x00,0x00,0x04,0x04,0x01,0x14,0x00,0x00,0x0a,0x00,0x02,0x01,0x06,0x08,0x01,0x01,0x09,
+  0x00,0x00,0x13,0x00,0x02,0x08,0x07,0x01,0x13,0x01,0x00,0x09,0x00,0x02,0x01,0x06,0x09,0x00,0x01,0x09,
+  0x01,0x00,0x13,0x07,0x02,0x08,0x00,0x01,0x13,0x00,0x00,0x09,0x01,0x02,0x01,0x07,0x09,0x00,0x01,0x0a,
+  0x00,0x00,0x14,0x04,0x02,0x04,0x00,0x00,0x06,0x00,0x01,0x12,0x00,0x00,0x0a,0x00,0x02,0x01,0x05,0x09,
+  0x00,0x01,0x0a,0x00,0x00,0x25,0x00,0x01,0x11,0x01,0x00,0x09,0x00,0x02,0x01,0x05,0x09,0x01,0x01,0x0a,
+  0x1e,0x00,0x06,0x00,0x01,0x12,0x00,0x00,0x09,0x00,0x02,0x01,0x05,0x0a,0x00,0x01,0x0a,0x00,0x00,0x25,
+  0x00,0x01,0x11,0x00,0x00,0x09,0x00,0x02,0x01,0x05,0x0a,0x01,0x01,0x0a,0x00,0x00,0x24,0x00,0x01,0x11,
+  0x00,0x00,0x09,0x01,0x02,0x01,0x05,0x0b,0x00,0x01,0x0a,0x01,0x00,0x23,0x00,0x01,0x11,0x00,0x00,0x09,
+  0x01,0x02,0x01,0x05,0x0b,0x00,0x01,0x0b,0x1c,0x00,0x07,0x00,0x01,0x11,0x00,0x00,0x09,0x01,0x02,0x01,
+  0x05,0x0c,0x00,0x01,0x0b,0x1b,0x00,0x07,0x00,0x01,0x11,0x00,0x00,0x09,0x01,0x02,0x01,0x05,0x0c,0x01,
+  0x01,0x0b,0x19,0x00,0x08,0x00,0x01,0x11,0x00,0x00,0x0a,0x00,0x02,0x01,0x05,0x0d,0x00,0x01,0x0c,0x18,
+  0x00,0x08,0x00,0x01,0x11,0x00,0x00,0x09,0x01,0x02,0x01,0x05,0x0d,0x01,0x01,0x0c,0x16,0x00,0x09,0x00,
+  0x01,0x11,0x00,0x00,0x09,0x01,0x02,0x01,0x05,0x0e,0x01,0x01,0x0c,0x14,0x00,0x09,0x01,0x01,0x11,0x00,
+  0x00,0x09,0x01,0x02,0x01,0x05,0x0f,0x00,0x01,0x0e,0x11,0x00,0x0a,0x00,0x01,0x12,0x00,0x00,0x09,0x01,
+  0x02,0x01,0x05,0x10,0x00,0x01,0x0f,0x0d,0x00,0x0c,0x00,0x01,0x12,0x00,0x00,0x09,0x00,0x02,0x01,0x05,
+  0x10,0x01,0x01,0x11,0x08,0x00,0x0d,0x00,0x01,0x13,0x00,0x00,0x09,0x00,0x02,0x01,0x03,0x11,0x28,0x01,
+  0x12,0x01,0x00,0x09,0x00,0x02,0x01,0x03,0x12,0x26,0x01,0x13,0x00,0x00,0x0a,0x00,0x02,0x01,0x03,0x13,
+  0x24,0x01,0x14,0x00,0x00,0x09,0x01,0x02,0x01,0x03,0x15,0x21,0x01,0x14,0x01,0x00,0x09,0x00,0x02,0x01,
+  0x03,0x16,0x1f,0x01,0x15,0x00,0x00,0x0a,0x00,0x02,0x01,0x02,0x18,0x1c,0x01,0x16,0x00,0x00,0x01,0x03,
+  0x19,0x1a,0x01,0x16,0x01,0x00,0x09,0x00,0x02,0x01,0x02,0x1b,0x16,0x01,0x18,0x00,0x00,0x01,0x02,0x1e,
+  0x10,0x01,0x1a,0x01,0x00,0x01,0x02,0x22,0x09,0x01,0x1d,0x00,0x00,0x01,0x01,0x48,0x00,0x00,0x01,0x01,
+  0x47,0x01,0x00,0x01,0x01,0x47,0x00,0x00,0x01,0x01,0x46,0x00,0x00,0x01,0x01,0x45,0x01,0x00,0x01,0x01,
+  0x44,0x01,0x00,0x01,0x01,0x43,0x01,0x00,0x01,0x01,0x42,0x01,0x00,0x01,0x01,0x41,0x01,0x00,0x01,0x01,
+  0x40,0x01,0x00,0x01,0x01,0x3e,0x02,0x00,0x01,0x01,0x3d,0x01,0x00,0x01,0x01,0x3b,0x02,0x00,0x01,0x01,
+  0x3a,0x01,0x00,0x01,0x01,0x37,0x02,0x00,0x01,0x01,0x35,0x02,0x00,0x01,0x01,0x32,0x03,0x00,0x01,0x01,
+  0x2d,0x05,0x00,0x00,0x01,0x05,0x01,0x29,0x03,0x00,0x01,0x01,0x27,0x02,0x00,0x01,0x01,0x25,0x02,0x00,
+  0x01,0x01,0x23,0x02,0x00,0x01,0x01,0x22,0x01,0x00,0x01,0x01,0x20,0x01,0x00,0x01,0x01,0x1f,0x01,0x00,
+  0x01,0x01,0x1e,0x00,0x00,0x01,0x01,0x1c,0x01,0x00,0x01,0x01,0x1b,0x01,0x00,0x01,0x01,0x1a,0x01,0x00,
+  0x01,0x01,0x19,0x01,0x00,0x01,0x01,0x19,0x00,0x00,0x01,0x01,0x18,0x00,0x00,0x01,0x01,0x17,0x01,0x00,
+  0x01,0x01,0x16,0x01,0x00,0x01,0x01,0x16,0x00,0x00,0x01,0x02,0x15,0x01,0x00,0x1c,0x0c,0x02,0x01,0x02,
+  0x15,0x00,0x00,0x1a,0x12,0x02,0x01,0x02,0x14,0x00,0x00,0x19,0x16,0x02,0x01,0x02,0x14,0x00,0x00,0x17,
+  0x1a,0x02,0x01,0x02,0x13,0x00,0x00,0x16,0x1e,0x02,0x01,0x02,0x13,0x00,0x00,0x15,0x21,0x02,0x01,0x02,
+  0x12,0x01,0x00,0x14,0x23,0x02,0x01,0x02,0x12,0x00,0x00,0x14,0x25,0x02,0x01,0x02,0x12,0x00,0x00,0x13,
+  0x27,0x02,0x01,0x02,0x11,0x01,0x00,0x13,0x28,0x02,0x01,0x05,0x07,0x00,0x01,0x09,0x00,0x00,0x13,0x00,
+  0x02,0x0e,0x09,0x00,0x11,0x00,0x02,0x01,0x05,0x07,0x00,0x01,0x09,0x00,0x00,0x12,0x01,0x02,0x0b,0x0f,
+  0x00,0x0f,0x00,0x02,0x01,0x05,0x06,0x01,0x01,0x09,0x00,0x00,0x12,0x00,0x02,0x0b,0x12,0x00,0x0d,0x01,
+  0x02,0x01,0x05,0x06,0x00,0x01,0x0a,0x00,0x00,0x12,0x00,0x02,0x09,0x15,0x00,0x0d,0x01,0x02,0x01,0x05,
+  0x06,0x00,0x01,0x0a,0x00,0x00,0x11,0x00,0x02,0x09,0x18,0x00,0x0c,0x00,0x02,0x01,0x05,0x06,0x00,0x01,
+  0x09,0x01,0x00,0x11,0x00,0x02,0x09,0x19,0x00,0x0c,0x00,0x02,0x01,0x05,0x06,0x00,0x01,0x09,0x01,0x00,
+  0x11,0x00,0x02,0x08,0x1b,0x00,0x0b,0x01,0x02,0x01,0x05,0x06,0x00,0x01,0x09,0x01,0x00,0x11,0x00,0x02,
+  0x08,0x1c,0x00,0x0b,0x00,0x02,0x01,0x05,0x06,0x00,0x01,0x09,0x01,0x00,0x11,0x00,0x02,0x07,0x1e,0x00,
+  0x0a,0x01,0x02,0x01,0x05,0x06,0x00,0x01,0x09,0x01,0x00,0x11,0x00,0x02,0x07,0x1e,0x00,0x0b,0x00,0x02,
+  0x01,0x05,0x06,0x00,0x01,0x0a,0x00,0x00,0x11,0x00,0x02,0x07,0x1f,0x00,0x0a,0x01,0x02,0x01,0x05,0x06,
+  0x00,0x01,0x0a,0x00,0x00,0x11,0x00,0x02,0x07,0x20,0x00,0x0a,0x00,0x02,0x01,0x05,0x06,0x01,0x01,0x09,
+  0x00,0x00,0x11,0x00,0x02,0x07,0x20,0x00,0x0a,0x01,0x02,0x01,0x05,0x06,0x01,0x01,0x09,0x00,0x00,0x12,
+  0x00,0x02,0x06,0x21,0x00,0x0a,0x00,0x02,0x01,0x07,0x07,0x00,0x01,0x09,0x00,0x00,0x12,0x00,0x02,0x07,
+  0x00,0x00,0x07,0x01,0x01,0x16,0x00,0x00,0x0a,0x00,0x02,0x01,0x06,0x07,0x00,0x01,0x09,0x01,0x00,0x12,
+  0x00,0x02,0x0b,0x06,0x01,0x14,0x01,0x00,0x09,0x00,0x02,0x01,0x07,0x07,0x00,0x01,0x0a,0x00,0x00,0x12,
+  0x01,0x02,0x07,0x00,0x00,0x09,0x01,0x01,0x13,0x00,0x00,0x09,0x01,0x02,0x01,0x07,0x07,0x01,0x01,0x09,
+  0x00,0x00,0x13,0x01,0x02,0x09,0x00,0x00,0x07,0x01,0x01,0x12,0x00,0x00,0x0a,0x00,0x02,0x01,0x06,0x08,
+  0x00,0x01,0x09,0x01,0x00,0x14,0x06,0x02,0x0b,0x00,0x01,0x12,0x01,0x00,0x09,0x00,0x02,0x01,0x07,0x08,
+  0x00,0x01,0x0a,0x00,0x00,0x16,0x01,0x02,0x07,0x00,0x00,0x07,0x00,0x01,0x12,0x00,0x00,0x09,0x00,0x02,
+  0x01,0x05,0x08,0x00,0x01,0x0a,0x21,0x00,0x06,0x00,0x01,0x12,0x00,0x00,0x09,0x01,0x02,0x01,0x05,0x08,
+  0x01,0x01,0x0a,0x20,0x00,0x07,0x00,0x01,0x11,0x00,0x00,0x09,0x01,0x02,0x01,0x05,0x09,0x00,0x01,0x0a,
+  0x20,0x00,0x07,0x00,0x01,0x11,0x00,0x00,0x0a,0x00,0x02,0x01,0x05,0x09,0x01,0x01,0x0a,0x1f,0x00,0x07,
+  0x00,0x01,0x11,0x00,0x00,0x0a,0x00,0x02,0x01,0x05,0x0a,0x00,0x01,0x0b,0x1e,0x00,0x07,0x00,0x01,0x11,
+  0x01,0x00,0x09,0x00,0x02,0x01,0x05,0x0a,0x01,0x01,0x0a,0x1e,0x00,0x07,0x00,0x01,0x11,0x01,0x00,0x09,
+  0x00,0x02,0x01,0x05,0x0b,0x00,0x01,0x0b,0x1c,0x00,0x08,0x00,0x01,0x11,0x01,0x00,0x09,0x00,0x02,0x01,
+  0x05,0x0b,0x01,0x01,0x0b,0x1b,0x00,0x08,0x00,0x01,0x11,0x01,0x00,0x09,0x00,0x02,0x01,0x05,0x0c,0x00,
+  0x01,0x0c,0x19,0x00,0x09,0x00,0x01,0x11,0x01,0x00,0x09,0x00,0x02,0x01,0x05,0x0d,0x00,0x01,0x0c,0x18,
+  0x00,0x09,0x00,0x01,0x11,0x00,0x00,0x0a,0x00,0x02,0x01,0x05,0x0d,0x01,0x01,0x0d,0x15,0x00,0x09,0x00,
+  0x01,0x12,0x00,0x00,0x0a,0x00,0x02,0x01,0x05,0x0e,0x01,0x01,0x0d,0x12,0x00,0x0b,0x00,0x01,0x12,0x00,
+  0x00,0x09,0x01,0x02,0x01,0x05,0x0f,0x00,0x01,0x0f,0x0f,0x00,0x0b,0x01,0x01,0x12,0x00,0x00,0x09,0x00,
+  0x02,0x01,0x05,0x10,0x00,0x01,0x11,0x09,0x00,0x0e,0x00,0x01,0x13,0x00,0x00,0x09,0x00,0x02,0x01,0x02,
+  0x11,0x28,0x01,0x13,0x01,0x00,0x01,0x02,0x12,0x27,0x01,0x13,0x00,0x00,0x01,0x02,0x13,0x25,0x01,0x14,
+  0x00,0x00,0x01,0x02,0x14,0x23,0x01,0x14,0x01,0x00,0x01,0x02,0x15,0x21,0x01,0x15,0x00,0x00,0x01,0x02,
+  0x17,0x1e,0x01,0x16,0x00,0x00,0x01,0x02,0x19,0x1a,0x01,0x17,0x00,0x00,0x01,0x02,0x1b,0x16,0x01,0x19,
+  0x00,0x00,0x01,0x02,0x1d,0x12,0x01,0x1a,0x00,0x00,0x01,0x02,0x20,0x0c,0x01,0x1c,0x01,0x00,0x01,0x01,
+  0x49,0x00,0x00,0x01,0x01,0x48,0x01,0x00,0x01,0x01,0x47,0x01,0x00,0x01,0x01,0x47,0x00,0x00,0x01,0x01,
+  0x46,0x00,0x00,0x01,0x01,0x45,0x01,0x00,0x01,0x01,0x44,0x01,0x00,0x01,0x01,0x43,0x01,0x00,0x01,0x01,
+  0x42,0x01,0x00,0x01,0x01,0x41,0x00,0x00,0x01,0x01,0x3f,0x01,0x00,0x01,0x01,0x3e,0x01,0x00,0x01,0x01,
+  0x3c,0x01,0x00,0x01,0x01,0x3a,0x02,0x00,0x01,0x01,0x38,0x02,0x00,0x01,0x01,0x36,0x02,0x00,0x01,0x01,
+  0x33,0x03,0x00,0x00,0x01,0x06,0x01,0x25,0x01,0x00,0x01,0x01,0x22,0x02,0x00,0x01,0x01,0x21,0x01,0x00,
+  0x01,0x01,0x1f,0x02,0x00,0x01,0x01,0x1e,0x01,0x00,0x01,0x01,0x1d,0x01,0x00,0x01,0x01,0x1c,0x01,0x00,
+  0x01,0x01,0x1b,0x00,0x00,0x01,0x01,0x1a,0x00,0x00,0x01,0x01,0x19,0x00,0x00,0x01,0x01,0x18,0x00,0x00,
+  0x01,0x01,0x17,0x01,0x00,0x01,0x01,0x16,0x01,0x00,0x01,0x01,0x16,0x00,0x00,0x01,0x01,0x15,0x00,0x00,
+  0x01,0x02,0x14,0x01,0x00,0x1c,0x0e,0x02,0x01,0x02,0x14,0x00,0x00,0x1a,0x14,0x02,0x01,0x02,0x13,0x01,
+  0x00,0x18,0x18,0x02,0x01,0x02,0x13,0x00,0x00,0x17,0x1c,0x02,0x01,0x02,0x12,0x01,0x00,0x16,0x1f,0x02,
+  0x01,0x02,0x12,0x00,0x00,0x16,0x21,0x02,0x01,0x02,0x11,0x01,0x00,0x14,0x25,0x02,0x01,0x02,0x11,0x00,
+  0x00,0x14,0x27,0x02,0x01,0x02,0x11,0x00,0x00,0x14,0x28,0x02,0x01,0x02,0x10,0x01,0x00,0x13,0x2a,0x02,
+  0x01,0x04,0x10,0x00,0x00,0x13,0x01,0x02,0x0d,0x0b,0x00,0x10,0x01,0x02,0x01,0x04,0x10,0x00,0x00,0x13,
+  0x00,0x02,0x0c,0x10,0x00,0x0e,0x01,0x02,0x01,0x04,0x10,0x00,0x00,0x12,0x00,0x02,0x0b,0x13,0x00,0x0e,
+  0x01,0x02,0x01,0x04,0x10,0x00,0x00,0x12,0x00,0x02,0x0a,0x16,0x00,0x0d,0x01,0x02,0x01,0x04,0x0f,0x01,
+  0x00,0x11,0x01,0x02,0x09,0x18,0x00,0x0d,0x00,0x02,0x01,0x04,0x0f,0x01,0x00,0x11,0x00,0x02,0x09,0x1b,
+  0x00,0x0b,0x01,0x02,0x01,0x04,0x0f,0x00,0x00,0x12,0x00,0x02,0x08,0x1d,0x00,0x0b,0x01,0x02,0x01,0x05,
+  0x05,0x00,0x01,0x09,0x00,0x00,0x12,0x00,0x02,0x08,0x1e,0x00,0x0b,0x00,0x02,0x01,0x05,0x05,0x00,0x01,
+  0x09,0x00,0x00,0x12,0x00,0x02,0x08,0x1e,0x00,0x0b,0x01,0x02,0x01,0x05,0x05,0x00,0x01,0x09,0x00,0x00,
+  0x12,0x00,0x02,0x07,0x20,0x00,0x0b,0x00,0x02,0x01,0x05,0x05,0x00,0x01,0x09,0x00,0x00,0x12,0x00,0x02,
+  0x07,0x21,0x00,0x0a,0x01,0x02,0x01,0x05,0x05,0x00,0x01,0x09,0x01,0x00,0x11,0x00,0x02,0x07,0x22,0x00,
+  0x0a,0x00,0x02,0x01,0x00,0x01,0x05,0x05,0x00,0x01,0x0a,0x00,0x00,0x11,0x00,0x02,0x07,0x23,0x00,0x0a,
+  0x00,0x02,0x01,0x05,0x05,0x00,0x01,0x0a,0x00,0x00,0x11,0x01,0x02,0x29,0x00,0x00,0x0a,0x00,0x02,0x01,
+  0x07,0x05,0x01,0x01,0x09,0x00,0x00,0x12,0x00,0x02,0x07,0x00,0x00,0x06,0x05,0x01,0x15,0x01,0x00,0x09,
+  0x01,0x02,0x01,0x07,0x06,0x00,0x01,0x09,0x00,0x00,0x12,0x01,0x02,0x07,0x00,0x00,0x0b,0x01,0x01,0x14,
+  0x00,0x00,0x09,0x01,0x02,0x01,0x07,0x06,0x00,0x01,0x09,0x01,0x00,0x12,0x00,0x02,0x08,0x00,0x00,0x0c,
+  0x00,0x01,0x13,0x00,0x00,0x0a,0x00,0x02,0x01,0x07,0x06,0x00,0x01,0x0a,0x00,0x00,0x13,0x00,0x02,0x0c,
+  0x00,0x00,0x08,0x00,0x01,0x12,0x01,0x00,0x09,0x00,0x02,0x01,0x07,0x06,0x01,0x01,0x09,0x00,0x00,0x14,
+  0x01,0x02,0x0b,0x00,0x00,0x07,0x01,0x01,0x12,0x00,0x00,0x09,0x00,0x02,0x01,0x07,0x06,0x01,0x01,0x09,
+  0x01,0x00,0x15,0x05,0x02,0x06,0x00,0x00,0x07,0x00,0x01,0x12,0x00,0x00,0x09,0x01,0x02,0x01,0x05,0x07,
+  0x00,0x01,0x0a,0x00,0x00,0x29,0x01,0x01,0x11,0x00,0x00,0x0a,0x00,0x02,0x01,0x05,0x07,0x00,0x01,0x0a,
+  0x23,0x00,0x07,0x00,0x01,0x11,0x00,0x00,0x0a,0x00,0x02,0x01,0x05,0x08,0x00,0x01,0x0a,0x22,0x00,0x07,
+  0x00,0x01,0x11,0x01,0x00,0x09,0x00,0x02,0x01,0x00,0x01,0x05,0x08,0x01,0x01,0x0a,0x21,0x00,0x07,0x00,
+  0x01,0x12,0x00,0x00,0x09,0x00,0x02,0x01,0x05,0x09,0x00,0x01,0x0b,0x20,0x00,0x07,0x00,0x01,0x12,0x00,
+  0x00,0x09,0x00,0x02,0x01,0x05,0x09,0x01,0x01,0x0b,0x1e,0x00,0x08,0x00,0x01,0x12,0x00,0x00,0x09,0x00,
+  0x02,0x01,0x05,0x0a,0x00,0x01,0x0b,0x1e,0x00,0x08,0x00,0x01,0x12,0x00,0x00,0x09,0x00,0x02,0x01,0x04,
+  0x0a,0x01,0x01,0x0b,0x1d,0x00,0x08,0x00,0x01,0x12,0x00,0x00,0x01,0x04,0x0b,0x01,0x01,0x0b,0x1b,0x00,
+  0x09,0x00,0x01,0x11,0x01,0x00,0x01,0x04,0x0c,0x00,0x01,0x0d,0x18,0x00,0x09,0x01,0x01,0x11,0x01,0x00,
+  0x01,0x04,0x0c,0x01,0x01,0x0d,0x16,0x00,0x0a,0x00,0x01,0x12,0x00,0x00,0x01,0x04,0x0d,0x01,0x01,0x0e,
+  0x13,0x00,0x0b,0x00,0x01,0x12,0x00,0x00,0x01,0x04,0x0e,0x01,0x01,0x0e,0x10,0x00,0x0c,0x00,0x01,0x13,
+  0x00,0x00,0x01,0x04,0x0f,0x01,0x01,0x10,0x0b,0x00,0x0d,0x01,0x01,0x13,0x00,0x00,0x01,0x02,0x10,0x2a,
+  0x01,0x13,0x01,0x00,0x01,0x02,0x11,0x28,0x01,0x14,0x00,0x00,0x01,0x02,0x12,0x27,0x01,0x14,0x00,0x00,
+  0x01,0x02,0x13,0x25,0x01,0x14,0x01,0x00,0x01,0x02,0x15,0x21,0x01,0x16,0x00,0x00,0x01,0x02,0x16,0x1f,
+  0x01,0x16,0x01,0x00,0x01,0x02,0x18,0x1c,0x01,0x17,0x00,0x00,0x01,0x02,0x1a,0x18,0x01,0x18,0x01,0x00,
+  0x01,0x02,0x1c,0x14,0x01,0x1a,0x00,0x00,0x01,0x02,0x1f,0x0e,0x01,0x1c,0x01,0x00,0x01,0x01,0x4a,0x00,
+  0x00,0x01,0x01,0x49,0x00,0x00,0x01,0x01,0x48,0x01,0x00,0x01,0x01,0x47,0x01,0x00,0x01,0x01,0x47,0x00,
+  0x00,0x01,0x01,0x46,0x00,0x00,0x01,0x01,0x45,0x00,0x00,0x01,0x01,0x44,0x00,0x00,0x01,0x01,0x42,0x01,
+  0x00,0x01,0x01,0x41,0x01,0x00,0x01,0x01,0x40,0x01,0x00,0x01,0x01,0x3e,0x02,0x00,0x01,0x01,0x3d,0x01,
+  0x00,0x01,0x01,0x3b,0x02,0x00,0x01,0x01,0x39,0x01,0x00,0x00,0x01,0x07,0x01,0x21,0x00,0x00,0x01,0x01,
+  0x1f,0x01,0x00,0x01,0x01,0x1d,0x01,0x00,0x01,0x01,0x1c,0x01,0x00,0x01,0x01,0x1b,0x01,0x00,0x01,0x01,
+  0x1a,0x01,0x00,0x01,0x01,0x19,0x01,0x00,0x01,0x01,0x18,0x01,0x00,0x01,0x01,0x17,0x01,0x00,0x01,0x01,
+  0x16,0x01,0x00,0x01,0x01,0x15,0x01,0x00,0x01,0x01,0x15,0x00,0x00,0x01,0x02,0x14,0x01,0x00,0x20,0x05,
+  0x02,0x01,0x02,0x13,0x01,0x00,0x1c,0x10,0x02,0x01,0x02,0x13,0x00,0x00,0x1a,0x16,0x02,0x01,0x02,0x12,
+  0x01,0x00,0x18,0x1a,0x02,0x01,0x02,0x12,0x00,0x00,0x18,0x1d,0x02,0x01,0x02,0x11,0x01,0x00,0x16,0x21,
+  0x02,0x01,0x02,0x11,0x00,0x00,0x16,0x23,0x02,0x01,0x02,0x10,0x01,0x00,0x15,0x25,0x02,0x01,0x02,0x10,
+  0x00,0x00,0x15,0x28,0x02,0x01,0x02,0x10,0x00,0x00,0x14,0x2a,0x02,0x01,0x04,0x0f,0x01,0x00,0x13,0x01,
+  0x02,0x11,0x03,0x00,0x14,0x01,0x02,0x01,0x04,0x0f,0x00,0x00,0x14,0x00,0x02,0x0d,0x0d,0x00,0x10,0x01,
+  0x02,0x01,0x04,0x0f,0x00,0x00,0x13,0x00,0x02,0x0c,0x11,0x00,0x0f,0x01,0x02,0x01,0x04,0x0f,0x00,0x00,
+  0x12,0x01,0x02,0x0b,0x14,0x00,0x0e,0x01,0x02,0x01,0x04,0x0e,0x01,0x00,0x12,0x00,0x02,0x0a,0x18,0x00,
+  0x0d,0x00,0x02,0x01,0x04,0x0e,0x01,0x00,0x12,0x00,0x02,0x09,0x1a,0x00,0x0d,0x00,0x02,0x01,0x04,0x0e,
+  0x00,0x00,0x12,0x00,0x02,0x09,0x1c,0x00,0x0c,0x01,0x02,0x01,0x04,0x0e,0x00,0x00,0x12,0x00,0x02,0x09,
+  0x1d,0x00,0x0c,0x00,0x02,0x01,0x04,0x0e,0x00,0x00,0x12,0x00,0x02,0x08,0x1f,0x00,0x0c,0x00,0x02,0x01,
+  0x04,0x0e,0x00,0x00,0x12,0x00,0x02,0x08,0x20,0x00,0x0b,0x01,0x02,0x01,0x04,0x0e,0x00,0x00,0x12,0x00,
+  0x02,0x07,0x22,0x00,0x0b,0x00,0x02,0x01,0x04,0x0e,0x00,0x00,0x12,0x00,0x02,0x07,0x23,0x00,0x0a,0x01,
+  0x02,0x01,0x04,0x0e,0x00,0x00,0x12,0x00,0x02,0x07,0x23,0x00,0x0b,0x00,0x02,0x01,0x05,0x04,0x00,0x01,
+  0x09,0x00,0x00,0x12,0x00,0x02,0x07,0x24,0x00,0x0a,0x00,0x02,0x01,0x05,0x04,0x00,0x01,0x09,0x00,0x00,
+  0x12,0x00,0x02,0x07,0x24,0x00,0x0a,0x01,0x02,0x01,0x05,0x04,0x00,0x01,0x09,0x01,0x00,0x11,0x00,0x02,
+  0x07,0x25,0x00,0x0a,0x00,0x02,0x01,0x07,0x04,0x00,0x01,0x09,0x01,0x00,0x11,0x00,0x02,0x08,0x00,0x00,
+  0x08,0x04,0x01,0x16,0x00,0x00,0x0a,0x00,0x02,0x01,0x07,0x04,0x00,0x01,0x0a,0x00,0x00,0x12,0x00,0x02,
+  0x07,0x00,0x00,0x0d,0x01,0x01,0x15,0x00,0x00,0x0a,0x00,0x02,0x01,0x07,0x04,0x01,0x01,0x09,0x00,0x00,
+  0x12,0x00,0x02,0x08,0x00,0x00,0x0e,0x00,0x01,0x14,0x00,0x00,0x0a,0x00,0x02,0x01,0x06,0x04,0x01,0x01,
+  0x09,0x00,0x00,0x13,0x00,0x02,0x17,0x00,0x01,0x13,0x01,0x00,0x09,0x00,0x02,0x01,0x06,0x05,0x00,0x01,
+  0x09,0x01,0x00,0x13,0x00,0x02,0x17,0x00,0x01,0x13,0x00,0x00,0x09,0x01,0x02,0x01,0x07,0x05,0x00,0x01,
+  0x0a,0x00,0x00,0x14,0x00,0x02,0x0e,0x00,0x00,0x08,0x00,0x01,0x12,0x00,0x00,0x09,0x01,0x02,0x01,0x07,
+  0x05,0x00,0x01,0x0a,0x00,0x00,0x15,0x01,0x02,0x0d,0x00,0x00,0x07,0x00,0x01,0x12,0x00,0x00,0x0a,0x00,
+  0x02,0x01,0x07,0x06,0x00,0x01,0x0a,0x00,0x00,0x16,0x04,0x02,0x08,0x00,0x00,0x08,0x00,0x01,0x11,0x01,
+  0x00,0x09,0x00,0x02,0x01,0x05,0x06,0x00,0x01,0x0a,0x25,0x00,0x07,0x00,0x01,0x11,0x01,0x00,0x09,0x00,
+  0x02,0x01,0x05,0x06,0x01,0x01,0x0a,0x24,0x00,0x07,0x00,0x01,0x12,0x00,0x00,0x09,0x00,0x02,0x01,0x05,
+  0x07,0x00,0x01,0x0a,0x24,0x00,0x07,0x00,0x01,0x12,0x00,0x00,0x09,0x00,0x02,0x01,0x04,0x07,0x00,0x01,
+  0x0b,0x23,0x00,0x07,0x00,0x01,0x12,0x00,0x00,0x01,0x04,0x07,0x01,0x01,0x0a,0x23,0x00,0x07,0x00,0x01,
+  0x12,0x00,0x00,0x01,0x04,0x08,0x00,0x01,0x0b,0x22,0x00,0x07,0x00,0x01,0x12,0x00,0x00,0x01,0x04,0x08,
+  0x01,0x01,0x0b,0x20,0x00,0x08,0x00,0x01,0x12,0x00,0x00,0x01,0x04,0x09,0x00,0x01,0x0c,0x1f,0x00,0x08,
+  0x00,0x01,0x12,0x00,0x00,0x01,0x04,0x0a,0x00,0x01,0x0c,0x1d,0x00,0x09,0x00,0x01,0x12,0x00,0x00,0x01,
+  0x04,0x0a,0x01,0x01,0x0c,0x1c,0x00,0x09,0x00,0x01,0x12,0x00,0x00,0x01,0x04,0x0b,0x00,0x01,0x0d,0x1a,
+  0x00,0x09,0x00,0x01,0x12,0x01,0x00,0x01,0x04,0x0c,0x00,0x01,0x0d,0x18,0x00,0x0a,0x00,0x01,0x12,0x01,
+  0x00,0x01,0x04,0x0c,0x01,0x01,0x0e,0x14,0x00,0x0b,0x01,0x01,0x12,0x00,0x00,0x01,0x04,0x0d,0x01,0x01,
+  0x0f,0x11,0x00,0x0c,0x00,0x01,0x13,0x00,0x00,0x01,0x04,0x0e,0x01,0x01,0x10,0x0d,0x00,0x0d,0x00,0x01,
+  0x14,0x00,0x00,0x01,0x04,0x0f,0x01,0x01,0x14,0x03,0x00,0x11,0x01,0x01,0x13,0x01,0x00,0x01,0x02,0x10,
+  0x2a,0x01,0x14,0x00,0x00,0x01,0x02,0x11,0x28,0x01,0x15,0x00,0x00,0x01,0x02,0x13,0x25,0x01,0x15,0x01,
+  0x00,0x01,0x02,0x14,0x23,0x01,0x16,0x00,0x00,0x01,0x02,0x15,0x21,0x01,0x16,0x01,0x00,0x01,0x02,0x17,
+  0x1d,0x01,0x18,0x00,0x00,0x01,0x02,0x19,0x1a,0x01,0x18,0x01,0x00,0x01,0x02,0x1b,0x16,0x01,0x1a,0x00,
+  0x00,0x01,0x02,0x1e,0x10,0x01,0x1c,0x01,0x00,0x01,0x02,0x24,0x05,0x01,0x20,0x01,0x00,0x01,0x01,0x4a,
+  0x00,0x00,0x01,0x01,0x49,0x01,0x00,0x01,0x01,0x48,0x01,0x00,0x01,0x01,0x47,0x01,0x00,0x01,0x01,0x46,
+  0x01,0x00,0x01,0x01,0x45,0x01,0x00,0x01,0x01,0x44,0x01,0x00,0x01,0x01,0x43,0x01,0x00,0x01,0x01,0x42,
+  0x01,0x00,0x01,0x01,0x41,0x01,0x00,0x01,0x01,0x3f,0x01,0x00,0x01,0x01,0x3e,0x00,0x00,0x00,0x01,0x0a,
+  0x01,0x1b,0x00,0x00,0x01,0x01,0x19,0x01,0x00,0x01,0x01,0x18,0x01,0x00,0x01,0x01,0x17,0x01,0x00,0x01,
+  0x01,0x16,0x01,0x00,0x01,0x01,0x15,0x01,0x00,0x01,0x01,0x15,0x00,0x00,0x01,0x01,0x14,0x00,0x00,0x01,
+  0x02,0x13,0x01,0x00,0x20,0x08,0x02,0x01,0x02,0x13,0x00,0x00,0x1c,0x12,0x02,0x01,0x02,0x12,0x00,0x00,
+  0x1b,0x16,0x02,0x01,0x02,0x11,0x01,0x00,0x19,0x1b,0x02,0x01,0x02,0x11,0x00,0x00,0x18,0x1f,0x02,0x01,
+  0x02,0x10,0x01,0x00,0x16,0x22,0x02,0x01,0x02,0x10,0x00,0x00,0x16,0x25,0x02,0x01,0x02,0x10,0x00,0x00,
+  0x15,0x27,0x02,0x01,0x02,0x0f,0x00,0x00,0x15,0x29,0x02,0x01,0x02,0x0f,0x00,0x00,0x14,0x2c,0x02,0x01,
+  0x04,0x0e,0x01,0x00,0x13,0x01,0x02,0x11,0x05,0x00,0x14,0x01,0x02,0x01,0x04,0x0e,0x00,0x00,0x14,0x00,
+  0x02,0x0e,0x0d,0x00,0x11,0x01,0x02,0x01,0x04,0x0e,0x00,0x00,0x13,0x01,0x02,0x0c,0x12,0x00,0x0f,0x01,
+  0x02,0x01,0x04,0x0e,0x00,0x00,0x13,0x00,0x02,0x0b,0x16,0x00,0x0e,0x00,0x02,0x01,0x04,0x0d,0x01,0x00,
+  0x12,0x00,0x02,0x0b,0x18,0x00,0x0e,0x00,0x02,0x01,0x04,0x0d,0x00,0x00,0x13,0x00,0x02,0x0a,0x1b,0x00,
+  0x0c,0x01,0x02,0x01,0x04,0x0d,0x00,0x00,0x12,0x01,0x02,0x09,0x1d,0x00,0x0c,0x01,0x02,0x01,0x04,0x0d,
+  0x00,0x00,0x12,0x00,0x02,0x09,0x1f,0x00,0x0c,0x00,0x02,0x01,0x04,0x0d,0x00,0x00,0x12,0x00,0x02,0x09,
+  0x20,0x00,0x0b,0x01,0x02,0x01,0x04,0x0d,0x00,0x00,0x12,0x00,0x02,0x08,0x22,0x00,0x0b,0x00,0x02,0x01,
+  0x04,0x0d,0x00,0x00,0x11,0x01,0x02,0x08,0x23,0x00,0x0b,0x00,0x02,0x01,0x04,0x0d,0x00,0x00,0x11,0x01,
+  0x02,0x07,0x24,0x00,0x0b,0x00,0x02,0x01,0x04,0x0d,0x00,0x00,0x11,0x01,0x02,0x07,0x25,0x00,0x0b,0x00,
+  0x02,0x01,0x04,0x0d,0x00,0x00,0x11,0x01,0x02,0x07,0x26,0x00,0x0a,0x00,0x02,0x01,0x04,0x0d,0x00,0x00,
+  0x12,0x00,0x02,0x07,0x26,0x00,0x0a,0x01,0x02,0x01,0x04,0x0d,0x00,0x00,0x12,0x00,0x02,0x07,0x27,0x00,
+  0x0a,0x00,0x02,0x01,0x05,0x0d,0x00,0x00,0x12,0x00,0x02,0x13,0x03,0x01,0x17,0x00,0x00,0x0a,0x00,0x02,
+  0x01,0x06,0x0d,0x00,0x00,0x12,0x00,0x02,0x08,0x00,0x00,0x08,0x07,0x01,0x15,0x01,0x00,0x09,0x01,0x02,
+  0x01,0x05,0x0d,0x01,0x00,0x12,0x00,0x02,0x0f,0x0a,0x01,0x14,0x00,0x00,0x0a,0x00,0x02,0x01,0x06,0x0e,
+  0x00,0x00,0x12,0x00,0x02,0x08,0x00,0x00,0x05,0x0c,0x01,0x13,0x01,0x00,0x09,0x00,0x02,0x01,0x06,0x0e,
+  0x00,0x00,0x13,0x00,0x02,0x09,0x00,0x00,0x0f,0x01,0x01,0x13,0x00,0x00,0x09,0x00,0x02,0x01,0x06,0x04,
+  0x00,0x01,0x09,0x00,0x00,0x13,0x01,0x02,0x0f,0x00,0x00,0x09,0x00,0x01,0x13,0x00,0x00,0x01,0x06,0x04,
+  0x00,0x01,0x09,0x01,0x00,0x13,0x0c,0x02,0x05,0x00,0x00,0x08,0x00,0x01,0x12,0x00,0x00,0x01,0x05,0x04,
+  0x00,0x01,0x0a,0x00,0x00,0x14,0x0a,0x02,0x0f,0x00,0x01,0x12,0x01,0x00,0x01,0x06,0x04,0x01,0x01,0x09,
+  0x01,0x00,0x15,0x07,0x02,0x08,0x00,0x00,0x08,0x00,0x01,0x12,0x00,0x00,0x01,0x05,0x05,0x00,0x01,0x0a,
+  0x00,0x00,0x17,0x03,0x02,0x13,0x00,0x01,0x12,0x00,0x00,0x01,0x04,0x05,0x00,0x01,0x0a,0x27,0x00,0x07,
+  0x00,0x01,0x12,0x00,0x00,0x01,0x04,0x05,0x01,0x01,0x0a,0x26,0x00,0x07,0x00,0x01,0x12,0x00,0x00,0x01,
+  0x04,0x06,0x00,0x01,0x0a,0x26,0x00,0x07,0x01,0x01,0x11,0x00,0x00,0x01,0x04,0x06,0x00,0x01,0x0b,0x25,
+  0x00,0x07,0x01,0x01,0x11,0x00,0x00,0x01,0x04,0x07,0x00,0x01,0x0b,0x24,0x00,0x07,0x01,0x01,0x11,0x00,
+  0x00,0x01,0x04,0x07,0x00,0x01,0x0b,0x23,0x00,0x08,0x01,0x01,0x11,0x00,0x00,0x01,0x04,0x08,0x00,0x01,
+  0x0b,0x22,0x00,0x08,0x00,0x01,0x12,0x00,0x00,0x01,0x04,0x08,0x01,0x01,0x0b,0x20,0x00,0x09,0x00,0x01,
+  0x12,0x00,0x00,0x01,0x04,0x09,0x00,0x01,0x0c,0x1f,0x00,0x09,0x00,0x01,0x12,0x00,0x00,0x01,0x04,0x09,
+  0x01,0x01,0x0c,0x1d,0x00,0x09,0x01,0x01,0x12,0x00,0x00,0x01,0x04,0x0a,0x01,0x01,0x0c,0x1b,0x00,0x0a,
+  0x00,0x01,0x13,0x00,0x00,0x01,0x04,0x0b,0x00,0x01,0x0e,0x18,0x00,0x0b,0x00,0x01,0x12,0x01,0x00,0x01,
+  0x04,0x0c,0x00,0x01,0x0e,0x16,0x00,0x0b,0x00,0x01,0x13,0x00,0x00,0x01,0x04,0x0c,0x01,0x01,0x0f,0x12,
+  0x00,0x0c,0x01,0x01,0x13,0x00,0x00,0x01,0x04,0x0d,0x01,0x01,0x11,0x0d,0x00,0x0e,0x00,0x01,0x14,0x00,
+  0x00,0x01,0x04,0x0e,0x01,0x01,0x14,0x05,0x00,0x11,0x01,0x01,0x13,0x01,0x00,0x01,0x02,0x0f,0x2c,0x01,
+  0x14,0x00,0x00,0x01,0x02,0x11,0x29,0x01,0x15,0x00,0x00,0x01,0x02,0x12,0x27,0x01,0x15,0x00,0x00,0x01,
+  0x02,0x13,0x25,0x01,0x16,0x00,0x00,0x01,0x02,0x15,0x22,0x01,0x16,0x01,0x00,0x01,0x02,0x16,0x1f,0x01,
+  0x18,0x00,0x00,0x01,0x02,0x18,0x1b,0x01,0x19,0x01,0x00,0x01,0x02,0x1b,0x16,0x01,0x1b,0x00,0x00,0x01,
+  0x02,0x1d,0x12,0x01,0x1c,0x00,0x00,0x01,0x02,0x22,0x08,0x01,0x20,0x01,0x00,0x01,0x01,0x4b,0x00,0x00,
+  0x01,0x01,0x4a,0x00,0x00,0x01,0x01,0x49,0x01,0x00,0x01,0x01,0x48,0x01,0x00,0x01,0x01,0x47,0x01,0x00,
+  0x01,0x01,0x46,0x01,0x00,0x01,0x01,0x45,0x01,0x00,0x01,0x01,0x44,0x00,0x00,0x00,0x01,0x0c,0x01,0x17,
+  0x00,0x00,0x01,0x01,0x16,0x00,0x00,0x01,0x01,0x15,0x00,0x00,0x01,0x01,0x14,0x00,0x00,0x01,0x01,0x13,
+  0x01,0x00,0x01,0x02,0x12,0x01,0x00,0x1f,0x0c,0x02,0x01,0x02,0x12,0x00,0x00,0x1c,0x14,0x02,0x01,0x02,
+  0x11,0x01,0x00,0x1a,0x18,0x02,0x01,0x02,0x11,0x00,0x00,0x19,0x1d,0x02,0x01,0x02,0x10,0x00,0x00,0x18,
+  0x20,0x02,0x01,0x02,0x0f,0x01,0x00,0x17,0x23,0x02,0x01,0x02,0x0f,0x00,0x00,0x17,0x26,0x02,0x01,0x02,
+  0x0f,0x00,0x00,0x15,0x29,0x02,0x01,0x02,0x0e,0x01,0x00,0x14,0x2b,0x02,0x01,0x02,0x0e,0x00,0x00,0x15,
+  0x2c,0x02,0x01,0x04,0x0d,0x01,0x00,0x14,0x00,0x02,0x11,0x08,0x00,0x13,0x00,0x02,0x01,0x04,0x0d,0x00,
+  0x00,0x14,0x00,0x02,0x0e,0x0f,0x00,0x11,0x00,0x02,0x01,0x04,0x0d,0x00,0x00,0x13,0x01,0x02,0x0c,0x14,
+  0x00,0x0f,0x00,0x02,0x01,0x04,0x0d,0x00,0x00,0x13,0x00,0x02,0x0c,0x16,0x00,0x0f,0x00,0x02,0x01,0x04,
+  0x0c,0x01,0x00,0x12,0x01,0x02,0x0a,0x1a,0x00,0x0d,0x01,0x02,0x01,0x04,0x0c,0x00,0x00,0x13,0x00,0x02,
+  0x0a,0x1c,0x00,0x0d,0x01,0x02,0x01,0x04,0x0c,0x00,0x00,0x12,0x01,0x02,0x09,0x1f,0x00,0x0c,0x00,0x02,
+  0x01,0x04,0x0c,0x00,0x00,0x12,0x00,0x02,0x0a,0x20,0x00,0x0c,0x00,0x02,0x01,0x04,0x0c,0x00,0x00,0x12,
+  0x00,0x02,0x09,0x22,0x00,0x0b,0x01,0x02,0x01,0x04,0x0c,0x00,0x00,0x12,0x00,0x02,0x08,0x24,0x00,0x0b,
+  0x00,0x02,0x01,0x04,0x0c,0x00,0x00,0x11,0x01,0x02,0x08,0x24,0x00,0x0b,0x01,0x02,0x01,0x04,0x0b,0x01,
+  0x00,0x11,0x00,0x02,0x09,0x25,0x00,0x0b,0x00,0x02,0x01,0x04,0x0b,0x01,0x00,0x11,0x00,0x02,0x08,0x27,
+  0x00,0x0a,0x01,0x02,0x01,0x04,0x0b,0x01,0x00,0x11,0x00,0x02,0x08,0x28,0x00,0x0a,0x00,0x02,0x01,0x04,
+  0x0c,0x00,0x00,0x11,0x00,0x02,0x08,0x28,0x00,0x0a,0x00,0x02,0x01,0x04,0x0c,0x00,0x00,0x11,0x01,0x02,
+  0x07,0x29,0x00,0x0a,0x00,0x02,0x01,0x04,0x0c,0x00,0x00,0x12,0x00,0x02,0x07,0x29,0x00,0x0a,0x00,0x02,
+  0x01,0x06,0x0c,0x00,0x00,0x12,0x00,0x02,0x08,0x00,0x00,0x0a,0x06,0x01,0x16,0x01,0x00,0x09,0x00,0x02,
+  0x01,0x05,0x0c,0x00,0x00,0x12,0x00,0x02,0x08,0x00,0x00,0x08,0x0a,0x01,0x15,0x00,0x00,0x01,0x05,0x0c,
+  0x00,0x00,0x12,0x01,0x02,0x08,0x00,0x00,0x12,0x00,0x01,0x14,0x00,0x00,0x01,0x05,0x0c,0x01,0x00,0x12,
+  0x00,0x02,0x08,0x00,0x00,0x13,0x00,0x01,0x14,0x00,0x00,0x01,0x06,0x0d,0x00,0x00,0x12,0x01,0x02,0x09,
+  0x00,0x00,0x06,0x00,0x00,0x0b,0x00,0x01,0x13,0x00,0x00,0x01,0x06,0x0d,0x00,0x00,0x13,0x00,0x02,0x0b,
+  0x00,0x00,0x06,0x00,0x00,0x09,0x01,0x01,0x12,0x00,0x00,0x01,0x05,0x0d,0x00,0x00,0x14,0x00,0x02,0x13,
+  0x00,0x00,0x08,0x00,0x01,0x12,0x01,0x00,0x01,0x05,0x0e,0x00,0x00,0x14,0x00,0x02,0x12,0x00,0x00,0x08,
+  0x01,0x01,0x12,0x00,0x00,0x01,0x05,0x0e,0x00,0x00,0x15,0x0a,0x02,0x08,0x00,0x00,0x08,0x00,0x01,0x12,
+  0x00,0x00,0x01,0x06,0x04,0x00,0x01,0x09,0x01,0x00,0x16,0x06,0x02,0x0a,0x00,0x00,0x08,0x00,0x01,0x12,
+  0x00,0x00,0x01,0x04,0x04,0x00,0x01,0x0a,0x29,0x00,0x07,0x00,0x01,0x12,0x00,0x00,0x01,0x04,0x04,0x00,
+  0x01,0x0a,0x29,0x00,0x07,0x01,0x01,0x11,0x00,0x00,0x01,0x04,0x05,0x00,0x01,0x0a,0x28,0x00,0x08,0x00,
+  0x01,0x11,0x00,0x00,0x01,0x04,0x05,0x00,0x01,0x0a,0x28,0x00,0x08,0x00,0x01,0x11,0x01,0x00,0x01,0x04,
+  0x05,0x01,0x01,0x0a,0x27,0x00,0x08,0x00,0x01,0x11,0x01,0x00,0x01,0x04,0x06,0x00,0x01,0x0b,0x25,0x00,
+  0x09,0x00,0x01,0x11,0x01,0x00,0x01,0x04,0x06,0x01,0x01,0x0b,0x24,0x00,0x08,0x01,0x01,0x11,0x00,0x00,
+  0x01,0x04,0x07,0x00,0x01,0x0b,0x24,0x00,0x08,0x00,0x01,0x12,0x00,0x00,0x01,0x04,0x07,0x01,0x01,0x0b,
+  0x22,0x00,0x09,0x00,0x01,0x12,0x00,0x00,0x01,0x04,0x08,0x00,0x01,0x0c,0x20,0x00,0x0a,0x00,0x01,0x12,
+  0x00,0x00,0x01,0x04,0x09,0x00,0x01,0x0c,0x1f,0x00,0x09,0x01,0x01,0x12,0x00,0x00,0x01,0x04,0x09,0x01,
+  0x01,0x0d,0x1c,0x00,0x0a,0x00,0x01,0x13,0x00,0x00,0x01,0x04,0x0a,0x01,0x01,0x0d,0x1a,0x00,0x0a,0x01,
+  0x01,0x12,0x01,0x00,0x01,0x04,0x0b,0x00,0x01,0x0f,0x16,0x00,0x0c,0x00,0x01,0x13,0x00,0x00,0x01,0x04,
+  0x0c,0x00,0x01,0x0f,0x14,0x00,0x0c,0x01,0x01,0x13,0x00,0x00,0x01,0x04,0x0d,0x00,0x01,0x11,0x0f,0x00,
+  0x0e,0x00,0x01,0x14,0x00,0x00,0x01,0x04,0x0e,0x00,0x01,0x13,0x08,0x00,0x11,0x00,0x01,0x14,0x01,0x00,
+  0x01,0x02,0x0f,0x2c,0x01,0x15,0x00,0x00,0x01,0x02,0x10,0x2b,0x01,0x14,0x01,0x00,0x01,0x02,0x11,0x29,
+  0x01,0x15,0x00,0x00,0x01,0x02,0x12,0x26,0x01,0x17,0x00,0x00,0x01,0x02,0x14,0x23,0x01,0x17,0x01,0x00,
+  0x01,0x02,0x16,0x20,0x01,0x18,0x00,0x00,0x01,0x02,0x17,0x1d,0x01,0x19,0x00,0x00,0x01,0x02,0x1a,0x18,
+  0x01,0x1a,0x01,0x00,0x01,0x02,0x1c,0x14,0x01,0x1c,0x00,0x00,0x01,0x02,0x20,0x0c,0x01,0x1f,0x01,0x00,
+  0x01,0x01,0x4b,0x01,0x00,0x01,0x01,0x4b,0x00,0x00,0x01,0x01,0x4a,0x00,0x00,0x01,0x01,0x49,0x00,0x00,
+  0x01,0x01,0x48,0x00,0x00,0x00,0x01,0x0f,0x01,0x13,0x00,0x00,0x01,0x02,0x12,0x00,0x00,0x1f,0x0e,0x02,
+  0x01,0x02,0x11,0x00,0x00,0x1d,0x14,0x02,0x01,0x02,0x10,0x01,0x00,0x1a,0x1a,0x02,0x01,0x02,0x10,0x00,
+  0x00,0x19,0x1e,0x02,0x01,0x02,0x0f,0x01,0x00,0x18,0x21,0x02,0x01,0x02,0x0f,0x00,0x00,0x17,0x25,0x02,
+  0x01,0x02,0x0e,0x00,0x00,0x17,0x27,0x02,0x01,0x02,0x0e,0x00,0x00,0x16,0x2a,0x02,0x01,0x02,0x0d,0x01,
+  0x00,0x15,0x2c,0x02,0x01,0x02,0x0d,0x00,0x00,0x15,0x2e,0x02,0x01,0x04,0x0c,0x01,0x00,0x14,0x01,0x02,
+  0x10,0x0a,0x00,0x12,0x01,0x02,0x01,0x04,0x0c,0x00,0x00,0x14,0x01,0x02,0x0e,0x10,0x00,0x10,0x01,0x02,
+  0x01,0x04,0x0c,0x00,0x00,0x14,0x00,0x02,0x0d,0x14,0x00,0x0f,0x01,0x02,0x01,0x04,0x0c,0x00,0x00,0x13,
+  0x00,0x02,0x0c,0x18,0x00,0x0e,0x01,0x02,0x01,0x04,0x0b,0x01,0x00,0x12,0x01,0x02,0x0b,0x1b,0x00,0x0d,
+  0x01,0x02,0x01,0x04,0x0b,0x00,0x00,0x13,0x00,0x02,0x0b,0x1d,0x00,0x0d,0x01,0x02,0x01,0x04,0x0b,0x00,
+  0x00,0x13,0x00,0x02,0x0a,0x1f,0x00,0x0d,0x00,0x02,0x01,0x04,0x0b,0x00,0x00,0x12,0x00,0x02,0x0a,0x21,
+  0x00,0x0c,0x01,0x02,0x01,0x04,0x0b,0x00,0x00,0x12,0x00,0x02,0x09,0x23,0x00,0x0c,0x01,0x02,0x01,0x04,
+  0x0a,0x01,0x00,0x12,0x00,0x02,0x09,0x24,0x00,0x0c,0x00,0x02,0x01,0x04,0x0a,0x01,0x00,0x11,0x01,0x02,
+  0x08,0x26,0x00,0x0b,0x00,0x02,0x01,0x03,0x0a,0x01,0x00,0x11,0x00,0x02,0x09,0x27,0x00,0x01,0x04,0x0a,
+  0x00,0x00,0x12,0x00,0x02,0x09,0x28,0x00,0x0a,0x00,0x02,0x01,0x03,0x0a,0x00,0x00,0x12,0x00,0x02,0x08,
+  0x29,0x00,0x01,0x03,0x0a,0x00,0x00,0x12,0x00,0x02,0x08,0x2a,0x00,0x01,0x03,0x0a,0x01,0x00,0x11,0x00,
+  0x02,0x08,0x2b,0x00,0x01,0x00,0x01,0x05,0x0a,0x01,0x00,0x11,0x01,0x02,0x07,0x00,0x00,0x0c,0x07,0x01,
+  0x16,0x01,0x00,0x01,0x05,0x0b,0x00,0x00,0x12,0x00,0x02,0x08,0x00,0x00,0x0a,0x09,0x01,0x16,0x00,0x00,
+  0x01,0x05,0x0b,0x00,0x00,0x12,0x00,0x02,0x08,0x00,0x00,0x14,0x01,0x01,0x14,0x00,0x00,0x01,0x05,0x0b,
+  0x00,0x00,0x12,0x00,0x02,0x09,0x00,0x00,0x07,0x0e,0x01,0x13,0x01,0x00,0x01,0x05,0x0b,0x00,0x00,0x13,
+  0x00,0x02,0x08,0x00,0x00,0x15,0x01,0x01,0x13,0x00,0x00,0x01,0x06,0x0b,0x01,0x00,0x12,0x00,0x02,0x09,
+  0x01,0x00,0x06,0x03,0x00,0x0a,0x00,0x01,0x13,0x00,0x00,0x01,0x06,0x0c,0x00,0x00,0x13,0x00,0x02,0x0a,
+  0x03,0x00,0x06,0x01,0x00,0x09,0x00,0x01,0x12,0x01,0x00,0x01,0x05,0x0c,0x00,0x00,0x13,0x01,0x02,0x15,
+  0x00,0x00,0x08,0x00,0x01,0x13,0x00,0x00,0x01,0x05,0x0c,0x01,0x00,0x13,0x0e,0x02,0x07,0x00,0x00,0x09,
+  0x00,0x01,0x12,0x00,0x00,0x01,0x05,0x0d,0x00,0x00,0x14,0x01,0x02,0x14,0x00,0x00,0x08,0x00,0x01,0x12,
+  0x00,0x00,0x01,0x05,0x0d,0x00,0x00,0x16,0x09,0x02,0x0a,0x00,0x00,0x08,0x00,0x01,0x12,0x00,0x00,0x01,
+  0x05,0x0d,0x01,0x00,0x16,0x07,0x02,0x0c,0x00,0x00,0x07,0x01,0x01,0x11,0x01,0x00,0x01,0x03,0x0e,0x2b,
+  0x00,0x08,0x00,0x01,0x11,0x01,0x00,0x01,0x00,0x01,0x03,0x0f,0x2a,0x00,0x08,0x00,0x01,0x12,0x00,0x00,
+  0x01,0x03,0x10,0x29,0x00,0x08,0x00,0x01,0x12,0x00,0x00,0x01,0x04,0x05,0x00,0x01,0x0a,0x28,0x00,0x09,
+  0x00,0x01,0x12,0x00,0x00,0x01,0x03,0x11,0x27,0x00,0x09,0x00,0x01,0x11,0x01,0x00,0x01,0x04,0x06,0x00,
+  0x01,0x0b,0x26,0x00,0x08,0x01,0x01,0x11,0x01,0x00,0x01,0x04,0x06,0x00,0x01,0x0c,0x24,0x00,0x09,0x00,
+  0x01,0x12,0x01,0x00,0x01,0x04,0x06,0x01,0x01,0x0c,0x23,0x00,0x09,0x00,0x01,0x12,0x00,0x00,0x01,0x04,
+  0x07,0x01,0x01,0x0c,0x21,0x00,0x0a,0x00,0x01,0x12,0x00,0x00,0x01,0x04,0x08,0x00,0x01,0x0d,0x1f,0x00,
+  0x0a,0x00,0x01,0x13,0x00,0x00,0x01,0x04,0x08,0x01,0x01,0x0d,0x1d,0x00,0x0b,0x00,0x01,0x13,0x00,0x00,
+  0x01,0x04,0x09,0x01,0x01,0x0d,0x1b,0x00,0x0b,0x01,0x01,0x12,0x01,0x00,0x01,0x04,0x0a,0x01,0x01,0x0e,
+  0x18,0x00,0x0c,0x00,0x01,0x13,0x00,0x00,0x01,0x04,0x0b,0x01,0x01,0x0f,0x14,0x00,0x0d,0x00,0x01,0x14,
+  0x00,0x00,0x01,0x04,0x0c,0x01,0x01,0x10,0x10,0x00,0x0e,0x01,0x01,0x14,0x00,0x00,0x01,0x04,0x0d,0x01,
+  0x01,0x12,0x0a,0x00,0x10,0x01,0x01,0x14,0x01,0x00,0x01,0x02,0x0e,0x2e,0x01,0x15,0x00,0x00,0x01,0x02,
+  0x0f,0x2c,0x01,0x15,0x01,0x00,0x01,0x02,0x10,0x2a,0x01,0x16,0x00,0x00,0x01,0x02,0x12,0x27,0x01,0x17,
+  0x00,0x00,0x01,0x02,0x13,0x25,0x01,0x17,0x00,0x00,0x01,0x02,0x15,0x21,0x01,0x18,0x01,0x00,0x01,0x02,
+  0x17,0x1e,0x01,0x19,0x00,0x00,0x01,0x02,0x19,0x1a,0x01,0x1a,0x01,0x00,0x01,0x02,0x1c,0x14,0x01,0x1d,
+  0x00,0x00,0x01,0x02,0x1f,0x0e,0x01,0x1f,0x00,0x00,0x01,0x01,0x4c,0x00,0x00,0x00,0x01,0x0e,0x01,0x37,
+  0x03,0x02,0x01,0x01,0x31,0x10,0x02,0x01,0x01,0x2e,0x16,0x02,0x01,0x01,0x2b,0x1c,0x02,0x01,0x01,0x2a,
+  0x1f,0x02,0x01,0x02,0x0f,0x00,0x00,0x18,0x23,0x02,0x01,0x02,0x0e,0x00,0x00,0x17,0x27,0x02,0x01,0x02,
+  0x0e,0x00,0x00,0x16,0x29,0x02,0x01,0x02,0x0d,0x00,0x00,0x16,0x2b,0x02,0x01,0x02,0x0c,0x01,0x00,0x15,
+  0x2e,0x02,0x01,0x02,0x0c,0x00,0x00,0x15,0x30,0x02,0x01,0x04,0x0c,0x00,0x00,0x14,0x01,0x02,0x10,0x0c,
+  0x00,0x12,0x01,0x02,0x01,0x04,0x0b,0x00,0x00,0x14,0x01,0x02,0x0e,0x12,0x00,0x10,0x01,0x02,0x01,0x04,
+  0x0b,0x00,0x00,0x14,0x00,0x02,0x0d,0x16,0x00,0x0f,0x01,0x02,0x01,0x04,0x0b,0x00,0x00,0x13,0x01,0x02,
+  0x0b,0x1a,0x00,0x0e,0x01,0x02,0x01,0x04,0x0a,0x01,0x00,0x13,0x00,0x02,0x0b,0x1c,0x00,0x0e,0x00,0x02,
+  0x01,0x04,0x0a,0x00,0x00,0x13,0x00,0x02,0x0b,0x1f,0x00,0x0d,0x00,0x02,0x01,0x03,0x0a,0x00,0x00,0x13,
+  0x00,0x02,0x0a,0x21,0x00,0x01,0x04,0x0a,0x00,0x00,0x12,0x01,0x02,0x09,0x23,0x00,0x0c,0x00,0x02,0x01,
+  0x03,0x09,0x01,0x00,0x12,0x00,0x02,0x0a,0x24,0x00,0x01,0x03,0x09,0x01,0x00,0x12,0x00,0x02,0x09,0x26,
+  0x00,0x01,0x03,0x09,0x00,0x00,0x12,0x01,0x02,0x09,0x27,0x00,0x01,0x03,0x09,0x00,0x00,0x12,0x00,0x02,
+  0x09,0x29,0x00,0x01,0x03,0x09,0x00,0x00,0x12,0x00,0x02,0x09,0x2a,0x00,0x01,0x00,0x01,0x03,0x09,0x00,
+  0x00,0x12,0x00,0x02,0x08,0x2c,0x00,0x01,0x00,0x01,0x03,0x09,0x00,0x00,0x12,0x00,0x02,0x08,0x2d,0x00,
+  0x01,0x05,0x09,0x00,0x00,0x12,0x00,0x02,0x08,0x00,0x00,0x0e,0x06,0x01,0x17,0x00,0x00,0x01,0x05,0x09,
+  0x00,0x00,0x12,0x00,0x02,0x08,0x00,0x00,0x0c,0x0a,0x01,0x16,0x00,0x00,0x01,0x05,0x09,0x01,0x00,0x11,
+  0x01,0x02,0x08,0x00,0x00,0x0a,0x0c,0x01,0x15,0x00,0x00,0x01,0x05,0x09,0x01,0x00,0x12,0x00,0x02,0x08,
+  0x00,0x00,0x09,0x0e,0x01,0x14,0x01,0x00,0x01,0x05,0x0a,0x00,0x00,0x12,0x00,0x02,0x09,0x00,0x00,0x17,
+  0x00,0x01,0x14,0x00,0x00,0x01,0x05,0x0a,0x00,0x00,0x12,0x01,0x02,0x08,0x00,0x00,0x18,0x00,0x01,0x13,
+  0x00,0x00,0x01,0x06,0x0a,0x00,0x00,0x13,0x00,0x02,0x09,0x00,0x00,0x0c,0x00,0x00,0x0a,0x01,0x01,0x12,
+  0x01,0x00,0x01,0x06,0x0a,0x01,0x00,0x12,0x01,0x02,0x0a,0x00,0x00,0x0c,0x00,0x00,0x09,0x00,0x01,0x13,
+  0x00,0x00,0x01,0x05,0x0b,0x00,0x00,0x13,0x00,0x02,0x18,0x00,0x00,0x08,0x01,0x01,0x12,0x00,0x00,0x01,
+  0x05,0x0b,0x00,0x00,0x14,0x00,0x02,0x17,0x00,0x00,0x09,0x00,0x01,0x12,0x00,0x00,0x01,0x05,0x0b,0x01,
+  0x00,0x14,0x0e,0x02,0x09,0x00,0x00,0x08,0x00,0x01,0x12,0x01,0x00,0x01,0x05,0x0c,0x00,0x00,0x15,0x0c,
+  0x02,0x0a,0x00,0x00,0x08,0x01,0x01,0x11,0x01,0x00,0x01,0x05,0x0c,0x00,0x00,0x16,0x0a,0x02,0x0c,0x00,
+  0x00,0x08,0x00,0x01,0x12,0x00,0x00,0x01,0x05,0x0d,0x00,0x00,0x17,0x06,0x02,0x0e,0x00,0x00,0x08,0x00,
+  0x01,0x12,0x00,0x00,0x01,0x03,0x0d,0x2d,0x00,0x08,0x00,0x01,0x12,0x00,0x00,0x01,0x03,0x0e,0x2c,0x00,
+  0x08,0x00,0x01,0x12,0x00,0x00,0x01,0x00,0x01,0x03,0x0f,0x2a,0x00,0x09,0x00,0x01,0x12,0x00,0x00,0x01,
+  0x00,0x01,0x03,0x10,0x29,0x00,0x09,0x00,0x01,0x12,0x00,0x00,0x01,0x03,0x11,0x27,0x00,0x09,0x01,0x01,
+  0x12,0x00,0x00,0x01,0x03,0x12,0x26,0x00,0x09,0x00,0x01,0x12,0x01,0x00,0x01,0x03,0x13,0x24,0x00,0x0a,
+  0x00,0x01,0x12,0x01,0x00,0x01,0x04,0x07,0x00,0x01,0x0c,0x23,0x00,0x09,0x01,0x01,0x12,0x00,0x00,0x01,
+  0x03,0x15,0x21,0x00,0x0a,0x00,0x01,0x13,0x00,0x00,0x01,0x04,0x08,0x00,0x01,0x0d,0x1f,0x00,0x0b,0x00,
+  0x01,0x13,0x00,0x00,0x01,0x04,0x09,0x00,0x01,0x0e,0x1c,0x00,0x0b,0x00,0x01,0x13,0x01,0x00,0x01,0x04,
+  0x09,0x01,0x01,0x0e,0x1a,0x00,0x0b,0x01,0x01,0x13,0x00,0x00,0x01,0x04,0x0a,0x01,0x01,0x0f,0x16,0x00,
+  0x0d,0x00,0x01,0x14,0x00,0x00,0x01,0x04,0x0b,0x01,0x01,0x10,0x12,0x00,0x0e,0x01,0x01,0x14,0x00,0x00,
+  0x01,0x04,0x0c,0x01,0x01,0x12,0x0c,0x00,0x10,0x01,0x01,0x14,0x00,0x00,0x01,0x02,0x0d,0x30,0x01,0x15,
+  0x00,0x00,0x01,0x02,0x0e,0x2e,0x01,0x15,0x01,0x00,0x01,0x02,0x10,0x2b,0x01,0x16,0x00,0x00,0x01,0x02,
+  0x11,0x29,0x01,0x16,0x00,0x00,0x01,0x02,0x12,0x27,0x01,0x17,0x00,0x00,0x01,0x02,0x14,0x23,0x01,0x18,
+  0x00,0x00,0x01,0x01,0x16,0x1f,0x01,0x01,0x01,0x18,0x1c,0x01,0x01,0x01,0x1b,0x16,0x01,0x01,0x01,0x1e,
+  0x10,0x01,0x01,0x01,0x25,0x03,0x01,0x00,0x01,0x0d,0x01,0x35,0x08,0x02,0x01,0x01,0x30,0x12,0x02,0x01,
+  0x01,0x2d,0x18,0x02,0x01,0x01,0x2b,0x1d,0x02,0x01,0x01,0x29,0x21,0x02,0x01,0x01,0x27,0x25,0x02,0x01,
+  0x01,0x26,0x27,0x02,0x01,0x01,0x24,0x2b,0x02,0x01,0x01,0x23,0x2d,0x02,0x01,0x01,0x22,0x2f,0x02,0x01,
+  0x03,0x21,0x01,0x02,0x15,0x02,0x00,0x17,0x01,0x02,0x01,0x04,0x0b,0x00,0x00,0x14,0x01,0x02,0x10,0x0e,
+  0x00,0x12,0x01,0x02,0x01,0x04,0x0b,0x00,0x00,0x14,0x00,0x02,0x0e,0x13,0x00,0x11,0x00,0x02,0x01,0x04,
+  0x0a,0x00,0x00,0x14,0x00,0x02,0x0d,0x18,0x00,0x0f,0x00,0x02,0x01,0x03,0x0a,0x00,0x00,0x13,0x01,0x02,
+  0x0c,0x1b,0x00,0x01,0x03,0x09,0x01,0x00,0x13,0x00,0x02,0x0c,0x1d,0x00,0x01,0x03,0x09,0x00,0x00,0x13,
+  0x01,0x02,0x0a,0x21,0x00,0x01,0x03,0x09,0x00,0x00,0x13,0x00,0x02,0x0a,0x23,0x00,0x01,0x03,0x09,0x00,
+  0x00,0x12,0x01,0x02,0x0a,0x24,0x00,0x01,0x03,0x08,0x01,0x00,0x12,0x00,0x02,0x0a,0x26,0x00,0x01,0x03,
+  0x08,0x00,0x00,0x13,0x00,0x02,0x09,0x28,0x00,0x01,0x03,0x08,0x00,0x00,0x12,0x01,0x02,0x09,0x29,0x00,
+  0x01,0x03,0x08,0x00,0x00,0x12,0x00,0x02,0x09,0x2b,0x00,0x01,0x00,0x01,0x03,0x08,0x00,0x00,0x12,0x00,
+  0x02,0x09,0x2c,0x00,0x01,0x03,0x08,0x00,0x00,0x12,0x00,0x02,0x08,0x2e,0x00,0x01,0x00,0x01,0x03,0x08,
+  0x00,0x00,0x12,0x00,0x02,0x08,0x2f,0x00,0x01,0x05,0x08,0x00,0x00,0x12,0x00,0x02,0x08,0x00,0x00,0x0f,
+  0x06,0x01,0x18,0x00,0x00,0x01,0x05,0x08,0x00,0x00,0x12,0x00,0x02,0x08,0x00,0x00,0x0d,0x0a,0x01,0x16,
+  0x01,0x00,0x01,0x05,0x08,0x00,0x00,0x12,0x00,0x02,0x08,0x00,0x00,0x0c,0x0d,0x01,0x15,0x00,0x00,0x01,
+  0x05,0x08,0x00,0x00,0x12,0x00,0x02,0x09,0x00,0x00,0x0a,0x0f,0x01,0x14,0x01,0x00,0x01,0x05,0x08,0x00,
+  0x00,0x12,0x01,0x02,0x08,0x00,0x00,0x19,0x01,0x01,0x14,0x00,0x00,0x01,0x05,0x08,0x01,0x00,0x12,0x00,
+  0x02,0x09,0x00,0x00,0x19,0x01,0x01,0x13,0x00,0x00,0x01,0x06,0x09,0x00,0x00,0x12,0x00,0x02,0x09,0x00,
+  0x00,0x0b,0x03,0x00,0x0b,0x00,0x01,0x13,0x01,0x00,0x01,0x05,0x09,0x00,0x00,0x13,0x00,0x02,0x09,0x10,
+  0x00,0x0a,0x00,0x01,0x13,0x00,0x00,0x01,0x05,0x09,0x00,0x00,0x13,0x00,0x02,0x0a,0x10,0x00,0x09,0x00,
+  0x01,0x13,0x00,0x00,0x01,0x06,0x09,0x01,0x00,0x13,0x00,0x02,0x0b,0x03,0x00,0x0b,0x00,0x00,0x09,0x00,
+  0x01,0x12,0x00,0x00,0x01,0x05,0x0a,0x00,0x00,0x13,0x01,0x02,0x19,0x00,0x00,0x09,0x00,0x01,0x12,0x01,
+  0x00,0x01,0x05,0x0a,0x00,0x00,0x14,0x01,0x02,0x19,0x00,0x00,0x08,0x01,0x01,0x12,0x00,0x00,0x01,0x05,
+  0x0a,0x01,0x00,0x14,0x0f,0x02,0x0a,0x00,0x00,0x09,0x00,0x01,0x12,0x00,0x00,0x01,0x05,0x0b,0x00,0x00,
+  0x15,0x0d,0x02,0x0c,0x00,0x00,0x08,0x00,0x01,0x12,0x00,0x00,0x01,0x05,0x0b,0x01,0x00,0x16,0x0a,0x02,
+  0x0d,0x00,0x00,0x08,0x00,0x01,0x12,0x00,0x00,0x01,0x05,0x0c,0x00,0x00,0x18,0x06,0x02,0x0f,0x00,0x00,
+  0x08,0x00,0x01,0x12,0x00,0x00,0x01,0x03,0x0c,0x2f,0x00,0x08,0x00,0x01,0x12,0x00,0x00,0x01,0x03,0x0d,
+  0x2e,0x00,0x08,0x00,0x01,0x12,0x00,0x00,0x01,0x00,0x01,0x03,0x0e,0x2c,0x00,0x09,0x00,0x01,0x12,0x00,
+  0x00,0x01,0x03,0x0f,0x2b,0x00,0x09,0x00,0x01,0x12,0x00,0x00,0x01,0x00,0x01,0x03,0x10,0x29,0x00,0x09,
+  0x01,0x01,0x12,0x00,0x00,0x01,0x03,0x11,0x28,0x00,0x09,0x00,0x01,0x13,0x00,0x00,0x01,0x03,0x12,0x26,
+  0x00,0x0a,0x00,0x01,0x12,0x01,0x00,0x01,0x03,0x13,0x24,0x00,0x0a,0x01,0x01,0x12,0x00,0x00,0x01,0x03,
+  0x14,0x23,0x00,0x0a,0x00,0x01,0x13,0x00,0x00,0x01,0x03,0x15,0x21,0x00,0x0a,0x01,0x01,0x13,0x00,0x00,
+  0x01,0x03,0x17,0x1d,0x00,0x0c,0x00,0x01,0x13,0x01,0x00,0x01,0x03,0x18,0x1b,0x00,0x0c,0x01,0x01,0x13,
+  0x00,0x00,0x01,0x04,0x0a,0x00,0x01,0x0f,0x18,0x00,0x0d,0x00,0x01,0x14,0x00,0x00,0x01,0x04,0x0b,0x00,
+  0x01,0x11,0x13,0x00,0x0e,0x00,0x01,0x14,0x00,0x00,0x01,0x04,0x0b,0x01,0x01,0x12,0x0e,0x00,0x10,0x01,
+  0x01,0x14,0x00,0x00,0x01,0x03,0x0c,0x01,0x01,0x17,0x02,0x00,0x15,0x01,0x01,0x01,0x01,0x0e,0x2f,0x01,
+  0x01,0x01,0x0f,0x2d,0x01,0x01,0x01,0x10,0x2b,0x01,0x01,0x01,0x12,0x27,0x01,0x01,0x01,0x13,0x25,0x01,
+  0x01,0x01,0x15,0x21,0x01,0x01,0x01,0x17,0x1d,0x01,0x01,0x01,0x1a,0x18,0x01,0x01,0x01,0x1d,0x12,0x01,
+  0x01,0x01,0x22,0x08,0x01,0x00,0x01,0x0c,0x01,0x33,0x0c,0x02,0x01,0x01,0x2f,0x14,0x02,0x01,0x01,0x2c,
+  0x1a,0x02,0x01,0x01,0x2a,0x1f,0x02,0x01,0x01,0x28,0x23,0x02,0x01,0x01,0x26,0x26,0x02,0x01,0x01,0x25,
+  0x29,0x02,0x01,0x01,0x24,0x2c,0x02,0x01,0x01,0x23,0x2e,0x02,0x01,0x01,0x22,0x2f,0x02,0x01,0x03,0x21,
+  0x00,0x02,0x14,0x06,0x00,0x15,0x00,0x02,0x01,0x02,0x20,0x00,0x02,0x10,0x0f,0x00,0x01,0x02,0x1f,0x00,
+  0x02,0x0f,0x14,0x00,0x01,0x02,0x1e,0x01,0x02,0x0d,0x18,0x00,0x01,0x02,0x1e,0x00,0x02,0x0c,0x1c,0x00,
+  0x01,0x02,0x1d,0x00,0x02,0x0c,0x1f,0x00,0x01,0x02,0x1c,0x01,0x02,0x0b,0x21,0x00,0x01,0x02,0x1c,0x00,
+  0x02,0x0b,0x23,0x00,0x01,0x03,0x08,0x00,0x00,0x13,0x00,0x02,0x0a,0x26,0x00,0x01,0x03,0x08,0x00,0x00,
+  0x12,0x00,0x02,0x0a,0x28,0x00,0x01,0x03,0x07,0x00,0x00,0x13,0x00,0x02,0x0a,0x29,0x00,0x01,0x03,0x07,
+  0x00,0x00,0x12,0x01,0x02,0x09,0x2b,0x00,0x01,0x03,0x07,0x00,0x00,0x12,0x00,0x02,0x0a,0x2b,0x00,0x01,
+  0x03,0x07,0x00,0x00,0x12,0x00,0x02,0x09,0x2d,0x00,0x01,0x03,0x07,0x00,0x00,0x12,0x00,0x02,0x09,0x2e,
+  0x00,0x01,0x03,0x07,0x00,0x00,0x12,0x00,0x02,0x09,0x2f,0x00,0x01,0x03,0x07,0x00,0x00,0x12,0x00,0x02,
+  0x08,0x30,0x00,0x01,0x03,0x06,0x01,0x00,0x12,0x00,0x02,0x08,0x31,0x00,0x01,0x05,0x07,0x00,0x00,0x12,
+  0x00,0x02,0x08,0x00,0x00,0x10,0x06,0x01,0x19,0x00,0x00,0x01,0x05,0x07,0x00,0x00,0x12,0x00,0x02,0x08,
+  0x00,0x00,0x0e,0x0b,0x01,0x16,0x01,0x00,0x01,0x05,0x07,0x00,0x00,0x12,0x00,0x02,0x08,0x00,0x00,0x0d,
+  0x0d,0x01,0x16,0x00,0x00,0x01,0x05,0x07,0x00,0x00,0x12,0x00,0x02,0x08,0x00,0x00,0x0c,0x0f,0x01,0x15,
+  0x01,0x00,0x01,0x05,0x07,0x00,0x00,0x12,0x00,0x02,0x09,0x00,0x00,0x1b,0x00,0x01,0x15,0x00,0x00,0x01,
+  0x05,0x07,0x00,0x00,0x12,0x00,0x02,0x09,0x00,0x00,0x0a,0x12,0x01,0x14,0x00,0x00,0x01,0x05,0x07,0x00,
+  0x00,0x13,0x00,0x02,0x08,0x01,0x00,0x09,0x13,0x01,0x13,0x01,0x00,0x01,0x07,0x07,0x01,0x00,0x12,0x00,
+  0x02,0x09,0x00,0x00,0x09,0x00,0x01,0x06,0x01,0x00,0x0a,0x01,0x01,0x13,0x00,0x00,0x01,0x05,0x08,0x00,
+  0x00,0x12,0x01,0x02,0x09,0x12,0x00,0x0a,0x00,0x01,0x13,0x00,0x00,0x01,0x05,0x08,0x00,0x00,0x13,0x00,
+  0x02,0x0a,0x12,0x00,0x09,0x01,0x01,0x12,0x00,0x00,0x01,0x07,0x08,0x00,0x00,0x13,0x01,0x02,0x0a,0x01,
+  0x00,0x06,0x00,0x02,0x09,0x00,0x00,0x09,0x00,0x01,0x12,0x01,0x00,0x01,0x05,0x08,0x01,0x00,0x13,0x13,
+  0x02,0x09,0x01,0x00,0x08,0x00,0x01,0x13,0x00,0x00,0x01,0x05,0x09,0x00,0x00,0x14,0x12,0x02,0x0a,0x00,
+  0x00,0x09,0x00,0x01,0x12,0x00,0x00,0x01,0x05,0x09,0x00,0x00,0x15,0x00,0x02,0x1b,0x00,0x00,0x09,0x00,
+  0x01,0x12,0x00,0x00,0x01,0x05,0x09,0x01,0x00,0x15,0x0f,0x02,0x0c,0x00,0x00,0x08,0x00,0x01,0x12,0x00,
+  0x00,0x01,0x05,0x0a,0x00,0x00,0x16,0x0d,0x02,0x0d,0x00,0x00,0x08,0x00,0x01,0x12,0x00,0x00,0x01,0x05,
+  0x0a,0x01,0x00,0x16,0x0b,0x02,0x0e,0x00,0x00,0x08,0x00,0x01,0x12,0x00,0x00,0x01,0x05,0x0b,0x00,0x00,
+  0x19,0x06,0x02,0x10,0x00,0x00,0x08,0x00,0x01,0x12,0x00,0x00,0x01,0x03,0x0b,0x31,0x00,0x08,0x00,0x01,
+  0x12,0x01,0x00,0x01,0x03,0x0c,0x30,0x00,0x08,0x00,0x01,0x12,0x00,0x00,0x01,0x03,0x0c,0x2f,0x00,0x09,
+  0x00,0x01,0x12,0x00,0x00,0x01,0x03,0x0d,0x2e,0x00,0x09,0x00,0x01,0x12,0x00,0x00,0x01,0x03,0x0e,0x2d,
+  0x00,0x09,0x00,0x01,0x12,0x00,0x00,0x01,0x03,0x0f,0x2b,0x00,0x0a,0x00,0x01,0x12,0x00,0x00,0x01,0x03,
+  0x0f,0x2b,0x00,0x09,0x01,0x01,0x12,0x00,0x00,0x01,0x03,0x10,0x29,0x00,0x0a,0x00,0x01,0x13,0x00,0x00,
+  0x01,0x03,0x11,0x28,0x00,0x0a,0x00,0x01,0x12,0x00,0x00,0x01,0x03,0x12,0x26,0x00,0x0a,0x00,0x01,0x13,
+  0x00,0x00,0x01,0x02,0x14,0x23,0x00,0x0b,0x00,0x01,0x01,0x02,0x15,0x21,0x00,0x0b,0x01,0x01,0x01,0x02,
+  0x16,0x1f,0x00,0x0c,0x00,0x01,0x01,0x02,0x18,0x1c,0x00,0x0c,0x00,0x01,0x01,0x02,0x1a,0x18,0x00,0x0d,
+  0x01,0x01,0x01,0x02,0x1c,0x14,0x00,0x0f,0x00,0x01,0x01,0x02,0x1f,0x0f,0x00,0x10,0x00,0x01,0x01,0x03,
+  0x0d,0x00,0x01,0x15,0x06,0x00,0x14,0x00,0x01,0x01,0x01,0x0e,0x2f,0x01,0x01,0x01,0x0e,0x2e,0x01,0x01,
+  0x01,0x0f,0x2c,0x01,0x01,0x01,0x11,0x29,0x01,0x01,0x01,0x13,0x26,0x01,0x01,0x01,0x14,0x23,0x01,0x01,
+  0x01,0x16,0x1f,0x01,0x01,0x01,0x19,0x1a,0x01,0x01,0x01,0x1c,0x14,0x01,0x01,0x01,0x20,0x0c,0x01,0x00,
+  0x01,0x0b,0x01,0x32,0x0e,0x02,0x01,0x01,0x2e,0x16,0x02,0x01,0x01,0x2b,0x1c,0x02,0x01,0x01,0x29,0x20,
+  0x02,0x01,0x01,0x27,0x24,0x02,0x01,0x01,0x26,0x27,0x02,0x01,0x01,0x24,0x2a,0x02,0x01,0x01,0x23,0x2c,
+  0x02,0x01,0x01,0x22,0x01,0x02,0x01,0x01,0x21,0x01,0x02,0x01,0x02,0x20,0x01,0x02,0x12,0x09,0x00,0x01,
+  0x02,0x1f,0x01,0x02,0x0f,0x11,0x00,0x01,0x02,0x1e,0x01,0x02,0x0e,0x16,0x00,0x01,0x02,0x1d,0x01,0x02,
+  0x0d,0x1a,0x00,0x01,0x02,0x1d,0x00,0x02,0x0d,0x1d,0x00,0x01,0x02,0x1c,0x01,0x02,0x0b,0x21,0x00,0x01,
+  0x02,0x1c,0x00,0x02,0x0b,0x23,0x00,0x01,0x02,0x1b,0x00,0x02,0x0b,0x25,0x00,0x01,0x02,0x1b,0x00,0x02,
+  0x0a,0x27,0x00,0x01,0x02,0x1a,0x01,0x02,0x09,0x29,0x00,0x01,0x02,0x1a,0x00,0x02,0x0a,0x2a,0x00,0x01,
+  0x02,0x1a,0x00,0x02,0x09,0x2c,0x00,0x01,0x02,0x19,0x00,0x02,0x0a,0x2d,0x00,0x01,0x03,0x06,0x00,0x00,
+  0x12,0x00,0x02,0x09,0x2f,0x00,0x01,0x03,0x06,0x00,0x00,0x12,0x00,0x02,0x09,0x30,0x00,0x01,0x00,0x01,
+  0x03,0x06,0x00,0x00,0x11,0x01,0x02,0x08,0x32,0x00,0x01,0x03,0x05,0x01,0x00,0x11,0x01,0x02,0x08,0x33,
+  0x00,0x01,0x05,0x05,0x00,0x00,0x12,0x01,0x02,0x08,0x00,0x00,0x11,0x07,0x01,0x19,0x00,0x00,0x01,0x05,
+  0x05,0x01,0x00,0x11,0x01,0x02,0x08,0x00,0x00,0x0f,0x0b,0x01,0x17,0x01,0x00,0x01,0x05,0x05,0x01,0x00,
+  0x11,0x01,0x02,0x08,0x00,0x00,0x0e,0x0e,0x01,0x16,0x00,0x00,0x01,0x05,0x05,0x01,0x00,0x12,0x00,0x02,
+  0x08,0x00,0x00,0x0d,0x10,0x01,0x15,0x01,0x00,0x01,0x05,0x05,0x01,0x00,0x12,0x00,0x02,0x08,0x00,0x00,
+  0x1d,0x01,0x01,0x15,0x00,0x00,0x01,0x05,0x06,0x00,0x00,0x12,0x00,0x02,0x09,0x00,0x00,0x0b,0x13,0x01,
+  0x14,0x00,0x00,0x01,0x05,0x06,0x00,0x00,0x12,0x00,0x02,0x09,0x00,0x00,0x1e,0x01,0x01,0x13,0x01,0x00,
+  0x01,0x06,0x06,0x00,0x00,0x12,0x01,0x02,0x08,0x00,0x00,0x0f,0x03,0x00,0x0c,0x00,0x01,0x14,0x00,0x00,
+  0x01,0x06,0x06,0x00,0x00,0x13,0x00,0x02,0x09,0x00,0x00,0x0c,0x07,0x00,0x0b,0x00,0x01,0x13,0x00,0x00,
+  0x01,0x05,0x06,0x01,0x00,0x12,0x00,0x02,0x0a,0x15,0x00,0x09,0x00,0x01,0x13,0x01,0x00,0x01,0x05,0x06,
+  0x01,0x00,0x13,0x00,0x02,0x09,0x15,0x00,0x0a,0x00,0x01,0x12,0x01,0x00,0x01,0x06,0x07,0x00,0x00,0x13,
+  0x00,0x02,0x0b,0x07,0x00,0x0c,0x00,0x00,0x09,0x00,0x01,0x13,0x00,0x00,0x01,0x06,0x07,0x00,0x00,0x14,
+  0x00,0x02,0x0c,0x03,0x00,0x0f,0x00,0x00,0x08,0x01,0x01,0x12,0x00,0x00,0x01,0x05,0x07,0x01,0x00,0x13,
+  0x01,0x02,0x1e,0x00,0x00,0x09,0x00,0x01,0x12,0x00,0x00,0x01,0x05,0x08,0x00,0x00,0x14,0x13,0x02,0x0b,
+  0x00,0x00,0x09,0x00,0x01,0x12,0x00,0x00,0x01,0x05,0x08,0x00,0x00,0x15,0x01,0x02,0x1d,0x00,0x00,0x08,
+  0x00,0x01,0x12,0x01,0x00,0x01,0x05,0x08,0x01,0x00,0x15,0x10,0x02,0x0d,0x00,0x00,0x08,0x00,0x01,0x12,
+  0x01,0x00,0x01,0x05,0x09,0x00,0x00,0x16,0x0e,0x02,0x0e,0x00,0x00,0x08,0x01,0x01,0x11,0x01,0x00,0x01,
+  0x05,0x09,0x01,0x00,0x17,0x0b,0x02,0x0f,0x00,0x00,0x08,0x01,0x01,0x11,0x01,0x00,0x01,0x05,0x0a,0x00,
+  0x00,0x19,0x07,0x02,0x11,0x00,0x00,0x08,0x01,0x01,0x12,0x00,0x00,0x01,0x03,0x0a,0x33,0x00,0x08,0x01,
+  0x01,0x11,0x01,0x00,0x01,0x03,0x0b,0x32,0x00,0x08,0x01,0x01,0x11,0x00,0x00,0x01,0x03,0x0c,0x30,0x00,
+  0x09,0x00,0x01,0x12,0x00,0x00,0x01,0x00,0x01,0x03,0x0d,0x2f,0x00,0x09,0x00,0x01,0x12,0x00,0x00,0x01,
+  0x02,0x0e,0x2d,0x00,0x0a,0x00,0x01,0x01,0x02,0x0f,0x2c,0x00,0x09,0x00,0x01,0x01,0x02,0x10,0x2a,0x00,
+  0x0a,0x00,0x01,0x01,0x02,0x11,0x29,0x00,0x09,0x01,0x01,0x01,0x02,0x12,0x27,0x00,0x0a,0x00,0x01,0x01,
+  0x02,0x13,0x25,0x00,0x0b,0x00,0x01,0x01,0x02,0x14,0x23,0x00,0x0b,0x00,0x01,0x01,0x02,0x15,0x21,0x00,
+  0x0b,0x01,0x01,0x01,0x02,0x17,0x1d,0x00,0x0d,0x00,0x01,0x01,0x02,0x19,0x1a,0x00,0x0d,0x01,0x01,0x01,
+  0x02,0x1b,0x16,0x00,0x0e,0x01,0x01,0x01,0x02,0x1e,0x11,0x00,0x0f,0x01,0x01,0x01,0x02,0x22,0x09,0x00,
+  0x12,0x01,0x01,0x01,0x01,0x3d,0x01,0x01,0x01,0x01,0x3c,0x01,0x01,0x01,0x01,0x10,0x2c,0x01,0x01,0x01,
+  0x11,0x2a,0x01,0x01,0x01,0x12,0x27,0x01,0x01,0x01,0x14,0x24,0x01,0x01,0x01,0x16,0x20,0x01,0x01,0x01,
+  0x18,0x1c,0x01,0x01,0x01,0x1b,0x16,0x01,0x01,0x01,0x1f,0x0e,0x01,0x00,0x01,0x09,0x01,0x39,0x00,0x02,
+  0x01,0x01,0x31,0x10,0x02,0x01,0x01,0x2d,0x18,0x02,0x01,0x01,0x2b,0x1d,0x02,0x01,0x01,0x28,0x21,0x02,
+  0x01,0x01,0x27,0x23,0x02,0x01,0x01,0x25,0x27,0x02,0x01,0x01,0x24,0x01,0x02,0x01,0x01,0x22,0x01,0x02,
+  0x01,0x01,0x21,0x01,0x02,0x01,0x01,0x20,0x01,0x02,0x01,0x02,0x1f,0x01,0x02,0x12,0x0c,0x00,0x01,0x02,
+  0x1e,0x01,0x02,0x10,0x12,0x00,0x01,0x02,0x1d,0x01,0x02,0x0e,0x18,0x00,0x01,0x02,0x1d,0x00,0x02,0x0d,
+  0x1c,0x00,0x01,0x02,0x1c,0x00,0x02,0x0d,0x1f,0x00,0x01,0x02,0x1b,0x01,0x02,0x0c,0x21,0x00,0x01,0x02,
+  0x1b,0x00,0x02,0x0b,0x25,0x00,0x01,0x02,0x1a,0x01,0x02,0x0a,0x27,0x00,0x01,0x02,0x1a,0x00,0x02,0x0b,
+  0x28,0x00,0x01,0x02,0x19,0x01,0x02,0x0a,0x2a,0x00,0x01,0x02,0x19,0x00,0x02,0x0a,0x2c,0x00,0x01,0x02,
+  0x19,0x00,0x02,0x09,0x2e,0x00,0x01,0x02,0x18,0x01,0x02,0x09,0x2f,0x00,0x01,0x02,0x18,0x00,0x02,0x09,
+  0x31,0x00,0x01,0x00,0x01,0x02,0x18,0x00,0x02,0x09,0x32,0x00,0x01,0x02,0x17,0x01,0x02,0x08,0x34,0x00,
+  0x01,0x02,0x17,0x00,0x02,0x09,0x34,0x00,0x01,0x04,0x17,0x00,0x02,0x09,0x00,0x00,0x12,0x07,0x01,0x1a,
+  0x00,0x00,0x01,0x04,0x17,0x00,0x02,0x09,0x00,0x00,0x10,0x0c,0x01,0x17,0x01,0x00,0x01,0x04,0x17,0x00,
+  0x02,0x09,0x00,0x00,0x0f,0x0e,0x01,0x17,0x00,0x00,0x01,0x04,0x17,0x00,0x02,0x09,0x00,0x00,0x0e,0x11,
+  0x01,0x15,0x00,0x00,0x01,0x05,0x04,0x00,0x00,0x12,0x01,0x02,0x08,0x00,0x00,0x0d,0x13,0x01,0x15,0x00,
+  0x00,0x01,0x05,0x04,0x00,0x00,0x12,0x01,0x02,0x08,0x00,0x00,0x0d,0x14,0x01,0x14,0x00,0x00,0x01,0x05,
+  0x04,0x01,0x00,0x12,0x00,0x02,0x08,0x01,0x00,0x20,0x00,0x01,0x14,0x01,0x00,0x01,0x06,0x04,0x01,0x00,
+  0x12,0x00,0x02,0x09,0x00,0x00,0x11,0x02,0x00,0x0d,0x00,0x01,0x14,0x00,0x00,0x01,0x06,0x05,0x00,0x00,
+  0x12,0x00,0x02,0x09,0x00,0x00,0x0f,0x06,0x00,0x0b,0x01,0x01,0x13,0x00,0x00,0x01,0x06,0x05,0x00,0x00,
+  0x12,0x01,0x02,0x09,0x00,0x00,0x15,0x01,0x00,0x0a,0x00,0x01,0x13,0x01,0x00,0x01,0x05,0x05,0x00,0x00,
+  0x13,0x00,0x02,0x09,0x18,0x00,0x09,0x01,0x01,0x13,0x00,0x00,0x01,0x05,0x05,0x00,0x00,0x13,0x01,0x02,
+  0x09,0x18,0x00,0x09,0x00,0x01,0x13,0x00,0x00,0x01,0x06,0x05,0x01,0x00,0x13,0x00,0x02,0x0a,0x01,0x00,
+  0x15,0x00,0x00,0x09,0x01,0x01,0x12,0x00,0x00,0x01,0x06,0x06,0x00,0x00,0x13,0x01,0x02,0x0b,0x06,0x00,
+  0x0f,0x00,0x00,0x09,0x00,0x01,0x12,0x00,0x00,0x01,0x06,0x06,0x00,0x00,0x14,0x00,0x02,0x0d,0x02,0x00,
+  0x11,0x00,0x00,0x09,0x00,0x01,0x12,0x01,0x00,0x01,0x05,0x06,0x01,0x00,0x14,0x00,0x02,0x20,0x01,0x00,
+  0x08,0x00,0x01,0x12,0x01,0x00,0x01,0x05,0x07,0x00,0x00,0x14,0x14,0x02,0x0d,0x00,0x00,0x08,0x01,0x01,
+  0x12,0x00,0x00,0x01,0x05,0x07,0x00,0x00,0x15,0x13,0x02,0x0d,0x00,0x00,0x08,0x01,0x01,0x12,0x00,0x00,
+  0x01,0x04,0x08,0x00,0x00,0x15,0x11,0x02,0x0e,0x00,0x00,0x09,0x00,0x01,0x01,0x04,0x08,0x00,0x00,0x17,
+  0x0e,0x02,0x0f,0x00,0x00,0x09,0x00,0x01,0x01,0x04,0x08,0x01,0x00,0x17,0x0c,0x02,0x10,0x00,0x00,0x09,
+  0x00,0x01,0x01,0x04,0x09,0x00,0x00,0x1a,0x07,0x02,0x12,0x00,0x00,0x09,0x00,0x01,0x01,0x02,0x0a,0x34,
+  0x00,0x09,0x00,0x01,0x01,0x02,0x0a,0x34,0x00,0x08,0x01,0x01,0x01,0x02,0x0b,0x32,0x00,0x09,0x00,0x01,
+  0x01,0x02,0x0c,0x31,0x00,0x09,0x00,0x01,0x01,0x00,0x01,0x02,0x0d,0x2f,0x00,0x09,0x01,0x01,0x01,0x02,
+  0x0e,0x2e,0x00,0x09,0x00,0x01,0x01,0x02,0x0f,0x2c,0x00,0x0a,0x00,0x01,0x01,0x02,0x10,0x2a,0x00,0x0a,
+  0x01,0x01,0x01,0x02,0x11,0x28,0x00,0x0b,0x00,0x01,0x01,0x02,0x12,0x27,0x00,0x0a,0x01,0x01,0x01,0x02,
+  0x13,0x25,0x00,0x0b,0x00,0x01,0x01,0x02,0x15,0x21,0x00,0x0c,0x01,0x01,0x01,0x02,0x16,0x1f,0x00,0x0d,
+  0x00,0x01,0x01,0x02,0x18,0x1c,0x00,0x0d,0x00,0x01,0x01,0x02,0x1a,0x18,0x00,0x0e,0x01,0x01,0x01,0x02,
+  0x1d,0x12,0x00,0x10,0x01,0x01,0x01,0x02,0x20,0x0c,0x00,0x12,0x01,0x01,0x01,0x01,0x3e,0x01,0x01,0x01,
+  0x01,0x3d,0x01,0x01,0x01,0x01,0x3c,0x01,0x01,0x01,0x01,0x3a,0x01,0x01,0x01,0x01,0x13,0x27,0x01,0x01,
+  0x01,0x15,0x23,0x01,0x01,0x01,0x16,0x21,0x01,0x01,0x01,0x17,0x1d,0x01,0x01,0x01,0x1a,0x18,0x01,0x01,
+  0x01,0x1e,0x10,0x01,0x01,0x01,0x26,0x00,0x01,0x00,0x01,0x08,0x01,0x35,0x08,0x02,0x01,0x01,0x30,0x12,
+  0x02,0x01,0x01,0x2c,0x18,0x02,0x01,0x01,0x2a,0x1c,0x02,0x01,0x01,0x28,0x02,0x02,0x01,0x01,0x26,0x01,
+  0x02,0x01,0x01,0x24,0x02,0x02,0x01,0x01,0x23,0x01,0x02,0x01,0x01,0x22,0x01,0x02,0x01,0x01,0x20,0x01,
+  0x02,0x01,0x01,0x1f,0x01,0x02,0x01,0x02,0x1e,0x01,0x02,0x12,0x0e,0x00,0x01,0x02,0x1d,0x01,0x02,0x10,
+  0x14,0x00,0x01,0x02,0x1d,0x00,0x02,0x0f,0x19,0x00,0x01,0x02,0x1c,0x00,0x02,0x0e,0x1d,0x00,0x01,0x02,
+  0x1b,0x01,0x02,0x0c,0x20,0x00,0x01,0x02,0x1b,0x00,0x02,0x0c,0x23,0x00,0x01,0x02,0x1a,0x00,0x02,0x0c,
+  0x25,0x00,0x01,0x02,0x19,0x01,0x02,0x0b,0x28,0x00,0x01,0x02,0x19,0x00,0x02,0x0b,0x2a,0x00,0x01,0x02,
+  0x18,0x01,0x02,0x0a,0x2c,0x00,0x01,0x02,0x18,0x00,0x02,0x0a,0x2e,0x00,0x01,0x02,0x18,0x00,0x02,0x0a,
+  0x2f,0x00,0x01,0x02,0x17,0x01,0x02,0x09,0x31,0x00,0x01,0x02,0x17,0x00,0x02,0x0a,0x32,0x00,0x01,0x02,
+  0x17,0x00,0x02,0x09,0x33,0x00,0x01,0x02,0x17,0x00,0x02,0x09,0x34,0x00,0x01,0x02,0x16,0x01,0x02,0x09,
+  0x35,0x00,0x01,0x02,0x16,0x00,0x02,0x09,0x36,0x00,0x01,0x04,0x16,0x00,0x02,0x09,0x00,0x00,0x13,0x08,
+  0x01,0x19,0x01,0x00,0x01,0x04,0x16,0x00,0x02,0x09,0x00,0x00,0x11,0x0c,0x01,0x18,0x00,0x00,0x01,0x04,
+  0x16,0x00,0x02,0x09,0x00,0x00,0x10,0x0f,0x01,0x17,0x00,0x00,0x01,0x04,0x16,0x00,0x02,0x09,0x00,0x00,
+  0x0f,0x11,0x01,0x16,0x00,0x00,0x01,0x04,0x16,0x00,0x02,0x09,0x00,0x00,0x0e,0x13,0x01,0x15,0x01,0x00,
+  0x01,0x04,0x16,0x00,0x02,0x09,0x00,0x00,0x0d,0x15,0x01,0x15,0x00,0x00,0x01,0x04,0x16,0x00,0x02,0x09,
+  0x00,0x00,0x0d,0x16,0x01,0x14,0x01,0x00,0x01,0x04,0x16,0x01,0x02,0x08,0x00,0x00,0x0d,0x17,0x01,0x14,
+  0x00,0x00,0x01,0x06,0x17,0x00,0x02,0x09,0x00,0x00,0x0c,0x00,0x01,0x04,0x05,0x00,0x0c,0x01,0x01,0x13,
+  0x00,0x00,0x01,0x07,0x04,0x00,0x00,0x12,0x00,0x02,0x09,0x00,0x00,0x0c,0x00,0x01,0x02,0x09,0x00,0x0b,
+  0x00,0x01,0x13,0x01,0x00,0x01,0x06,0x04,0x00,0x00,0x12,0x00,0x02,0x0a,0x00,0x00,0x18,0x00,0x00,0x0a,
+  0x01,0x01,0x13,0x00,0x00,0x01,0x07,0x04,0x00,0x00,0x13,0x00,0x02,0x09,0x00,0x00,0x0c,0x00,0x01,0x0c,
+  0x00,0x00,0x0a,0x00,0x01,0x13,0x00,0x00,0x01,0x07,0x04,0x00,0x00,0x13,0x00,0x02,0x0a,0x00,0x00,0x0c,
+  0x00,0x02,0x0c,0x00,0x00,0x09,0x00,0x01,0x13,0x00,0x00,0x01,0x06,0x04,0x00,0x00,0x13,0x01,0x02,0x0a,
+  0x00,0x00,0x18,0x00,0x00,0x0a,0x00,0x01,0x12,0x00,0x00,0x01,0x07,0x04,0x01,0x00,0x13,0x00,0x02,0x0b,
+  0x09,0x00,0x02,0x00,0x02,0x0c,0x00,0x00,0x09,0x00,0x01,0x12,0x00,0x00,0x01,0x06,0x05,0x00,0x00,0x13,
+  0x01,0x02,0x0c,0x05,0x00,0x04,0x00,0x02,0x0c,0x00,0x00,0x09,0x00,0x01,0x01,0x04,0x05,0x00,0x00,0x14,
+  0x17,0x02,0x0d,0x00,0x00,0x08,0x01,0x01,0x01,0x04,0x05,0x01,0x00,0x14,0x16,0x02,0x0d,0x00,0x00,0x09,
+  0x00,0x01,0x01,0x04,0x06,0x00,0x00,0x15,0x15,0x02,0x0d,0x00,0x00,0x09,0x00,0x01,0x01,0x04,0x06,0x01,
+  0x00,0x15,0x13,0x02,0x0e,0x00,0x00,0x09,0x00,0x01,0x01,0x04,0x07,0x00,0x00,0x16,0x11,0x02,0x0f,0x00,
+  0x00,0x09,0x00,0x01,0x01,0x04,0x07,0x00,0x00,0x17,0x0f,0x02,0x10,0x00,0x00,0x09,0x00,0x01,0x01,0x04,
+  0x08,0x00,0x00,0x18,0x0c,0x02,0x11,0x00,0x00,0x09,0x00,0x01,0x01,0x04,0x08,0x01,0x00,0x19,0x08,0x02,
+  0x13,0x00,0x00,0x09,0x00,0x01,0x01,0x02,0x09,0x36,0x00,0x09,0x00,0x01,0x01,0x02,0x09,0x35,0x00,0x09,
+  0x01,0x01,0x01,0x02,0x0a,0x34,0x00,0x09,0x00,0x01,0x01,0x02,0x0b,0x33,0x00,0x09,0x00,0x01,0x01,0x02,
+  0x0b,0x32,0x00,0x0a,0x00,0x01,0x01,0x02,0x0c,0x31,0x00,0x09,0x01,0x01,0x01,0x02,0x0d,0x2f,0x00,0x0a,
+  0x00,0x01,0x01,0x02,0x0e,0x2e,0x00,0x0a,0x00,0x01,0x01,0x02,0x0f,0x2c,0x00,0x0a,0x01,0x01,0x01,0x02,
+  0x10,0x2a,0x00,0x0b,0x00,0x01,0x01,0x02,0x11,0x28,0x00,0x0b,0x01,0x01,0x01,0x02,0x13,0x25,0x00,0x0c,
+  0x00,0x01,0x01,0x02,0x14,0x23,0x00,0x0c,0x00,0x01,0x01,0x02,0x16,0x20,0x00,0x0c,0x01,0x01,0x01,0x02,
+  0x17,0x1d,0x00,0x0e,0x00,0x01,0x01,0x02,0x19,0x19,0x00,0x0f,0x00,0x01,0x01,0x02,0x1c,0x14,0x00,0x10,
+  0x01,0x01,0x01,0x02,0x1f,0x0e,0x00,0x12,0x01,0x01,0x01,0x01,0x3f,0x01,0x01,0x01,0x01,0x3e,0x01,0x01,
+  0x01,0x01,0x3c,0x01,0x01,0x01,0x01,0x3b,0x01,0x01,0x01,0x01,0x39,0x02,0x01,0x01,0x01,0x38,0x01,0x01,
+  0x01,0x01,0x35,0x02,0x01,0x01,0x01,0x19,0x1c,0x01,0x01,0x01,0x1b,0x18,0x01,0x01,0x01,0x1d,0x12,0x01,
+  0x01,0x01,0x22,0x08,0x01,0x00,0x01,0x07,0x01,0x33,0x0b,0x02,0x01,0x01,0x2f,0x11,0x02,0x01,0x01,0x2b,
+  0x04,0x02,0x01,0x01,0x29,0x02,0x02,0x01,0x01,0x27,0x02,0x02,0x01,0x01,0x25,0x02,0x02,0x01,0x01,0x24,
+  0x01,0x02,0x01,0x01,0x22,0x01,0x02,0x01,0x01,0x21,0x01,0x02,0x01,0x01,0x20,0x01,0x02,0x01,0x02,0x1f,
+  0x00,0x02,0x17,0x04,0x00,0x01,0x02,0x1e,0x00,0x02,0x12,0x10,0x00,0x01,0x02,0x1d,0x00,0x02,0x10,0x16,
+  0x00,0x01,0x02,0x1c,0x00,0x02,0x0f,0x1a,0x00,0x01,0x02,0x1b,0x01,0x02,0x0d,0x1e,0x00,0x01,0x02,0x1a,
+  0x01,0x02,0x0d,0x21,0x00,0x01,0x02,0x1a,0x00,0x02,0x0c,0x25,0x00,0x01,0x02,0x19,0x01,0x02,0x0b,0x27,
+  0x00,0x01,0x02,0x19,0x00,0x02,0x0b,0x29,0x00,0x01,0x02,0x18,0x00,0x02,0x0b,0x2c,0x00,0x01,0x02,0x18,
+  0x00,0x02,0x0a,0x2e,0x00,0x01,0x02,0x17,0x00,0x02,0x0b,0x2f,0x00,0x01,0x02,0x17,0x00,0x02,0x0a,0x31,
+  0x00,0x01,0x02,0x16,0x01,0x02,0x09,0x32,0x00,0x01,0x02,0x16,0x00,0x02,0x0a,0x33,0x00,0x01,0x02,0x16,
+  0x00,0x02,0x09,0x35,0x00,0x01,0x02,0x15,0x01,0x02,0x09,0x36,0x00,0x01,0x00,0x01,0x02,0x15,0x00,0x02,
+  0x09,0x38,0x00,0x01,0x04,0x15,0x00,0x02,0x09,0x00,0x00,0x14,0x08,0x01,0x1a,0x01,0x00,0x01,0x04,0x15,
+  0x00,0x02,0x09,0x00,0x00,0x12,0x0d,0x01,0x18,0x00,0x00,0x01,0x04,0x15,0x00,0x02,0x09,0x00,0x00,0x10,
+  0x10,0x01,0x17,0x01,0x00,0x01,0x04,0x15,0x00,0x02,0x09,0x00,0x00,0x0f,0x13,0x01,0x16,0x00,0x00,0x01,
+  0x04,0x15,0x00,0x02,0x09,0x00,0x00,0x0f,0x14,0x01,0x15,0x01,0x00,0x01,0x04,0x15,0x00,0x02,0x09,0x00,
+  0x00,0x0e,0x16,0x01,0x15,0x00,0x00,0x01,0x04,0x15,0x00,0x02,0x09,0x00,0x00,0x24,0x01,0x01,0x14,0x01,
+  0x00,0x01,0x04,0x15,0x00,0x02,0x09,0x00,0x00,0x0d,0x19,0x01,0x14,0x00,0x00,0x01,0x06,0x15,0x00,0x02,
+  0x09,0x00,0x00,0x0d,0x00,0x01,0x05,0x05,0x00,0x0d,0x00,0x01,0x14,0x00,0x00,0x01,0x05,0x15,0x01,0x02,
+  0x09,0x00,0x00,0x11,0x08,0x00,0x0c,0x00,0x01,0x13,0x00,0x00,0x01,0x04,0x16,0x00,0x02,0x09,0x00,0x00,
+  0x1a,0x01,0x00,0x0a,0x00,0x01,0x01,0x05,0x16,0x00,0x02,0x09,0x01,0x00,0x0c,0x00,0x01,0x01,0x0d,0x00,
+  0x0a,0x00,0x01,0x01,0x04,0x16,0x01,0x02,0x09,0x00,0x00,0x1b,0x00,0x00,0x0a,0x00,0x01,0x01,0x04,0x17,
+  0x00,0x02,0x0a,0x00,0x00,0x1b,0x00,0x00,0x09,0x01,0x01,0x01,0x05,0x17,0x00,0x02,0x0a,0x0d,0x00,0x01,
+  0x00,0x02,0x0c,0x01,0x00,0x09,0x00,0x01,0x01,0x04,0x18,0x00,0x02,0x0a,0x01,0x00,0x1a,0x00,0x00,0x09,
+  0x00,0x01,0x01,0x05,0x04,0x00,0x00,0x13,0x00,0x02,0x0c,0x08,0x00,0x11,0x00,0x00,0x09,0x01,0x01,0x01,
+  0x06,0x04,0x00,0x00,0x14,0x00,0x02,0x0d,0x05,0x00,0x05,0x00,0x02,0x0d,0x00,0x00,0x09,0x00,0x01,0x01,
+  0x04,0x04,0x00,0x00,0x14,0x19,0x02,0x0d,0x00,0x00,0x09,0x00,0x01,0x01,0x04,0x04,0x01,0x00,0x14,0x01,
+  0x02,0x24,0x00,0x00,0x09,0x00,0x01,0x01,0x04,0x05,0x00,0x00,0x15,0x16,0x02,0x0e,0x00,0x00,0x09,0x00,
+  0x01,0x01,0x04,0x05,0x01,0x00,0x15,0x14,0x02,0x0f,0x00,0x00,0x09,0x00,0x01,0x01,0x04,0x06,0x00,0x00,
+  0x16,0x13,0x02,0x0f,0x00,0x00,0x09,0x00,0x01,0x01,0x04,0x06,0x01,0x00,0x17,0x10,0x02,0x10,0x00,0x00,
+  0x09,0x00,0x01,0x01,0x04,0x07,0x00,0x00,0x18,0x0d,0x02,0x12,0x00,0x00,0x09,0x00,0x01,0x01,0x04,0x07,
+  0x01,0x00,0x1a,0x08,0x02,0x14,0x00,0x00,0x09,0x00,0x01,0x01,0x02,0x08,0x38,0x00,0x09,0x00,0x01,0x01,
+  0x02,0x09,0x36,0x00,0x09,0x01,0x01,0x01,0x00,0x01,0x02,0x0a,0x35,0x00,0x09,0x00,0x01,0x01,0x02,0x0b,
+  0x33,0x00,0x0a,0x00,0x01,0x01,0x02,0x0c,0x32,0x00,0x09,0x01,0x01,0x01,0x02,0x0c,0x31,0x00,0x0a,0x00,
+  0x01,0x01,0x02,0x0d,0x2f,0x00,0x0b,0x00,0x01,0x01,0x02,0x0e,0x2e,0x00,0x0a,0x00,0x01,0x01,0x02,0x0f,
+  0x2c,0x00,0x0b,0x00,0x01,0x01,0x02,0x11,0x29,0x00,0x0b,0x00,0x01,0x01,0x02,0x12,0x27,0x00,0x0b,0x01,
+  0x01,0x01,0x02,0x13,0x25,0x00,0x0c,0x00,0x01,0x01,0x02,0x15,0x21,0x00,0x0d,0x01,0x01,0x01,0x02,0x17,
+  0x1e,0x00,0x0d,0x01,0x01,0x01,0x02,0x19,0x1a,0x00,0x0f,0x00,0x01,0x01,0x02,0x1b,0x16,0x00,0x10,0x00,
+  0x01,0x01,0x02,0x1e,0x10,0x00,0x12,0x00,0x01,0x01,0x02,0x24,0x04,0x00,0x17,0x00,0x01,0x01,0x01,0x3e,
+  0x01,0x01,0x01,0x01,0x3d,0x01,0x01,0x01,0x01,0x3c,0x01,0x01,0x01,0x01,0x3a,0x01,0x01,0x01,0x01,0x38,
+  0x02,0x01,0x01,0x01,0x36,0x02,0x01,0x01,0x01,0x34,0x02,0x01,0x01,0x01,0x30,0x04,0x01,0x01,0x01,0x1f,
+  0x11,0x01,0x01,0x01,0x21,0x0b,0x01,0x00,0x01,0x06,0x01,0x32,0x08,0x02,0x01,0x01,0x2d,0x05,0x02,0x01,
+  0x01,0x2b,0x03,0x02,0x01,0x01,0x28,0x02,0x02,0x01,0x01,0x26,0x02,0x02,0x01,0x01,0x24,0x02,0x02,0x01,
+  0x01,0x23,0x01,0x02,0x01,0x01,0x21,0x02,0x02,0x01,0x01,0x20,0x01,0x02,0x01,0x01,0x1f,0x01,0x02,0x01,
+  0x02,0x1e,0x01,0x02,0x15,0x08,0x00,0x01,0x02,0x1d,0x01,0x02,0x11,0x12,0x00,0x01,0x02,0x1c,0x01,0x02,
+  0x0f,0x18,0x00,0x01,0x02,0x1b,0x01,0x02,0x0e,0x1c,0x00,0x01,0x02,0x1a,0x01,0x02,0x0d,0x20,0x00,0x01,
+  0x02,0x1a,0x00,0x02,0x0d,0x23,0x00,0x01,0x02,0x19,0x00,0x02,0x0d,0x25,0x00,0x01,0x02,0x18,0x01,0x02,
+  0x0b,0x29,0x00,0x01,0x02,0x18,0x00,0x02,0x0b,0x2b,0x00,0x01,0x02,0x17,0x01,0x02,0x0a,0x2d,0x00,0x01,
+  0x02,0x17,0x00,0x02,0x0b,0x2e,0x00,0x01,0x02,0x16,0x01,0x02,0x0a,0x30,0x00,0x01,0x02,0x16,0x00,0x02,
+  0x0a,0x32,0x00,0x01,0x02,0x15,0x01,0x02,0x0a,0x33,0x00,0x01,0x02,0x15,0x00,0x02,0x0a,0x35,0x00,0x01,
+  0x02,0x15,0x00,0x02,0x09,0x37,0x00,0x01,0x02,0x14,0x01,0x02,0x09,0x38,0x00,0x01,0x02,0x14,0x00,0x02,
+  0x0a,0x38,0x00,0x01,0x02,0x14,0x00,0x02,0x09,0x3a,0x00,0x01,0x04,0x14,0x00,0x02,0x09,0x00,0x00,0x14,
+  0x0a,0x01,0x1a,0x01,0x00,0x01,0x04,0x14,0x00,0x02,0x09,0x00,0x00,0x12,0x0e,0x01,0x19,0x00,0x00,0x01,
+  0x04,0x14,0x00,0x02,0x09,0x00,0x00,0x11,0x11,0x01,0x17,0x00,0x00,0x01,0x04,0x14,0x00,0x02,0x09,0x00,
+  0x00,0x10,0x13,0x01,0x17,0x00,0x00,0x01,0x04,0x14,0x00,0x02,0x09,0x00,0x00,0x0f,0x16,0x01,0x15,0x00,
+  0x00,0x01,0x03,0x14,0x00,0x02,0x09,0x00,0x00,0x0f,0x17,0x01,0x01,0x03,0x14,0x00,0x02,0x09,0x00,0x00,
+  0x0e,0x18,0x01,0x01,0x03,0x14,0x00,0x02,0x09,0x00,0x00,0x0e,0x19,0x01,0x01,0x04,0x14,0x00,0x02,0x09,
+  0x00,0x00,0x15,0x04,0x00,0x0e,0x00,0x01,0x01,0x04,0x14,0x00,0x02,0x09,0x00,0x00,0x13,0x09,0x00,0x0b,
+  0x01,0x01,0x01,0x05,0x14,0x00,0x02,0x09,0x01,0x00,0x0d,0x00,0x01,0x03,0x0b,0x00,0x0b,0x00,0x01,0x01,
+  0x05,0x14,0x01,0x02,0x09,0x00,0x00,0x0d,0x00,0x01,0x02,0x0d,0x00,0x0a,0x01,0x01,0x01,0x04,0x15,0x00,
+  0x02,0x09,0x00,0x00,0x1e,0x00,0x00,0x0a,0x00,0x01,0x01,0x04,0x15,0x00,0x02,0x0a,0x00,0x00,0x1d,0x01,
+  0x00,0x09,0x01,0x01,0x01,0x04,0x15,0x01,0x02,0x09,0x01,0x00,0x1d,0x00,0x00,0x0a,0x00,0x01,0x01,0x04,
+  0x16,0x00,0x02,0x0a,0x00,0x00,0x1e,0x00,0x00,0x09,0x00,0x01,0x01,0x05,0x16,0x01,0x02,0x0a,0x0d,0x00,
+  0x02,0x00,0x02,0x0d,0x00,0x00,0x09,0x01,0x01,0x01,0x05,0x17,0x00,0x02,0x0b,0x0b,0x00,0x03,0x00,0x02,
+  0x0d,0x01,0x00,0x09,0x00,0x01,0x01,0x04,0x17,0x01,0x02,0x0b,0x09,0x00,0x13,0x00,0x00,0x09,0x00,0x01,
+  0x01,0x04,0x18,0x00,0x02,0x0e,0x04,0x00,0x15,0x00,0x00,0x09,0x00,0x01,0x01,0x03,0x19,0x19,0x02,0x0e,
+  0x00,0x00,0x09,0x00,0x01,0x01,0x03,0x1a,0x18,0x02,0x0e,0x00,0x00,0x09,0x00,0x01,0x01,0x03,0x1a,0x17,
+  0x02,0x0f,0x00,0x00,0x09,0x00,0x01,0x01,0x04,0x05,0x00,0x00,0x15,0x16,0x02,0x0f,0x00,0x00,0x09,0x00,
+  0x01,0x01,0x04,0x05,0x00,0x00,0x17,0x13,0x02,0x10,0x00,0x00,0x09,0x00,0x01,0x01,0x04,0x06,0x00,0x00,
+  0x17,0x11,0x02,0x11,0x00,0x00,0x09,0x00,0x01,0x01,0x04,0x06,0x00,0x00,0x19,0x0e,0x02,0x12,0x00,0x00,
+  0x09,0x00,0x01,0x01,0x04,0x06,0x01,0x00,0x1a,0x0a,0x02,0x14,0x00,0x00,0x09,0x00,0x01,0x01,0x02,0x07,
+  0x3a,0x00,0x09,0x00,0x01,0x01,0x02,0x08,0x38,0x00,0x0a,0x00,0x01,0x01,0x02,0x08,0x38,0x00,0x09,0x01,
+  0x01,0x01,0x02,0x09,0x37,0x00,0x09,0x00,0x01,0x01,0x02,0x0a,0x35,0x00,0x0a,0x00,0x01,0x01,0x02,0x0b,
+  0x33,0x00,0x0a,0x01,0x01,0x01,0x02,0x0c,0x32,0x00,0x0a,0x00,0x01,0x01,0x02,0x0d,0x30,0x00,0x0a,0x01,
+  0x01,0x01,0x02,0x0e,0x2e,0x00,0x0b,0x00,0x01,0x01,0x02,0x0f,0x2d,0x00,0x0a,0x01,0x01,0x01,0x02,0x10,
+  0x2b,0x00,0x0b,0x00,0x01,0x01,0x02,0x11,0x29,0x00,0x0b,0x01,0x01,0x01,0x02,0x13,0x25,0x00,0x0d,0x00,
+  0x01,0x01,0x02,0x14,0x23,0x00,0x0d,0x00,0x01,0x01,0x02,0x16,0x20,0x00,0x0d,0x01,0x01,0x01,0x02,0x18,
+  0x1c,0x00,0x0e,0x01,0x01,0x01,0x02,0x1a,0x18,0x00,0x0f,0x01,0x01,0x01,0x02,0x1d,0x12,0x00,0x11,0x01,
+  0x01,0x01,0x02,0x22,0x08,0x00,0x15,0x01,0x01,0x01,0x01,0x3f,0x01,0x01,0x01,0x01,0x3e,0x01,0x01,0x01,
+  0x01,0x3c,0x02,0x01,0x01,0x01,0x3b,0x01,0x01,0x01,0x01,0x39,0x02,0x01,0x01,0x01,0x37,0x02,0x01,0x01,
+  0x01,0x35,0x02,0x01,0x01,0x01,0x31,0x03,0x01,0x01,0x01,0x2d,0x05,0x01,0x01,0x01,0x25,0x08,0x01,0x00,
+  0x01,0x05,0x01,0x30,0x06,0x02,0x01,0x01,0x2d,0x04,0x02,0x01,0x01,0x2a,0x02,0x02,0x01,0x01,0x27,0x03,
+  0x02,0x01,0x01,0x25,0x02,0x02,0x01,0x01,0x24,0x01,0x02,0x01,0x01,0x22,0x01,0x02,0x01,0x01,0x21,0x01,
+  0x02,0x01,0x01,0x1f,0x01,0x02,0x01,0x01,0x1e,0x01,0x02,0x01,0x02,0x1d,0x01,0x02,0x14,0x0c,0x00,0x01,
+  0x02,0x1c,0x01,0x02,0x11,0x14,0x00,0x01,0x02,0x1b,0x01,0x02,0x10,0x19,0x00,0x01,0x02,0x1a,0x01,0x02,
+  0x0f,0x1d,0x00,0x01,0x02,0x1a,0x00,0x02,0x0e,0x21,0x00,0x01,0x02,0x19,0x00,0x02,0x0d,0x25,0x00,0x01,
+  0x02,0x18,0x01,0x02,0x0c,0x27,0x00,0x01,0x02,0x17,0x01,0x02,0x0c,0x2a,0x00,0x01,0x02,0x17,0x00,0x02,
+  0x0c,0x2c,0x00,0x01,0x02,0x16,0x01,0x02,0x0b,0x2e,0x00,0x01,0x02,0x16,0x00,0x02,0x0b,0x30,0x00,0x01,
+  0x02,0x15,0x01,0x02,0x0a,0x32,0x00,0x01,0x02,0x15,0x00,0x02,0x0a,0x34,0x00,0x01,0x02,0x14,0x01,0x02,
+  0x0a,0x35,0x00,0x01,0x02,0x14,0x00,0x02,0x0a,0x37,0x00,0x01,0x02,0x14,0x00,0x02,0x0a,0x38,0x00,0x01,
+  0x02,0x13,0x01,0x02,0x09,0x39,0x00,0x01,0x02,0x13,0x00,0x02,0x0a,0x3a,0x00,0x01,0x02,0x13,0x00,0x02,
+  0x09,0x3b,0x00,0x01,0x04,0x13,0x00,0x02,0x09,0x00,0x00,0x15,0x0a,0x01,0x1b,0x00,0x00,0x01,0x03,0x13,
+  0x00,0x02,0x09,0x00,0x00,0x13,0x0f,0x01,0x01,0x03,0x13,0x00,0x02,0x09,0x00,0x00,0x12,0x11,0x01,0x01,
+  0x03,0x12,0x01,0x02,0x09,0x00,0x00,0x11,0x14,0x01,0x01,0x03,0x12,0x01,0x02,0x08,0x01,0x00,0x10,0x16,
+  0x01,0x01,0x03,0x12,0x01,0x02,0x08,0x01,0x00,0x0f,0x18,0x01,0x01,0x03,0x12,0x01,0x02,0x08,0x01,0x00,
+  0x0f,0x19,0x01,0x01,0x03,0x12,0x01,0x02,0x08,0x01,0x00,0x0e,0x1b,0x01,0x01,0x05,0x12,0x01,0x02,0x09,
+  0x00,0x00,0x0e,0x00,0x01,0x07,0x05,0x00,0x0d,0x01,0x01,0x01,0x05,0x13,0x00,0x02,0x09,0x00,0x00,0x0e,
+  0x00,0x01,0x05,0x09,0x00,0x0c,0x00,0x01,0x01,0x05,0x13,0x00,0x02,0x09,0x00,0x00,0x0e,0x00,0x01,0x04,
+  0x0c,0x00,0x0b,0x00,0x01,0x01,0x05,0x13,0x00,0x02,0x09,0x00,0x00,0x0e,0x00,0x01,0x10,0x01,0x00,0x0a,
+  0x01,0x01,0x01,0x04,0x13,0x00,0x02,0x09,0x01,0x00,0x1f,0x01,0x00,0x0a,0x00,0x01,0x01,0x04,0x13,0x01,
+  0x02,0x09,0x00,0x00,0x20,0x00,0x00,0x0a,0x01,0x01,0x01,0x04,0x14,0x00,0x02,0x09,0x01,0x00,0x20,0x00,
+  0x00,0x0a,0x00,0x01,0x01,0x04,0x14,0x00,0x02,0x0a,0x00,0x00,0x20,0x01,0x00,0x09,0x00,0x01,0x01,0x04,
+  0x14,0x01,0x02,0x0a,0x00,0x00,0x20,0x00,0x00,0x09,0x01,0x01,0x01,0x04,0x15,0x00,0x02,0x0a,0x01,0x00,
+  0x1f,0x01,0x00,0x09,0x00,0x01,0x01,0x05,0x15,0x01,0x02,0x0a,0x01,0x00,0x10,0x00,0x02,0x0e,0x00,0x00,
+  0x09,0x00,0x01,0x01,0x05,0x16,0x00,0x02,0x0b,0x0c,0x00,0x04,0x00,0x02,0x0e,0x00,0x00,0x09,0x00,0x01,
+  0x01,0x05,0x17,0x00,0x02,0x0c,0x09,0x00,0x05,0x00,0x02,0x0e,0x00,0x00,0x09,0x00,0x01,0x01,0x05,0x17,
+  0x01,0x02,0x0d,0x05,0x00,0x07,0x00,0x02,0x0e,0x00,0x00,0x09,0x01,0x01,0x01,0x03,0x18,0x1b,0x02,0x0e,
+  0x01,0x00,0x08,0x01,0x01,0x01,0x03,0x19,0x19,0x02,0x0f,0x01,0x00,0x08,0x01,0x01,0x01,0x03,0x1a,0x18,
+  0x02,0x0f,0x01,0x00,0x08,0x01,0x01,0x01,0x03,0x1b,0x16,0x02,0x10,0x01,0x00,0x08,0x01,0x01,0x01,0x03,
+  0x1c,0x14,0x02,0x11,0x00,0x00,0x09,0x01,0x01,0x01,0x03,0x1e,0x11,0x02,0x12,0x00,0x00,0x09,0x00,0x01,
+  0x01,0x03,0x1f,0x0f,0x02,0x13,0x00,0x00,0x09,0x00,0x01,0x01,0x04,0x06,0x00,0x00,0x1b,0x0a,0x02,0x15,
+  0x00,0x00,0x09,0x00,0x01,0x01,0x02,0x07,0x3b,0x00,0x09,0x00,0x01,0x01,0x02,0x07,0x3a,0x00,0x0a,0x00,
+  0x01,0x01,0x02,0x08,0x39,0x00,0x09,0x01,0x01,0x01,0x02,0x08,0x38,0x00,0x0a,0x00,0x01,0x01,0x02,0x09,
+  0x37,0x00,0x0a,0x00,0x01,0x01,0x02,0x0a,0x35,0x00,0x0a,0x01,0x01,0x01,0x02,0x0b,0x34,0x00,0x0a,0x00,
+  0x01,0x01,0x02,0x0c,0x32,0x00,0x0a,0x01,0x01,0x01,0x02,0x0d,0x30,0x00,0x0b,0x00,0x01,0x01,0x02,0x0e,
+  0x2e,0x00,0x0b,0x01,0x01,0x01,0x02,0x0f,0x2c,0x00,0x0c,0x00,0x01,0x01,0x02,0x10,0x2a,0x00,0x0c,0x01,
+  0x01,0x01,0x02,0x12,0x27,0x00,0x0c,0x01,0x01,0x01,0x02,0x13,0x25,0x00,0x0d,0x00,0x01,0x01,0x02,0x15,
+  0x21,0x00,0x0e,0x00,0x01,0x01,0x02,0x17,0x1d,0x00,0x0f,0x01,0x01,0x01,0x02,0x19,0x19,0x00,0x10,0x01,
+  0x01,0x01,0x02,0x1c,0x14,0x00,0x11,0x01,0x01,0x01,0x02,0x20,0x0c,0x00,0x14,0x01,0x01,0x01,0x01,0x40,
+  0x01,0x01,0x01,0x01,0x3f,0x01,0x01,0x01,0x01,0x3d,0x01,0x01,0x01,0x01,0x3c,0x01,0x01,0x01,0x01,0x3a,
+  0x01,0x01,0x01,0x01,0x38,0x02,0x01,0x01,0x01,0x35,0x03,0x01,0x01,0x01,0x33,0x02,0x01,0x01,0x01,0x2e,
+  0x04,0x01,0x01,0x01,0x29,0x06,0x01,0x00,0x01,0x05,0x01,0x2c,0x03,0x02,0x01,0x01,0x29,0x03,0x02,0x01,
+  0x01,0x27,0x02,0x02,0x01,0x01,0x25,0x01,0x02,0x01,0x01,0x23,0x01,0x02,0x01,0x01,0x21,0x02,0x02,0x01,
+  0x01,0x20,0x01,0x02,0x01,0x01,0x1f,0x01,0x02,0x01,0x01,0x1d,0x01,0x02,0x01,0x02,0x1c,0x01,0x02,0x14,
+  0x0e,0x00,0x01,0x02,0x1b,0x01,0x02,0x11,0x16,0x00,0x01,0x02,0x1a,0x01,0x02,0x10,0x1a,0x00,0x01,0x02,
+  0x1a,0x00,0x02,0x0f,0x1f,0x00,0x01,0x02,0x19,0x00,0x02,0x0e,0x23,0x00,0x01,0x02,0x18,0x01,0x02,0x0d,
+  0x25,0x00,0x01,0x02,0x17,0x01,0x02,0x0c,0x29,0x00,0x01,0x02,0x17,0x00,0x02,0x0c,0x2b,0x00,0x01,0x02,
+  0x16,0x00,0x02,0x0c,0x2e,0x00,0x01,0x02,0x15,0x01,0x02,0x0b,0x30,0x00,0x01,0x02,0x15,0x00,0x02,0x0b,
+  0x32,0x00,0x01,0x02,0x14,0x01,0x02,0x0a,0x34,0x00,0x01,0x02,0x14,0x00,0x02,0x0b,0x35,0x00,0x01,0x02,
+  0x14,0x00,0x02,0x0a,0x36,0x00,0x01,0x02,0x13,0x00,0x02,0x0a,0x38,0x00,0x01,0x02,0x13,0x00,0x02,0x0a,
+  0x00,0x00,0x01,0x02,0x12,0x01,0x02,0x09,0x01,0x00,0x01,0x02,0x12,0x00,0x02,0x0a,0x00,0x00,0x01,0x03,
+  0x12,0x00,0x02,0x0a,0x00,0x00,0x19,0x03,0x01,0x01,0x03,0x12,0x00,0x02,0x09,0x00,0x00,0x16,0x0b,0x01,
+  0x01,0x03,0x12,0x00,0x02,0x09,0x00,0x00,0x14,0x0f,0x01,0x01,0x03,0x11,0x01,0x02,0x09,0x00,0x00,0x12,
+  0x13,0x01,0x01,0x03,0x11,0x01,0x02,0x09,0x00,0x00,0x11,0x16,0x01,0x01,0x03,0x11,0x00,0x02,0x09,0x01,
+  0x00,0x10,0x18,0x01,0x01,0x03,0x11,0x00,0x02,0x09,0x00,0x00,0x11,0x19,0x01,0x01,0x03,0x11,0x00,0x02,
+  0x09,0x00,0x00,0x10,0x1b,0x01,0x01,0x03,0x11,0x00,0x02,0x09,0x00,0x00,0x10,0x1c,0x01,0x01,0x05,0x11,
+  0x00,0x02,0x09,0x00,0x00,0x0f,0x00,0x01,0x09,0x04,0x00,0x0e,0x01,0x01,0x01,0x05,0x11,0x00,0x02,0x09,
+  0x01,0x00,0x0e,0x00,0x01,0x07,0x08,0x00,0x0d,0x00,0x01,0x01,0x05,0x11,0x01,0x02,0x09,0x00,0x00,0x0e,
+  0x00,0x01,0x05,0x0c,0x00,0x0b,0x01,0x01,0x01,0x05,0x12,0x00,0x02,0x09,0x00,0x00,0x0e,0x00,0x01,0x12,
+  0x00,0x00,0x0b,0x00,0x01,0x01,0x04,0x12,0x00,0x02,0x09,0x00,0x00,0x13,0x0f,0x00,0x0b,0x00,0x01,0x01,
+  0x05,0x12,0x00,0x02,0x09,0x00,0x00,0x0f,0x00,0x01,0x13,0x00,0x00,0x0a,0x00,0x01,0x01,0x05,0x12,0x00,
+  0x02,0x0a,0x00,0x00,0x0f,0x00,0x01,0x12,0x01,0x00,0x0a,0x00,0x01,0x01,0x05,0x12,0x01,0x02,0x09,0x00,
+  0x00,0x10,0x00,0x01,0x12,0x00,0x00,0x0a,0x00,0x01,0x01,0x05,0x13,0x00,0x02,0x0a,0x00,0x00,0x12,0x00,
+  0x02,0x10,0x00,0x00,0x09,0x01,0x01,0x01,0x05,0x13,0x00,0x02,0x0a,0x01,0x00,0x12,0x00,0x02,0x0f,0x00,
+  0x00,0x0a,0x00,0x01,0x01,0x05,0x14,0x00,0x02,0x0a,0x00,0x00,0x13,0x00,0x02,0x0f,0x00,0x00,0x09,0x00,
+  0x01,0x01,0x04,0x14,0x00,0x02,0x0b,0x0f,0x00,0x13,0x00,0x00,0x09,0x00,0x01,0x01,0x05,0x15,0x00,0x02,
+  0x0b,0x00,0x00,0x12,0x00,0x02,0x0e,0x00,0x00,0x09,0x00,0x01,0x01,0x05,0x15,0x01,0x02,0x0b,0x0c,0x00,
+  0x05,0x00,0x02,0x0e,0x00,0x00,0x09,0x01,0x01,0x01,0x05,0x16,0x00,0x02,0x0d,0x08,0x00,0x07,0x00,0x02,
+  0x0e,0x01,0x00,0x09,0x00,0x01,0x01,0x05,0x16,0x01,0x02,0x0e,0x04,0x00,0x09,0x00,0x02,0x0f,0x00,0x00,
+  0x09,0x00,0x01,0x01,0x03,0x17,0x1c,0x02,0x10,0x00,0x00,0x09,0x00,0x01,0x01,0x03,0x18,0x1b,0x02,0x10,
+  0x00,0x00,0x09,0x00,0x01,0x01,0x03,0x19,0x19,0x02,0x11,0x00,0x00,0x09,0x00,0x01,0x01,0x03,0x1a,0x18,
+  0x02,0x10,0x01,0x00,0x09,0x00,0x01,0x01,0x03,0x1b,0x16,0x02,0x11,0x00,0x00,0x09,0x01,0x01,0x01,0x03,
+  0x1d,0x13,0x02,0x12,0x00,0x00,0x09,0x01,0x01,0x01,0x03,0x1f,0x0f,0x02,0x14,0x00,0x00,0x09,0x00,0x01,
+  0x01,0x03,0x21,0x0b,0x02,0x16,0x00,0x00,0x09,0x00,0x01,0x01,0x03,0x25,0x03,0x02,0x19,0x00,0x00,0x0a,
+  0x00,0x01,0x01,0x02,0x42,0x00,0x00,0x0a,0x00,0x01,0x01,0x02,0x41,0x01,0x00,0x09,0x01,0x01,0x01,0x02,
+  0x41,0x00,0x00,0x0a,0x00,0x01,0x01,0x02,0x09,0x38,0x00,0x0a,0x00,0x01,0x01,0x02,0x0a,0x36,0x00,0x0a,
+  0x00,0x01,0x01,0x02,0x0a,0x35,0x00,0x0b,0x00,0x01,0x01,0x02,0x0b,0x34,0x00,0x0a,0x01,0x01,0x01,0x02,
+  0x0c,0x32,0x00,0x0b,0x00,0x01,0x01,0x02,0x0d,0x30,0x00,0x0b,0x01,0x01,0x01,0x02,0x0e,0x2e,0x00,0x0c,
+  0x00,0x01,0x01,0x02,0x10,0x2b,0x00,0x0c,0x00,0x01,0x01,0x02,0x11,0x29,0x00,0x0c,0x01,0x01,0x01,0x02,
+  0x13,0x25,0x00,0x0d,0x01,0x01,0x01,0x02,0x14,0x23,0x00,0x0e,0x00,0x01,0x01,0x02,0x16,0x1f,0x00,0x0f,
+  0x00,0x01,0x01,0x02,0x19,0x1a,0x00,0x10,0x01,0x01,0x01,0x02,0x1b,0x16,0x00,0x11,0x01,0x01,0x01,0x02,
+  0x1f,0x0e,0x00,0x14,0x01,0x01,0x01,0x01,0x41,0x01,0x01,0x01,0x01,0x3f,0x01,0x01,0x01,0x01,0x3e,0x01,
+  0x01,0x01,0x01,0x3c,0x02,0x01,0x01,0x01,0x3b,0x01,0x01,0x01,0x01,0x39,0x01,0x01,0x01,0x01,0x36,0x02,
+  0x01,0x01,0x01,0x33,0x03,0x01,0x01,0x01,0x30,0x03,0x01,0x00,
+};
@@ -0,0 +1,151 @@
+#pragma once
+#include <Arduino.h>
+#include "iram.h"
+
+// ===== Coverage tables: anti-aliased disc rows, shaded through small RGB565 ramps =====
+// A table holds, per row of a disc, the span of touched pixels, the fully covered interior and a
+// coverage level (0..FULL) for each edge pixel. Tables are built once per radius (init or layout
+// change); drawing a row is then a table walk plus a ramp lookup, so edges cost only on rows we touch.
+// Other outlines (sdf.h) fill the same tables row by row through begin() / buildRow().
+namespace Coverage {
+
+// ---------- Tunables ----------
+static constexpr int SS       = 4;                  // SS x SS samples per pixel
+static constexpr int FULL     = SS * SS;            // level of a fully covered pixel
+static constexpr int MAX_R    = 48;                 // largest disc radius
+static constexpr int MAX_EDGE = 1536;               // edge pixels across all rows of an outline (stars, hearts)
+static constexpr int PHASES   = 4;                  // sub-pixel stamp phases per axis (quarter pixels)
+static constexpr int MAX_STAMP_R    = 16;           // largest pupil radius
+static constexpr int MAX_STAMP_EDGE = 192;
+
+// Quality vs cost: intermediate shades per ramp segment. Fewer shades -> longer equal-colour runs
+// -> fewer SPI transactions per edge row. Aliased is a hard threshold (the old fillCircle look).
+enum class Quality : uint8_t { Aliased = 0, Fast, Smooth };
+static constexpr int STEPS[] = { 0, 1, 2 };
+
+struct Row {
+  int8_t   x0 = 1, x1 = 0;   // touched pixels (dx from centre), empty when x0 > x1
+  int8_t   f0 = 1, f1 = 0;   // longest fully covered run, empty when f0 > f1
+  uint16_t lv = 0;           // first edge level in Table::level (left edge, then right edge)
+};
+
+template <int MAXR, int MAXE>
+struct TableT {
+  static constexpr int MAX_RADIUS = MAXR;
+  static constexpr int MAX_ROWS   = 2 * (MAXR + 2) + 1;
+
+  int     half = 0;          // row i holds dy = i - half
+  int     rows = 0;
+  int     used = 0;
+  Row     row[MAX_ROWS];
+  uint8_t level[MAXE];
+
+  inline const Row* at(int dy) const {
+    dy += half;
+    return (dy < 0 || dy >= rows) ? nullptr : &row[dy];
+  }
+  // Coverage level of pixel dx on a row (0 outside the disc).
+  inline uint8_t t(const Row& r, int dx) const {
+    if (dx < r.x0 || dx > r.x1) return 0;
+    if (dx >= r.f0 && dx <= r.f1) return FULL;
+    return level[r.lv + (dx < r.f0 ? dx - r.x0 : (r.f0 - r.x0) + (dx - r.f1 - 1))];
+  }
+};
+
+using Table      = TableT<MAX_R, MAX_EDGE>;              // sclera disc
+using StampTable = TableT<MAX_STAMP_R, MAX_STAMP_EDGE>;  // pupil stamp, one per sub-pixel phase
+
+struct Ramp { uint16_t lut[FULL + 1]; };
+
+static inline int samplesIn(float fx, float fy, float r2){
+  int n = 0;
+  for (int j = 0; j < SS; ++j) {
+    const float sy = fy + ((float)j + 0.5f) / SS - 0.5f;
+    for (int i = 0; i < SS; ++i) {
+      const float sx = fx + ((float)i + 0.5f) / SS - 0.5f;
+      n += (sx*sx + sy*sy <= r2);
+    }
+  }
+  return n;
+}
+
+// Empties a table for rows dy = -half .. half, to be filled in order by buildRow().
+template <class T>
+static void begin(T& tb, int half){
+  tb.half = min(half, T::MAX_RADIUS + 2);
+  tb.rows = 2 * tb.half + 1;
+  tb.used = 0;
+}
+
+// Row i from level(dx) (0..FULL) for dx = -half .. half. Pixels outside the interior run keep their
+// level, so rows with gaps (heart lobes, star points) still read back exactly.
+template <class T, class Level>
+static void buildRow(T& tb, int i, Level level){
+  const int maxE = (int)sizeof(tb.level);
+  uint8_t lv[T::MAX_ROWS];
+  Row& r = tb.row[i];
+  r = Row();
+  int x0 = 1, x1 = 0, f0 = 1, f1 = 0, run0 = -tb.half;
+  for (int dx = -tb.half; dx <= tb.half; ++dx) {
+    const int t = level(dx);
+    lv[dx + tb.half] = (uint8_t)t;
+    if (t != FULL) run0 = dx + 1;
+    else if (dx - run0 > f1 - f0) { f0 = run0; f1 = dx; }
+    if (!t) continue;
+    if (x0 > x1) x0 = dx;
+    x1 = dx;
+  }
+  if (x0 > x1) return;
+  if (f0 > f1) { f0 = x1 + 1; f1 = x1; }   // no interior: whole row is "left edge"
+  r.x0 = (int8_t)x0; r.x1 = (int8_t)x1; r.f0 = (int8_t)f0; r.f1 = (int8_t)f1;
+  r.lv = (uint16_t)tb.used;
+  for (int dx = x0; dx <= x1; ++dx) {
+    if (dx >= f0 && dx <= f1) continue;
+    if (tb.used < maxE) tb.level[tb.used] = lv[dx + tb.half];
+    ++tb.used;
+  }
+  if (tb.used > maxE) { tb.used = maxE; r.x0 = 1; r.x1 = 0; }  // out of room: drop the row
+}
+
+// Disc of radius rOut centred (ox, oy) px right/down of a pixel centre, 0 <= ox, oy < 1. With rIn >= 0
+// the level is the mean of the outer and inner disc coverage, so 0 = outside, FULL/2 = on the rim
+// line, FULL = inside the rim.
+template <class T>
+static void build(T& tb, float rOut, float rIn = -1.f, float ox = 0.f, float oy = 0.f){
+  if (rOut > T::MAX_RADIUS + 0.5f) rOut = T::MAX_RADIUS + 0.5f;
+  const float ro2 = rOut * rOut, ri2 = rIn * rIn;
+  begin(tb, (int)ceilf(rOut) + 1);
+  for (int i = 0; i < tb.rows; ++i) {
+    const float fy = (float)(i - tb.half) - oy;
+    buildRow(tb, i, [&](int dx){
+      const float fx = (float)dx - ox;
+      int t = samplesIn(fx, fy, ro2);
+      if (rIn >= 0.f) t = (t + samplesIn(fx, fy, ri2) + 1) / 2;
+      return t;
+    });
+  }
+}
+
+static inline uint16_t lerp565(uint16_t a, uint16_t b, int num, int den){
+  const int ar = a >> 11, ag = (a >> 5) & 0x3f, ab = a & 0x1f;
+  const int br = b >> 11, bg = (b >> 5) & 0x3f, bb = b & 0x1f;
+  const int r  = (ar * (den - num) + br * num + den / 2) / den;
+  const int gg = (ag * (den - num) + bg * num + den / 2) / den;
+  const int bl = (ab * (den - num) + bb * num + den / 2) / den;
+  return (uint16_t)((r << 11) | (gg << 5) | bl);
+}
+
+// Colour stops spread evenly over levels 0..FULL; each segment quantised to the quality's shade count.
+static void buildRamp(Ramp& rp, const uint16_t* stops, int nStops, Quality q){
+  const int segs = nStops - 1;
+  const int den  = STEPS[(int)q] + 1;
+  for (int t = 0; t <= FULL; ++t) {
+    int seg = (t * segs) / FULL;
+    if (seg >= segs) seg = segs - 1;
+    const int u = t * segs - seg * FULL;               // 0..FULL within the segment
+    const int k = (u * den + FULL / 2) / FULL;         // 0..den
+    rp.lut[t] = lerp565(stops[seg], stops[seg + 1], k, den);
+  }
+}
+
+} // namespace Coverage
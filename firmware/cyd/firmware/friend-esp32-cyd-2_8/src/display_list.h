@@ -0,0 +1,113 @@
+#pragma once
+#include <Arduino.h>
+#include <limits.h>
+#include "iram.h"
+
+// ===== Display list: a frame as horizontal spans (y, x0, x1, colour), diffed against the last one =====
+// Generators (eye rows, mouth rows) append spans row by row, left to right; pixels no span covers are
+// background. diffRow() walks the previous and current spans of a row together and hands only the
+// pixels whose colour changed to a sink, so every animation (lids, pupils, lips, theme fades) goes
+// through one incremental path instead of per-feature repaint logic.
+namespace DList {
+
+// ---------- Tunables ----------
+static constexpr int MAX_ROWS  = 240;    // screen rows (landscape 2.8")
+static constexpr int MAX_SPANS = 2048;   // face measures <= ~800 (tools/host/span_bench.cpp)
+
+struct Span {
+  int16_t  x0, x1;   // inclusive
+  uint16_t c;
+};
+
+struct List {
+  int      rows = 0;                  // rows closed so far
+  int      n    = 0;                  // spans used
+  bool     overflow = false;          // ran out of spans; later spans were dropped
+  uint16_t start[MAX_ROWS + 1] = {};  // row y holds span[start[y] .. start[y + 1])
+  Span     span[MAX_SPANS];
+
+  inline void begin(){ rows = 0; n = 0; overflow = false; start[0] = 0; }
+  inline void endRow(){ if (rows < MAX_ROWS) start[++rows] = (uint16_t)n; }
+
+  // Appends to the open row. Equal-colour neighbours merge; overlap with the previous span is
+  // clipped away (first writer wins), so generators paint front to back.
+  inline void fill(int x, int len, uint16_t c){
+    if (len <= 0) return;
+    if (n > start[rows]) {
+      Span& l = span[n - 1];
+      if (x <= l.x1) { len -= l.x1 + 1 - x; x = l.x1 + 1; if (len <= 0) return; }
+      if (l.c == c && l.x1 + 1 == x) { l.x1 = (int16_t)(x + len - 1); return; }
+    }
+    if (n >= MAX_SPANS) { overflow = true; return; }
+    span[n++] = { (int16_t)x, (int16_t)(x + len - 1), c };
+  }
+  inline void put(int x, uint16_t c){ fill(x, 1, c); }
+
+  inline const Span* rowBegin(int y) const { return y < rows ? &span[start[y]] : nullptr; }
+  inline const Span* rowEnd(int y)   const { return y < rows ? &span[start[y + 1]] : nullptr; }
+};
+
+struct Stats {
+  uint16_t spans   = 0;   // spans in the frame's list
+  uint16_t emitted = 0;   // spans sent to the sink
+  uint16_t rows    = 0;   // rows that differed
+  uint32_t px      = 0;   // pixels sent to the sink
+  bool     overflow = false;
+};
+
+static inline bool sameRow(const Span* a, const Span* ae, const Span* b, const Span* be){
+  return ae - a == be - b && (a == ae || !memcmp(a, b, (size_t)(ae - a) * sizeof(Span)));
+}
+
+// Emits the pixels of row y whose colour differs between a (shown) and b (wanted), coalesced into
+// runs of the wanted colour. Sink: void span(int y, int x0, int x1, uint16_t c).
+template <class Sink>
+FACE_IRAM(dlist) static int diffRow(const Span* a, const Span* ae, const Span* b, const Span* be,
+                                    int y, uint16_t bg, Sink& out, uint32_t& px){
+  if (sameRow(a, ae, b, be)) return 0;
+  int emitted = 0;
+  int ox0 = 0, ox1 = -1; uint16_t oc = 0;   // pending output run
+  int x = min(a < ae ? (int)a->x0 : INT_MAX, b < be ? (int)b->x0 : INT_MAX);
+  while (a < ae || b < be) {
+    uint16_t ca = bg, cb = bg;
+    int enda = INT_MAX, endb = INT_MAX;
+    if (a < ae) { if (a->x0 <= x) { ca = a->c; enda = a->x1; } else enda = a->x0 - 1; }
+    if (b < be) { if (b->x0 <= x) { cb = b->c; endb = b->x1; } else endb = b->x0 - 1; }
+    const int end = min(enda, endb);
+    if (ca != cb) {
+      if (ox0 <= ox1 && oc == cb && ox1 + 1 == x) ox1 = end;
+      else {
+        if (ox0 <= ox1) { out.span(y, ox0, ox1, oc); px += ox1 - ox0 + 1; ++emitted; }
+        ox0 = x; ox1 = end; oc = cb;
+      }
+    }
+    x = end + 1;
+    if (a < ae && a->x1 < x) ++a;
+    if (b < be && b->x1 < x) ++b;
+  }
+  if (ox0 <= ox1) { out.span(y, ox0, ox1, oc); px += ox1 - ox0 + 1; ++emitted; }
+  return emitted;
+}
+
+// Span sink adapter passing only columns [x0, x1].
+template <class Sink>
+struct Clip {
+  Sink& out;
+  int   x0, x1;
+  inline void span(int y, int a, int b, uint16_t c){
+    a = max(a, x0); b = min(b, x1);
+    if (a <= b) out.span(y, a, b, c);
+  }
+};
+
+// Diffs every row of `want` against `shown` (rows missing from `shown` count as background).
+template <class Sink>
+static void diff(const List& shown, const List& want, uint16_t bg, Sink& out, Stats& st){
+  st.spans = (uint16_t)want.n; st.emitted = 0; st.rows = 0; st.px = 0; st.overflow = want.overflow;
+  for (int y = 0; y < want.rows; ++y) {
+    const int e = diffRow(shown.rowBegin(y), shown.rowEnd(y), want.rowBegin(y), want.rowEnd(y), y, bg, out, st.px);
+    if (e) { st.emitted += e; ++st.rows; }
+  }
+}
+
+} // namespace DList
@@ -1,6 +1,12 @@
 #pragma once
 #include <Arduino.h>
 #include <LovyanGFX.hpp>
+#include "iram.h"
+#include "trace.h"
+#include "coverage.h"
+#include "sdf.h"
+#include "theme.h"
+#include "display_list.h"
 
 // ===== Eyes module: handles geometry, gaze, drift/saccades, blink, lids, pupils =====
 namespace Eyes {
@@ -34,6 +40,18 @@ static constexpr int   PURSUIT_CHANCE_PCT     = 35;
 static constexpr int   VERT_OFFSET_MIN        = -8;
 static constexpr int   VERT_OFFSET_MAX        = +8;
 
+static constexpr Coverage::Quality EDGE_QUALITY_DEFAULT = Coverage::Quality::Smooth;
+static constexpr int   HALF_RES               = 2;      // State::scale of half-resolution eyes
+
+// audio reactions (Onset events, see onset.h)
+static constexpr int   PUPIL_PULSE_PX         = 2;      // pupil dilation on an onset ...
+static constexpr int   PUPIL_PULSE_MS_MIN     = 50;     // ... held this long for the weakest onset ...
+static constexpr int   PUPIL_PULSE_MS_MAX     = 120;    // ... up to this for the strongest
+static constexpr int   EMPHASIS_STRENGTH      = 128;    // onsets at least this strong also lift the lids ...
+static constexpr float LID_LIFT               = 0.14f;  // ... by up to this much closure ...
+static constexpr int   LID_LIFT_MS            = 300;    // ... easing back over this
+static constexpr int   LOUD_BLINK_DEFER_MS    = 250;    // while loud, due blinks are retried this often
+
 // Layout knobs (you can pass in overrides at init)
 struct Layout {
   int  cxL =  83, cy = 120, cxR = 237;
@@ -42,13 +60,13 @@ struct Layout {
   int  maxOffset = 26;         // pupil horizon from center
   int  targetLidTopMargin = 25;// px from top to TOP of upper lid baseline
   int  eyeNudgeDownPx = 15;    // additional global nudge
+  int  scale = 1;              // HALF_RES: eyes rasterised at half resolution (large panels)
 };
 
 struct Eye {
   int   cx = 0, cy = 0, rWhite = 0, rPupil = 0, maxOffset = 0;
-  int   px = 0, py = 0;
-  float lidU = 0.f, lidU_prev = 0.f;
-  float lidL = 0.f, lidL_prev = 0.f;
+  int   qx = 0, qy = 0;          // pupil centre in 1/Coverage::PHASES px
+  float lidU = 0.f, lidL = 0.f;   // lid closure, 0 = open .. 1 = shut
 
   Eye() = default;
   Eye(int _cx, int _cy, int _rWhite, int _rPupil, int _maxOffset)
@@ -70,11 +88,41 @@ struct BlinkCtl {
   bool activeL = false, activeR = false;
 };
 
+// Anti-aliased edge tables, shared by both eyes (same radii). Colours come from Theme::palette().
+struct Edges {
+  Coverage::Table outline[2];   // sclera + rim; [front] is drawn, the other is rasterised during a morph
+  uint8_t front = 0;
+  Coverage::StampTable stamp[2][Coverage::PHASES * Coverage::PHASES];  // pupil at rest / dilated, per sub-pixel phase
+  uint8_t pupil = 0;            // stamp set drawn
+  inline const Coverage::Table& disc() const { return outline[front]; }
+};
+
+// Outline shape: a morph from the shape on screen to a target, rasterised a bounded amount per frame.
+struct ShapeCtl {
+  Sdf::Morph  shown;             // what outline[front] holds
+  uint16_t    frame = 0, frames = 0;
+  uint16_t    jobFrame = 0;      // frame the raster in `job` started on
+  uint8_t     lag = 0;           // frames the last raster took: a blend is aimed that far ahead
+  Sdf::Raster job;
+};
+
+// Responses to the audio being played: a pupil pulse, a lid lift easing back, blinks held while loud.
+struct AudioCtl {
+  uint32_t pulseUntilMs = 0;
+  uint32_t liftStartMs = 0;
+  float    lift = 0.f;         // closure removed at liftStartMs
+  bool     loud = false;
+};
+
 struct State {
   Eye L;
   Eye R;
   GazeCtl gaze;
   BlinkCtl blink;
+  Edges edges;
+  ShapeCtl shape;
+  AudioCtl audio;
+  uint8_t scale = 1;  // 1: native; HALF_RES: tables and rows at half resolution, pixel-doubled
   int oldCy = 120; // for mouth placement deltas (optional)
 };
 
@@ -84,80 +132,120 @@ static inline uint32_t nowMs(){ return millis(); }
 static inline int randRange(int lo, int hi){ return lo + (int)(random(0x7fffffff) % (uint32_t)(hi - lo + 1)); }
 static inline float easeInOutCubic(float t){ t = t<0?0:(t>1?1:t); return (t<0.5f)?4*t*t*t:1 - powf(-2*t+2,3)/2; }
 
-// ===== Rendering helpers =====
-static void drawEyeRim(LGFX& g, const Eye& e){
-  g.fillCircle(e.cx, e.cy, e.rWhite, TFT_WHITE);
-  g.drawCircle(e.cx, e.cy, e.rWhite, TFT_DARKGREY);
+// ===== Rendering: display-list rows =====
+// Every eye row comes from a coverage table: the disc row carries the rim fringe and the interior
+// colour (sclera, or lid on lid rows). Layers are resolved per row as spans, front to back: lid rows
+// hide the pupil, open rows show it clipped to the sclera interior. Face::render diffs the spans
+// against the previous frame, so lid, pupil and palette changes push only the pixels that moved.
+// Half-resolution eyes (large panels) walk the same rows on a 2x2 pixel grid: tables are a quarter
+// of the samples, rows half the edge pixels, and every span lands in the list doubled in x and y.
+static void buildEdgeTables(Edges& ed, ShapeCtl& sc, const Eye& e, int scale){
+  Sdf::start(sc.job, ed.outline[ed.front], sc.shown, e.rWhite / scale);
+  Sdf::step(sc.job, UINT32_MAX);
+  for (int k = 0; k < 2; ++k)
+    for (int fy = 0; fy < Coverage::PHASES; ++fy)
+      for (int fx = 0; fx < Coverage::PHASES; ++fx)
+        Coverage::build(ed.stamp[k][fy * Coverage::PHASES + fx], (float)(e.rPupil + k * PUPIL_PULSE_PX) / scale + 0.5f,
+                        -1.f, (float)fx / Coverage::PHASES, (float)fy / Coverage::PHASES);
 }
 
-static void paintScleraHBandCircle(LGFX& g, const Eye& e, int yStart, int yEnd) {
-  yStart = max(yStart, e.cy - e.rWhite);
-  yEnd   = min(yEnd,   e.cy + e.rWhite);
-  for (int y = yStart; y < yEnd; ++y) {
-    const int dy = y - e.cy;
-    const int r2 = e.rWhite * e.rWhite;
-    const int maxdx = (int)floorf(sqrtf((float)max(0, r2 - dy*dy)));
-    g.drawFastHLine(e.cx - maxdx, y, maxdx * 2 + 1, TFT_WHITE);
-  }
+// Rows [top, bot) of an eye are open (sclera + pupil); rows above top / from bot on are lid.
+static inline void openRows(const Eye& e, int& top, int& bot){
+  top = e.cy - e.rWhite + (int)(e.rWhite * e.lidU) + LID_OVERLAP_PX;
+  bot = e.cy + e.rWhite - (int)(e.rWhite * e.lidL) - LID_OVERLAP_PX;
 }
 
-static void updateUpperLid(LGFX& g, Eye& e, float newLidU) {
-  newLidU = clampf(newLidU, 0.f, 1.f);
-  const int x0 = e.cx - e.rWhite;
-  const int w  = e.rWhite * 2;
-  const int yU = e.cy - e.rWhite;
-  const int oldH = (int)(e.rWhite * e.lidU_prev);
-  const int newH = (int)(e.rWhite * newLidU);
-  if (newH == oldH) { e.lidU_prev = e.lidU = newLidU; return; }
-
-  if (newH > oldH) {
-    const int y = yU + max(0, oldH - LID_OVERLAP_PX);
-    const int h = (newH - oldH) + LID_OVERLAP_PX * 2;
-    g.setClipRect(x0, y, w, min(h, (yU + e.rWhite) - y + 1));
-    g.fillRect(x0, y, w, min(h, (yU + e.rWhite) - y + 1), TFT_BLACK);
-    g.clearClipRect();
-  } else {
-    paintScleraHBandCircle(g, e, yU + max(0, newH - LID_OVERLAP_PX), yU + oldH + LID_OVERLAP_PX);
-  }
-  e.lidU_prev = e.lidU = newLidU;
+// Stamp for a sub-pixel position: whole-pixel origin plus the table pre-shifted to its phase.
+static inline const Coverage::StampTable& stampAt(const Edges& ed, int qx, int qy, int& px, int& py){
+  px = qx / Coverage::PHASES; py = qy / Coverage::PHASES;   // on-screen positions are never negative
+  return ed.stamp[ed.pupil][(qy % Coverage::PHASES) * Coverage::PHASES + (qx % Coverage::PHASES)];
 }
 
-static void updateLowerLid(LGFX& g, Eye& e, float newLidL) {
-  newLidL = clampf(newLidL, 0.f, 1.f);
-  const int x0 = e.cx - e.rWhite;
-  const int w  = e.rWhite * 2;
-  const int yL = e.cy + e.rWhite;
-  const int oldH = (int)(e.rWhite * e.lidL_prev);
-  const int newH = (int)(e.rWhite * newLidL);
-  if (newH == oldH) { e.lidL_prev = e.lidL = newLidL; return; }
-
-  if (newH > oldH) {
-    const int y = yL - newH - LID_OVERLAP_PX;
-    const int h = (newH - oldH) + LID_OVERLAP_PX * 2;
-    const int yClip = max(y, yL - e.rWhite);
-    g.setClipRect(x0, yClip, w, min(h, yL - yClip));
-    g.fillRect(x0, yClip, w, min(h, yL - yClip), TFT_BLACK);
-    g.clearClipRect();
+// Out: fill(x, len, c) and put(x, c), in the eye's pixel grid.
+template <class Out>
+FACE_IRAM(eyes) static void emitEyeRow(Out& dl, const Eye& e, const Edges& ed, int y){
+  const Coverage::Table& disc = ed.disc();
+  const Coverage::Row* r = disc.at(y - e.cy);
+  if (!r || r->x0 > r->x1) return;
+  const Theme::Palette& pal = Theme::palette();
+  int top, bot;
+  openRows(e, top, bot);
+  const bool open = (y >= top && y < bot);
+  const Coverage::Ramp& ramp = open ? pal.sclera : pal.lid;
+  const uint16_t inner = ramp.lut[Coverage::FULL];
+  const int ia = e.cx + r->f0, ib = e.cx + r->f1;
+
+  // pupil span on this row, clipped to the sclera interior (empty when pa > pb)
+  int px = 0, py = 0, pa = 1, pb = 0;
+  const Coverage::StampTable& st = stampAt(ed, e.qx, e.qy, px, py);
+  const Coverage::Row* pr = open ? st.at(y - py) : nullptr;
+  if (pr && pr->x0 <= pr->x1) { pa = max(px + pr->x0, ia); pb = min(px + pr->x1, ib); }
+
+  for (int dx = r->x0; dx < r->f0; ++dx) dl.put(e.cx + dx, ramp.lut[disc.t(*r, dx)]);
+  if (pa <= pb) {
+    dl.fill(ia, pa - ia, inner);
+    for (int x = pa; x <= pb; ++x) dl.put(x, pal.iris.lut[st.t(*pr, x - px)]);
+    dl.fill(pb + 1, ib - pb, inner);
   } else {
-    paintScleraHBandCircle(g, e, yL - oldH - LID_OVERLAP_PX, yL - newH + LID_OVERLAP_PX);
+    dl.fill(ia, ib - ia + 1, inner);
   }
-  e.lidL_prev = e.lidL = newLidL;
+  for (int dx = max((int)r->f0, r->f1 + 1); dx <= r->x1; ++dx) dl.put(e.cx + dx, ramp.lut[disc.t(*r, dx)]);
 }
 
-static void movePupil(LGFX& g, Eye& e, int newPx, int newPy) {
-  if (newPx == e.px && newPy == e.py) return;
+// Half-resolution rows into the list: each pixel becomes 2 columns (the caller emits the row twice).
+struct Doubled {
+  DList::List& dl;
+  inline void fill(int x, int len, uint16_t c){ dl.fill(2 * x, 2 * len, c); }
+  inline void put(int x, uint16_t c){ dl.fill(2 * x, 2, c); }
+};
 
-  const int minx = min(e.px, newPx) - e.rPupil - 2;
-  const int maxx = max(e.px, newPx) + e.rPupil + 2;
-  const int miny = min(e.py, newPy) - e.rPupil - 2;
-  const int maxy = max(e.py, newPy) + e.rPupil + 2;
+// An eye on the half-resolution grid: screen pixel x is half pixel x / 2. The pupil keeps its
+// sub-pixel offset from the centre, halved.
+static inline Eye halfEye(const Eye& e){
+  Eye h = e;
+  h.cx = e.cx >> 1; h.cy = e.cy >> 1;
+  h.rWhite = e.rWhite / HALF_RES; h.rPupil = e.rPupil / HALF_RES;
+  h.qx = h.cx * Coverage::PHASES + (e.qx - e.cx * Coverage::PHASES) / HALF_RES;
+  h.qy = h.cy * Coverage::PHASES + (e.qy - e.cy * Coverage::PHASES) / HALF_RES;
+  return h;
+}
 
-  g.setClipRect(minx, miny, maxx - minx + 1, maxy - miny + 1);
-  if (e.px || e.py) g.fillCircle(e.px, e.py, e.rPupil, TFT_WHITE);
-  g.fillCircle(newPx, newPy, e.rPupil, TFT_BLACK);
-  g.clearClipRect();
+// Both eyes' spans on row y, left eye first.
+FACE_IRAM(eyes) static void emitRow(DList::List& dl, const State& s, int y){
+  if (s.scale == 1) {
+    emitEyeRow(dl, s.L, s.edges, y);
+    emitEyeRow(dl, s.R, s.edges, y);
+    return;
+  }
+  Doubled d{ dl };
+  emitEyeRow(d, halfEye(s.L), s.edges, y >> 1);
+  emitEyeRow(d, halfEye(s.R), s.edges, y >> 1);
+}
 
-  e.px = newPx; e.py = newPy;
+// ===== Outline morph =====
+// Each frame advances the morph clock; a raster of the blend due when it will land (`lag` frames on)
+// runs into the back table within Sdf::EVAL_BUDGET samples and is swapped in when complete, so a morph
+// shows every blend it manages to finish, the last on its final frame, and a static shape costs nothing.
+static void stepShape(State& s){
+  ShapeCtl& sc = s.shape;
+  if (sc.frame < sc.frames) ++sc.frame;
+  if (!sc.job.busy) {
+    if (sc.shown.t >= Sdf::BLEND_ONE || sc.frames == 0) return;
+    Sdf::Morph m = sc.shown;
+    uint32_t at = sc.frame + sc.lag;
+    if (at >= sc.frames) at = sc.frames;
+    else if (at + sc.lag + 1 > sc.frames) return;   // too late for another blend: wait for the last one
+    m.t = (uint16_t)(at * Sdf::BLEND_ONE / sc.frames);
+    if (m.t == sc.shown.t) return;
+    sc.jobFrame = sc.frame;
+    Sdf::start(sc.job, s.edges.outline[s.edges.front ^ 1], m, s.L.rWhite / s.scale);
+  }
+  TRACE_SCOPE_ARG(Trace::EYE_SHAPE, sc.job.row);
+  if (!Sdf::step(sc.job)) return;
+  s.edges.front ^= 1;
+  sc.lag = (uint8_t)min<uint32_t>(sc.frame - sc.jobFrame, 255);
+  sc.shown = sc.job.m;
+  if (sc.shown.t >= Sdf::BLEND_ONE) { sc.shown.from = sc.shown.to; sc.frames = 0; }
 }
 
 // ===== Gaze/blink FSM =====
@@ -186,8 +274,16 @@ static void scheduleNextBlink(State& s){
   s.blink.nextTriggerMsR = s.blink.nextTriggerMsL + BLINK_EYE_OFFSET_MS;
 }
 
+// Gaze centred and fixating, next blinks scheduled from now.
+static void startBehaviour(State& s){
+  s.gaze = GazeCtl(); s.blink = BlinkCtl(); s.audio = AudioCtl();
+  s.gaze.posX=0.f; s.gaze.posY=0.f; s.gaze.driftPhase=0.f; enterFixate(s, s.L.maxOffset);
+  scheduleNextBlink(s);
+}
+
 // ===== Public API =====
-static void init(LGFX& g, State& s, const Layout& lay) {
+// Sets up state only; the first Face::render draws the eyes.
+static void init(State& s, const Layout& lay) {
   s.L = Eye(lay.cxL, lay.cy, lay.rWhite, lay.rPupil, lay.maxOffset);
   s.R = Eye(lay.cxR, lay.cy, lay.rWhite, lay.rPupil, lay.maxOffset);
   s.oldCy = s.L.cy;
@@ -203,31 +299,57 @@ static void init(LGFX& g, State& s, const Layout& lay) {
   s.L.maxOffset = min(s.L.maxOffset, safeL);
   s.R.maxOffset = min(s.R.maxOffset, safeR);
 
-  drawEyeRim(g, s.L); drawEyeRim(g, s.R);
+  s.shape = ShapeCtl();
+  s.scale = (uint8_t)(lay.scale == HALF_RES ? HALF_RES : 1);
+  buildEdgeTables(s.edges, s.shape, s.L, s.scale);
+  Theme::setQuality(EDGE_QUALITY_DEFAULT);
 
-  s.L.px=s.L.cx; s.L.py=s.L.cy; s.R.px=s.R.cx; s.R.py=s.R.cy;
-  g.fillCircle(s.L.px, s.L.py, s.L.rPupil, TFT_BLACK);
-  g.fillCircle(s.R.px, s.R.py, s.R.rPupil, TFT_BLACK);
+  constexpr int Q = Coverage::PHASES;
+  s.L.qx = s.L.cx * Q; s.L.qy = s.L.cy * Q;
+  s.R.qx = s.R.cx * Q; s.R.qy = s.R.cy * Q;
+  s.L.lidU = s.R.lidU = BASE_UPPER_LID;
+  s.L.lidL = s.R.lidL = BASE_LOWER_LID;
 
-  s.L.lidU_prev = s.L.lidL_prev = 0.f;
-  s.R.lidU_prev = s.R.lidL_prev = 0.f;
+  startBehaviour(s);
+}
 
-  g.startWrite();
-  updateUpperLid(g, s.L, BASE_UPPER_LID); updateLowerLid(g, s.L, BASE_LOWER_LID);
-  updateUpperLid(g, s.R, BASE_UPPER_LID); updateLowerLid(g, s.R, BASE_LOWER_LID);
-  g.drawCircle(s.L.cx, s.L.cy, s.L.rWhite, TFT_DARKGREY);
-  g.drawCircle(s.R.cx, s.R.cy, s.R.rWhite, TFT_DARKGREY);
-  g.endWrite();
+// Morphs both outlines to `to` over `frames` frames (0 = next frame). Starting mid-morph continues
+// from the nearer of the two shapes being blended.
+static void setShape(State& s, const Sdf::Shape& to, uint16_t frames = Sdf::MORPH_FRAMES_DEFAULT){
+  ShapeCtl& sc = s.shape;
+  const Sdf::Shape from = (sc.shown.t * 2 >= Sdf::BLEND_ONE) ? sc.shown.to : sc.shown.from;
+  if (from == to && sc.shown.to == to) return;
+  sc.shown.from = from; sc.shown.to = to;
+  sc.shown.t = 0;
+  sc.frame = 0; sc.frames = frames ? frames : 1;
+  sc.job.busy = false;
+}
 
-  s.L.lidU = s.L.lidU_prev = BASE_UPPER_LID; s.L.lidL = s.L.lidL_prev = BASE_LOWER_LID;
-  s.R.lidU = s.R.lidU_prev = BASE_UPPER_LID; s.R.lidL = s.R.lidL_prev = BASE_LOWER_LID;
+// Native or half-resolution eyes (HALF_RES); rebuilds the tables at the current blend. The mouth
+// and caption always render at native resolution.
+static void setScale(State& s, int scale){
+  scale = scale == HALF_RES ? HALF_RES : 1;
+  if (scale == s.scale) return;
+  s.scale = (uint8_t)scale;
+  buildEdgeTables(s.edges, s.shape, s.L, s.scale);
+}
 
-  s.gaze.posX=0.f; s.gaze.posY=0.f; s.gaze.driftPhase=0.f; enterFixate(s, s.L.maxOffset);
-  scheduleNextBlink(s);
+// An onset heard now (strength 0..255): the pupils pulse, strong ones lift the lids too.
+static void onset(State& s, uint8_t strength){
+  const uint32_t t = nowMs();
+  s.audio.pulseUntilMs = t + PUPIL_PULSE_MS_MIN + (PUPIL_PULSE_MS_MAX - PUPIL_PULSE_MS_MIN) * strength / 255;
+  if (strength >= EMPHASIS_STRENGTH) {
+    s.audio.lift = LID_LIFT * (float)(strength - EMPHASIS_STRENGTH + 1) / (float)(256 - EMPHASIS_STRENGTH);
+    s.audio.liftStartMs = t;
+  }
 }
 
-// one frame update (call at fixed cadence). Returns newCy if you need it for mouth placement.
-static int update(LGFX& g, State& s, float dt) {
+// Loud passages hold off blinks; the one that was due comes soon after.
+static void setLoud(State& s, bool loud){ s.audio.loud = loud; }
+
+// one frame update (call at fixed cadence): advances gaze, blinks, lids and pupils; drawing is
+// Face::render. Returns the eye centre Y if you need it for mouth placement.
+static int update(State& s, float dt) {
   const uint32_t tNow = nowMs();
   const uint32_t tIn  = tNow - s.gaze.stateStartMs;
 
@@ -256,7 +378,11 @@ static int update(LGFX& g, State& s, float dt) {
     else { s.gaze.posX += dx/len * step; s.gaze.posY += dy/len * step; }
   }
 
-  // Blink schedule
+  // Blink schedule (held while loud)
+  if (s.audio.loud && !s.blink.activeL && !s.blink.activeR && tNow >= s.blink.nextTriggerMsL){
+    s.blink.nextTriggerMsL = tNow + LOUD_BLINK_DEFER_MS;
+    s.blink.nextTriggerMsR = s.blink.nextTriggerMsL + BLINK_EYE_OFFSET_MS;
+  }
   if (!s.blink.activeL && tNow >= s.blink.nextTriggerMsL){ s.blink.activeL=true; s.blink.startMsL=tNow; }
   if (!s.blink.activeR && tNow >= s.blink.nextTriggerMsR){ s.blink.activeR=true; s.blink.startMsR=tNow; }
 
@@ -265,8 +391,13 @@ static int update(LGFX& g, State& s, float dt) {
     return (ph < 0.5f) ? (ph*2.f) : (1.f - (ph - 0.5f)*2.f);
   };
 
-  float targetU_L = BASE_UPPER_LID, targetL_L = BASE_LOWER_LID;
-  float targetU_R = BASE_UPPER_LID, targetL_R = BASE_LOWER_LID;
+  // lid lift on emphasis, easing back
+  const uint32_t tLift = tNow - s.audio.liftStartMs;
+  const float lift = (tLift < (uint32_t)LID_LIFT_MS) ? s.audio.lift * (1.f - easeInOutCubic((float)tLift / LID_LIFT_MS)) : 0.f;
+  s.edges.pupil = (int32_t)(s.audio.pulseUntilMs - tNow) > 0;
+
+  float targetU_L = BASE_UPPER_LID - lift, targetL_L = BASE_LOWER_LID;
+  float targetU_R = BASE_UPPER_LID - lift, targetL_R = BASE_LOWER_LID;
 
   if (s.blink.activeL){
     float u = tri(s.blink.startMsL, tNow);
@@ -281,20 +412,19 @@ static int update(LGFX& g, State& s, float dt) {
     if ((tNow - s.blink.startMsR) >= (uint32_t)BLINK_DUR_MS){ s.blink.activeR=false; }
   }
 
-  const int newLx = clampi(s.L.cx + (int)lrintf(s.gaze.posX), s.L.cx - s.L.maxOffset, s.L.cx + s.L.maxOffset);
-  const int newLy = clampi(s.L.cy + (int)lrintf(s.gaze.posY), s.L.cy - s.L.maxOffset, s.L.cy + s.L.maxOffset);
-  const int newRx = clampi(s.R.cx + (int)lrintf(s.gaze.posX), s.R.cx - s.R.maxOffset, s.R.cx + s.R.maxOffset);
-  const int newRy = clampi(s.R.cy + (int)lrintf(s.gaze.posY), s.R.cy - s.R.maxOffset, s.R.cy + s.R.maxOffset);
+  // Pupil targets in 1/PHASES px: slow pursuit and micro-drift move by sub-pixel steps instead of freezing.
+  constexpr int Q = Coverage::PHASES;
+  const int newLx = clampi(s.L.cx * Q + (int)lrintf(s.gaze.posX * Q), (s.L.cx - s.L.maxOffset) * Q, (s.L.cx + s.L.maxOffset) * Q);
+  const int newLy = clampi(s.L.cy * Q + (int)lrintf(s.gaze.posY * Q), (s.L.cy - s.L.maxOffset) * Q, (s.L.cy + s.L.maxOffset) * Q);
+  const int newRx = clampi(s.R.cx * Q + (int)lrintf(s.gaze.posX * Q), (s.R.cx - s.R.maxOffset) * Q, (s.R.cx + s.R.maxOffset) * Q);
+  const int newRy = clampi(s.R.cy * Q + (int)lrintf(s.gaze.posY * Q), (s.R.cy - s.R.maxOffset) * Q, (s.R.cy + s.R.maxOffset) * Q);
 
-  g.startWrite();
-  movePupil(g, s.L, newLx, newLy);
-  movePupil(g, s.R, newRx, newRy);
-  updateUpperLid(g, s.L, targetU_L); updateLowerLid(g, s.L, targetL_L);
-  updateUpperLid(g, s.R, targetU_R); updateLowerLid(g, s.R, targetL_R);
-  g.drawCircle(s.L.cx, s.L.cy, s.L.rWhite, TFT_DARKGREY);
-  g.drawCircle(s.R.cx, s.R.cy, s.R.rWhite, TFT_DARKGREY);
-  g.endWrite();
+  s.L.qx = newLx; s.L.qy = newLy;
+  s.R.qx = newRx; s.R.qy = newRy;
+  s.L.lidU = clampf(targetU_L, 0.f, 1.f); s.L.lidL = clampf(targetL_L, 0.f, 1.f);
+  s.R.lidU = clampf(targetU_R, 0.f, 1.f); s.R.lidL = clampf(targetL_R, 0.f, 1.f);
 
+  stepShape(s);
   return s.L.cy; // current eye center Y (useful for mouth placement)
 }
 
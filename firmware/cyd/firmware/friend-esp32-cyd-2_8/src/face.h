@@ -0,0 +1,317 @@
+#pragma once
+#include <Arduino.h>
+#include <LovyanGFX.hpp>
+#include "trace.h"
+#include "iram.h"
+#include "theme.h"
+#include "display_list.h"
+#include "tiles.h"
+#include "batch.h"
+#include "scroll.h"
+#include "caption.h"
+#include "eyes.h"
+#include "mouth_patterns.h"
+
+// ===== Face renderer: eyes + mouth -> display list -> diff -> panel =====
+// Each frame is rebuilt from state (Eyes::State, the current MouthFrame, Theme::palette()) and compared
+// with the list already on screen: span diff by default, or 16x16 tile hashes over a retained 4bpp
+// shadow when a Tiles::Shadow is attached. Diffed spans go through Batch::Batcher, which packs them
+// into few panel windows. Nothing else draws into the face area, so state changes need no repaint
+// bookkeeping of their own. While the palette moves (theme fades) a frame pushes at most
+// Theme::FADE_PX_PER_FRAME: rows past the budget are left stale and pushed whole on later frames, as
+// are all rows when the background changes (the diff takes uncovered pixels as today's background in
+// both lists); the tile strategy does the same with stale tiles (Tiles::update). A slide (slide()) swaps faces with the hardware scroll instead: the outgoing face stays
+// frozen while the incoming one is diffed only where it is already on screen.
+namespace Face {
+
+struct Renderer {
+  DList::List list[2];
+  uint8_t     shown = 0;           // list[shown] is what the panel holds
+  Tiles::Shadow* shadow = nullptr; // set: tile-hash strategy instead of span diff
+  bool        batch = true;        // span diff: pack spans into windows (false: one window per span)
+  Scroll::Slide slide;             // running slide transition
+  bool        repaint = false;     // next frame pushes the whole screen (panel contents unknown)
+  uint16_t    bg = TFT_BLACK;      // background the panel holds outside list[shown]'s spans
+  uint32_t    palette = 0;         // Theme::version() of the last frame
+  uint8_t     stale[(DList::MAX_ROWS + 7) / 8] = {};   // rows the panel may not hold as list[shown]
+  int16_t     nStale = 0;
+  int16_t     sweep = 0;           // row the next budgeted frame starts at
+  DList::Stats last;
+  uint16_t    pushOps  = 0;        // windows pushed last frame
+  uint32_t    cmdBytes = 0;        // window setup bytes (CASET/PASET/RAMWR) last frame
+  uint32_t    pxBytes  = 0;        // pixel bytes last frame
+};
+
+// Counts what reaches the panel sink.
+template <class Sink>
+struct Meter {
+  Sink& out;
+  uint16_t windows = 0;
+  uint32_t px = 0;
+  inline void fill(int x, int y, int w, int h, uint16_t c){ out.fill(x, y, w, h, c); ++windows; px += w * h; }
+  inline void image(int x, int y, int w, int h, const uint16_t* p){ out.image(x, y, w, h, p); ++windows; px += w * h; }
+  inline void scroll(int line){ out.scroll(line); }
+};
+
+// Mouth::style bits; 0 is the original look (each segment a separate 1 px line).
+static constexpr uint8_t LIPS_JOIN   = 1;   // vertical runs join neighbouring segments (and the anchors)
+static constexpr uint8_t LIPS_CAVITY = 2;   // fill between the lips where the upper one is above
+static constexpr uint8_t LIPS_TEETH  = 4;   // with the cavity: a teeth band under the upper lip
+
+// Where the mouth sits, which frame it shows (nullptr = no mouth) and how the lips are drawn.
+struct Mouth {
+  int baseY = -1, w = 0;
+  const MouthFrame* frame = nullptr;
+  uint8_t style = LIPS_JOIN;
+};
+
+// Dual-lip mouth with fixed ANCHOR_PX ends; SIGNED offsets (+ = above baseline). Spans on row y only.
+// A scanline walk over the two polylines: segment i spans columns [x[i], x[i + 1]) with the lips on
+// rows u[i] / l[i] (the anchors are segments at the baseline). A joined lip also covers the first
+// column of a segment between the previous segment's row and its own; the cavity is the rows
+// strictly between the lips, teeth its top MOUTH_TEETH_PX rows where it is over twice that tall.
+FACE_IRAM(face) static void emitMouthRow(DList::List& dl, const Mouth& m, int screenW, int y){
+  if (!m.frame || y < m.baseY - MOUTH_MAX_DY || y > m.baseY + MOUTH_MAX_DY) return;
+  constexpr int N = MOUTH_SEGMENTS + 2;
+  const MouthFrame& mf = *m.frame;
+  const Theme::Palette& pal = Theme::palette();
+  const int mouthX = (screenW - m.w) / 2;
+  const bool join = m.style & LIPS_JOIN, cavity = m.style & LIPS_CAVITY, teeth = m.style & LIPS_TEETH;
+
+  // Column edges: anchors, then the inner segments (symmetric widths: innerW * i / SEGMENTS, rounded)
+  int x[N + 1], u[N], l[N];
+  const int innerW = m.w - 2*ANCHOR_PX;
+  x[0] = mouthX; u[0] = l[0] = m.baseY;
+  for (int i = 0, acc = MOUTH_SEGMENTS; i < MOUTH_SEGMENTS; ++i, acc += 2 * innerW) {
+    x[i + 1] = mouthX + ANCHOR_PX + acc / (2 * MOUTH_SEGMENTS);
+    u[i + 1] = m.baseY - constrain((int)mf.upper[i], -MOUTH_MAX_DY, MOUTH_MAX_DY);
+    l[i + 1] = m.baseY - constrain((int)mf.lower[i], -MOUTH_MAX_DY, MOUTH_MAX_DY);
+  }
+  x[N - 1] = mouthX + m.w - ANCHOR_PX; u[N - 1] = l[N - 1] = m.baseY;
+  x[N] = mouthX + m.w;
+
+  auto between = [](int v, int a, int b){ return a < b ? (v >= a && v <= b) : (v >= b && v <= a); };
+  for (int i = 0; i < N; ++i) {
+    // ensure every inner segment is at least 1 px (the last one ends exactly at the right anchor)
+    const int xa = x[i], xb = (i > 0 && i < N - 1) ? max(x[i + 1], xa + 1) : x[i + 1];
+    if (xb <= xa) continue;
+    uint16_t c = 0; bool on = false;
+    if (y == u[i] || y == l[i]) {
+      on = true; c = pal.lip;
+    } else if (cavity && u[i] < y && y < l[i]) {
+      on = true;
+      c = (teeth && l[i] - u[i] - 1 > 2 * MOUTH_TEETH_PX && y - u[i] <= MOUTH_TEETH_PX) ? pal.teeth : pal.cavity;
+    }
+    // joint column: the lip runs vertically from the previous segment's row to this one's
+    if (join && i > 0 && (between(y, u[i - 1], u[i]) || between(y, l[i - 1], l[i]))) {
+      dl.put(xa, pal.lip);
+      if (on) dl.fill(xa + 1, xb - xa - 1, c);
+    } else if (on) {
+      dl.fill(xa, xb - xa, c);
+    }
+  }
+}
+
+// Whole frame as a display list, top row to bottom. Half-resolution eyes are walked on even rows
+// only; odd rows repeat the even row's eye spans.
+static void build(DList::List& dl, const Eyes::State& eyes, const Mouth& mouth, const Caption::Strip* caption,
+                  int screenW, int screenH){
+  dl.begin();
+  int eye0 = 0, eye1 = 0;   // the last walked row's eye spans
+  for (int y = 0; y < min(screenH, DList::MAX_ROWS); ++y) {
+    if (caption) Caption::emitRow(dl, *caption, y);
+    if (eyes.scale != 1 && (y & 1)) {
+      for (int i = eye0; i < eye1; ++i) dl.fill(dl.span[i].x0, dl.span[i].x1 - dl.span[i].x0 + 1, dl.span[i].c);
+    } else {
+      eye0 = dl.n;
+      Eyes::emitRow(dl, eyes, y);
+      eye1 = dl.n;
+    }
+    emitMouthRow(dl, mouth, screenW, y);
+    dl.endRow();
+  }
+}
+
+static inline bool isStale(const Renderer& r, int y){ return r.stale[y >> 3] & (1 << (y & 7)); }
+
+static inline void setStale(Renderer& r, int y, bool on){
+  if (isStale(r, y) == on) return;
+  r.stale[y >> 3] ^= (uint8_t)(1 << (y & 7));
+  r.nStale += on ? 1 : -1;
+}
+
+static inline void clearStale(Renderer& r){ memset(r.stale, 0, sizeof(r.stale)); r.nStale = 0; r.sweep = 0; }
+
+// Nothing left stale by the fade budget: the panel holds list[shown].
+static inline bool settled(const Renderer& r){ return !r.nStale && !(r.shadow && r.shadow->nStale); }
+
+// Rows [y0, y1) under the fade budget: stale rows are pushed whole, the rest diffed, until the
+// frame's pixels reach it; a changed row past that is marked stale (`deferred`: the first one).
+template <class Spans, class Sink>
+static void diffRows(Renderer& r, const DList::List& want, uint16_t bg, int y0, int y1, int screenW,
+                     int& deferred, Spans& spans, Sink& out){
+  const DList::List& shown = r.list[r.shown];
+  DList::Stats& st = r.last;
+  for (int y = y0; y < y1; ++y) {
+    const bool stale = isStale(r, y);
+    if (st.px >= Theme::FADE_PX_PER_FRAME) {
+      if (stale || !DList::sameRow(shown.rowBegin(y), shown.rowEnd(y), want.rowBegin(y), want.rowEnd(y))) {
+        setStale(r, y, true);
+        if (deferred < 0) deferred = y;
+      }
+      continue;
+    }
+    if (stale) {
+      Batch::pushArea(out, want, bg, 0, screenW - 1, y, y);
+      setStale(r, y, false);
+      st.px += screenW; ++st.emitted; ++st.rows;
+      continue;
+    }
+    const int e = DList::diffRow(shown.rowBegin(y), shown.rowEnd(y), want.rowBegin(y), want.rowEnd(y), y, bg, spans, st.px);
+    if (e) { st.emitted += e; ++st.rows; }
+  }
+}
+
+// Span diff while the palette moves or rows are stale: from r.sweep to the bottom, then from the top,
+// so each frame carries on where the budget ran out the frame before.
+template <class Sink>
+static void diffBudget(Renderer& r, const DList::List& want, uint16_t bg, int screenW, Sink& out){
+  r.last = DList::Stats();
+  r.last.spans = (uint16_t)want.n; r.last.overflow = want.overflow;
+  int deferred = -1;
+  const int from = min((int)r.sweep, want.rows);
+  for (int pass = 0; pass < 2; ++pass) {
+    const int y0 = pass ? 0 : from, y1 = pass ? from : want.rows;
+    if (r.batch) {
+      Batch::Batcher<Sink> b(out, want, bg);
+      diffRows(r, want, bg, y0, y1, screenW, deferred, b, out);
+      b.finish();
+    } else {
+      Batch::PerSpan<Sink> b{ out };
+      diffRows(r, want, bg, y0, y1, screenW, deferred, b, out);
+    }
+  }
+  if (deferred >= 0) r.sweep = (int16_t)deferred;
+}
+
+// One slide step: the diff is clipped to incoming columns already on screen, the columns about to
+// wrap into view are pushed whole, then the start line moves.
+template <class Sink>
+static void slideStep(Renderer& r, const DList::List& want, uint16_t bg, int screenH, Sink& out){
+  int lo, hi;
+  Scroll::revealed(r.slide, lo, hi);
+  if (lo < hi) {
+    Batch::Batcher<Sink> b(out, want, bg);
+    DList::Clip<Batch::Batcher<Sink>> clip{ b, lo, hi - 1 };
+    DList::diff(r.list[r.shown], want, bg, clip, r.last);
+    b.finish();
+  } else {
+    r.last = DList::Stats();
+  }
+  Scroll::exposed(r.slide, lo, hi);
+  Batch::pushArea(out, want, bg, lo, hi - 1, 0, screenH - 1);
+  const bool more = Scroll::advance(r.slide);
+  out.scroll(more ? Scroll::startLine(r.slide) : 0);
+  if (!more && r.shadow) Tiles::sync(*r.shadow, want);
+}
+
+// Builds the frame and hands what changed to `out`: fill(x, y, w, h, c) / image(x, y, w, h, px),
+// and scroll(line) while a slide runs.
+template <class Sink>
+static const DList::Stats& render(Renderer& r, const Eyes::State& eyes, const Mouth& mouth,
+                                  const Caption::Strip* caption, int screenW, int screenH, Sink& out){
+  DList::List& want = r.list[r.shown ^ 1];
+  {
+    TRACE_SCOPE(Trace::RENDER_BUILD);
+    build(want, eyes, mouth, caption, screenW, screenH);
+  }
+  {
+    TRACE_SCOPE_ARG(Trace::RENDER_DIFF, min(want.n / 16, 255));
+    const uint16_t bg = Theme::palette().bg;
+    const bool paletteMoved = Theme::version() != r.palette;
+    r.palette = Theme::version();
+    Meter<Sink> m{ out };
+    if (r.repaint) {
+      m.scroll(0);
+      Batch::pushArea(m, want, bg, 0, screenW - 1, 0, screenH - 1);
+      r.last = DList::Stats();
+      r.repaint = false;
+      r.bg = bg; clearStale(r);
+      if (r.shadow) Tiles::sync(*r.shadow, want);
+    } else if (r.slide.active()) {
+      slideStep(r, want, bg, screenH, m);
+    } else if (r.shadow) {
+      Tiles::update(*r.shadow, r.list[r.shown], want, paletteMoved || r.shadow->nStale ? Theme::FADE_PX_PER_FRAME : UINT32_MAX, m);
+      r.bg = bg;
+    } else if (r.bg != bg || paletteMoved || r.nStale) {
+      if (r.bg != bg) {
+        for (int y = 0; y < DList::MAX_ROWS; ++y) setStale(r, y, true);
+        r.bg = bg;
+      }
+      diffBudget(r, want, bg, screenW, m);
+    } else if (r.batch) {
+      Batch::Batcher<Meter<Sink>> b(m, want, bg);
+      DList::diff(r.list[r.shown], want, bg, b, r.last);
+      b.finish();
+    } else {
+      Batch::PerSpan<Meter<Sink>> b{ m };
+      DList::diff(r.list[r.shown], want, bg, b, r.last);
+    }
+    r.pushOps  = m.windows;
+    r.cmdBytes = (uint32_t)m.windows * Batch::WINDOW_CMD_BYTES;
+    r.pxBytes  = m.px * 2;
+  }
+  r.shown ^= 1;
+  return r.last;
+}
+
+struct GfxSink {
+  LGFX& g;
+  inline void fill(int x, int y, int w, int h, uint16_t c){ g.fillRect(x, y, w, h, c); }
+  inline void image(int x, int y, int w, int h, const uint16_t* px){ g.pushImage(x, y, w, h, (const lgfx::rgb565_t*)px); }
+  inline void scroll(int line){ Scroll::setStart(g, line); }
+};
+
+static const DList::Stats& render(LGFX& g, Renderer& r, const Eyes::State& eyes, const Mouth& mouth,
+                                  const Caption::Strip* caption = nullptr){
+  GfxSink sink{ g };
+  g.startWrite();
+  render(r, eyes, mouth, caption, g.width(), g.height(), sink);
+  {
+    TRACE_SCOPE(Trace::DMA);
+    g.waitDMA();
+  }
+  g.endWrite();
+  return r.last;
+}
+
+// The panel was cleared to the background: the next render pushes the whole face.
+static void reset(Renderer& r){
+  r.list[r.shown].begin();
+  r.bg = Theme::palette().bg; r.palette = Theme::version();
+  clearStale(r);
+  if (r.shadow) Tiles::sync(*r.shadow, r.list[r.shown]);
+}
+
+// The panel holds something else (sleep frames, another app): the next render redraws everything
+// once, background included, and cancels a running slide.
+static void repaint(Renderer& r){
+  r.repaint = true;
+  r.slide = Scroll::Slide();
+}
+
+// Slides the face currently on screen out and whatever the following frames build in, one step per
+// render. Change the state (theme, mood, sleep) together with the call.
+static void slide(Renderer& r, Scroll::Dir dir, int step = Scroll::SLIDE_PX_PER_FRAME){
+  Scroll::begin(r.slide, dir, step);
+}
+
+// Switches strategy at runtime (nullptr = span diff). The shadow is synced to what the panel shows,
+// so the switch itself pushes nothing.
+static void useTiles(Renderer& r, Tiles::Shadow* sh){
+  r.shadow = sh;
+  if (sh) Tiles::sync(*sh, r.list[r.shown]);
+  if (sh && r.nStale) repaint(r);   // the shadow cannot know the stale rows
+}
+
+} // namespace Face
@@ -0,0 +1,21 @@
+#pragma once
+#include <Arduino.h>
+
+// ===== IRAM placement for the render / audio hot path =====
+// The ESP32 runs code from flash through a small cache; SD, decode and the library code around our
+// loops evict it, and a flash-resident inner loop then pays a cache miss per line it runs again.
+// FACE_IRAM(module) puts a function in IRAM under its own section (.iram1.face.<module>) so
+// tools/iram_report.py can total IRAM usage per module from the map file. It does not help during a
+// flash read, write or erase: IDF parks the other CPU for those, IRAM or not. Tag the loops; a
+// function whose work is mostly calls into flash (libm, drivers, the audio library, the panel) only
+// moves the misses to its callees, so those stay untagged.
+// Build with -D FACE_NO_IRAM to compare against flash-resident code.
+#if defined(ARDUINO_ARCH_ESP32) && !defined(FACE_NO_IRAM)
+  #define FACE_IRAM(module)  __attribute__((noinline, section(".iram1.face." #module)))
+  #define FACE_DRAM          DRAM_ATTR   // lookup tables read by IRAM code
+  #define FACE_IRAM_ENABLED  1
+#else
+  #define FACE_IRAM(module)
+  #define FACE_DRAM
+  #define FACE_IRAM_ENABLED  0
+#endif
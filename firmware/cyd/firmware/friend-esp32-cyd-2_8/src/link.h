@@ -0,0 +1,168 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// ===== Link: framing for the fixed-size messages in link_msgs.h =====
+// A frame is MAGIC, id, seq (u16), the message body, crc8 over everything after MAGIC. Its size follows
+// from the id (Msg::FRAME_SIZE), so there is no length byte, and the message struct is the frame: the
+// firmware and host tools include the same generated header and read a received frame in place
+// (Msg::view) or build one in place in a TX ring (the Msg::send* helpers). Little-endian on both ends.
+// MAGIC is not ASCII, so frames share a serial port with command lines (and with Remote packets).
+namespace Link {
+
+// ---------- Tunables ----------
+static constexpr uint8_t MAGIC     = 0xFB;   // first byte of a frame (Remote uses 0xFA)
+static constexpr int     MAX_FRAME = 72;     // largest frame, crc included; link_msgs.h checks each
+static constexpr int     RING_LEN  = 1024;   // TX ring bytes; power of two
+
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "link frames are little-endian structs");
+
+#pragma pack(push, 1)
+struct Header {
+  uint8_t  magic;
+  uint8_t  id;
+  uint16_t seq;
+};
+#pragma pack(pop)
+static_assert(sizeof(Header) == 4, "Header layout");
+
+// CRC-8, polynomial 0x07, by table.
+static const uint8_t CRC8[256] = {
+  0x00, 0x07, 0x0e, 0x09, 0x1c, 0x1b, 0x12, 0x15, 0x38, 0x3f, 0x36, 0x31, 0x24, 0x23, 0x2a, 0x2d,
+  0x70, 0x77, 0x7e, 0x79, 0x6c, 0x6b, 0x62, 0x65, 0x48, 0x4f, 0x46, 0x41, 0x54, 0x53, 0x5a, 0x5d,
+  0xe0, 0xe7, 0xee, 0xe9, 0xfc, 0xfb, 0xf2, 0xf5, 0xd8, 0xdf, 0xd6, 0xd1, 0xc4, 0xc3, 0xca, 0xcd,
+  0x90, 0x97, 0x9e, 0x99, 0x8c, 0x8b, 0x82, 0x85, 0xa8, 0xaf, 0xa6, 0xa1, 0xb4, 0xb3, 0xba, 0xbd,
+  0xc7, 0xc0, 0xc9, 0xce, 0xdb, 0xdc, 0xd5, 0xd2, 0xff, 0xf8, 0xf1, 0xf6, 0xe3, 0xe4, 0xed, 0xea,
+  0xb7, 0xb0, 0xb9, 0xbe, 0xab, 0xac, 0xa5, 0xa2, 0x8f, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9d, 0x9a,
+  0x27, 0x20, 0x29, 0x2e, 0x3b, 0x3c, 0x35, 0x32, 0x1f, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0d, 0x0a,
+  0x57, 0x50, 0x59, 0x5e, 0x4b, 0x4c, 0x45, 0x42, 0x6f, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7d, 0x7a,
+  0x89, 0x8e, 0x87, 0x80, 0x95, 0x92, 0x9b, 0x9c, 0xb1, 0xb6, 0xbf, 0xb8, 0xad, 0xaa, 0xa3, 0xa4,
+  0xf9, 0xfe, 0xf7, 0xf0, 0xe5, 0xe2, 0xeb, 0xec, 0xc1, 0xc6, 0xcf, 0xc8, 0xdd, 0xda, 0xd3, 0xd4,
+  0x69, 0x6e, 0x67, 0x60, 0x75, 0x72, 0x7b, 0x7c, 0x51, 0x56, 0x5f, 0x58, 0x4d, 0x4a, 0x43, 0x44,
+  0x19, 0x1e, 0x17, 0x10, 0x05, 0x02, 0x0b, 0x0c, 0x21, 0x26, 0x2f, 0x28, 0x3d, 0x3a, 0x33, 0x34,
+  0x4e, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5c, 0x5b, 0x76, 0x71, 0x78, 0x7f, 0x6a, 0x6d, 0x64, 0x63,
+  0x3e, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2c, 0x2b, 0x06, 0x01, 0x08, 0x0f, 0x1a, 0x1d, 0x14, 0x13,
+  0xae, 0xa9, 0xa0, 0xa7, 0xb2, 0xb5, 0xbc, 0xbb, 0x96, 0x91, 0x98, 0x9f, 0x8a, 0x8d, 0x84, 0x83,
+  0xde, 0xd9, 0xd0, 0xd7, 0xc2, 0xc5, 0xcc, 0xcb, 0xe6, 0xe1, 0xe8, 0xef, 0xfa, 0xfd, 0xf4, 0xf3,
+};
+
+static inline uint8_t crc8(const uint8_t* p, int n){
+  uint8_t c = 0;
+  while (n--) c = CRC8[c ^ *p++];
+  return c;
+}
+
+// ---------- TX ring ----------
+// SPSC byte ring: one producer encodes frames in place, one consumer drains bytes to the port. A frame
+// never straddles the end of the buffer: the producer skips the tail of the lap (deadAt) instead, so
+// each reserved frame is contiguous. Plain data, so a ring can live in shared memory.
+struct Ring {
+  uint32_t head = 0, tail = 0;     // free-running, skipped bytes included; written by producer / consumer only
+  uint32_t deadAt = UINT32_MAX;    // start of the skipped tail of a lap
+  uint32_t skip = 0;               // producer: bytes skipped by the frame being written
+  uint32_t frames = 0, dropped = 0;   // frames committed / refused, ring full
+  uint8_t  buf[RING_LEN];
+};
+
+// Contiguous room for an n-byte frame, or nullptr when the ring is full.
+static uint8_t* reserve(Ring& r, int n){
+  const uint32_t tail = __atomic_load_n(&r.tail, __ATOMIC_ACQUIRE);
+  const uint32_t off = r.head & (RING_LEN - 1);
+  r.skip = off + n > (uint32_t)RING_LEN ? RING_LEN - off : 0;
+  if (r.head + r.skip + n - tail > (uint32_t)RING_LEN) { ++r.dropped; return nullptr; }
+  if (r.skip) __atomic_store_n(&r.deadAt, r.head, __ATOMIC_RELAXED);   // published with head
+  return r.buf + ((r.head + r.skip) & (RING_LEN - 1));
+}
+
+// Seals the reserved frame of n bytes (its crc) and hands it to the consumer.
+static void commit(Ring& r, int n){
+  uint8_t* p = r.buf + ((r.head + r.skip) & (RING_LEN - 1));
+  p[n - 1] = crc8(p + 1, n - 2);
+  ++r.frames;
+  __atomic_store_n(&r.head, r.head + r.skip + n, __ATOMIC_RELEASE);
+}
+
+// Consumer: the next contiguous run of bytes to send (0 when empty); consume() what was sent.
+static size_t peek(Ring& r, const uint8_t*& p){
+  const uint32_t head = __atomic_load_n(&r.head, __ATOMIC_ACQUIRE);
+  uint32_t t = r.tail;
+  const uint32_t dead = __atomic_load_n(&r.deadAt, __ATOMIC_RELAXED);
+  if (t == dead && t != head) {
+    t += RING_LEN - (t & (RING_LEN - 1));
+    __atomic_store_n(&r.tail, t, __ATOMIC_RELEASE);
+  }
+  uint32_t n = head - t;
+  const uint32_t lap = RING_LEN - (t & (RING_LEN - 1));
+  if (n > lap) n = lap;
+  if ((int32_t)(dead - t) > 0 && dead - t < n) n = dead - t;
+  p = r.buf + (t & (RING_LEN - 1));
+  return n;
+}
+
+static void consume(Ring& r, size_t n){ __atomic_store_n(&r.tail, r.tail + (uint32_t)n, __ATOMIC_RELEASE); }
+
+// Consumer, frame by frame: the size of the next frame, read in place at p; 0 when there is none.
+template <int N>
+static size_t next(Ring& r, const uint8_t*& p, const uint8_t (&sizes)[N]){
+  const size_t run = peek(r, p);
+  if (!run) return 0;
+  const size_t n = p[1] < N ? sizes[p[1]] : 0;
+  return n <= run ? n : 0;
+}
+
+// Sends whole frames while `out` (an Arduino Stream) has room for them, without blocking. A frame is
+// never split, so text lines printed between drains land between frames.
+template <class Port, int N>
+static size_t drain(Ring& r, Port& out, const uint8_t (&sizes)[N]){
+  size_t sent = 0;
+  const uint8_t* p;
+  for (size_t n; (n = next(r, p, sizes)); ) {
+    if ((size_t)out.availableForWrite() < n) break;
+    out.write(p, n);
+    consume(r, n);
+    sent += n;
+  }
+  return sent;
+}
+
+// ---------- RX ----------
+// Frames assembled from a byte stream, then read in place from buf.
+struct Rx {
+  uint8_t  buf[MAX_FRAME];
+  uint8_t  got = 0, need = 0;
+  uint32_t frames = 0, bad = 0;
+};
+
+enum Fed : uint8_t { NOT_LINK = 0, MORE, FRAME };
+
+// A whole frame of n bytes at p: known id, its size, good crc.
+template <int N>
+static bool check(const uint8_t* p, size_t n, const uint8_t (&sizes)[N]){
+  return n >= sizeof(Header) + 1 && p[0] == MAGIC && p[1] < N && sizes[p[1]] == n && p[n - 1] == crc8(p + 1, (int)n - 2);
+}
+
+static inline bool receiving(const Rx& rx){ return rx.got != 0; }
+
+// One byte from a stream. NOT_LINK: not part of a frame (a command character); FRAME: buf holds one.
+template <int N>
+static Fed feed(Rx& rx, uint8_t c, const uint8_t (&sizes)[N]){
+  if (!rx.got) {
+    if (c != MAGIC) return NOT_LINK;
+    rx.buf[rx.got++] = c;
+    return MORE;
+  }
+  rx.buf[rx.got++] = c;
+  if (rx.got == 2) {
+    rx.need = c < N ? sizes[c] : 0;
+    if (!rx.need) { ++rx.bad; rx.got = 0; }
+    return MORE;
+  }
+  if (rx.got < rx.need) return MORE;
+  rx.got = 0;
+  if (rx.buf[rx.need - 1] != crc8(rx.buf + 1, rx.need - 2)) { ++rx.bad; return MORE; }
+  ++rx.frames;
+  return FRAME;
+}
+
+} // namespace Link
@@ -0,0 +1,287 @@
+#pragma once
+// Generated by tools/linkgen.py from tools/link.schema; edit the schema and regenerate.
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "link.h"
+
+// ===== Msg: the face link messages =====
+// Each struct is a whole frame (Link::Header, fields, crc8), read in place with view<M>() and built
+// in place in a TX ring with send<Name>().
+namespace Msg {
+
+static constexpr uint16_t SCHEMA = 0xa14d;   // crc16 of the schema, in Hello
+
+static constexpr uint8_t APP_USB = 0;          // Hello.app
+static constexpr uint8_t APP_FACE = 1;
+static constexpr uint8_t ACK_OK = 0;           // Ack.status
+static constexpr uint8_t ACK_UNSUPPORTED = 1;  // not a command this firmware takes
+static constexpr uint8_t ACK_REFUSED = 2;      // busy, or a bad argument
+
+enum Id : uint8_t {
+  HELLO = 1,
+  PING = 2,
+  PONG = 3,
+  ACK = 4,
+  MOOD = 5,
+  SLEEP = 6,
+  SAY = 7,
+  TRACE = 8,
+  LINK_STATS = 9,
+  SHOWN = 10,
+  NUM_IDS = 11
+};
+
+#pragma pack(push, 1)
+
+// device -> host: at boot, and in answer to a Ping with seq 0
+struct Hello {
+  static constexpr Id   ID = HELLO;
+  static constexpr bool CRITICAL = false;
+  Link::Header h;
+  uint8_t  app;                   // APP_*
+  uint16_t schema;                // Msg::SCHEMA the device was built with
+  uint16_t maxFrame;              // Link::MAX_FRAME
+  uint8_t  crc;
+};
+
+// host -> device; answered by a Pong with the same seq
+struct Ping {
+  static constexpr Id   ID = PING;
+  static constexpr bool CRITICAL = false;
+  Link::Header h;
+  uint32_t hostUs;
+  uint8_t  crc;
+};
+
+// device -> host
+struct Pong {
+  static constexpr Id   ID = PONG;
+  static constexpr bool CRITICAL = false;
+  Link::Header h;
+  uint32_t hostUs;                // the Ping's, echoed
+  uint32_t deviceUs;              // device clock when the Ping was read
+  uint8_t  crc;
+};
+
+// device -> host: result of a command message
+struct Ack {
+  static constexpr Id   ID = ACK;
+  static constexpr bool CRITICAL = false;
+  Link::Header h;
+  uint8_t  cmd;                   // the command's message id
+  uint8_t  status;                // ACK_*
+  uint16_t cmdSeq;                // the command's seq
+  uint8_t  crc;
+};
+
+// host -> device: show a mouth mood (0 neutral, 1 smile, 2 frown, 3 puzzled, 4 oooh)
+struct Mood {
+  static constexpr Id   ID = MOOD;
+  static constexpr bool CRITICAL = true;
+  Link::Header h;
+  uint8_t  mood;
+  uint8_t  crc;
+};
+
+// host -> device
+struct Sleep {
+  static constexpr Id   ID = SLEEP;
+  static constexpr bool CRITICAL = true;
+  Link::Header h;
+  uint8_t  on;                    // 1 sleep, 0 wake
+  uint8_t  crc;
+};
+
+// host -> device: lip sync for text the host plays (durMs) or TTS on the device (0; ACK_UNSUPPORTED with no network)
+struct Say {
+  static constexpr Id   ID = SAY;
+  static constexpr bool CRITICAL = true;
+  Link::Header h;
+  uint16_t durMs;
+  char     text[60];              // NUL-terminated unless full
+  uint8_t  crc;
+};
+
+// host -> device: dump the trace ring (as text lines)
+struct Trace {
+  static constexpr Id   ID = TRACE;
+  static constexpr bool CRITICAL = false;
+  Link::Header h;
+  uint8_t  crc;
+};
+
+// device -> host, every few seconds while the host talks
+struct LinkStats {
+  static constexpr Id   ID = LINK_STATS;
+  static constexpr bool CRITICAL = false;
+  Link::Header h;
+  uint32_t rxFrames;
+  uint32_t txFrames;
+  uint16_t rxBad;                 // framing / crc / unknown id
+  uint16_t txDropped;             // TX ring full
+  uint8_t  crc;
+};
+
+// device -> host: the first frame showing a command's effect was pushed
+struct Shown {
+  static constexpr Id   ID = SHOWN;
+  static constexpr bool CRITICAL = false;
+  Link::Header h;
+  uint8_t  cmd;                   // the command's message id
+  uint16_t cmdSeq;                // its seq
+  uint32_t deviceUs;              // device clock after the push
+  uint8_t  crc;
+};
+#pragma pack(pop)
+
+static_assert(sizeof(Hello) == 10, "Hello layout");
+static_assert(offsetof(Hello, app) == 4, "Hello::app offset");
+static_assert(offsetof(Hello, schema) == 5, "Hello::schema offset");
+static_assert(offsetof(Hello, maxFrame) == 7, "Hello::maxFrame offset");
+static_assert(sizeof(Hello) <= Link::MAX_FRAME, "Hello too large");
+static_assert(sizeof(Ping) == 9, "Ping layout");
+static_assert(offsetof(Ping, hostUs) == 4, "Ping::hostUs offset");
+static_assert(sizeof(Ping) <= Link::MAX_FRAME, "Ping too large");
+static_assert(sizeof(Pong) == 13, "Pong layout");
+static_assert(offsetof(Pong, hostUs) == 4, "Pong::hostUs offset");
+static_assert(offsetof(Pong, deviceUs) == 8, "Pong::deviceUs offset");
+static_assert(sizeof(Pong) <= Link::MAX_FRAME, "Pong too large");
+static_assert(sizeof(Ack) == 9, "Ack layout");
+static_assert(offsetof(Ack, cmd) == 4, "Ack::cmd offset");
+static_assert(offsetof(Ack, status) == 5, "Ack::status offset");
+static_assert(offsetof(Ack, cmdSeq) == 6, "Ack::cmdSeq offset");
+static_assert(sizeof(Ack) <= Link::MAX_FRAME, "Ack too large");
+static_assert(sizeof(Mood) == 6, "Mood layout");
+static_assert(offsetof(Mood, mood) == 4, "Mood::mood offset");
+static_assert(sizeof(Mood) <= Link::MAX_FRAME, "Mood too large");
+static_assert(sizeof(Sleep) == 6, "Sleep layout");
+static_assert(offsetof(Sleep, on) == 4, "Sleep::on offset");
+static_assert(sizeof(Sleep) <= Link::MAX_FRAME, "Sleep too large");
+static_assert(sizeof(Say) == 67, "Say layout");
+static_assert(offsetof(Say, durMs) == 4, "Say::durMs offset");
+static_assert(offsetof(Say, text) == 6, "Say::text offset");
+static_assert(sizeof(Say) <= Link::MAX_FRAME, "Say too large");
+static_assert(sizeof(Trace) == 5, "Trace layout");
+static_assert(sizeof(Trace) <= Link::MAX_FRAME, "Trace too large");
+static_assert(sizeof(LinkStats) == 17, "LinkStats layout");
+static_assert(offsetof(LinkStats, rxFrames) == 4, "LinkStats::rxFrames offset");
+static_assert(offsetof(LinkStats, txFrames) == 8, "LinkStats::txFrames offset");
+static_assert(offsetof(LinkStats, rxBad) == 12, "LinkStats::rxBad offset");
+static_assert(offsetof(LinkStats, txDropped) == 14, "LinkStats::txDropped offset");
+static_assert(sizeof(LinkStats) <= Link::MAX_FRAME, "LinkStats too large");
+static_assert(sizeof(Shown) == 12, "Shown layout");
+static_assert(offsetof(Shown, cmd) == 4, "Shown::cmd offset");
+static_assert(offsetof(Shown, cmdSeq) == 5, "Shown::cmdSeq offset");
+static_assert(offsetof(Shown, deviceUs) == 7, "Shown::deviceUs offset");
+static_assert(sizeof(Shown) <= Link::MAX_FRAME, "Shown too large");
+
+// Frame bytes by id, crc included (0: no such message): what Link::feed cuts a stream with.
+static constexpr uint8_t FRAME_SIZE[NUM_IDS] = { 0, 10, 9, 13, 9, 6, 6, 67, 5, 17, 12 };
+// Critical messages by id: what a lossy transport sends more than once (udp_link.h).
+static constexpr bool IS_CRITICAL[NUM_IDS] = { false, false, false, false, false, true, true, true, false, false, false };
+static const char* const NAMES[NUM_IDS] = { "", "Hello", "Ping", "Pong", "Ack", "Mood", "Sleep", "Say", "Trace", "LinkStats", "Shown" };
+
+// The checked frame at p (n bytes) as an M, without copying; nullptr when it is another message.
+template <class M>
+static inline const M* view(const uint8_t* p, size_t n){
+  return n == sizeof(M) && p[1] == M::ID ? reinterpret_cast<const M*>(p) : nullptr;
+}
+
+// Encoders: each builds its frame in place in the ring; false when the ring is full.
+static inline bool sendHello(Link::Ring& r, uint16_t seq, uint8_t app, uint16_t schema, uint16_t maxFrame){
+  Hello* m = reinterpret_cast<Hello*>(Link::reserve(r, sizeof(Hello)));
+  if (!m) return false;
+  m->h = { Link::MAGIC, Hello::ID, seq };
+  m->app = app;
+  m->schema = schema;
+  m->maxFrame = maxFrame;
+  Link::commit(r, sizeof(Hello));
+  return true;
+}
+static inline bool sendPing(Link::Ring& r, uint16_t seq, uint32_t hostUs){
+  Ping* m = reinterpret_cast<Ping*>(Link::reserve(r, sizeof(Ping)));
+  if (!m) return false;
+  m->h = { Link::MAGIC, Ping::ID, seq };
+  m->hostUs = hostUs;
+  Link::commit(r, sizeof(Ping));
+  return true;
+}
+static inline bool sendPong(Link::Ring& r, uint16_t seq, uint32_t hostUs, uint32_t deviceUs){
+  Pong* m = reinterpret_cast<Pong*>(Link::reserve(r, sizeof(Pong)));
+  if (!m) return false;
+  m->h = { Link::MAGIC, Pong::ID, seq };
+  m->hostUs = hostUs;
+  m->deviceUs = deviceUs;
+  Link::commit(r, sizeof(Pong));
+  return true;
+}
+static inline bool sendAck(Link::Ring& r, uint16_t seq, uint8_t cmd, uint8_t status, uint16_t cmdSeq){
+  Ack* m = reinterpret_cast<Ack*>(Link::reserve(r, sizeof(Ack)));
+  if (!m) return false;
+  m->h = { Link::MAGIC, Ack::ID, seq };
+  m->cmd = cmd;
+  m->status = status;
+  m->cmdSeq = cmdSeq;
+  Link::commit(r, sizeof(Ack));
+  return true;
+}
+static inline bool sendMood(Link::Ring& r, uint16_t seq, uint8_t mood){
+  Mood* m = reinterpret_cast<Mood*>(Link::reserve(r, sizeof(Mood)));
+  if (!m) return false;
+  m->h = { Link::MAGIC, Mood::ID, seq };
+  m->mood = mood;
+  Link::commit(r, sizeof(Mood));
+  return true;
+}
+static inline bool sendSleep(Link::Ring& r, uint16_t seq, uint8_t on){
+  Sleep* m = reinterpret_cast<Sleep*>(Link::reserve(r, sizeof(Sleep)));
+  if (!m) return false;
+  m->h = { Link::MAGIC, Sleep::ID, seq };
+  m->on = on;
+  Link::commit(r, sizeof(Sleep));
+  return true;
+}
+static inline bool sendSay(Link::Ring& r, uint16_t seq, uint16_t durMs, const char* text){
+  Say* m = reinterpret_cast<Say*>(Link::reserve(r, sizeof(Say)));
+  if (!m) return false;
+  m->h = { Link::MAGIC, Say::ID, seq };
+  m->durMs = durMs;
+  if (!text) text = "";
+  size_t textLen = 0;
+  while (textLen < sizeof(m->text) && text[textLen]) ++textLen;
+  memcpy(m->text, text, textLen);
+  memset(m->text + textLen, 0, sizeof(m->text) - textLen);
+  Link::commit(r, sizeof(Say));
+  return true;
+}
+static inline bool sendTrace(Link::Ring& r, uint16_t seq){
+  Trace* m = reinterpret_cast<Trace*>(Link::reserve(r, sizeof(Trace)));
+  if (!m) return false;
+  m->h = { Link::MAGIC, Trace::ID, seq };
+  Link::commit(r, sizeof(Trace));
+  return true;
+}
+static inline bool sendLinkStats(Link::Ring& r, uint16_t seq, uint32_t rxFrames, uint32_t txFrames, uint16_t rxBad, uint16_t txDropped){
+  LinkStats* m = reinterpret_cast<LinkStats*>(Link::reserve(r, sizeof(LinkStats)));
+  if (!m) return false;
+  m->h = { Link::MAGIC, LinkStats::ID, seq };
+  m->rxFrames = rxFrames;
+  m->txFrames = txFrames;
+  m->rxBad = rxBad;
+  m->txDropped = txDropped;
+  Link::commit(r, sizeof(LinkStats));
+  return true;
+}
+static inline bool sendShown(Link::Ring& r, uint16_t seq, uint8_t cmd, uint16_t cmdSeq, uint32_t deviceUs){
+  Shown* m = reinterpret_cast<Shown*>(Link::reserve(r, sizeof(Shown)));
+  if (!m) return false;
+  m->h = { Link::MAGIC, Shown::ID, seq };
+  m->cmd = cmd;
+  m->cmdSeq = cmdSeq;
+  m->deviceUs = deviceUs;
+  Link::commit(r, sizeof(Shown));
+  return true;
+}
+
+} // namespace Msg
@@ -1,16 +1,38 @@
 #include <Arduino.h>
 #include <LovyanGFX.hpp>
 #include <Audio.h>
+#include <WiFi.h>             // TTS is fetched over the network
+#include <driver/i2s.h>       // stretched speech goes to I2S from the audio hook
+#include <type_traits>
+#include "trace.h"
 #include "eyes.h"
 #include "mouth_patterns.h"   // dual-lip frames + moods + talking bank
+#include "face.h"             // display-list renderer (eyes + mouth)
+#include "sleep.h"            // partial/idle-mode sleep renderer
+#include "power.h"            // time-in-mode power telemetry
+#include "speech.h"           // talk/silence behaviour (normal mode)
+#include "clip.h"             // pre-rendered reaction clips from flash
+#include "onset.h"            // playback envelope + onsets -> eye reactions
+#include "stretch.h"          // WSOLA speech rate control
+#include "sound.h"            // prioritised sound events, ducking
+#include "viseme.h"           // mouth shapes from text + duration
+#include "remote.h"           // face state streamed from the host
+#include "link_msgs.h"        // schema-generated link messages (tools/link.schema)
+#include "clips/dizzy.h"
 
 
 // ---------------------------- MODE SELECTION ----------------------------
 // Comment OUT the one you don't want; leave the desired one enabled.
-// #define MODE_DEBUG        // cycles all moods for 7s each (with label)
+// #define MODE_DEBUG        // cycles all moods for 7s each (with label), themes and eye shapes
 #define MODE_NORMAL          // random talk/silence as before 
+// #define MODE_BENCH_FLASH  // normal face + frame-time report, alternating idle / flash+SD stress
+// #define MODE_BENCH_EDGES  // normal face + frame-time report per eye edge quality
+// #define MODE_BENCH_RENDER // normal face + frame-time report, per-span vs batched windows vs tile hashes
 // ------------------------------------------------------------------------
 // LovyanGFX preset in platformio.ini: -D LOVYANGFX_BOARD=ESP32_2432S028
+// Renderer: span diff by default; -D FACE_TILES pushes changed 16x16 tiles of a 4bpp shadow instead.
+// Face switches slide on the panel's hardware scroll (scroll.h); captions are part of the face.
+// Serial commands: "sleep" / "wake" (partial + idle panel mode, 2 Hz) and "power" (telemetry line).
 
 static LGFX gfx;
 
@@ -27,154 +49,492 @@ void audioBegin() {
   audio.setVolume(16);  // 0..21 (start conservative to avoid pops)
 }
 
+// Audio pump runs on core 0 so decoding/I2S refills never wait behind a frame on core 1.
+static constexpr int AUDIO_TASK_CORE  = 0;
+static constexpr int AUDIO_TASK_STACK = 8192;
+static constexpr int AUDIO_TASK_PRIO  = 2;
+
+// Playback analysis: the audio library hands every decoded block to audio_process_extern on its way to
+// I2S (audio task, core 0); the render loop applies the events when they are heard.
+static constexpr uint32_t AUDIO_OUT_LATENCY_MS = 46;   // I2S DMA queue ahead of the speaker (8 x 256 frames at 44.1 kHz)
+static Onset::Detector g_onset;
+static Onset::Queue    g_onsetQ;
+static Sound::Scheduler g_sound;                       // posted from the render loop, run by the audio task
+
+// Speech rate: off 1x the hook cannot hand the library a block of a different length, so it writes the
+// stretched audio to I2S itself (blocking on the DMA queue, which paces the decoder) and tells the
+// library to skip the block. The A/V clock is the source time now at the speaker.
+static constexpr int      STRETCH_CHUNK = 256;          // frames per I2S write
+static Stretch::State     g_stretch;
+static uint32_t           g_avClockMs = 0;              // written by the audio task
+
+FACE_IRAM(audio) static void avClock(uint32_t rate){
+  const uint32_t behind = AUDIO_OUT_LATENCY_MS * rate / 1000;
+  const uint32_t out = g_stretch.produced > behind ? g_stretch.produced - behind : 0;
+  __atomic_store_n(&g_avClockMs, (uint32_t)((uint64_t)Stretch::sourceAt(g_stretch, out) * 1000 / rate), __ATOMIC_RELAXED);
+}
+
+// Interleaved stereo int16 frames. The hook of the ESP32-audioI2S 2.0.0 pinned in platformio.ini (Arduino
+// core 2.x, legacy I2S driver); *continueI2S starts false there.
+void audio_process_extern(int16_t* outBuff, uint16_t validSamples, bool* continueI2S) {
+  const uint32_t rate = audio.getSampleRate();
+  Onset::setRate(g_onset, rate);
+  Sound::apply(g_sound, outBuff, validSamples, 2, rate, millis() + AUDIO_OUT_LATENCY_MS);
+  Stretch::begin(g_stretch, rate, 2);
+  if (!rate || Stretch::bypassed(g_stretch)) {
+    Stretch::passed(g_stretch, validSamples);
+    Onset::feed(g_onset, outBuff, validSamples, 2, millis() + AUDIO_OUT_LATENCY_MS, g_onsetQ);
+    if (rate) avClock(rate);
+    *continueI2S = true;
+    return;
+  }
+  static int16_t chunk[STRETCH_CHUNK * 2];
+  int done = 0;
+  while (done < validSamples) {
+    done += Stretch::push(g_stretch, outBuff + done * 2, validSamples - done);
+    for (int got; (got = Stretch::pull(g_stretch, chunk, STRETCH_CHUNK)) > 0; ) {
+      Onset::feed(g_onset, chunk, got, 2, millis() + AUDIO_OUT_LATENCY_MS, g_onsetQ);
+      size_t written;
+      i2s_write(I2S_NUM_0, chunk, (size_t)got * 4, &written, portMAX_DELAY);
+      avClock(rate);
+    }
+  }
+  *continueI2S = false;
+}
+// Anything but the library's exact signature would be an overload it never calls.
+static_assert(std::is_same<decltype(audio_process_extern), void(int16_t*, uint16_t, bool*)>::value, "audio hook signature");
+
 // SD (SPI slot)
 #include <SD.h>
 bool sdInit() {
   return SD.begin(/* cs pin */);
 }
 
+// Sound events: files from SD or text to speak; tags let a command cancel its own sounds.
+static constexpr uint16_t TAG_SAY = 1, TAG_PLAY = 2, TAG_AMBIENT = 3;
+
+// connecttospeech fetches the speech from a web service: without a network it can only fail, so
+// TTS is refused up front (text with a duration still moves the lips, see startLips).
+static bool ttsReady(){ return WiFi.status() == WL_CONNECTED; }
+
+struct AudioPlayer {
+  bool start(const Sound::Request& r){
+    return r.kind == Sound::TTS ? audio.connecttospeech(r.src, "en") : audio.connecttoFS(SD, r.src, r.resume ? (int32_t)r.resume : -1);
+  }
+  uint32_t stop(){ const uint32_t pos = audio.getFilePos(); audio.stopSong(); return pos; }
+  bool running(){ return audio.isRunning(); }
+};
+
+static void audioTask(void*) {
+  AudioPlayer player;
+  for (;;) {
+    Sound::tick(g_sound, player);
+    {
+      TRACE_SCOPE(Trace::AUDIO_FILL);
+      audio.loop();
+    }
+    vTaskDelay(1);
+  }
+}
+
 // ================== Layout / Tuning ==================
 static constexpr float MOUTH_WIDTH_FACTOR    = 0.55f * (2.0f/3.0f); // ~2/3 of earlier width
 static constexpr int   MOUTH_BASELINE_OFFSET = 18;                  // baseline from bottom
 static constexpr int   MOUTH_EXTRA_DOWN      = 20;                  // extra drop vs eyes
 
-// Talking cadence (fast so it reads as speech)
-static constexpr uint32_t TALK_SWAP_MS_BASE = 160;  // ~6.25 Hz
-static constexpr uint32_t TALK_SWAP_JITTER  = 40;
-
 // ---------- Speech state (Normal mode) ----------
-enum class SpeechState : uint8_t { Silent=0, Talking };
-static SpeechState g_speech = SpeechState::Silent;
-
-// Allowed durations (seconds) for talk/silence
-static const uint8_t DUR_CHOICES_S[] = {5, 10, 15, 20};
-
-static uint32_t g_stateUntilMs = 0;     // next transition time
-static MouthMood g_currMood = MouthMood::Neutral;
-
-static uint32_t g_nextMouthSwapMs = 0;  // cadence while talking
-static int      g_currTalkIdx     = 0;
-
-static int  g_mouthY = -1;
-static int  g_mouthW = -1;
+static Speech::State g_speech;
+
+static Face::Mouth g_mouth;   // placement + current frame; drawn by Face::render
+
+// ---------- Caption strip (top band, drawn by Face::render) ----------
+static Caption::Strip g_caption;
+static LGFX_Sprite    g_captionText(&gfx);   // 1bpp raster, 640 B
+
+static void setCaption(const char* txt){
+  LGFX_Sprite& s = g_captionText;
+  if (!s.getBuffer()) { s.setColorDepth(1); s.createSprite(Caption::MAX_W, Caption::ROWS); }
+  s.fillScreen(TFT_BLACK);
+  s.setFont(&fonts::Font2);
+  s.setTextColor(TFT_WHITE);
+  s.setTextDatum(textdatum_t::top_left);
+  s.drawString(txt, 0, 0);
+  Caption::show(g_caption, (const uint8_t*)s.getBuffer(), Caption::MAX_W / 8, min((int)s.textWidth(txt), Caption::MAX_W));
+}
 
 static inline uint32_t nowMs(){ return millis(); }
-static inline int randRange(int lo, int hi){ return lo + (int)(random(0x7fffffff) % (uint32_t)(hi - lo + 1)); }
-static inline int pickDurationMs() {
-  int ix = randRange(0, (int)(sizeof(DUR_CHOICES_S)/sizeof(DUR_CHOICES_S[0]) - 1));
-  return DUR_CHOICES_S[ix] * 1000;
-}
 
-// ---------- Mood label (top band) ----------
+// ---------- Mood label (caption strip) ----------
 static void drawMoodLabel(const char* txt){
 #ifdef MODE_DEBUG
-  gfx.setTextColor(TFT_WHITE, TFT_BLACK);
-  gfx.setFont(&fonts::Font2);
-  gfx.setTextDatum(textdatum_t::middle_center);
-  gfx.fillRect(0, 0, gfx.width(), 20, TFT_BLACK);  // clear old text
-  gfx.drawString(txt, gfx.width()/2, 10);
+  setCaption(txt);
 #endif
 }
 
 static void clearMoodLabel(){
-  gfx.fillRect(0, 0, gfx.width(), 20, TFT_BLACK); // clear label band
+  Caption::hide(g_caption);
 }
 
-// ---------- Mouth drawing (dual-lip with fixed 2px anchors; SIGNED offsets) ----------
-static void drawMouthFrame(int baseY, int mouthW, const MouthFrame& mf) {
-  const int W = gfx.width();
-  const int mouthX = (W - mouthW) / 2;
+// ---------- Mouth frames (drawn by the next Face::render) ----------
+// Moods are drawn as joined lips; talking frames open the mouth (cavity + teeth).
+static void drawMouthMood(MouthMood mood) {
+  g_mouth.frame = &moodToFrame(mood);
+  g_mouth.style = Face::LIPS_JOIN;
+}
+static void drawMouthTalkIdx(int idx) {
+  idx = (idx % NUM_TALK_FRAMES + NUM_TALK_FRAMES) % NUM_TALK_FRAMES;
+  g_mouth.frame = &TALK_FRAMES[idx];
+  g_mouth.style = Face::LIPS_JOIN | Face::LIPS_CAVITY | Face::LIPS_TEETH;
+}
 
-  // Clear a band around the mouth so larger amplitudes don't ghost
-  const int clearY0 = baseY - MOUTH_MAX_DY - MOUTH_CLEAR_PAD;
-  const int clearY1 = baseY + MOUTH_MAX_DY + MOUTH_CLEAR_PAD;
-  gfx.fillRect(mouthX, clearY0, mouthW, clearY1 - clearY0 + 1, TFT_BLACK);
 
-  // 2-pixel anchors at baseline (ALWAYS on centerline)
-  gfx.drawFastHLine(mouthX, baseY, ANCHOR_PX, TFT_WHITE);
-  gfx.drawFastHLine(mouthX + mouthW - ANCHOR_PX, baseY, ANCHOR_PX, TFT_WHITE);
+// ---------- Speech transitions (Normal mode) ----------
+// Draws what Speech::tick changed: a held mood with its label, or the current talking frame.
+static void showSpeech(Speech::Event ev){
+  switch (ev) {
+    case Speech::Event::Silent:
+      clearMoodLabel();
+      drawMouthMood(g_speech.mood);
+      drawMoodLabel(
+        g_speech.mood==MouthMood::Smile   ? "Smile"   :
+        g_speech.mood==MouthMood::Frown   ? "Frown"   :
+        g_speech.mood==MouthMood::Puzzled ? "Puzzled" :
+        g_speech.mood==MouthMood::Oooh    ? "Oooh"    :
+                                            "Neutral"
+      );
+      break;
+    case Speech::Event::Talking:
+      clearMoodLabel();               // no label while talking
+      drawMouthTalkIdx(g_speech.talkIdx);
+      break;
+    case Speech::Event::Swap:
+      drawMouthTalkIdx(g_speech.talkIdx);
+      break;
+    case Speech::Event::None:
+      break;
+  }
+}
 
-  // Inner segmented region (symmetric widths via accumulator)
-const int innerW = mouthW - 2*ANCHOR_PX;
-if (innerW <= 0) return;
+// ===== Eyes module instance =====
+static Eyes::State  EYES;
+static Eyes::Layout E_LAYOUT; // defaults (your tuned cx/cy/radii)
 
-float step = innerW / (float)MOUTH_SEGMENTS;
-int x = mouthX + ANCHOR_PX;
+// Lip sync from text: runs instead of the random talking frames while a track plays.
+static Viseme::Track g_lips;
+
+// Audio events heard by the middle of this frame: pupil pulses and lid lifts on onsets, blinks held
+// while loud, voicing for the lip-sync timing.
+static void reactToAudio(){
+  Onset::Event ev;
+  while (Onset::pop(g_onsetQ, millis() + 500 / Eyes::FPS_DEFAULT, ev)) {
+    if (ev.kind == Onset::ONSET) Eyes::onset(EYES, ev.strength);
+    else if (ev.kind == Onset::VOICED || ev.kind == Onset::UNVOICED) Viseme::voiced(g_lips, ev.kind == Onset::VOICED, ev.dueMs);
+    else Eyes::setLoud(EYES, ev.kind == Onset::LOUD);
+  }
+}
 
-for (int i = 0; i < MOUTH_SEGMENTS; ++i) {
-  // ensure last segment ends exactly at the right anchor
-  int nextX = (i == MOUTH_SEGMENTS - 1)
-                ? (mouthX + mouthW - ANCHOR_PX)
-                : (mouthX + ANCHOR_PX + (int)lroundf(step * (i + 1)));
-  int w = nextX - x;
-  if (w < 1) w = 1;
+// Mouth from text: `durMs` 0 estimates it.
+static void startLips(const char* text, uint32_t durMs){
+  if (!Viseme::begin(g_lips, text, durMs, nowMs())) return;
+  clearMoodLabel();
+  drawMouthTalkIdx(Viseme::frame(g_lips));
+}
 
-  // SIGNED offsets (clamped)
-  int uy = mf.upper[i];
-  if (uy < -MOUTH_MAX_DY) uy = -MOUTH_MAX_DY;
-  if (uy >  MOUTH_MAX_DY) uy =  MOUTH_MAX_DY;
+// Face state streamed from the host: packets share the serial port with the command lines.
+static Remote::Link g_remote;
+static Remote::Vec  g_remoteVec;
+static MouthFrame   g_remoteMouth;
+static uint8_t      g_remoteStyle = Face::LIPS_JOIN;
+static bool         g_remoteOn = false;
+
+// After Eyes::update, at the frame boundary: the newest streamed state overrides gaze, lids and mouth.
+// When the stream stops the face carries on by itself from there, the mouth with a held mood.
+static void steerFromHost(){
+  const uint32_t now = nowMs();
+  if (Remote::take(g_remote, g_remoteVec, now)) g_remoteStyle = Remote::toMouth(g_remoteVec, g_remoteMouth);
+  Remote::ack(g_remote, now, Serial);
+  const bool on = Remote::active(g_remote, now);
+  if (on) {
+    Remote::applyEyes(EYES, g_remoteVec, now);
+    g_mouth.frame = &g_remoteMouth;
+    g_mouth.style = g_remoteStyle;
+  } else if (g_remoteOn) {
+    Speech::enterSilent(g_speech, now);
+    showSpeech(Speech::Event::Silent);
+  }
+  g_remoteOn = on;
+}
 
-  int ly = mf.lower[i];
-  if (ly < -MOUTH_MAX_DY) ly = -MOUTH_MAX_DY;
-  if (ly >  MOUTH_MAX_DY) ly =  MOUTH_MAX_DY;
+// ===== Face renderer =====
+// Eyes, mouth, caption and theme fades all reach the panel through one display-list diff per frame.
+static Face::Renderer g_face;
+#if defined(FACE_TILES) || defined(MODE_BENCH_RENDER)
+static Tiles::Shadow  g_shadow;   // 38 KB internal SRAM, only with the tile renderer
+#endif
 
-  gfx.drawFastHLine(x, baseY - uy, w, TFT_WHITE);
-  gfx.drawFastHLine(x, baseY - ly, w, TFT_WHITE);
+// ===== Sleep =====
+static Sleep::State g_sleep;
+static uint32_t     g_powerReportMs = 0;
+
+// ===== Clips =====
+// A reaction clip centred on each eye. Face::render pauses while they play; the face is repainted
+// once they end, since the clip area covers more than the eyes.
+static constexpr uint32_t CLIP_HOLD_MS = 3000;   // loops until then
+static Clip::Player g_clip[2];
+static uint32_t     g_clipUntilMs = 0;
+
+static bool startClip(const uint8_t* data, size_t size){
+  if (g_face.slide.active()) {
+    g_face.slide = Scroll::Slide();
+    gfx.startWrite(); Scroll::setStart(gfx, 0); gfx.endWrite();
+  }
+  const Eyes::Eye* eyes[2] = { &EYES.L, &EYES.R };
+  const uint32_t now = millis();
+  for (int i = 0; i < 2; ++i) {
+    Clip::Player& pl = g_clip[i];
+    if (!Clip::start(pl, data, size, 0, 0, now, true)) return false;
+    pl.ox = (int16_t)(eyes[i]->cx - pl.clip.w / 2);
+    pl.oy = (int16_t)(eyes[i]->cy - pl.clip.h / 2);
+  }
+  g_clipUntilMs = now + CLIP_HOLD_MS;
+  return true;
+}
 
-  x = nextX;
+static void stopClip(){
+  if (!g_clip[0].active) return;
+  for (auto& pl : g_clip) pl.active = false;
+  Face::repaint(g_face);
 }
+
+static void setSleep(bool on){
+  if (on) {
+    stopClip();
+    if (!g_sleep.active) Sleep::enter(gfx, g_face, g_sleep, EYES.L.cy);
+  } else if (g_sleep.active) {
+    Sleep::wake(gfx, g_face, g_sleep);
+  }
 }
 
-static void drawMouthMood(MouthMood mood) {
-  const MouthFrame& f = moodToFrame(mood);
-  drawMouthFrame(g_mouthY, g_mouthW, f);
+// ===== Link messages =====
+// Frames from the host are read in place from the RX buffer; replies are built in place in the TX
+// ring of the transport the frame came by, which the loop drains between command lines (serial) or
+// into datagrams (UDP).
+static constexpr uint32_t LINK_STATS_MS = 5000;   // LinkStats cadence while frames arrive
+static Link::Rx   g_linkRx;
+static Link::Ring g_linkTx;
+static uint16_t   g_linkSeq = 0;
+static uint32_t   g_linkStatsMs = 0, g_linkStatsFrames = 0;
+static uint8_t    g_linkShownId = 0;   // a command whose effect the next pushed frame shows (0: none)
+static uint16_t   g_linkShownSeq = 0;
+static Link::Ring* g_linkShownTx = &g_linkTx;   // the ring of the transport it came by
+
+#ifdef FACE_TRACE
+static void linkFlush(Link::Ring& tx);
+#endif
+
+static void onLinkFrame(const uint8_t* f, size_t n, Link::Ring& tx){
+  TRACE_SCOPE(Trace::LINK_RX);
+  const Link::Header& h = *reinterpret_cast<const Link::Header*>(f);
+  uint8_t status = Msg::ACK_OK;
+  if (const Msg::Ping* m = Msg::view<Msg::Ping>(f, n)) {
+    if (!h.seq) Msg::sendHello(tx, g_linkSeq++, Msg::APP_FACE, Msg::SCHEMA, Link::MAX_FRAME);
+    Msg::sendPong(tx, h.seq, m->hostUs, micros());
+    return;
+  } else if (const Msg::Mood* m = Msg::view<Msg::Mood>(f, n)) {
+    if (m->mood <= (uint8_t)MouthMood::Oooh && !g_lips.active) {
+      Speech::enterSilent(g_speech, nowMs());
+      g_speech.mood = (MouthMood)m->mood;
+      showSpeech(Speech::Event::Silent);
+    } else status = Msg::ACK_REFUSED;
+  } else if (const Msg::Sleep* m = Msg::view<Msg::Sleep>(f, n)) {
+    setSleep(m->on);
+  } else if (const Msg::Say* m = Msg::view<Msg::Say>(f, n)) {
+    char text[sizeof(m->text) + 1];
+    memcpy(text, m->text, sizeof(m->text)); text[sizeof(m->text)] = 0;
+    if (m->durMs) startLips(text, m->durMs);
+    else if (!ttsReady()) status = Msg::ACK_UNSUPPORTED;
+    else if (Sound::play(g_sound, Sound::SPEECH, Sound::TTS, text, TAG_SAY, millis())) startLips(text, 0);
+    else status = Msg::ACK_REFUSED;
+#ifdef FACE_TRACE
+  } else if (Msg::view<Msg::Trace>(f, n)) {
+    linkFlush(tx);   // replies so far go out before the (serial, text) dump
+    Trace::dump(Serial);
+#endif
+  } else {
+    status = Msg::ACK_UNSUPPORTED;
+  }
+  Msg::sendAck(tx, g_linkSeq++, h.id, status, h.seq);
+  if (status == Msg::ACK_OK && h.id != Msg::TRACE) { g_linkShownId = h.id; g_linkShownSeq = h.seq; g_linkShownTx = &tx; }
 }
-static void drawMouthTalkIdx(int idx) {
-  idx = (idx % NUM_TALK_FRAMES + NUM_TALK_FRAMES) % NUM_TALK_FRAMES;
-  drawMouthFrame(g_mouthY, g_mouthW, TALK_FRAMES[idx]);
+
+// After a frame is pushed: tells the host its last command is on screen (application latency).
+static void linkShown(){
+  if (!g_linkShownId) return;
+  Msg::sendShown(*g_linkShownTx, g_linkSeq++, g_linkShownId, g_linkShownSeq, micros());
+  g_linkShownId = 0;
 }
 
+// Every LINK_STATS_MS while the host sends frames.
+static void linkStats(uint32_t nowMs){
+  if (nowMs - g_linkStatsMs < LINK_STATS_MS) return;
+  g_linkStatsMs = nowMs;
+  if (g_linkRx.frames == g_linkStatsFrames) return;
+  g_linkStatsFrames = g_linkRx.frames;
+  Msg::sendLinkStats(g_linkTx, g_linkSeq++, g_linkRx.frames, g_linkTx.frames, (uint16_t)g_linkRx.bad, (uint16_t)g_linkTx.dropped);
+}
 
-// ---------- Speech transitions (Normal mode) ----------
-static void enterSilent(){
-  g_speech = SpeechState::Silent;
-  g_stateUntilMs = nowMs() + pickDurationMs();
+#ifdef FACE_UDP
+// ===== Link over UDP (FACE_UDP) =====
+// The same frames straight from the host over Wi-Fi, with no broker in between: datagrams are put
+// back in order and critical commands arrive twice over (udp_link.h). Replies go to whoever sent the
+// last datagram. FACE_WIFI_SSID / FACE_WIFI_PASS come from build_flags.
+#include <WiFiUdp.h>
+#include "udp_link.h"
+
+static WiFiUDP    g_udp;
+static bool       g_udpUp = false;
+static Udp::Rx    g_udpRx;
+static Udp::Tx    g_udpTx;
+static Link::Ring g_udpRing;            // replies to frames that came by UDP
+static IPAddress  g_udpPeer;
+static uint16_t   g_udpPeerPort = 0;    // 0: no host yet
+
+static void udpBegin(){
+  WiFi.mode(WIFI_STA);
+  WiFi.begin(FACE_WIFI_SSID, FACE_WIFI_PASS);
+  g_udpTx.epoch = (uint8_t)(esp_random() % 255 + 1);
+}
 
-  // pick a mood to hold during silence
-  const int pick = randRange(0, 3); // Smile/Frown/Puzzled/Oooh
-  g_currMood = (pick==0) ? MouthMood::Smile :
-               (pick==1) ? MouthMood::Frown :
-               (pick==2) ? MouthMood::Puzzled :
-                           MouthMood::Oooh;
+static void udpOut(const uint8_t* p, size_t n){
+  g_udp.beginPacket(g_udpPeer, g_udpPeerPort);
+  g_udp.write(p, n);
+  g_udp.endPacket();
+}
 
-  gfx.startWrite();
-  clearMoodLabel(); 
-  drawMouthMood(g_currMood);
-  drawMoodLabel(
-    g_currMood==MouthMood::Smile   ? " Smile   "   :
-    g_currMood==MouthMood::Frown   ? " Frown   "   :
-    g_currMood==MouthMood::Puzzled ? " Puzzled "   :
-    g_currMood==MouthMood::Oooh    ? " Oooh    "   :
-                                     " Neutral "
-  );
-  gfx.endWrite();
+static void udpFrame(const uint8_t* f, size_t n){ onLinkFrame(f, n, g_udpRing); }
+
+// Once per frame, after pollCommands: datagrams in, frames in seq order, replies out.
+static void pollUdp(uint32_t nowMs){
+  if (!g_udpUp) {
+    if (WiFi.status() != WL_CONNECTED) return;
+    g_udpUp = g_udp.begin(Udp::PORT);
+    Serial.printf("{\"status\":\"udp\",\"ip\":\"%s\",\"port\":%u}\n", WiFi.localIP().toString().c_str(), (unsigned)Udp::PORT);
+    return;
+  }
+  static uint8_t d[Udp::MAX_DGRAM];
+  while (g_udp.parsePacket() > 0) {
+    const int len = g_udp.read(d, sizeof(d));
+    g_udpPeer = g_udp.remoteIP(); g_udpPeerPort = g_udp.remotePort();
+    if (len > 0) Udp::receive(g_udpRx, d, (size_t)len, nowMs, Msg::FRAME_SIZE, udpFrame);
+  }
+  Udp::tick(g_udpRx, nowMs, udpFrame);
+  if (!g_udpPeerPort) return;
+  Udp::drain(g_udpRing, g_udpTx, Msg::FRAME_SIZE, Msg::IS_CRITICAL, nowMs, udpOut);
+  Udp::tick(g_udpTx, nowMs, udpOut);
 }
 
-static void enterTalking(){
-  g_speech = SpeechState::Talking;
-  g_stateUntilMs = nowMs() + pickDurationMs();
-  g_currTalkIdx = randRange(0, NUM_TALK_FRAMES-1);
-  g_nextMouthSwapMs = nowMs() + TALK_SWAP_MS_BASE + randRange(-(int)TALK_SWAP_JITTER,(int)TALK_SWAP_JITTER);
+static void udpReport(Print& out){
+  const Udp::Rx& r = g_udpRx;
+  out.printf("{\"udp\":\"%s\",\"rx_dgrams\":%u,\"rx_frames\":%u,\"dups\":%u,\"early\":%u,\"lost\":%u,"
+             "\"recovered\":%u,\"bad\":%u,\"resyncs\":%u,\"tx_dgrams\":%u,\"tx_frames\":%u}\n",
+             g_udpUp ? "up" : "down", (unsigned)r.datagrams, (unsigned)r.frames, (unsigned)r.dups, (unsigned)r.early,
+             (unsigned)r.lost, (unsigned)r.recovered, (unsigned)r.bad, (unsigned)r.resyncs,
+             (unsigned)g_udpTx.datagrams, (unsigned)g_udpTx.frames);
+}
+#endif
 
-  gfx.startWrite();
-  clearMoodLabel();               // no label while talking
-  drawMouthTalkIdx(g_currTalkIdx);
-  gfx.endWrite();
+#ifdef FACE_TRACE
+// Sends what `tx` holds now, on the transport it belongs to.
+static void linkFlush(Link::Ring& tx){
+#ifdef FACE_UDP
+  if (&tx == &g_udpRing) {
+    if (g_udpPeerPort) Udp::drain(g_udpRing, g_udpTx, Msg::FRAME_SIZE, Msg::IS_CRITICAL, millis(), udpOut);
+    return;
+  }
+#endif
+  Link::drain(tx, Serial, Msg::FRAME_SIZE);
 }
+#endif
 
-// ===== Eyes module instance =====
-static Eyes::State  EYES;
-static Eyes::Layout E_LAYOUT; // defaults (your tuned cx/cy/radii)
+static void pollCommands(){
+  static String line;
+  while (Serial.available()) {
+    const uint8_t b = (uint8_t)Serial.read();
+    if (!Link::receiving(g_linkRx) && Remote::feed(g_remote, b, millis())) continue;   // a face-state packet byte
+    const Link::Fed fed = Link::feed(g_linkRx, b, Msg::FRAME_SIZE);
+    if (fed == Link::FRAME) onLinkFrame(g_linkRx.buf, g_linkRx.need, g_linkTx);
+    if (fed != Link::NOT_LINK) continue;
+    const char c = (char)b;
+    if (c == '\n' || c == '\r') {
+      if (line.length()) {
+        TRACE_SCOPE(Trace::LINK_RX);
+        line.trim();
+        if (line.equalsIgnoreCase("sleep")) {
+          setSleep(true);
+          Serial.println("{\"ack\":\"sleep\"}");
+        } else if (line.equalsIgnoreCase("wake")) {
+          setSleep(false);
+          Serial.println("{\"ack\":\"wake\"}");
+        } else if (line.equalsIgnoreCase("power")) {
+          Power::report(Serial);
+        } else if (line.equalsIgnoreCase("eyes half") || line.equalsIgnoreCase("eyes full")) {
+          Eyes::setScale(EYES, line.equalsIgnoreCase("eyes half") ? Eyes::HALF_RES : 1);
+          Serial.println("{\"ack\":\"eyes\"}");
+        } else if (line.equalsIgnoreCase("clip dizzy")) {
+          if (!g_sleep.active && startClip(CLIP_DIZZY, sizeof(CLIP_DIZZY))) Serial.println("{\"ack\":\"clip\"}");
+          else Serial.println("{\"error\":\"clip\"}");
+        } else if (line.equalsIgnoreCase("clip stop")) {
+          stopClip();
+          Serial.println("{\"ack\":\"clip\"}");
+        } else if (line.startsWith("say ") && !ttsReady()) {
+          Serial.println("{\"error\":\"no_network\"}");   // "lips <ms> <text>" moves the mouth without audio
+        } else if (line.startsWith("say ") || line.startsWith("play ") || line.startsWith("ambient ")) {
+          const int sp = line.indexOf(' ');
+          const String src = line.substring(sp + 1);
+          const bool ok = line[0] == 's' ? Sound::play(g_sound, Sound::SPEECH, Sound::TTS, src.c_str(), TAG_SAY, millis())
+                        : line[0] == 'p' ? Sound::play(g_sound, Sound::REACTION, Sound::FILE, src.c_str(), TAG_PLAY, millis())
+                        : Sound::play(g_sound, Sound::AMBIENT, Sound::FILE, src.c_str(), TAG_AMBIENT, millis());
+          if (ok && line[0] == 's') startLips(src.c_str(), 0);
+          Serial.println(ok ? "{\"ack\":\"sound\"}" : "{\"error\":\"sound_busy\"}");
+        } else if (line.startsWith("lips ")) {
+          // "lips <ms> <text>": the host plays the audio, the face only knows its text and length
+          const String rest = line.substring(5);
+          const int sp = rest.indexOf(' ');
+          const int ms = rest.toInt();
+          if (sp > 0 && ms > 0) { startLips(rest.substring(sp + 1).c_str(), (uint32_t)ms); Serial.println("{\"ack\":\"lips\"}"); }
+          else Serial.println("{\"error\":\"lips\"}");
+        } else if (line.equalsIgnoreCase("sound")) {
+          Sound::report(g_sound, Serial);
+        } else if (line.equalsIgnoreCase("sound flush")) {
+          Serial.println(Sound::flush(g_sound) ? "{\"ack\":\"sound\"}" : "{\"error\":\"sound_busy\"}");
+        } else if (line.startsWith("sound cancel ")) {
+          const int tag = line.substring(13).toInt();
+          Serial.println(tag > 0 && Sound::cancel(g_sound, (uint16_t)tag) ? "{\"ack\":\"sound\"}" : "{\"error\":\"sound\"}");
+        } else if (line.equalsIgnoreCase("face")) {
+          Remote::report(g_remote, millis(), Serial);
+#ifdef FACE_UDP
+        } else if (line.equalsIgnoreCase("udp")) {
+          udpReport(Serial);
+#endif
+        } else if (line.equalsIgnoreCase("rate")) {
+          Serial.printf("{\"rate\":%.2f,\"av_clock_ms\":%u,\"steps\":%u}\n", Stretch::rate(g_stretch) / (float)Stretch::ONE,
+                        (unsigned)__atomic_load_n(&g_avClockMs, __ATOMIC_RELAXED), (unsigned)g_stretch.steps);
+        } else if (line.startsWith("rate ")) {
+          const float r = line.substring(5).toFloat();
+          if (r > 0) { Stretch::setRate(g_stretch, (uint32_t)(r * Stretch::ONE + 0.5f)); Serial.println("{\"ack\":\"rate\"}"); }
+          else Serial.println("{\"error\":\"rate\"}");
+        } else {
+          Serial.print("{\"error\":\"unknown_cmd\",\"cmd\":\"");
+          Serial.print(line);
+          Serial.println("\"}");
+        }
+        line = "";
+      }
+    } else {
+      line += c;
+    }
+  }
+}
 
 // ===== DEBUG MODE state =====
 #ifdef MODE_DEBUG
@@ -184,6 +544,8 @@ static const MouthMood DEBUG_MOODS[] = {
 };
 static int       dbg_idx = 0;
 static uint32_t  dbg_nextSwitch = 0;
+static int       dbg_theme = 0;
+static int       dbg_shape = 0;
 
 static const char* moodName(MouthMood m){
   switch(m){
@@ -197,84 +559,233 @@ static const char* moodName(MouthMood m){
 }
 #endif
 
+// ================== Frame-time benchmarks ==================
+// Each bench cycles through phases of BENCH_PHASE_MS while the normal face keeps running and prints
+// one JSON line per phase (frames, mean and worst frame time, mean windows, command and pixel bytes
+// pushed per frame) on Serial.
+//  MODE_BENCH_FLASH: idle vs. a core-0 task hammering flash and SD. Each partition read parks core 1
+//                    whatever it runs (IRAM too); between reads the churn evicts the cache, which is
+//                    what FACE_IRAM leaves avoid. Compare a normal build against -D FACE_NO_IRAM.
+//  MODE_BENCH_EDGES: eye edge quality Aliased / Fast / Smooth (coverage-table anti-aliasing cost).
+//  MODE_BENCH_RENDER: one window per diffed span vs. batched windows vs. tile hashes on the live face.
+#if defined(MODE_BENCH_FLASH) || defined(MODE_BENCH_EDGES) || defined(MODE_BENCH_RENDER)
+static constexpr uint32_t BENCH_PHASE_MS = 10000;
+
+struct BenchStats { uint32_t frames = 0, maxUs = 0; uint64_t sumUs = 0, pushOps = 0, cmdBytes = 0, pxBytes = 0; };
+
+static BenchStats g_benchStats;
+static uint32_t   g_benchPhaseEndMs = 0;
+static int        g_benchPhase      = 0;
+
+#ifdef MODE_BENCH_FLASH
+#include <esp_partition.h>
+
+static constexpr const char* BENCH_NAME        = "flash";
+static constexpr int      BENCH_PHASES         = 2;
+static constexpr size_t   BENCH_READ_BYTES     = 4096;
+static constexpr int      BENCH_READS_PER_TICK = 4;
+static constexpr const char* BENCH_SD_FILE     = "/bench.bin"; // any large file; optional
+
+static volatile bool g_benchStress = false;
+static uint8_t       g_benchBuf[BENCH_READ_BYTES];
+
+static void benchStressTask(void*) {
+  const esp_partition_t* part = esp_partition_find_first(ESP_PARTITION_TYPE_APP, ESP_PARTITION_SUBTYPE_ANY, nullptr);
+  File f = sdInit() ? SD.open(BENCH_SD_FILE) : File();
+  uint32_t off = 0;
+  for (;;) {
+    if (g_benchStress) {
+      for (int i = 0; i < BENCH_READS_PER_TICK; ++i) {
+        if (part) {
+          esp_partition_read(part, off, g_benchBuf, BENCH_READ_BYTES);
+          off = (off + 61 * BENCH_READ_BYTES) % (part->size - BENCH_READ_BYTES); // stride past the cache
+        }
+        if (f && f.read(g_benchBuf, BENCH_READ_BYTES) <= 0) f.seek(0);
+      }
+    }
+    vTaskDelay(1);
+  }
+}
+
+static const char* benchPhaseName(int phase) { return phase ? "stress" : "idle"; }
+static void benchApplyPhase(int phase)       { g_benchStress = (phase != 0); }
+#elif defined(MODE_BENCH_EDGES)
+static constexpr const char* BENCH_NAME   = "edges";
+static constexpr int         BENCH_PHASES = 3;
+
+static const char* benchPhaseName(int phase) {
+  static const char* const NAMES[BENCH_PHASES] = { "aliased", "fast", "smooth" };
+  return NAMES[phase];
+}
+static void benchApplyPhase(int phase) { Theme::setQuality((Coverage::Quality)phase); }
+#else
+static constexpr const char* BENCH_NAME   = "render";
+static constexpr int         BENCH_PHASES = 3;
+
+static const char* benchPhaseName(int phase) {
+  static const char* const NAMES[BENCH_PHASES] = { "spans", "batched", "tiles" };
+  return NAMES[phase];
+}
+static void benchApplyPhase(int phase) {
+  g_face.batch = (phase == 1);
+  Face::useTiles(g_face, phase == 2 ? &g_shadow : nullptr);
+}
+#endif
+
+static void benchFrame(uint32_t frameUs) {
+  BenchStats& st = g_benchStats;
+  st.frames++; st.sumUs += frameUs;
+  if (frameUs > st.maxUs) st.maxUs = frameUs;
+  st.pushOps += g_face.pushOps; st.cmdBytes += g_face.cmdBytes; st.pxBytes += g_face.pxBytes;
+
+  const uint32_t tNow = millis();
+  if (tNow < g_benchPhaseEndMs) return;
+  if (g_benchPhaseEndMs) {
+    const uint32_t n = st.frames ? st.frames : 1;
+    Serial.printf("{\"bench\":\"%s\",\"phase\":\"%s\",\"iram\":%d,\"frames\":%u,\"mean_us\":%u,\"max_us\":%u,"
+                  "\"push_ops\":%u,\"cmd_bytes\":%u,\"px_bytes\":%u}\n",
+                  BENCH_NAME, benchPhaseName(g_benchPhase), FACE_IRAM_ENABLED, (unsigned)st.frames,
+                  (unsigned)(st.sumUs / n), (unsigned)st.maxUs, (unsigned)(st.pushOps / n),
+                  (unsigned)(st.cmdBytes / n), (unsigned)(st.pxBytes / n));
+    g_benchPhase = (g_benchPhase + 1) % BENCH_PHASES;
+  }
+  benchApplyPhase(g_benchPhase);
+  st = BenchStats();
+  g_benchPhaseEndMs = tNow + BENCH_PHASE_MS;
+}
+#endif
+
 void setup(){
   randomSeed((uint32_t)esp_random() ^ (uint32_t)micros());
   Serial.begin(115200);
 
+  audioBegin();
+  sdInit();
+  xTaskCreatePinnedToCore(audioTask, "audio", AUDIO_TASK_STACK, nullptr, AUDIO_TASK_PRIO, nullptr, AUDIO_TASK_CORE);
+#ifdef FACE_UDP
+  udpBegin();
+#endif
+
+#ifdef MODE_BENCH_FLASH
+  xTaskCreatePinnedToCore(benchStressTask, "bench", 4096, nullptr, 1, nullptr, 0);
+#endif
+
   gfx.init();
   gfx.setRotation(1);
   gfx.fillScreen(TFT_BLACK);
+  gfx.startWrite();
+  Scroll::define(gfx);          // whole panel scrolls, start line 0
+  Scroll::setStart(gfx, 0);
+  gfx.endWrite();
 
-  // Initialize eyes (draw rims, pupils, baseline lids)
-  Eyes::init(gfx, EYES, E_LAYOUT);
+  // Initialize eyes (rims, pupils, baseline lids appear with the first Face::render)
+  Eyes::init(EYES, E_LAYOUT);
+  Face::reset(g_face);
+#ifdef FACE_TILES
+  Face::useTiles(g_face, &g_shadow);
+#endif
 
   // Lay out mouth relative to current eye position
   const int H = gfx.height();
   const int defaultMouthY = H - MOUTH_BASELINE_OFFSET;
   const int deltaY = (EYES.oldCy - EYES.L.cy); // positive if eyes moved up; negative if moved down
-  g_mouthY = constrain(defaultMouthY - deltaY + MOUTH_EXTRA_DOWN, EYES.L.cy + EYES.L.rWhite + 8, H - 4);
-  g_mouthW = (int)roundf(gfx.width() * MOUTH_WIDTH_FACTOR);
+  g_mouth.baseY = constrain(defaultMouthY - deltaY + MOUTH_EXTRA_DOWN, EYES.L.cy + EYES.L.rWhite + 8, H - 4);
+  g_mouth.w     = (int)roundf(gfx.width() * MOUTH_WIDTH_FACTOR);
 
 #ifdef MODE_DEBUG
   // Start at first mood
   dbg_idx = 0;
   const MouthMood m = DEBUG_MOODS[dbg_idx];
-  gfx.startWrite();
   drawMouthMood(m);
-  clearMoodLabel(); 
   drawMoodLabel(moodName(m));
-  gfx.endWrite();
   dbg_nextSwitch = nowMs() + DEBUG_MOOD_HOLD_MS;
 #else
   // Start silent with a mood
-  enterSilent();
+  Speech::enterSilent(g_speech, nowMs());
+  showSpeech(Speech::Event::Silent);
 #endif
 }
 
 void loop(){
-  // Fixed cadence using FreeRTOS tick
+  // Fixed cadence using FreeRTOS tick (slow while asleep)
   static TickType_t last = xTaskGetTickCount();
-  const TickType_t period = pdMS_TO_TICKS(1000 / Eyes::FPS_DEFAULT);
+  const TickType_t period = pdMS_TO_TICKS(g_sleep.active ? Sleep::UPDATE_MS : 1000 / Eyes::FPS_DEFAULT);
   vTaskDelayUntil(&last, period);
   const float dt = (float)period / 1000.f;
+  const uint32_t frameStartUs = micros();
 
-  // Always update eyes (blink, gaze, lids, pupils)
-  Eyes::update(gfx, EYES, dt);
+  pollCommands();
+#ifdef FACE_UDP
+  pollUdp(millis());
+#endif
+  linkStats(millis());
+  Link::drain(g_linkTx, Serial, Msg::FRAME_SIZE);
+  if (millis() - g_powerReportMs >= Power::REPORT_MS) {
+    g_powerReportMs = millis();
+    Power::report(Serial);
+  }
+  if (g_sleep.active) {
+    Sleep::render(gfx, g_face, g_sleep);
+    linkShown();
+    return;
+  }
 
 #ifdef MODE_DEBUG
   // Cycle moods every 5s, always show label
   const uint32_t tNow = nowMs();
   if (tNow >= dbg_nextSwitch){
     dbg_idx = (dbg_idx + 1) % (int)(sizeof(DEBUG_MOODS)/sizeof(DEBUG_MOODS[0]));
+    dbg_theme = (dbg_theme + 1) % Theme::NUM_PRESETS;
     const MouthMood m = DEBUG_MOODS[dbg_idx];
-    gfx.startWrite();
     drawMouthMood(m);
-    clearMoodLabel(); 
     drawMoodLabel(moodName(m));
-    gfx.endWrite();
+    dbg_shape = (dbg_shape + 1) % Sdf::NUM_KINDS;
+    Sdf::Shape shape;
+    shape.kind = (Sdf::Kind)dbg_shape;
+    Eyes::setShape(EYES, shape);
+    if (dbg_idx & 1) {            // alternate: cross-fade, or slide the new face in
+      Theme::fadeTo(*Theme::PRESETS[dbg_theme]);
+    } else {
+      Theme::fadeTo(*Theme::PRESETS[dbg_theme], 0);
+      Face::slide(g_face, (dbg_theme & 1) ? Scroll::Dir::Left : Scroll::Dir::Right);
+    }
     dbg_nextSwitch = tNow + DEBUG_MOOD_HOLD_MS;
   }
 #else
-  // ------- Normal mode: random talk/silence -------
-  const uint32_t tNow = nowMs();
-
-  // State transition when time is up
-  if (tNow >= g_stateUntilMs) {
-    if (g_speech == SpeechState::Silent) enterTalking();
-    else                                  enterSilent();
+  // ------- Normal mode: random talk/silence (transitions, then mouth swaps at cadence) -------
+  if (g_lips.active) {
+    // lip sync from text; back to a held mood when it ends
+    if (Viseme::tick(g_lips, nowMs())) {
+      if (g_lips.active) drawMouthTalkIdx(Viseme::frame(g_lips));
+      else { Speech::enterSilent(g_speech, nowMs()); showSpeech(Speech::Event::Silent); }
+    }
+  } else {
+    showSpeech(Speech::tick(g_speech, nowMs()));
   }
+#endif
 
-  // Talking: swap mouth frames at cadence
-  if (g_speech == SpeechState::Talking && tNow >= g_nextMouthSwapMs) {
-    int nextIdx = g_currTalkIdx;
-    while (nextIdx == g_currTalkIdx) nextIdx = randRange(0, NUM_TALK_FRAMES-1);
-    g_currTalkIdx = nextIdx;
-
-    gfx.startWrite();
-    drawMouthTalkIdx(g_currTalkIdx);
-    gfx.endWrite();
-
-    g_nextMouthSwapMs = tNow + TALK_SWAP_MS_BASE + randRange(-(int)TALK_SWAP_JITTER,(int)TALK_SWAP_JITTER);
+  // Always update eyes (blink, gaze, lids, pupils) and the theme fade, then push what changed
+  {
+    TRACE_SCOPE(Trace::RENDER_FRAME);
+    reactToAudio();
+    Eyes::update(EYES, dt);
+    steerFromHost();
+    Theme::tick();
+    Caption::tick(g_caption);
+    if (g_clip[0].active) {
+      Face::GfxSink sink{ gfx };
+      gfx.startWrite();
+      for (auto& pl : g_clip) Clip::tick(pl, millis(), sink);
+      gfx.endWrite();
+      if ((int32_t)(millis() - g_clipUntilMs) >= 0) stopClip();
+    } else {
+      Face::render(gfx, g_face, EYES, g_mouth, &g_caption);
+      linkShown();
+    }
   }
+
+  TRACE_STUTTER(Serial, micros() - frameStartUs, 1000000UL / Eyes::FPS_DEFAULT);
+#if defined(MODE_BENCH_FLASH) || defined(MODE_BENCH_EDGES) || defined(MODE_BENCH_RENDER)
+  benchFrame(micros() - frameStartUs);
 #endif
 }
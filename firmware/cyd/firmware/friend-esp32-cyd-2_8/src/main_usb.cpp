@@ -1,23 +1,61 @@
 #include <Arduino.h>
+#include "trace.h"
+#include "link_msgs.h"   // schema-generated link messages (tools/link.schema)
+
+static Link::Rx   g_rx;
+static Link::Ring g_tx;
+static uint16_t   g_seq = 0;
+
+// One frame from the host, read in place; commands are answered with an Ack.
+static void onFrame(const uint8_t* f, size_t n){
+  TRACE_SCOPE(Trace::LINK_RX);
+  const Link::Header& h = *reinterpret_cast<const Link::Header*>(f);
+  uint8_t status = Msg::ACK_OK;
+  if (const Msg::Ping* m = Msg::view<Msg::Ping>(f, n)) {
+    if (!h.seq) Msg::sendHello(g_tx, g_seq++, Msg::APP_USB, Msg::SCHEMA, Link::MAX_FRAME);
+    Msg::sendPong(g_tx, h.seq, m->hostUs, micros());
+    return;
+  } else if (const Msg::Mood* m = Msg::view<Msg::Mood>(f, n)) {
+    digitalWrite(LED_BUILTIN, m->mood ? HIGH : LOW);   // the pipe test: any mood but neutral lights it
+#ifdef FACE_TRACE
+  } else if (Msg::view<Msg::Trace>(f, n)) {
+    Link::drain(g_tx, Serial, Msg::FRAME_SIZE);
+    Trace::dump(Serial);
+#endif
+  } else {
+    status = Msg::ACK_UNSUPPORTED;
+  }
+  Msg::sendAck(g_tx, g_seq++, h.id, status, h.seq);
+}
 
 void setup() {
   Serial.begin(115200);
   while (!Serial) { delay(10); }  // wait for USB CDC on S3
   Serial.println("{\"status\":\"ready\",\"app\":\"usb-link\"}");
+  Msg::sendHello(g_tx, g_seq++, Msg::APP_USB, Msg::SCHEMA, Link::MAX_FRAME);
   pinMode(LED_BUILTIN, OUTPUT);
 }
 
 void loop() {
   static String line;
   while (Serial.available()) {
-    char c = (char)Serial.read();
+    const uint8_t b = (uint8_t)Serial.read();
+    const Link::Fed fed = Link::feed(g_rx, b, Msg::FRAME_SIZE);
+    if (fed == Link::FRAME) onFrame(g_rx.buf, g_rx.need);
+    if (fed != Link::NOT_LINK) continue;
+    const char c = (char)b;
     if (c == '\n' || c == '\r') {
       if (line.length()) {
+        TRACE_SCOPE(Trace::LINK_RX);
         line.trim();
-        // simple commands to prove the pipe
+        // text commands for a serial monitor; the host speaks link frames
         if (line.equalsIgnoreCase("start smile")) {
           Serial.println("{\"ack\":\"start_smile\"}");
           digitalWrite(LED_BUILTIN, HIGH);
+#ifdef FACE_TRACE
+        } else if (line.equalsIgnoreCase("trace")) {
+          Trace::dump(Serial);
+#endif
         } else if (line.equalsIgnoreCase("stop")) {
           Serial.println("{\"ack\":\"stop\"}");
           digitalWrite(LED_BUILTIN, LOW);
@@ -32,4 +70,5 @@ void loop() {
       line += c;
     }
   }
+  Link::drain(g_tx, Serial, Msg::FRAME_SIZE);
 }
@@ -1,11 +1,12 @@
 #pragma once
 #include <stdint.h>
+#include "iram.h"
 
 // ====== Global mouth geometry ======
 static constexpr int   MOUTH_SEGMENTS   = 21; // smoother contours
 static constexpr int   MOUTH_MAX_DY     = 12; // abs max px offset per lip
-static constexpr int   MOUTH_CLEAR_PAD  = 5;  // vertical clear band around mouth
 static constexpr int   ANCHOR_PX        = 2;  // fixed pixels at each end that never move
+static constexpr int   MOUTH_TEETH_PX   = 2;  // teeth band under the upper lip (open mouths)
 
 // Signed offsets per lip, relative to baseline (0)
 // +N = above baseline; -N = below baseline
@@ -23,35 +24,35 @@ enum class MouthMood : uint8_t { Neutral=0, Smile, Frown, Puzzled, Oooh };
 // Helper comment: 21 points are indexed 0..20 (center at 10).
 
 // Neutral: single slightly-open line (lower just a hair below baseline)
-static const MouthFrame MOOD_NEUTRAL = {
+FACE_DRAM static const MouthFrame MOOD_NEUTRAL = {
   MF_UP( 0,0,0,0,0,0,0,0,1,1, 1, 1,1,0,0,0,0,0,0,0,0 ),
   MF_LO( -1,-1,-1,-1,-1,-1,-2,-2,-2,-2, -2, -2,-2,-2,-2,-1,-1,-1,-1,-1,-1 )
 };
 
 // Smile: upper = subtle ∩, lower = deeper ∪
-static const MouthFrame MOOD_SMILE = {
+FACE_DRAM static const MouthFrame MOOD_SMILE = {
   MF_UP( 6,4,0,-4,-4,-6,-6,-9,-9,-10, -12, -10,-9,-9,-6,-6,-4,-4,0,4,6 ),
   MF_LO( 5,2,-2,-5,-5,-6,-9,-9,-9,-10, -12, -10,-9,-9,-9,-6,-5,-5,-2,2,5 )
 };
 
 // Frown: upper = deeper ∩, lower = subtle ∪ (inverted smile)
-static const MouthFrame MOOD_FROWN = {
+FACE_DRAM static const MouthFrame MOOD_FROWN = {
   MF_UP( -4,-2,2,4,5,6,9,9,11,12, 12, 12,11,9,9,6,5,4,2,-2,-4 ),
   MF_LO( -6,-3,0,3,4,7,7,8,8,9, 10, 9,8,8,7,7,4,3,0,-3,-6 )
 };
 
 // Puzzled: mild asymmetry, wavy
-static const MouthFrame MOOOD_PUZZLED_FALLBACK = { // in case of typo use this name
+FACE_DRAM static const MouthFrame MOOOD_PUZZLED_FALLBACK = { // in case of typo use this name
   MF_UP( 0,0,1,2,2,  1,3,1,  2,0, 1, 1,0, 2,1,3, 1,2,1,0,0 ),
   MF_LO( 0,0,-1,0,-2, -1,-2,-1, -1,0, -1, -1,0, -2,-1,-2, -1,0,-1,0,0 )
 };
-static const MouthFrame MOOD_PUZZLED = {
+FACE_DRAM static const MouthFrame MOOD_PUZZLED = {
   MF_UP( 0,0,1,2,2,  1,3,1,  2,0, 1, 1,0, 2,1,3, 1,2,1,0,0 ),
   MF_LO( 0,0,-1,0,-2, -1,-2,-1, -1,0, -1, -1,0, -2,-1,-2, -1,0,-1,0,0 )
 };
 
 // “Oooh”: rounded O—symmetric upper(+)/lower(-)
-static const MouthFrame MOOD_OOOH = {
+FACE_DRAM static const MouthFrame MOOD_OOOH = {
   MF_UP( 2,4,4,7,7, 7,8,10,10,12, 12, 12,10,10,8,7,7,7,4,4,2 ),
   MF_LO( -2,-3,-5,-7,-7, -8,-8,-10,-10,-11, -12, -11,-10,-10,-8,-8,-7,-7,-5,-3,-2 )
 };
@@ -69,7 +70,7 @@ static inline const MouthFrame& moodToFrame(MouthMood m) {
 
 // ====== Talking frames (animated bank, signed) ======
 // Keep within [-MOUTH_MAX_DY, +MOUTH_MAX_DY]. 21-point versions.
-static const MouthFrame TALK_FRAMES[] = {
+FACE_DRAM static const MouthFrame TALK_FRAMES[] = {
   // Gentle vowel-ish
   { MF_UP( 0,0,0,0,0, 1,1,2,2,2, 3, 2,2,2,1,1,0,0,0,0,0 ),
     MF_LO( 0,0,0,0,0, -1,-1,-2,-2,-2, -3, -2,-2,-2,-1,-1,0,0,0,0,0 ) },
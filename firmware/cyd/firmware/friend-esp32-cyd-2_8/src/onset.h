@@ -0,0 +1,125 @@
+#pragma once
+#include <Arduino.h>
+#include "iram.h"
+
+// ===== Onsets: playback envelope and beat/onset detection on the audio output stream =====
+// Runs in the audio task on every decoded block before it goes to I2S, integer-only: per ~5 ms hop,
+// the mean level (for the envelope) and the mean first difference (a cheap high-frequency emphasis
+// that rises on attacks, not on sustained tones). An onset is a hop whose high-frequency level jumps
+// above a multiple of its running mean, outside a refractory window. Loudness is the envelope with
+// hysteresis; voicing is a faster envelope with its own, much lower, thresholds (speech against
+// pauses, for lip sync). Events are stamped with the time they will be heard (the block's audible time plus the
+// hop's offset in it) and handed to the render core through a lock-free ring, which drains what is
+// due within half a frame, so an eye response lands on the frame nearest the sound.
+namespace Onset {
+
+// ---------- Tunables ----------
+static constexpr uint32_t HOPS_PER_S      = 200;    // 5 ms analysis hops
+static constexpr int      MEAN_SHIFT      = 5;      // running mean of the HF level: ~32 hops (160 ms)
+static constexpr int      ATTACK_SHIFT    = 4;      // envelope: attack (~80 ms) so single hits do not count as loud ...
+static constexpr int      RELEASE_SHIFT   = 6;      // ... and slower release (~320 ms)
+static constexpr uint32_t RATIO_MIN_Q4    = 40;     // onset: HF level >= 2.5x its running mean (Q4) ...
+static constexpr uint32_t RATIO_FULL_Q4   = 160;    // ... strength 255 at 10x
+static constexpr uint32_t HF_FLOOR        = 120;    // ... and above this (of 65535, ~ -55 dBFS)
+static constexpr uint32_t REFRACTORY_HOPS = 16;     // at most one onset per 80 ms
+static constexpr uint32_t LOUD_ON         = 6000;   // envelope (of 32767) that counts as loud ...
+static constexpr uint32_t LOUD_OFF        = 3500;   // ... until it falls below this
+static constexpr int      VOICE_SHIFT     = 2;      // voicing envelope: ~20 ms both ways
+static constexpr uint32_t VOICE_ON        = 500;    // voicing envelope that counts as sound ...
+static constexpr uint32_t VOICE_OFF       = 250;    // ... until it falls below this (~ -42 dBFS)
+static constexpr int      QUEUE_LEN       = 16;     // power of two
+
+enum Kind : uint8_t { ONSET = 0, LOUD, QUIET, VOICED, UNVOICED };
+
+struct Event {
+  uint32_t dueMs;      // when it is heard
+  uint8_t  kind;
+  uint8_t  strength;   // ONSET: 0..255
+};
+
+// Single producer (audio task), single consumer (render loop).
+struct Queue {
+  Event    ev[QUEUE_LEN];
+  uint32_t head = 0, tail = 0;   // free-running; written by producer / consumer only
+  uint32_t dropped = 0;
+};
+
+struct Detector {
+  uint32_t rate = 0, hop = 0;      // samples per hop
+  uint32_t n = 0, acc = 0, accHf = 0;
+  int32_t  prev = 0;
+  uint32_t env = 0;                // 0..32767
+  uint32_t voiceEnv = 0;
+  uint32_t meanHf = 0;             // running mean of the HF level, Q4
+  uint32_t hops = 0, lastOnsetHop = 0;
+  bool     loud = false, voiced = false;
+  uint32_t onsets = 0;             // since setRate
+};
+
+static void setRate(Detector& d, uint32_t rate){
+  if (!rate || rate == d.rate) return;
+  d = Detector();
+  d.rate = rate;
+  d.hop = max<uint32_t>(rate / HOPS_PER_S, 16);
+}
+
+FACE_IRAM(audio) static bool push(Queue& q, const Event& e){
+  const uint32_t tail = __atomic_load_n(&q.tail, __ATOMIC_ACQUIRE);
+  if (q.head - tail >= (uint32_t)QUEUE_LEN) { ++q.dropped; return false; }
+  q.ev[q.head & (QUEUE_LEN - 1)] = e;
+  __atomic_store_n(&q.head, q.head + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+// Oldest event due by `byMs`; events stay queued until then.
+static bool pop(Queue& q, uint32_t byMs, Event& e){
+  const uint32_t head = __atomic_load_n(&q.head, __ATOMIC_ACQUIRE);
+  if (q.tail == head) return false;
+  const Event& next = q.ev[q.tail & (QUEUE_LEN - 1)];
+  if ((int32_t)(byMs - next.dueMs) < 0) return false;
+  e = next;
+  __atomic_store_n(&q.tail, q.tail + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+// One finished hop; `dueMs` is when its last sample is heard.
+FACE_IRAM(audio) static void endHop(Detector& d, uint32_t dueMs, Queue& q){
+  const uint32_t level = d.acc / d.hop, hf = d.accHf / d.hop;
+  d.acc = d.accHf = 0; d.n = 0;
+  ++d.hops;
+
+  if (level > d.env) d.env += (level - d.env + (1u << ATTACK_SHIFT) - 1) >> ATTACK_SHIFT;
+  else               d.env -= (d.env - level) >> RELEASE_SHIFT;
+  if (!d.loud && d.env >= LOUD_ON)      { d.loud = true;  push(q, Event{ dueMs, LOUD, 0 }); }
+  else if (d.loud && d.env < LOUD_OFF)  { d.loud = false; push(q, Event{ dueMs, QUIET, 0 }); }
+  d.voiceEnv = d.voiceEnv + (level >> VOICE_SHIFT) - (d.voiceEnv >> VOICE_SHIFT);
+  if (!d.voiced && d.voiceEnv >= VOICE_ON)      { d.voiced = true;  push(q, Event{ dueMs, VOICED, 0 }); }
+  else if (d.voiced && d.voiceEnv < VOICE_OFF)  { d.voiced = false; push(q, Event{ dueMs, UNVOICED, 0 }); }
+
+  const uint32_t mean = d.meanHf >> 4;
+  const uint32_t ratioQ4 = (hf << 4) / max<uint32_t>(mean, 1);
+  if (hf >= HF_FLOOR && ratioQ4 >= RATIO_MIN_Q4 && d.hops - d.lastOnsetHop >= REFRACTORY_HOPS) {
+    const uint32_t s = min<uint32_t>(ratioQ4, RATIO_FULL_Q4) - RATIO_MIN_Q4;
+    push(q, Event{ dueMs, ONSET, (uint8_t)(s * 255 / (RATIO_FULL_Q4 - RATIO_MIN_Q4)) });
+    d.lastOnsetHop = d.hops;
+    ++d.onsets;
+  }
+  // the mean follows the HF level in Q4, so a quiet passage does not round it down to zero
+  d.meanHf = d.meanHf + (hf << 4 >> MEAN_SHIFT) - (d.meanHf >> MEAN_SHIFT);
+}
+
+// A block of interleaved PCM (channels averaged) that starts being heard at `blockDueMs`.
+FACE_IRAM(audio) static void feed(Detector& d, const int16_t* pcm, int frames, int channels, uint32_t blockDueMs, Queue& q){
+  if (!d.hop) return;
+  for (int i = 0; i < frames; ++i) {
+    int32_t x = pcm[i * channels];
+    if (channels > 1) x = (x + pcm[i * channels + 1]) >> 1;
+    d.acc   += (uint32_t)(x < 0 ? -x : x);
+    const int32_t dx = x - d.prev;
+    d.accHf += (uint32_t)(dx < 0 ? -dx : dx);
+    d.prev = x;
+    if (++d.n == d.hop) endHop(d, blockDueMs + (uint32_t)((uint64_t)(i + 1) * 1000 / d.rate), q);
+  }
+}
+
+} // namespace Onset
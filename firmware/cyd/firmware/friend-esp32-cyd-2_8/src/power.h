@@ -0,0 +1,66 @@
+#pragma once
+#include <Arduino.h>
+
+// ===== Power telemetry: estimated board current from time spent in each display mode =====
+// There is no current sensor on the CYD, so each mode carries a fixed estimate (panel logic + MCU +
+// backlight at the mode's PWM level) and the counter integrates it over time in mode. Calibrate the
+// table against a USB meter; the ratios between modes are what the sleep renderer is judged by.
+namespace Power {
+
+// ---------- Tunables ----------
+static constexpr float    BACKLIGHT_MA    = 60.f;     // backlight at full PWM
+static constexpr uint32_t REPORT_MS       = 60000;    // periodic JSON line
+
+enum class Mode : uint8_t { Full = 0, Sleep, COUNT };
+
+struct ModeDraw {
+  const char* name;
+  float   panelMa;     // ILI9341 logic + source drivers
+  float   mcuMa;       // ESP32 running this mode's loop (audio task included)
+  uint8_t backlight;   // LovyanGFX setBrightness() level
+};
+
+static const ModeDraw MODES[(int)Mode::COUNT] = {
+  { "full",  6.0f, 45.f, 255 },   // all 320 lines, 65k colours, 40 FPS
+  { "sleep", 1.5f, 30.f, 24  },   // partial area + idle (8-colour) mode, 2 Hz
+};
+
+static inline float modeMa(Mode m){
+  const ModeDraw& d = MODES[(int)m];
+  return d.panelMa + d.mcuMa + BACKLIGHT_MA * d.backlight / 255.f;
+}
+
+struct Counter {
+  Mode     mode    = Mode::Full;
+  uint32_t sinceMs = 0;                     // entered `mode`
+  uint64_t ms[(int)Mode::COUNT] = {};       // time in each mode, closed intervals
+};
+
+static inline Counter& counter(){ static Counter c; return c; }
+
+static inline uint64_t msIn(Mode m){
+  const Counter& c = counter();
+  return c.ms[(int)m] + (c.mode == m ? millis() - c.sinceMs : 0);
+}
+
+static void enter(Mode m){
+  Counter& c = counter();
+  const uint32_t now = millis();
+  c.ms[(int)c.mode] += now - c.sinceMs;
+  c.mode = m; c.sinceMs = now;
+}
+
+// One JSON line: time and estimated draw per mode, charge used, mean current since boot.
+static void report(Print& out){
+  double mAs = 0; uint64_t total = 0;
+  for (int i = 0; i < (int)Mode::COUNT; ++i) {
+    const uint64_t t = msIn((Mode)i);
+    mAs += modeMa((Mode)i) * t / 1000.0; total += t;
+  }
+  out.printf("{\"power\":\"%s\",\"ma_now\":%.1f", MODES[(int)counter().mode].name, modeMa(counter().mode));
+  for (int i = 0; i < (int)Mode::COUNT; ++i)
+    out.printf(",\"ms_%s\":%llu,\"ma_%s\":%.1f", MODES[i].name, (unsigned long long)msIn((Mode)i), MODES[i].name, modeMa((Mode)i));
+  out.printf(",\"mah\":%.3f,\"ma_avg\":%.1f}\n", mAs / 3600.0, total ? mAs * 1000.0 / total : 0.0);
+}
+
+} // namespace Power
@@ -0,0 +1,270 @@
+#pragma once
+#include <Arduino.h>
+#include <math.h>
+#include "eyes.h"
+#include "mouth_patterns.h"
+#include "face.h"
+#include "link.h"
+
+// ===== Remote: face state streamed from the host =====
+// The host (a face mirrored from a camera, a puppeteer) sends the whole face as a small parameter
+// vector, ~60 times a second, over the same serial link as the text commands. A packet is framed as
+//   MAGIC, len, payload[len], crc8(payload)
+// MAGIC is not ASCII, so packets and command lines share the stream. The payload is varints:
+//   seq, back, t, mask, zigzag(v[i] - base[i]) for each bit set in mask
+// `back` is seq minus the seq of the base state (0: a key packet, against the zero vector); `t` is the
+// host clock in ms, low 16 bits. The base is the latest state the device acknowledged, so a packet
+// only carries the parameters that moved since, and losing one costs nothing: the next is against the
+// same or a newer base (the host sends a key packet instead once its base is HISTORY packets old,
+// or before the first ack). Packets are decoded as they arrive; the newest waits for the frame boundary
+// (take()) and an older one still waiting is dropped. Every ACK_MS the device answers with the seq it
+// applied last and that packet's `t`, which gives the host its base and the round trip.
+namespace Remote {
+
+// ---------- Tunables ----------
+static constexpr uint8_t  MAGIC       = 0xFA;   // first byte of a packet
+static constexpr int      MAX_PAYLOAD = 64;
+static constexpr int      HISTORY     = 16;     // applied states kept as delta bases; power of two
+static constexpr uint32_t ACK_MS      = 100;    // ack cadence while packets arrive
+static constexpr uint32_t HOLD_MS     = 500;    // the face is autonomous again after this long without a packet
+static constexpr int      ONE         = 256;    // parameter scale: 1.0
+
+// Gaze is a fraction of the pupil horizon, lids a closure (0 open .. ONE shut), the mouth a few
+// blend weights that toMouth() turns into lip offsets.
+enum Param : uint8_t {
+  GAZE_X = 0, GAZE_Y,                      // -ONE..ONE, +x right, +y down
+  LID_UL, LID_LL, LID_UR, LID_LR,          // 0..ONE: upper/lower, left/right eye
+  PUPIL,                                   // 0 rest, else dilated
+  JAW,                                     // 0..ONE open
+  SMILE,                                   // -ONE (frown) .. ONE
+  PUCKER,                                  // 0..ONE rounded, narrow
+  ASYM,                                    // -ONE..ONE: mouth pulled left .. right
+  NUM_PARAMS
+};
+
+static const char* const PARAM_NAMES[NUM_PARAMS] = {
+  "gaze_x", "gaze_y", "lid_ul", "lid_ll", "lid_ur", "lid_lr", "pupil", "jaw", "smile", "pucker", "asym"
+};
+
+struct Vec { int16_t v[NUM_PARAMS] = {}; };
+
+struct Stats {
+  uint32_t bytes = 0, packets = 0, applied = 0;
+  uint32_t stale = 0, bad = 0, noBase = 0;         // superseded before a frame / framing or crc / base unknown
+  uint32_t sinceMs = 0;                            // window start
+  // send-to-receive / send-to-apply in host-clock ms, shifted by Link::ref (see decode())
+  uint32_t rxMin = UINT32_MAX, applySum = 0, applyMax = 0;
+};
+
+struct Link {
+  // parser
+  uint8_t  buf[MAX_PAYLOAD];
+  uint8_t  st = 0, len = 0, got = 0;
+
+  // decoded, waiting for the frame boundary
+  bool     pending = false;
+  uint32_t pendSeq = 0, pendRxMs = 0;
+  uint16_t pendT = 0;
+  Vec      pendVec;
+
+  // applied
+  Vec      hist[HISTORY];
+  uint32_t histSeq[HISTORY] = {};
+  uint32_t seq = 0, appliedMs = 0, ackMs = 0, ackedSeq = 0;
+  uint16_t t = 0, ref = 0;
+  bool     haveRef = false;
+
+  Stats    stats;
+};
+
+enum : uint8_t { WAIT = 0, LEN, BODY, CRC };
+
+// ---------- codec (shared with the host encoder) ----------
+static inline uint32_t zigzag(int32_t v){ return ((uint32_t)v << 1) ^ (uint32_t)(v >> 31); }
+static inline int32_t unzigzag(uint32_t u){ return (int32_t)(u >> 1) ^ -(int32_t)(u & 1); }
+
+static inline uint8_t* putVar(uint8_t* p, uint32_t v){
+  while (v >= 0x80) { *p++ = (uint8_t)(v | 0x80); v >>= 7; }
+  *p++ = (uint8_t)v;
+  return p;
+}
+
+// Bounded: false past `end` or on a varint longer than 32 bits.
+static inline bool getVar(const uint8_t*& p, const uint8_t* end, uint32_t& v){
+  v = 0;
+  for (int shift = 0; shift < 35; shift += 7) {
+    if (p == end) return false;
+    const uint8_t b = *p++;
+    v |= (uint32_t)(b & 0x7f) << shift;
+    if (!(b & 0x80)) return true;
+  }
+  return false;
+}
+
+// Writes a framed packet of `cur` against `base` (nullptr: a key packet) into out; returns its size.
+static int encode(uint8_t* out, uint32_t seq, const Vec& cur, const Vec* base, uint32_t baseSeq, uint16_t t){
+  static const Vec zero;
+  const Vec& b = base ? *base : zero;
+  uint8_t* p = out + 2;
+  p = putVar(p, seq);
+  p = putVar(p, base ? seq - baseSeq : 0);
+  p = putVar(p, t);
+  uint32_t mask = 0;
+  for (int i = 0; i < NUM_PARAMS; ++i) if (cur.v[i] != b.v[i]) mask |= 1u << i;
+  p = putVar(p, mask);
+  for (int i = 0; i < NUM_PARAMS; ++i) if (mask >> i & 1) p = putVar(p, zigzag(cur.v[i] - b.v[i]));
+  const int len = (int)(p - out - 2);
+  out[0] = MAGIC; out[1] = (uint8_t)len;
+  *p++ = ::Link::crc8(out + 2, len);
+  return (int)(p - out);
+}
+
+// ---------- device ----------
+static inline bool active(const Link& l, uint32_t nowMs){ return l.seq && nowMs - l.appliedMs < HOLD_MS; }
+
+static void decode(Link& l, uint32_t nowMs){
+  const uint8_t* p = l.buf;
+  const uint8_t* end = l.buf + l.len;
+  uint32_t seq, back, t, mask;
+  if (!getVar(p, end, seq) || !getVar(p, end, back) || !getVar(p, end, t) || !getVar(p, end, mask) || !seq ||
+      (mask >> NUM_PARAMS)) { ++l.stats.bad; return; }
+  // a host that went quiet may have restarted its count (and its clock)
+  if (!l.pending && !active(l, nowMs)) l.haveRef = false;
+  const uint32_t newest = l.pending ? l.pendSeq : l.haveRef ? l.seq : 0;
+  if ((int32_t)(seq - newest) <= 0) { ++l.stats.stale; return; }
+
+  Vec v;
+  if (back) {
+    const uint32_t baseSeq = seq - back;
+    const int slot = baseSeq & (HISTORY - 1);
+    if (!l.seq || l.histSeq[slot] != baseSeq) { ++l.stats.noBase; return; }
+    v = l.hist[slot];
+  }
+  for (int i = 0; i < NUM_PARAMS; ++i) {
+    if (!(mask >> i & 1)) continue;
+    uint32_t d;
+    if (!getVar(p, end, d)) { ++l.stats.bad; return; }
+    v.v[i] = (int16_t)(v.v[i] + unzigzag(d));
+  }
+  if (p != end) { ++l.stats.bad; return; }
+
+  if (l.pending) ++l.stats.stale;          // superseded before it was drawn
+  l.pending = true;
+  l.pendSeq = seq; l.pendVec = v; l.pendT = (uint16_t)t; l.pendRxMs = nowMs;
+  ++l.stats.packets;
+
+  // link delay in host ms, offset by the first packet's so it stays near 1 s and never wraps
+  const uint16_t rx = (uint16_t)(nowMs - t);
+  if (!l.haveRef) { l.ref = (uint16_t)(rx - 1000); l.haveRef = true; }
+  l.stats.rxMin = min<uint32_t>(l.stats.rxMin, (uint16_t)(rx - l.ref));
+}
+
+// One byte from the serial port. Returns false when it is not part of a packet (a command character).
+static bool feed(Link& l, uint8_t c, uint32_t nowMs){
+  switch (l.st) {
+    case WAIT:
+      if (c != MAGIC) return false;
+      l.st = LEN; break;
+    case LEN:
+      if (c == 0 || c > MAX_PAYLOAD) { ++l.stats.bad; l.st = WAIT; break; }
+      l.len = c; l.got = 0; l.st = BODY; break;
+    case BODY:
+      l.buf[l.got++] = c;
+      if (l.got == l.len) l.st = CRC;
+      break;
+    default:
+      l.st = WAIT;
+      l.stats.bytes += l.len + 3;
+      if (c == ::Link::crc8(l.buf, l.len)) decode(l, nowMs);
+      else ++l.stats.bad;
+  }
+  return true;
+}
+
+static inline bool receiving(const Link& l){ return l.st != WAIT; }
+
+// At the frame boundary: the newest state received, if there is one since the last call.
+static bool take(Link& l, Vec& out, uint32_t nowMs){
+  if (!l.pending) return false;
+  l.pending = false;
+  const int slot = l.pendSeq & (HISTORY - 1);
+  l.hist[slot] = l.pendVec; l.histSeq[slot] = l.pendSeq;
+  l.seq = l.pendSeq; l.t = l.pendT; l.appliedMs = nowMs;
+  out = l.pendVec;
+  Stats& s = l.stats;
+  ++s.applied;
+  const uint32_t d = (uint16_t)((uint16_t)(nowMs - l.pendT) - l.ref);
+  s.applySum += d; s.applyMax = max(s.applyMax, d);
+  return true;
+}
+
+// The latest applied seq, every ACK_MS while it moves.
+static void ack(Link& l, uint32_t nowMs, Print& out){
+  if (l.seq == l.ackedSeq || nowMs - l.ackMs < ACK_MS) return;
+  l.ackMs = nowMs; l.ackedSeq = l.seq;
+  out.printf("{\"ack\":\"face\",\"seq\":%u,\"t\":%u}\n", (unsigned)l.seq, (unsigned)l.t);
+}
+
+// Link bytes per second and apply latency over the window since the last report, then a new window.
+// Latency is send-to-apply in host ms less the fastest packet's send-to-receive: the frame wait plus
+// link queueing. The host adds the wire time it sees (half the ack round trip).
+static void report(Link& l, uint32_t nowMs, Print& out){
+  Stats& s = l.stats;
+  const uint32_t ms = max<uint32_t>(1, nowMs - s.sinceMs);
+  const bool lat = s.applied && s.rxMin != UINT32_MAX;
+  out.printf("{\"face_link\":\"%s\",\"seq\":%u,\"bytes_s\":%u,\"packets_s\":%u,\"applied_s\":%u,\"stale\":%u,"
+             "\"bad\":%u,\"no_base\":%u,\"lat_avg_ms\":%d,\"lat_max_ms\":%d}\n",
+             active(l, nowMs) ? "on" : "off", (unsigned)l.seq, (unsigned)(s.bytes * 1000ull / ms),
+             (unsigned)(s.packets * 1000ull / ms), (unsigned)(s.applied * 1000ull / ms), (unsigned)s.stale,
+             (unsigned)s.bad, (unsigned)s.noBase, lat ? (int)(s.applySum / s.applied - s.rxMin) : -1,
+             lat ? (int)(s.applyMax - s.rxMin) : -1);
+  s = Stats();
+  s.sinceMs = nowMs;
+}
+
+// ---------- the face ----------
+// Gaze and lids over what Eyes::update worked out this frame. The gaze FSM is parked in a fixation at
+// the streamed position and blinks are held off, so the face carries on from here when the stream stops.
+static void applyEyes(Eyes::State& s, const Vec& v, uint32_t nowMs){
+  constexpr int Q = Coverage::PHASES;
+  const int h = s.L.maxOffset;
+  s.gaze.posX = (float)Eyes::clampi(v.v[GAZE_X], -ONE, ONE) * h / ONE;
+  s.gaze.posY = (float)Eyes::clampi(v.v[GAZE_Y], -ONE, ONE) * h / ONE;
+  s.gaze.state = Eyes::GazeState::FIXATE; s.gaze.stateStartMs = nowMs;
+  s.blink.activeL = s.blink.activeR = false;
+  s.blink.nextTriggerMsL = nowMs + Eyes::BLINK_INTERVAL_MIN_MS;
+  s.blink.nextTriggerMsR = s.blink.nextTriggerMsL + Eyes::BLINK_EYE_OFFSET_MS;
+  const int dx = (int)lrintf(s.gaze.posX * Q), dy = (int)lrintf(s.gaze.posY * Q);
+  s.L.qx = s.L.cx * Q + dx; s.L.qy = s.L.cy * Q + dy;
+  s.R.qx = s.R.cx * Q + dx; s.R.qy = s.R.cy * Q + dy;
+  auto lid = [&](int p){ return Eyes::clampf((float)v.v[p] / ONE, 0.f, 1.f); };
+  s.L.lidU = lid(LID_UL); s.L.lidL = lid(LID_LL);
+  s.R.lidU = lid(LID_UR); s.R.lidL = lid(LID_LR);
+  s.edges.pupil = v.v[PUPIL] != 0;
+}
+
+// Lip offsets from the mouth weights: the jaw opens a bowl between the lips, a pucker narrows and
+// rounds it, a smile bends both lips (corners up, centre down; negative frowns), asym slides it sideways.
+static uint8_t toMouth(const Vec& v, MouthFrame& f){
+  const float jaw = Eyes::clampf((float)v.v[JAW] / ONE, 0.f, 1.f);
+  const float smile = Eyes::clampf((float)v.v[SMILE] / ONE, -1.f, 1.f);
+  const float pucker = Eyes::clampf((float)v.v[PUCKER] / ONE, 0.f, 1.f);
+  const float asym = Eyes::clampf((float)v.v[ASYM] / ONE, -1.f, 1.f);
+  const float open = jaw * MOUTH_MAX_DY + pucker * 4.f;
+  const float w = 1.f - 0.45f * pucker;
+  const int mid = MOUTH_SEGMENTS / 2;
+  for (int i = 0; i < MOUTH_SEGMENTS; ++i) {
+    const float x = (float)(i - mid) / mid;
+    const float u = (x - 0.3f * asym) / w;
+    const float in = u * u < 1.f ? 1.f - u * u : 0.f;
+    const float bowl = (1.f - pucker) * in + pucker * sqrtf(in);
+    const float bend = smile * (18.f * x * x - 10.f) * 0.6f;
+    float up = bend + open * 0.35f * bowl, lo = bend - 1.f - open * 0.9f * bowl;
+    up = Eyes::clampf(up, -MOUTH_MAX_DY, MOUTH_MAX_DY);
+    lo = Eyes::clampf(lo, -MOUTH_MAX_DY, up);
+    f.upper[i] = (int8_t)lrintf(up); f.lower[i] = (int8_t)lrintf(lo);
+  }
+  return open > 2.f ? Face::LIPS_JOIN | Face::LIPS_CAVITY | Face::LIPS_TEETH : Face::LIPS_JOIN;
+}
+
+} // namespace Remote
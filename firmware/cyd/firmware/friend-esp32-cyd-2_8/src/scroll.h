@@ -0,0 +1,78 @@
+#pragma once
+#include <Arduino.h>
+
+// ===== Hardware scroll: slide transitions on the ILI9341 scroll start line =====
+// The controller scrolls along its native 320-line axis (VSCRDEF / VSCRSADD), which is screen x in
+// the landscape rotation used here, and the scroll area always spans all 240 screen rows. A slide
+// moves the start line a few lines per frame, one command each, and only the face columns that wrap
+// into view are drawn. A full slide ends on the start line it began on, so face columns always equal
+// panel lines at rest and the renderer keeps drawing in face coordinates; mid-slide, screenX() maps
+// an incoming column to where it shows.
+namespace Scroll {
+
+// ---------- Tunables ----------
+static constexpr int     LINES              = 320;   // scroll axis = landscape screen width
+static constexpr int     SLIDE_PX_PER_FRAME = 16;    // 20 frames = 0.5 s at 40 FPS
+static constexpr uint8_t CMD_VSCRDEF        = 0x33;  // top fixed, scroll area, bottom fixed
+static constexpr uint8_t CMD_VSCRSADD       = 0x37;  // scroll start line
+
+// Direction the outgoing face leaves in (swapped on a mirrored panel mount).
+enum class Dir : int8_t { Left = 1, Right = -1 };
+
+struct Slide {
+  int16_t  progress = 0;   // incoming face columns on screen
+  int16_t  step     = 0;   // columns per frame; 0 = no slide running
+  Dir      dir      = Dir::Left;
+  inline bool active() const { return step != 0; }
+};
+
+static inline void begin(Slide& s, Dir dir, int step = SLIDE_PX_PER_FRAME){
+  s.progress = 0; s.dir = dir; s.step = (int16_t)max(1, min(step, LINES));
+}
+
+// Incoming face columns already on screen: [lo, hi).
+static inline void revealed(const Slide& s, int& lo, int& hi){
+  if (s.dir == Dir::Left) { lo = 0; hi = s.progress; }
+  else                    { lo = LINES - s.progress; hi = LINES; }
+}
+
+// Columns the next step wraps into view: [lo, hi).
+static inline void exposed(const Slide& s, int& lo, int& hi){
+  const int k = min((int)s.step, LINES - s.progress);
+  if (s.dir == Dir::Left) { lo = s.progress; hi = s.progress + k; }
+  else                    { lo = LINES - s.progress - k; hi = LINES - s.progress; }
+}
+
+// Start line once `progress` columns are in.
+static inline int startLine(const Slide& s){
+  const int p = s.progress % LINES;
+  return s.dir == Dir::Left ? p : (LINES - p) % LINES;
+}
+
+// Screen x showing incoming face column x.
+static inline int screenX(const Slide& s, int x){ return ((x - startLine(s)) % LINES + LINES) % LINES; }
+
+// Advances one step; returns false once the slide has finished.
+static inline bool advance(Slide& s){
+  s.progress = (int16_t)min(LINES, s.progress + s.step);
+  if (s.progress < LINES) return true;
+  s.progress = 0; s.step = 0;
+  return false;
+}
+
+// Panel commands; call inside startWrite()/endWrite().
+template <class Gfx>
+static void define(Gfx& g, int topFixed = 0, int bottomFixed = 0){
+  g.writeCommand(CMD_VSCRDEF);
+  g.writeData16(topFixed);
+  g.writeData16(LINES - topFixed - bottomFixed);
+  g.writeData16(bottomFixed);
+}
+
+template <class Gfx>
+static inline void setStart(Gfx& g, int line){
+  g.writeCommand(CMD_VSCRSADD);
+  g.writeData16(line);
+}
+
+} // namespace Scroll
@@ -0,0 +1,153 @@
+#pragma once
+#include <Arduino.h>
+#include "coverage.h"
+
+// ===== Eye outlines as integer signed distance functions =====
+// Each shape is an integer SDF in 1/Q px around the eye centre (negative inside), scaled to the eye
+// radius. A morph blends two shapes' distances, which stays 1-Lipschitz, so a pixel whose centre is
+// more than SKIP_Q from the outline is settled without supersampling. Outlines are rasterised into
+// the same coverage tables as the disc (rim = mean of the d <= +RIM_Q and d <= -RIM_Q coverage), a
+// bounded number of samples per frame; drawing a row never touches the SDF.
+namespace Sdf {
+
+// ---------- Tunables ----------
+static constexpr int      Q                    = 16;     // fixed point: 1/16 px
+static constexpr int      RIM_Q                = Q / 2;  // rim line half-width (disc: r +- 0.5)
+static constexpr int      SKIP_Q               = 18;     // > RIM_Q + the farthest sample (0.53 px)
+static constexpr uint32_t EVAL_BUDGET          = 4000;   // samples rasterised per frame during a morph
+static constexpr uint16_t MORPH_FRAMES_DEFAULT = 16;     // 0.4 s at 40 FPS
+static constexpr int      BLEND_ONE            = 256;
+
+enum class Kind : uint8_t { Circle = 0, RoundRect, Squint, Heart, Star };
+static constexpr int NUM_KINDS = 5;
+
+// p: corner radius (RoundRect), lid cut (Squint), inner radius (Star), in 1/255 of the eye radius.
+struct Shape {
+  Kind    kind = Kind::Circle;
+  uint8_t p    = 128;
+  inline bool operator==(const Shape& o) const { return kind == o.kind && p == o.p; }
+};
+
+// `from` blended toward `to` by t / BLEND_ONE.
+struct Morph {
+  Shape    from, to;
+  uint16_t t = 0;
+};
+
+static inline uint32_t isqrt(uint32_t v){
+  uint32_t r = 0, bit = 1u << 30;
+  while (bit > v) bit >>= 2;
+  while (bit) {
+    if (v >= r + bit) { v -= r + bit; r = (r >> 1) + bit; }
+    else r >>= 1;
+    bit >>= 2;
+  }
+  return r;
+}
+static inline int len(int x, int y){ return (int)isqrt((uint32_t)(x * x + y * y)); }
+
+// ---------- Primitives (all lengths in 1/Q px, y down) ----------
+static inline int circle(int x, int y, int r){ return len(x, y) - r; }
+
+static inline int roundRect(int x, int y, int bx, int by, int r){
+  const int qx = abs(x) - bx + r, qy = abs(y) - by + r;
+  return len(max(qx, 0), max(qy, 0)) + min(max(qx, qy), 0) - r;
+}
+
+// Heart of height ~1.1 s, tip down at (0, tipY).
+static inline int heart(int x, int y, int s, int tipY){
+  const int px = abs(x), py = tipY - y;
+  if (px + py > s) return len(px - s / 4, py - 3 * s / 4) - s * 181 / 512;      // sqrt(2)/4
+  const int h = max(px + py, 0) / 2;
+  const int d = (int)isqrt((uint32_t)min(px * px + (py - s) * (py - s), (px - h) * (px - h) + (py - h) * (py - h)));
+  return px > py ? d : -d;
+}
+
+// Five-point star, outer radius r, inner radius ratio rf / 256, one point up.
+static inline int star5(int x, int y, int r, int rf){
+  static constexpr int K1X = 3314, K1Y = -2408;                     // (cos 36, -sin 36) in Q12
+  int px = abs(x), py = -y;
+  int d = (K1X * px + K1Y * py) >> 12;
+  if (d > 0) { px -= (2 * d * K1X) >> 12; py -= (2 * d * K1Y) >> 12; }
+  d = (-K1X * px + K1Y * py) >> 12;
+  if (d > 0) { px += (2 * d * K1X) >> 12; py -= (2 * d * K1Y) >> 12; }
+  px = abs(px); py -= r;
+  const int bax = (rf * -K1Y) >> 8, bay = ((rf * K1X) >> 8) - 4096; // Q12
+  const int64_t num = (int64_t)px * bax + (int64_t)py * bay;
+  const int64_t den = (int64_t)bax * bax + (int64_t)bay * bay;
+  const int h = (int)constrain(num * 4096 / den, (int64_t)0, (int64_t)r);
+  const int dist = len(px - ((bax * h) >> 12), py - ((bay * h) >> 12));
+  return (int64_t)py * bax - (int64_t)px * bay > 0 ? dist : -dist;
+}
+
+// Distance to `sh` scaled to eye radius r (1/Q px).
+static int eval(const Shape& sh, int x, int y, int r){
+  switch (sh.kind) {
+    case Kind::Circle:    return circle(x, y, r);
+    case Kind::RoundRect: return roundRect(x, y, r, r * 7 / 8, r * sh.p / 255);
+    case Kind::Squint:    return max(circle(x, y, r), -circle(x, y - r * (64 + sh.p) / 255, r));
+    case Kind::Heart:     return heart(x, y, r * 8 / 5, r * 7 / 8);
+    case Kind::Star:      return star5(x, y, r, sh.p);
+  }
+  return circle(x, y, r);
+}
+
+static inline int eval(const Morph& m, int x, int y, int r){
+  if (m.t == 0 || m.from == m.to) return eval(m.from, x, y, r);
+  if (m.t >= BLEND_ONE) return eval(m.to, x, y, r);
+  return (eval(m.from, x, y, r) * (BLEND_ONE - m.t) + eval(m.to, x, y, r) * m.t) / BLEND_ONE;
+}
+
+// Rasterises a morph into a coverage table across frames.
+struct Raster {
+  Coverage::Table* tb = nullptr;
+  Morph    m;
+  int      r = 0;            // eye radius, 1/Q px
+  int16_t  row = 0;          // next table row
+  bool     busy = false;
+  uint32_t evals = 0;        // samples of the current build so far
+  uint32_t evalsLast = 0;    // samples of the last step (bounded by EVAL_BUDGET + one row)
+};
+
+static void start(Raster& j, Coverage::Table& tb, const Morph& m, int radiusPx){
+  j.tb = &tb; j.m = m; j.r = radiusPx * Q;
+  j.row = 0; j.busy = true; j.evals = 0;
+  Coverage::begin(tb, radiusPx + 2);
+}
+
+// One pixel's level: settled from the centre distance when far from the outline, else SS x SS samples.
+static inline int level(const Raster& j, int dx, int dy, uint32_t& evals){
+  const int cx = dx * Q, cy = dy * Q;
+  const int d = eval(j.m, cx, cy, j.r);
+  ++evals;
+  if (d > SKIP_Q)  return 0;
+  if (d < -SKIP_Q) return Coverage::FULL;
+  int n = 0;
+  for (int sj = 0; sj < Coverage::SS; ++sj) {
+    const int sy = cy + (2 * sj + 1 - Coverage::SS) * Q / (2 * Coverage::SS);
+    for (int si = 0; si < Coverage::SS; ++si) {
+      const int sx = cx + (2 * si + 1 - Coverage::SS) * Q / (2 * Coverage::SS);
+      const int ds = eval(j.m, sx, sy, j.r);
+      n += (ds <= RIM_Q) + (ds <= -RIM_Q);
+    }
+  }
+  evals += Coverage::FULL;
+  return (n + 1) / 2;
+}
+
+// Builds rows until `budget` samples are spent; true once the table is complete.
+static bool step(Raster& j, uint32_t budget = EVAL_BUDGET){
+  if (!j.busy) return true;
+  uint32_t n = 0;
+  Coverage::Table& tb = *j.tb;
+  while (j.row < tb.rows && n < budget) {
+    const int dy = j.row - tb.half;
+    Coverage::buildRow(tb, j.row, [&](int dx){ return level(j, dx, dy, n); });
+    ++j.row;
+  }
+  j.evals += n; j.evalsLast = n;
+  j.busy = j.row < tb.rows;
+  return !j.busy;
+}
+
+} // namespace Sdf
@@ -0,0 +1,117 @@
+#pragma once
+#include <Arduino.h>
+#include <LovyanGFX.hpp>
+#include "theme.h"
+#include "display_list.h"
+#include "batch.h"
+#include "scroll.h"
+#include "face.h"
+#include "power.h"
+
+// ===== Sleep renderer: closed eyes in a partial-area band, idle (8-colour) mode, 1-2 Hz =====
+// Partial mode drives only the scan lines of PTLAR and idle mode drops the panel to the MSB of each
+// channel. Scan lines are screen columns in the landscape rotation, so the band is a column range
+// (centred, so a mirrored mount keeps it in place) and the sleeping eyes are drawn narrow enough to
+// fit it. Sleep frames go through the face renderer's lists and the span batcher, clipped to the
+// band; columns outside it keep the awake face in panel memory, so wake() asks Face for one full
+// redraw.
+namespace Sleep {
+
+// ---------- Tunables ----------
+static constexpr int      BAND_X0      = 112;   // first driven line (screen column)
+static constexpr int      BAND_W       = 96;    // driven lines
+static constexpr uint32_t UPDATE_MS    = 500;   // sleep frame period (2 Hz)
+static constexpr int      EYE_DX       = 24;    // eye centre from band centre
+static constexpr int      EYE_R        = 16;    // half-width of a closed eye
+static constexpr int      EYE_SAG      = 5;     // depth of the closed-lid curve
+static constexpr int      BREATH_PX    = 2;     // slow bob of both eyes
+static constexpr int      BREATH_STEPS = 8;     // frames per breath (4 s at 2 Hz)
+
+static constexpr uint8_t CMD_PTLON  = 0x12, CMD_NORON = 0x13, CMD_PTLAR = 0x30;
+static constexpr uint8_t CMD_IDMOFF = 0x38, CMD_IDMON = 0x39;
+
+struct State {
+  bool    active = false;
+  uint8_t step   = 0;      // breath phase
+  int     cy     = 120;    // eye line (awake eye centre)
+};
+
+// What idle mode shows for a colour: the MSB of each channel.
+static inline uint16_t to8(uint16_t c){
+  return (c & 0x8000 ? 0xF800 : 0) | (c & 0x0400 ? 0x07E0 : 0) | (c & 0x0010 ? 0x001F : 0);
+}
+
+// Closed eyes: a 2 px lid curve sagging EYE_SAG at the centre.
+static void emitRow(DList::List& dl, const State& s, int y, uint16_t ink){
+  static const int8_t BREATH[BREATH_STEPS] = { 0, 0, 1, 2, 2, 2, 1, 0 };
+  const int base = s.cy + BREATH[s.step % BREATH_STEPS] * BREATH_PX / 2;
+  if (y < base || y > base + EYE_SAG + 1) return;
+  const int mid = BAND_X0 + BAND_W / 2;
+  for (int e = -1; e <= 1; e += 2) {
+    const int cx = mid + e * EYE_DX;
+    int run = INT_MIN;
+    for (int dx = -EYE_R; dx <= EYE_R + 1; ++dx) {
+      bool on = false;
+      if (dx <= EYE_R) {
+        const float u = dx / (float)EYE_R;
+        const int ly = base + (int)lroundf(EYE_SAG * sqrtf(1.f - u * u));
+        on = y == ly || y == ly + 1;
+      }
+      if (on && run == INT_MIN) run = dx;
+      if (!on && run != INT_MIN) { dl.fill(cx + run, dx - run, ink); run = INT_MIN; }
+    }
+  }
+}
+
+static void render(LGFX& g, Face::Renderer& r, State& s){
+  const uint16_t bg = to8(Theme::palette().bg);
+  uint16_t ink = to8(Theme::palette().lip);
+  if (ink == bg) ink = ~bg & 0xFFFF;
+
+  DList::List& want = r.list[r.shown ^ 1];
+  want.begin();
+  for (int y = 0; y < min(g.height(), DList::MAX_ROWS); ++y) {
+    emitRow(want, s, y, ink);
+    want.endRow();
+  }
+  Face::GfxSink sink{ g };
+  g.startWrite();
+  {
+    Batch::Batcher<Face::GfxSink> b(sink, want, bg);
+    DList::Clip<Batch::Batcher<Face::GfxSink>> clip{ b, BAND_X0, BAND_X0 + BAND_W - 1 };
+    DList::diff(r.list[r.shown], want, bg, clip, r.last);
+    b.finish();
+  }
+  g.endWrite();
+  r.shown ^= 1;
+  ++s.step;
+}
+
+// Narrows the panel to the band in idle mode; the caller then calls render() every UPDATE_MS.
+static void enter(LGFX& g, Face::Renderer& r, State& s, int eyeCy){
+  s.active = true; s.step = 0; s.cy = eyeCy;
+  g.startWrite();
+  if (r.slide.active()) { r.slide = Scroll::Slide(); Scroll::setStart(g, 0); }
+  g.writeCommand(CMD_PTLAR);
+  g.writeData16(BAND_X0);
+  g.writeData16(BAND_X0 + BAND_W - 1);
+  g.writeCommand(CMD_PTLON);
+  g.writeCommand(CMD_IDMON);
+  g.endWrite();
+  g.setBrightness(Power::MODES[(int)Power::Mode::Sleep].backlight);
+  Power::enter(Power::Mode::Sleep);
+}
+
+// Back to normal display and full colour; the next Face::render redraws the whole face once.
+static void wake(LGFX& g, Face::Renderer& r, State& s){
+  s.active = false;
+  g.startWrite();
+  g.writeCommand(CMD_IDMOFF);
+  g.writeCommand(CMD_NORON);
+  g.endWrite();
+  g.setBrightness(Power::MODES[(int)Power::Mode::Full].backlight);
+  Power::enter(Power::Mode::Full);
+  Face::repaint(r);
+}
+
+} // namespace Sleep
@@ -0,0 +1,225 @@
+#pragma once
+#include <Arduino.h>
+#include "iram.h"
+
+// ===== Sound: prioritised sound events on the one decoder =====
+// Speech outranks reactions, which outrank ambient sounds. Requests wait in a binary heap (priority,
+// then arrival) in preallocated slots, so queueing and picking the next sound are O(log n). There is a
+// single decoder, so a higher-priority request ducks the sound playing: its gain eases to zero over
+// DUCK_MS, then it is stopped (an ambient sound goes back in the queue to resume where it was; a
+// reaction is dropped, it would be stale) and the new sound eases in. Equal priorities take turns.
+// cancel(tag) removes queued requests with that tag and ducks out a playing one; flush() (tag 0) does it
+// for all.
+//
+// Any core posts requests through an SPSC command ring (one poster: the render loop). The audio task
+// owns the heap and the decoder: tick() before each decoder pump, and apply() on every decoded block,
+// which runs the gain curve and records event-to-audible latency per priority class.
+namespace Sound {
+
+// ---------- Tunables ----------
+static constexpr int      QUEUE_LEN = 16;      // pending requests
+static constexpr int      CMD_LEN   = 8;       // command ring; power of two
+static constexpr int      SRC_LEN   = 96;      // path or text, with terminator
+static constexpr uint32_t DUCK_MS   = 120;     // fade-out before a sound is preempted or cancelled
+static constexpr uint32_t FADE_MS   = 30;      // fade-in of each sound
+static constexpr int      GAIN_ONE  = 1 << 15;
+
+enum Prio : uint8_t { SPEECH = 0, REACTION, AMBIENT, NUM_PRIO };
+enum Kind : uint8_t { FILE = 0, TTS };
+
+static const char* const PRIO_NAMES[NUM_PRIO] = { "speech", "reaction", "ambient" };
+
+struct Request {
+  uint32_t seq = 0;              // arrival order
+  uint32_t askedMs = 0;          // post time; 0 = not measured (a requeued ambient sound)
+  uint32_t resume = 0;           // FILE: byte offset to resume from (0 = the start)
+  uint16_t tag = 0;
+  uint8_t  prio = AMBIENT, kind = FILE;
+  char     src[SRC_LEN] = {};
+};
+
+enum Op : uint8_t { PLAY = 0, CANCEL, FLUSH };
+struct Command { uint8_t op; Request r; };
+
+struct Stats {
+  uint32_t started = 0, stopped = 0, dropped = 0;   // stopped: ducked out (preempted or cancelled)
+  uint32_t latSumMs = 0, latMaxMs = 0, latN = 0;
+};
+
+struct Scheduler {
+  // command ring: posted by one core, drained by the audio task
+  Command  cmd[CMD_LEN];
+  uint32_t head = 0, tail = 0;
+  uint32_t nextSeq = 1;
+
+  // audio task only
+  Request  heap[QUEUE_LEN];
+  int      n = 0;
+  Request  cur;
+  bool     playing = false, heard = false;
+  bool     ducking = false, requeue = false;
+  int32_t  gain = 0, target = 0, step = 0;   // Q15 gain ramp, per frame
+  uint32_t rate = 44100;
+
+  Stats    stats[NUM_PRIO];
+};
+
+// ---------- posting (render loop) ----------
+static bool post(Scheduler& sc, const Command& c){
+  const uint32_t tail = __atomic_load_n(&sc.tail, __ATOMIC_ACQUIRE);
+  if (sc.head - tail >= (uint32_t)CMD_LEN) return false;
+  sc.cmd[sc.head & (CMD_LEN - 1)] = c;
+  __atomic_store_n(&sc.head, sc.head + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+// Queues a file path (FILE) or text to speak (TTS); false if the command ring is full.
+static bool play(Scheduler& sc, Prio prio, Kind kind, const char* src, uint16_t tag, uint32_t nowMs){
+  Command c;
+  c.op = PLAY;
+  c.r.seq = sc.nextSeq++; c.r.askedMs = nowMs ? nowMs : 1;
+  c.r.tag = tag; c.r.prio = prio; c.r.kind = kind;
+  strncpy(c.r.src, src, SRC_LEN - 1);
+  return post(sc, c);
+}
+
+static bool cancel(Scheduler& sc, uint16_t tag){ Command c; c.op = CANCEL; c.r.tag = tag; return post(sc, c); }
+static bool flush(Scheduler& sc){ Command c; c.op = FLUSH; return post(sc, c); }
+
+// ---------- heap (audio task) ----------
+static inline bool before(const Request& a, const Request& b){
+  return a.prio != b.prio ? a.prio < b.prio : (int32_t)(a.seq - b.seq) < 0;
+}
+
+static void siftUp(Scheduler& sc, int i){
+  while (i > 0) {
+    const int p = (i - 1) / 2;
+    if (!before(sc.heap[i], sc.heap[p])) break;
+    std::swap(sc.heap[i], sc.heap[p]); i = p;
+  }
+}
+
+static void siftDown(Scheduler& sc, int i){
+  for (;;) {
+    const int l = 2 * i + 1, r = l + 1;
+    int m = i;
+    if (l < sc.n && before(sc.heap[l], sc.heap[m])) m = l;
+    if (r < sc.n && before(sc.heap[r], sc.heap[m])) m = r;
+    if (m == i) break;
+    std::swap(sc.heap[i], sc.heap[m]); i = m;
+  }
+}
+
+static bool enqueue(Scheduler& sc, const Request& r){
+  if (sc.n == QUEUE_LEN) { ++sc.stats[r.prio].dropped; return false; }
+  sc.heap[sc.n] = r;
+  siftUp(sc, sc.n++);
+  return true;
+}
+
+static void dequeue(Scheduler& sc, Request& r){
+  r = sc.heap[0];
+  sc.heap[0] = sc.heap[--sc.n];
+  siftDown(sc, 0);
+}
+
+// Drops queued requests with `tag` (all with tag 0), then restores the heap in O(n).
+static void remove(Scheduler& sc, uint16_t tag){
+  int k = 0;
+  for (int i = 0; i < sc.n; ++i) if (tag && sc.heap[i].tag != tag) sc.heap[k++] = sc.heap[i];
+  sc.n = k;
+  for (int i = sc.n / 2 - 1; i >= 0; --i) siftDown(sc, i);
+}
+
+// ---------- gain ----------
+static void rampTo(Scheduler& sc, int32_t target, uint32_t ms){
+  sc.target = target;
+  const int32_t frames = (int32_t)max<uint32_t>(1, sc.rate * ms / 1000);
+  sc.step = (target - sc.gain) / frames;
+  if (!sc.step) sc.step = target > sc.gain ? 1 : -1;
+}
+
+static void duckOut(Scheduler& sc, bool requeue){
+  if (!sc.playing || sc.ducking) return;
+  sc.ducking = true; sc.requeue = requeue;
+  rampTo(sc, 0, DUCK_MS);
+}
+
+// Smoothstep of the linear ramp (Q15): no corner at either end of a fade.
+static inline int32_t ease(int32_t g){
+  return (int32_t)(((int64_t)g * g >> 15) * (3 * GAIN_ONE - 2 * g) >> 15);
+}
+
+// Every decoded block (interleaved int16), in the audio task before it is heard; `dueMs` is when it is.
+FACE_IRAM(audio) static void apply(Scheduler& sc, int16_t* pcm, int frames, int channels, uint32_t rate, uint32_t dueMs){
+  if (rate) sc.rate = rate;
+  if (sc.playing && !sc.heard && sc.cur.askedMs) {
+    Stats& s = sc.stats[sc.cur.prio];
+    const uint32_t lat = dueMs - sc.cur.askedMs;
+    s.latSumMs += lat; s.latMaxMs = max(s.latMaxMs, lat); ++s.latN;
+  }
+  sc.heard = true;
+  if (sc.gain == GAIN_ONE && sc.target == GAIN_ONE) return;
+  for (int i = 0; i < frames; ++i) {
+    if (sc.gain != sc.target) {
+      sc.gain += sc.step;
+      if ((sc.step > 0) == (sc.gain >= sc.target)) sc.gain = sc.target;
+    }
+    const int32_t g = ease(sc.gain);
+    for (int k = 0; k < channels; ++k) pcm[i * channels + k] = (int16_t)(pcm[i * channels + k] * g >> 15);
+  }
+}
+
+// ---------- scheduling (audio task) ----------
+// Player: bool start(const Request&), uint32_t stop() (the file position reached), bool running().
+template <class Player>
+static void tick(Scheduler& sc, Player& pl){
+  // commands
+  const uint32_t head = __atomic_load_n(&sc.head, __ATOMIC_ACQUIRE);
+  while (sc.tail != head) {
+    const Command& c = sc.cmd[sc.tail & (CMD_LEN - 1)];
+    if (c.op == PLAY) enqueue(sc, c.r);
+    else {
+      const uint16_t tag = c.op == FLUSH ? 0 : c.r.tag;
+      remove(sc, tag);
+      if (sc.playing && (!tag || sc.cur.tag == tag)) { duckOut(sc, false); sc.requeue = false; }
+    }
+    __atomic_store_n(&sc.tail, sc.tail + 1, __ATOMIC_RELEASE);
+  }
+
+  // the sound playing: ended, ducked out, or about to be
+  if (sc.playing) {
+    if (!pl.running()) sc.playing = false;
+    else if (sc.ducking && sc.gain == 0) {
+      const uint32_t pos = pl.stop();
+      ++sc.stats[sc.cur.prio].stopped;
+      if (sc.requeue) { sc.cur.askedMs = 0; sc.cur.resume = pos; enqueue(sc, sc.cur); }
+      sc.playing = false;
+    } else if (sc.n && sc.heap[0].prio < sc.cur.prio) duckOut(sc, sc.cur.prio == AMBIENT);
+  }
+
+  // next
+  while (!sc.playing && sc.n) {
+    Request r;
+    dequeue(sc, r);
+    sc.cur = r;
+    sc.gain = 0; rampTo(sc, GAIN_ONE, FADE_MS);
+    sc.ducking = false; sc.heard = false;
+    sc.playing = pl.start(sc.cur);
+    if (sc.playing) ++sc.stats[r.prio].started;
+    else ++sc.stats[r.prio].dropped;
+  }
+}
+
+static void report(const Scheduler& sc, Print& out){
+  out.printf("{\"sound\":\"%s\",\"queued\":%d", sc.playing ? PRIO_NAMES[sc.cur.prio] : "idle", sc.n);
+  for (int p = 0; p < NUM_PRIO; ++p) {
+    const Stats& s = sc.stats[p];
+    out.printf(",\"%s\":{\"started\":%u,\"stopped\":%u,\"dropped\":%u,\"lat_avg_ms\":%u,\"lat_max_ms\":%u}", PRIO_NAMES[p],
+               (unsigned)s.started, (unsigned)s.stopped, (unsigned)s.dropped, (unsigned)(s.latN ? s.latSumMs / s.latN : 0),
+               (unsigned)s.latMaxMs);
+  }
+  out.printf("}\n");
+}
+
+} // namespace Sound
@@ -0,0 +1,76 @@
+#pragma once
+#include <Arduino.h>
+#include "trace.h"
+#include "mouth_patterns.h"
+
+// ===== Speech behaviour: alternating silence (a held mood) and talking (swapped mouth frames) =====
+// Pure state: tick() reports what changed and the caller draws it, so the same machine runs the
+// firmware's normal mode and the host fleet simulator (tools/host/fleet_sim.cpp).
+namespace Speech {
+
+// ---------- Tunables ----------
+static constexpr uint32_t TALK_SWAP_MS_BASE = 160;  // ~6.25 Hz, fast so it reads as speech
+static constexpr uint32_t TALK_SWAP_JITTER  = 40;
+static const uint8_t DUR_CHOICES_S[] = {5, 10, 15, 20};   // allowed talk/silence durations (seconds)
+
+enum class Phase : uint8_t { Silent = 0, Talking };
+
+// What a tick changed.
+enum class Event : uint8_t { None = 0, Silent, Talking, Swap };
+
+struct State {
+  Phase     phase      = Phase::Silent;
+  uint32_t  untilMs    = 0;                  // next transition time
+  uint32_t  nextSwapMs = 0;                  // cadence while talking
+  int       talkIdx    = 0;                  // TALK_FRAMES index
+  MouthMood mood       = MouthMood::Neutral; // held during silence
+};
+
+static inline int randRange(int lo, int hi){ return lo + (int)(random(0x7fffffff) % (uint32_t)(hi - lo + 1)); }
+static inline int pickDurationMs() {
+  int ix = randRange(0, (int)(sizeof(DUR_CHOICES_S)/sizeof(DUR_CHOICES_S[0]) - 1));
+  return DUR_CHOICES_S[ix] * 1000;
+}
+static inline uint32_t swapDelayMs(){
+  return TALK_SWAP_MS_BASE + randRange(-(int)TALK_SWAP_JITTER, (int)TALK_SWAP_JITTER);
+}
+
+static void enterSilent(State& s, uint32_t nowMs){
+  s.phase = Phase::Silent;
+  TRACE_INSTANT(Trace::BEHAVIOUR, (uint8_t)s.phase);
+  s.untilMs = nowMs + pickDurationMs();
+
+  // pick a mood to hold during silence
+  const int pick = randRange(0, 3); // Smile/Frown/Puzzled/Oooh
+  s.mood = (pick==0) ? MouthMood::Smile :
+           (pick==1) ? MouthMood::Frown :
+           (pick==2) ? MouthMood::Puzzled :
+                       MouthMood::Oooh;
+}
+
+static void enterTalking(State& s, uint32_t nowMs){
+  s.phase = Phase::Talking;
+  TRACE_INSTANT(Trace::BEHAVIOUR, (uint8_t)s.phase);
+  s.untilMs = nowMs + pickDurationMs();
+  s.talkIdx = randRange(0, NUM_TALK_FRAMES-1);
+  s.nextSwapMs = nowMs + swapDelayMs();
+}
+
+// Once per frame: a phase change when its time is up, else a new talking frame at cadence.
+static Event tick(State& s, uint32_t nowMs){
+  if (nowMs >= s.untilMs) {
+    if (s.phase == Phase::Silent) { enterTalking(s, nowMs); return Event::Talking; }
+    enterSilent(s, nowMs);
+    return Event::Silent;
+  }
+  if (s.phase == Phase::Talking && nowMs >= s.nextSwapMs) {
+    int nextIdx = s.talkIdx;
+    while (nextIdx == s.talkIdx) nextIdx = randRange(0, NUM_TALK_FRAMES-1);
+    s.talkIdx = nextIdx;
+    s.nextSwapMs = nowMs + swapDelayMs();
+    return Event::Swap;
+  }
+  return Event::None;
+}
+
+} // namespace Speech
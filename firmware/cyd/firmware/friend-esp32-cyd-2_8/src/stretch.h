@@ -0,0 +1,219 @@
+#pragma once
+#include <Arduino.h>
+#include "iram.h"
+
+// ===== Stretch: streaming WSOLA time-stretch for speech rate control =====
+// Speech sped up or slowed down without a pitch change. Output is built in steps of HOP frames
+// (half a 20 ms window). Each step crossfades from the natural continuation of the last segment to
+// a new segment taken near the nominal source position, which advances HOP x rate per step. The
+// segment start is searched within +-SEEK of the nominal for the best waveform match to the
+// continuation: integer dot products on the channel mean, scored by normalised correlation,
+// coarse on every DECIMATE-th sample and then refined. The nominal position never depends on the
+// search, so the source clock stays within SEEK + HOP of rate x time at any rate. Rate changes take
+// effect on the next step. At exactly 1x the stage copies its input through and then steps aside
+// (bypassed()).
+//
+// Audio task: push() input, pull() output. Any core: setRate(). The audio task maps output frames to
+// source frames with sourceAt() for the A/V clock.
+namespace Stretch {
+
+// ---------- Tunables ----------
+static constexpr uint32_t ONE        = 1u << 16;         // rates in Q16
+static constexpr uint32_t RATE_MIN   = ONE * 3 / 4;      // 0.75x
+static constexpr uint32_t RATE_MAX   = ONE * 3 / 2;      // 1.5x
+static constexpr int      WINDOW_MS  = 20;               // segment; steps are half of it
+static constexpr int      SEEK_MS    = 6;                // search either side of the nominal position
+static constexpr int      DECIMATE   = 4;                // coarse search stride and sample stride
+static constexpr int      MAX_CH     = 2;
+static constexpr int      MAX_HOP    = 480;              // 10 ms at 48 kHz
+static constexpr int      BUF_FRAMES = 4096;             // input history: window + search + pushed block
+static constexpr int      MAP_LEN    = 64;               // output -> source points kept (one per step)
+
+struct MapPoint { uint32_t out, src; };
+
+struct State {
+  // set up by begin()
+  uint32_t sampleRate = 0;
+  int      ch = 2, hop = 0, seek = 0;
+  uint32_t rate = ONE;                  // Q16; written by setRate() from any core
+
+  // input: frames [base, base + n) of the source
+  int16_t  buf[BUF_FRAMES * MAX_CH];
+  uint32_t base = 0;
+  int      n = 0;
+
+  // position
+  bool     started = false;
+  uint32_t cont = 0;                    // next frame of the last segment's natural continuation
+  uint64_t nominal = 0;                 // source position the rate says we are at, Q16
+
+  // output of the current step, handed out by pull()
+  int16_t  out[MAX_HOP * MAX_CH];
+  int      outLen = 0, outPos = 0;
+  uint32_t produced = 0;                // output frames handed out
+  uint32_t consumed = 0;                // source frames pushed
+
+  MapPoint map[MAP_LEN];
+  uint32_t mapHead = 0;
+
+  uint32_t steps = 0;                   // WSOLA steps run
+  uint32_t macs = 0;                    // correlation multiply-adds (cost)
+};
+
+static inline uint32_t clampRate(uint32_t q16){ return q16 < RATE_MIN ? RATE_MIN : (q16 > RATE_MAX ? RATE_MAX : q16); }
+
+static void setRate(State& st, uint32_t q16){ __atomic_store_n(&st.rate, clampRate(q16), __ATOMIC_RELAXED); }
+static inline uint32_t rate(const State& st){ return __atomic_load_n(&st.rate, __ATOMIC_RELAXED); }
+
+// Sets the stream format; a change restarts the stage (counters and rate kept).
+static void begin(State& st, uint32_t sampleRate, int channels){
+  channels = channels < 1 ? 1 : (channels > MAX_CH ? MAX_CH : channels);
+  if (sampleRate == st.sampleRate && channels == st.ch && st.hop) return;
+  st.sampleRate = sampleRate; st.ch = channels;
+  st.hop  = min<int>(MAX_HOP, (int)(sampleRate * WINDOW_MS / 2000));
+  st.seek = (int)(sampleRate * SEEK_MS / 1000);
+  st.n = 0; st.started = false; st.outLen = st.outPos = 0;
+}
+
+static void mark(State& st, uint32_t out, uint32_t src){
+  st.map[st.mapHead++ % MAP_LEN] = MapPoint{ out, src };
+}
+
+// Source frame playing at output frame `out` (the latest mapping at or before it).
+static uint32_t sourceAt(const State& st, uint32_t out){
+  for (uint32_t k = 0; k < min<uint32_t>(st.mapHead, MAP_LEN); ++k) {
+    const MapPoint& p = st.map[(st.mapHead - 1 - k) % MAP_LEN];
+    if ((int32_t)(out - p.out) >= 0) return p.src + (out - p.out);
+  }
+  return out;
+}
+
+// Stepped aside at 1x: nothing buffered, the caller passes audio straight through (and calls passed()).
+static inline bool bypassed(const State& st){
+  return rate(st) == ONE && st.outPos == st.outLen && (!st.started || st.cont == st.base + (uint32_t)st.n);
+}
+
+// `frames` went out unprocessed while bypassed.
+static void passed(State& st, uint32_t frames){
+  if (st.started) { st.started = false; st.n = 0; }
+  mark(st, st.produced, st.consumed);
+  st.produced += frames; st.consumed += frames;
+}
+
+// Mean of the channels at buffer frame i, scaled so products of a window fit in 32 bits.
+static inline int32_t mid(const State& st, int i){
+  const int16_t* p = &st.buf[i * st.ch];
+  return (st.ch == 2 ? (p[0] + p[1]) >> 1 : p[0]) >> 5;
+}
+
+// Correlation of the continuation at `a` with a candidate at `b` (buffer frames), and the candidate's energy.
+FACE_IRAM(audio) static void correlate(State& st, int a, int b, int stride, int64_t& c, int64_t& e){
+  int32_t cc = 0, ee = 0;
+  for (int j = 0; j < st.hop; j += stride) {
+    const int32_t y = mid(st, b + j);
+    cc += mid(st, a + j) * y; ee += y * y;
+  }
+  st.macs += 2 * (st.hop / stride);
+  c = cc; e = ee;
+}
+
+static inline bool better(int64_t c, int64_t e, int64_t bc, int64_t be){
+  // normalised correlation, squared: c^2 / e (in phase only)
+  if (c <= 0) return false;
+  if (bc <= 0) return true;
+  return c * c / max<int64_t>(e, 1) > bc * bc / max<int64_t>(be, 1);
+}
+
+// Drops input no future step can reach.
+static void compact(State& st){
+  const uint32_t keep = st.started ? min<uint32_t>(st.cont, (uint32_t)(st.nominal >> 16) > (uint32_t)st.seek ?
+                                     (uint32_t)(st.nominal >> 16) - st.seek : 0) : st.base + st.n;
+  const int drop = (int)(keep - st.base);
+  if (drop <= 0) return;
+  const int d = min(drop, st.n);
+  memmove(st.buf, st.buf + d * st.ch, (size_t)(st.n - d) * st.ch * sizeof(int16_t));
+  st.base += d; st.n -= d;
+}
+
+// Up to `frames` interleaved frames of input; returns how many were taken (the rest waits for pull()).
+static int push(State& st, const int16_t* pcm, int frames){
+  if (st.n + frames > BUF_FRAMES) compact(st);
+  const int take = min(frames, BUF_FRAMES - st.n);
+  memcpy(st.buf + st.n * st.ch, pcm, (size_t)take * st.ch * sizeof(int16_t));
+  if (!st.started && !st.n) st.base = st.consumed;
+  st.n += take; st.consumed += take;
+  return take;
+}
+
+// One step into out[]; false until enough input is buffered.
+FACE_IRAM(audio) static bool step(State& st){
+  const uint32_t end = st.base + (uint32_t)st.n;
+  const int hop = st.hop;
+  if (!st.started) {
+    // first segment after a (re)start goes out as it is
+    if ((int)(end - st.base) < hop) return false;
+    memcpy(st.out, st.buf, (size_t)hop * st.ch * sizeof(int16_t));
+    mark(st, st.produced, st.base);
+    st.cont = st.base + hop; st.nominal = (uint64_t)st.base << 16;
+    st.started = true;
+    st.outLen = hop; st.outPos = 0;
+    return true;
+  }
+  const uint32_t r = rate(st);
+  if (r == ONE) {
+    // 1x: the continuation as it is; nominal follows so a later rate change starts from here
+    const int avail = min<int>((int)(end - st.cont), hop);
+    if (avail <= 0) return false;
+    memcpy(st.out, st.buf + (st.cont - st.base) * st.ch, (size_t)avail * st.ch * sizeof(int16_t));
+    mark(st, st.produced, st.cont);
+    st.cont += avail; st.nominal = (uint64_t)(st.cont - hop) << 16;
+    st.outLen = avail; st.outPos = 0;
+    return true;
+  }
+  const uint64_t nominal = st.nominal + (uint64_t)hop * r;
+  const int centre = (int)((uint32_t)(nominal >> 16) - st.base);
+  const int a = (int)(st.cont - st.base);
+  const int lo = max(centre - st.seek, 0), hi = centre + st.seek;
+  if (hi + hop > st.n || a + hop > st.n) return false;
+
+  // coarse search on the decimated mean, then refine around the winner at full resolution
+  int best = max(lo, min(centre, hi)); int64_t bc = 0, be = 1;
+  for (int b = lo; b <= hi; b += DECIMATE) {
+    int64_t c, e; correlate(st, a, b, DECIMATE, c, e);
+    if (better(c, e, bc, be)) { best = b; bc = c; be = e; }
+  }
+  const int c0 = best;
+  bc = 0; be = 1;
+  for (int b = max(lo, c0 - DECIMATE + 1); b <= min(hi, c0 + DECIMATE - 1); ++b) {
+    int64_t c, e; correlate(st, a, b, 1, c, e);
+    if (better(c, e, bc, be)) { best = b; bc = c; be = e; }
+  }
+
+  // crossfade continuation -> segment over the hop
+  const int16_t* x = st.buf + a * st.ch;
+  const int16_t* y = st.buf + best * st.ch;
+  for (int i = 0; i < hop; ++i)
+    for (int k = 0; k < st.ch; ++k)
+      st.out[i * st.ch + k] = (int16_t)((x[i * st.ch + k] * (hop - i) + y[i * st.ch + k] * i) / hop);
+  mark(st, st.produced, st.base + best);
+  st.cont = st.base + best + hop;
+  st.nominal = nominal;
+  st.outLen = hop; st.outPos = 0;
+  ++st.steps;
+  return true;
+}
+
+// Up to `frames` interleaved frames of output; 0 when more input is needed.
+static int pull(State& st, int16_t* pcm, int frames){
+  int got = 0;
+  while (got < frames) {
+    if (st.outPos == st.outLen && !step(st)) break;
+    const int k = min(frames - got, st.outLen - st.outPos);
+    memcpy(pcm + got * st.ch, st.out + st.outPos * st.ch, (size_t)k * st.ch * sizeof(int16_t));
+    st.outPos += k; got += k;
+    st.produced += k;
+  }
+  return got;
+}
+
+} // namespace Stretch
@@ -0,0 +1,110 @@
+#pragma once
+#include <Arduino.h>
+#include <LovyanGFX.hpp>
+#include "coverage.h"
+
+// ===== Theme module: face colours resolved into the RGB565 palette every span fill reads =====
+// A theme is a handful of face colours. Switching (or each cross-fade step) resolves it once into
+// solid colours plus the coverage ramps, so drawing is a table lookup whatever the theme: a colour
+// face costs exactly what the monochrome one does while no fade is running.
+namespace Theme {
+
+// ---------- Tunables ----------
+static constexpr uint16_t FADE_FRAMES_DEFAULT = 24;    // ~0.6 s at 40 FPS
+static constexpr uint32_t FADE_PX_PER_FRAME   = 2048;  // render budget while the palette moves (Face::render)
+
+struct Colors {
+  uint16_t bg;       // screen background (kept black by the stock themes)
+  uint16_t sclera;   // sclera tint
+  uint16_t iris;     // iris / pupil hue
+  uint16_t lid;      // lid colour inside the rim
+  uint16_t glow;     // rim line around each eye
+  uint16_t lip;
+};
+
+static const Colors MONO   = { TFT_BLACK, TFT_WHITE, TFT_BLACK, TFT_BLACK, TFT_DARKGREY, TFT_WHITE };
+static const Colors OCEAN  = { TFT_BLACK, 0xEF7F,    0x03BF,    0x0008,    0x05FF,       0xBEFF    };
+static const Colors EMBER  = { TFT_BLACK, 0xFF5C,    0xC300,    0x3000,    0xFC00,       0xFED0    };
+static const Colors FOREST = { TFT_BLACK, 0xEFFB,    0x2444,    0x0100,    0x4E89,       0xCFF7    };
+
+static const Colors* const PRESETS[] = { &MONO, &OCEAN, &EMBER, &FOREST };
+static constexpr int NUM_PRESETS = sizeof(PRESETS) / sizeof(PRESETS[0]);
+
+// What span fills read. Ramps map coverage levels (Coverage::FULL scale) to colours.
+struct Palette {
+  uint16_t bg = TFT_BLACK, lip = TFT_WHITE;
+  uint16_t cavity = TFT_BLACK, teeth = TFT_WHITE;   // open mouth: dark rim tint, sclera tinted toward iris
+  Coverage::Ramp sclera;   // BG -> GLOW -> SCLERA
+  Coverage::Ramp lid;      // BG -> GLOW -> LID (rim stays visible across lid rows)
+  Coverage::Ramp iris;     // SCLERA -> IRIS
+};
+
+struct Fade { Colors from, to; uint16_t frame = 0, frames = 0; };
+
+struct Current {
+  Colors  colors  = MONO;
+  Coverage::Quality quality = Coverage::Quality::Smooth;
+  Palette pal;
+  Fade    fade;
+  uint32_t version = 0;   // bumped whenever pal changes
+};
+
+static inline Current& current(){ static Current c; return c; }
+static inline const Palette& palette(){ return current().pal; }
+static inline Coverage::Quality quality(){ return current().quality; }
+static inline bool fading(){ return current().fade.frame < current().fade.frames; }
+static inline uint32_t version(){ return current().version; }
+
+static void resolve(Palette& p, const Colors& c, Coverage::Quality q){
+  const uint16_t scleraStops[] = { c.bg, c.glow, c.sclera };
+  const uint16_t lidStops[]    = { c.bg, c.glow, c.lid };
+  const uint16_t irisStops[]   = { c.sclera, c.iris };
+  p.bg = c.bg; p.lip = c.lip;
+  Coverage::buildRamp(p.sclera, scleraStops, 3, q);
+  Coverage::buildRamp(p.lid,    lidStops,    3, q);
+  Coverage::buildRamp(p.iris,   irisStops,   2, q);
+  p.cavity = p.sclera.lut[Coverage::FULL / 8];   // ramp colours: no extra tile-shadow inks
+  p.teeth  = p.iris.lut[Coverage::FULL / 4];
+}
+
+static inline Colors mix(const Colors& a, const Colors& b, int num, int den){
+  Colors m;
+  m.bg     = Coverage::lerp565(a.bg,     b.bg,     num, den);
+  m.sclera = Coverage::lerp565(a.sclera, b.sclera, num, den);
+  m.iris   = Coverage::lerp565(a.iris,   b.iris,   num, den);
+  m.lid    = Coverage::lerp565(a.lid,    b.lid,    num, den);
+  m.glow   = Coverage::lerp565(a.glow,   b.glow,   num, den);
+  m.lip    = Coverage::lerp565(a.lip,    b.lip,    num, den);
+  return m;
+}
+
+static void apply(const Colors& c){
+  Current& cur = current();
+  cur.colors = c;
+  resolve(cur.pal, c, cur.quality);
+  ++cur.version;
+}
+
+static void setQuality(Coverage::Quality q){
+  current().quality = q;
+  apply(current().colors);
+}
+
+// Cross-fade from the current colours; frames == 0 switches on the next tick.
+static void fadeTo(const Colors& to, uint16_t frames = FADE_FRAMES_DEFAULT){
+  Fade& f = current().fade;
+  f.from = current().colors; f.to = to;
+  f.frame = 0; f.frames = frames ? frames : 1;
+}
+
+// Once per frame. Returns true when the palette moved; the next Face::render repaints what changed,
+// FADE_PX_PER_FRAME at a time.
+static bool tick(){
+  if (!fading()) return false;
+  Fade& f = current().fade;
+  ++f.frame;
+  apply(mix(f.from, f.to, f.frame, f.frames));
+  return true;
+}
+
+} // namespace Theme
@@ -0,0 +1,191 @@
+#pragma once
+#include <Arduino.h>
+#include "iram.h"
+#include "theme.h"
+#include "display_list.h"
+
+// ===== Tile shadow: retained 4bpp framebuffer, pushed per 16x16 tile when the tile's hash changes =====
+// Alternative to span diffing (Face::Renderer picks one). The frame's display list is painted into an
+// indexed shadow of the panel, every tile on a repainted row band is hashed, and only tiles whose hash
+// moved are expanded to RGB565 and pushed as one 16x16 window each. Inks are derived from the theme
+// palette (<= 16 for the stock 3-stop ramps), so the shadow is 38 KB and lives in internal SRAM.
+// Tiles the panel does not hold yet are marked stale, so a frame can leave some for later (theme fades).
+namespace Tiles {
+
+// ---------- Tunables ----------
+static constexpr int TILE     = 16;
+static constexpr int W        = 320, H = 240;      // landscape 2.8" panel
+static constexpr int COLS     = W / TILE, ROWS = H / TILE;
+static constexpr int MAX_INKS = 16;                // 4bpp
+
+// Palette colours -> 4-bit ink indices. Built in a fixed order so an unchanged palette keeps its indices;
+// the background is always ink 0, so a cleared shadow row is all zero bytes.
+struct Inks {
+  uint16_t rgb[MAX_INKS] = {};
+  uint8_t  n = 0;
+  uint16_t lastC = 0; uint8_t lastI = 0;           // one-entry cache: spans mostly repeat colours
+
+  void add(uint16_t c){
+    for (int i = 0; i < n; ++i) if (rgb[i] == c) return;
+    if (n < MAX_INKS) rgb[n++] = c;
+  }
+  // Exact match, else the nearest ink (only reachable with custom palettes over 16 colours).
+  inline uint8_t index(uint16_t c){
+    if (c == lastC && lastI < n && rgb[lastI] == c) return lastI;
+    int best = 0, bestD = INT_MAX;
+    for (int i = 0; i < n; ++i) {
+      if (rgb[i] == c) { best = i; break; }
+      const int dr = (rgb[i] >> 11) - (c >> 11), dg = ((rgb[i] >> 5) & 0x3f) - ((c >> 5) & 0x3f), db = (rgb[i] & 0x1f) - (c & 0x1f);
+      const int d = 4 * dr * dr + dg * dg + 4 * db * db;
+      if (d < bestD) { bestD = d; best = i; }
+    }
+    lastC = c; lastI = (uint8_t)best;
+    return (uint8_t)best;
+  }
+};
+
+static void inksFromPalette(Inks& k, const Theme::Palette& p){
+  memset(k.rgb, 0, sizeof(k.rgb));
+  k.n = 0; k.lastI = MAX_INKS;
+  k.add(p.bg);
+  for (int t = 0; t <= Coverage::FULL; ++t) k.add(p.sclera.lut[t]);
+  for (int t = 0; t <= Coverage::FULL; ++t) k.add(p.lid.lut[t]);
+  for (int t = 0; t <= Coverage::FULL; ++t) k.add(p.iris.lut[t]);
+  k.add(p.lip);
+}
+
+struct Stats {
+  uint16_t hashed = 0;   // tiles hashed this frame
+  uint16_t pushed = 0;   // tiles sent to the panel
+};
+
+struct Shadow {
+  uint8_t  px[H][W / 2];          // two pixels per byte, even x in the low nibble
+  uint32_t hash[ROWS][COLS];      // hash of each tile as painted
+  uint32_t stale[ROWS] = {};      // bit tx: tile painted but not pushed since
+  int16_t  nStale = 0;
+  int16_t  sweep = 0;             // tile (ty * COLS + tx) the next budgeted frame starts at
+  Inks     inks;
+  Stats    last;
+};
+static_assert(COLS <= 32, "one stale word per tile row");
+
+static inline bool isStale(const Shadow& sh, int tx, int ty){ return sh.stale[ty] >> tx & 1; }
+
+static inline void setStale(Shadow& sh, int tx, int ty, bool on){
+  if (isStale(sh, tx, ty) == on) return;
+  sh.stale[ty] ^= 1u << tx;
+  sh.nStale += on ? 1 : -1;
+}
+
+FACE_IRAM(tiles) static void fillRow(uint8_t* row, int x0, int x1, uint8_t ink){
+  if (x0 < 0) x0 = 0;
+  if (x1 > W - 1) x1 = W - 1;
+  if (x0 > x1) return;
+  if (x0 & 1) { row[x0 >> 1] = (row[x0 >> 1] & 0x0f) | (ink << 4); ++x0; }
+  if (!(x1 & 1) && x1 >= x0) { row[x1 >> 1] = (row[x1 >> 1] & 0xf0) | ink; --x1; }
+  if (x0 <= x1) memset(row + (x0 >> 1), ink | (ink << 4), (x1 - x0 + 1) >> 1);
+}
+
+// FNV-style multiply over the tile's 16 rows of 8 bytes, a word at a time. The xor-shift folds high
+// bits back down: a bare multiply only carries changes upward, so two flips in bit 31 would cancel.
+static constexpr uint32_t HASH_SEED = 2166136261u, HASH_MUL = 16777619u;
+static inline uint32_t hashStep(uint32_t h, uint32_t w){ h = (h ^ w) * HASH_MUL; return h ^ (h >> 15); }
+
+FACE_IRAM(tiles) static uint32_t hashTile(const Shadow& sh, int tx, int ty){
+  uint32_t h = HASH_SEED;
+  for (int y = ty * TILE; y < (ty + 1) * TILE; ++y) {
+    const uint32_t* w = (const uint32_t*)&sh.px[y][tx * TILE / 2];
+    h = hashStep(h, w[0]);
+    h = hashStep(h, w[1]);
+  }
+  return h;
+}
+
+// Hash of an all-background tile (all zero bytes).
+static inline uint32_t bgHash(){
+  uint32_t h = HASH_SEED;
+  for (int i = 0; i < 2 * TILE; ++i) h = hashStep(h, 0);
+  return h;
+}
+
+static void paintRow(Shadow& sh, const DList::List& dl, int y){
+  uint8_t* row = sh.px[y];
+  memset(row, 0, W / 2);
+  for (const DList::Span* s = dl.rowBegin(y); s != dl.rowEnd(y); ++s) fillRow(row, s->x0, s->x1, sh.inks.index(s->c));
+}
+
+// Makes the shadow match what the panel shows (`shown`, background elsewhere) without pushing anything.
+static void sync(Shadow& sh, const DList::List& shown){
+  inksFromPalette(sh.inks, Theme::palette());
+  for (int y = 0; y < H; ++y) paintRow(sh, shown, y);
+  for (int ty = 0; ty < ROWS; ++ty)
+    for (int tx = 0; tx < COLS; ++tx) sh.hash[ty][tx] = hashTile(sh, tx, ty);
+  memset(sh.stale, 0, sizeof(sh.stale));
+  sh.nStale = 0; sh.sweep = 0;
+}
+
+// Paints `want` into the shadow (rows it or `shown` cover), hashes the tile bands those rows touch and
+// marks changed tiles stale: every tile with content when the inks move (theme fade), all tiles if the
+// background moved.
+FACE_IRAM(tiles) static void mark(Shadow& sh, const DList::List& shown, const DList::List& want){
+  Stats& st = sh.last;
+  Inks inks;
+  inksFromPalette(inks, Theme::palette());
+  const bool inkMoved = inks.n != sh.inks.n || memcmp(inks.rgb, sh.inks.rgb, sizeof(inks.rgb));
+  const bool bgMoved  = inks.rgb[0] != sh.inks.rgb[0];
+  sh.inks = inks;
+
+  bool band[ROWS] = {};
+  for (int y = 0; y < H; ++y) {
+    const bool now = want.rowBegin(y) != want.rowEnd(y);
+    const bool was = shown.rowBegin(y) != shown.rowEnd(y);
+    if (!now && !was && !bgMoved) continue;
+    paintRow(sh, want, y);
+    band[y / TILE] = true;
+  }
+
+  const uint32_t bgH = bgHash();
+  for (int ty = 0; ty < ROWS; ++ty) {
+    if (!band[ty]) continue;
+    for (int tx = 0; tx < COLS; ++tx) {
+      const uint32_t h = hashTile(sh, tx, ty);
+      ++st.hashed;
+      if (h == sh.hash[ty][tx] && !(inkMoved && (bgMoved || h != bgH))) continue;
+      sh.hash[ty][tx] = h;
+      setStale(sh, tx, ty, true);
+    }
+  }
+}
+
+// Sends stale tiles to the sink as 16x16 RGB565 windows: image(x, y, w, h, px), at most budgetPx worth;
+// the rest go out on later frames, starting where this one stopped. Mostly panel pushes: not in IRAM.
+template <class Sink>
+static void push(Shadow& sh, uint32_t budgetPx, Sink& out){
+  Stats& st = sh.last;
+  uint16_t px[TILE * TILE];
+  uint32_t sent = 0;
+  for (int k = 0; k < ROWS * COLS && sh.nStale; ++k) {
+    const int t = (sh.sweep + k) % (ROWS * COLS), ty = t / COLS, tx = t % COLS;
+    if (!isStale(sh, tx, ty)) continue;
+    if (sent + TILE * TILE > budgetPx) { sh.sweep = (int16_t)t; break; }
+    for (int y = 0; y < TILE; ++y) {
+      const uint8_t* src = &sh.px[ty * TILE + y][tx * TILE / 2];
+      uint16_t* dst = &px[y * TILE];
+      for (int i = 0; i < TILE / 2; ++i) { dst[2 * i] = sh.inks.rgb[src[i] & 0x0f]; dst[2 * i + 1] = sh.inks.rgb[src[i] >> 4]; }
+    }
+    out.image(tx * TILE, ty * TILE, TILE, TILE, px);
+    setStale(sh, tx, ty, false);
+    sent += TILE * TILE;
+    ++st.pushed;
+  }
+}
+
+template <class Sink>
+static void update(Shadow& sh, const DList::List& shown, const DList::List& want, uint32_t budgetPx, Sink& out){
+  sh.last = Stats();
+  mark(sh, shown, want);
+  push(sh, budgetPx, out);
+}
+
+} // namespace Tiles
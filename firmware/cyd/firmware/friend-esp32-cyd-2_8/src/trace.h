@@ -0,0 +1,119 @@
+#pragma once
+#include <Arduino.h>
+#include "iram.h"
+
+// ===== Trace module: lock-free ring of begin/end/instant events for timeline dumps =====
+// Build with -D FACE_TRACE to record; otherwise every TRACE_* macro compiles to nothing and there is
+// no ring and no dump (callers check FACE_TRACE before Trace::dump).
+// Dump format (one event per line, framed so the host tool can find it in a serial log):
+//   #trace-begin <count> <dropped>
+//   <t_us> <core> <B|E|i> <name> <arg>
+//   #trace-end
+// Convert with tools/trace2chrome.py and open in chrome://tracing or ui.perfetto.dev.
+namespace Trace {
+
+// ---------- Tunables ----------
+static constexpr int      CAPACITY          = 1024;   // events (8 bytes each), power of two
+static constexpr uint32_t STUTTER_FACTOR    = 2;      // dump when a frame takes > factor * period
+static constexpr uint32_t DUMP_COOLDOWN_MS  = 5000;   // don't flood the serial port
+static constexpr uint32_t IN_FLIGHT         = 4;      // oldest slots a dump skips: writers that got past `frozen`
+
+enum Id : uint8_t {
+  RENDER_FRAME = 0,   // whole frame: eye/theme step + Face::render
+  RENDER_BUILD,       // display list built from eye + mouth state
+  RENDER_DIFF,        // list diffed against the last frame, changed spans pushed
+  AUDIO_FILL,         // one audio.loop() pump (decoder -> I2S DMA block)
+  LINK_RX,            // one received link packet / command line
+  BEHAVIOUR,          // speech/mood state transition (arg = new state)
+  DMA,                // waiting on display DMA completion
+  EYE_SHAPE,          // one bounded step of an outline morph raster (arg = table rows done)
+  NUM_IDS
+};
+
+static const char* const NAMES[NUM_IDS] = {
+  "render", "build", "diff", "audio_fill", "link_rx", "behaviour", "dma", "shape"
+};
+
+#ifdef FACE_TRACE
+struct Event {
+  uint32_t tUs;
+  uint8_t  id;
+  char     ph;     // 'B' begin, 'E' end, 'i' instant
+  uint8_t  core;
+  uint8_t  arg;
+};
+
+struct Ring {
+  Event    ev[CAPACITY];
+  uint32_t head = 0;      // total events ever written (monotonic; only writers move it)
+  uint32_t shown = 0;     // head at the last dump (reader only)
+  uint8_t  frozen = 0;    // set by the reader while it dumps; __atomic, writers run on both cores
+  uint32_t lastDumpMs = 0;
+};
+
+static_assert((CAPACITY & (CAPACITY - 1)) == 0, "Trace::CAPACITY must be a power of two");
+
+static inline Ring& ring(){ static Ring r; return r; }
+
+// Safe from both cores and from ISRs: the slot is claimed atomically, so two writers never share one.
+FACE_IRAM(trace) static void record(Id id, char ph, uint8_t arg = 0){
+  Ring& r = ring();
+  if (__atomic_load_n(&r.frozen, __ATOMIC_ACQUIRE)) return;
+  const uint32_t slot = __atomic_fetch_add(&r.head, 1u, __ATOMIC_RELAXED) & (CAPACITY - 1);
+  Event& e = r.ev[slot];
+  e.tUs = (uint32_t)micros();
+  e.id = id; e.ph = ph; e.core = (uint8_t)xPortGetCoreID(); e.arg = arg;
+}
+
+struct Scope {
+  Id id;
+  explicit Scope(Id _id, uint8_t arg = 0) : id(_id) { record(id, 'B', arg); }
+  ~Scope() { record(id, 'E'); }
+};
+
+// Writes the events since the last dump, oldest-first. Recording is paused while dumping; the head is
+// only snapshotted, never reset from here. A writer that checked `frozen` just before the pause claims
+// a slot past the snapshot, i.e. one of the oldest ones, so the IN_FLIGHT oldest are not printed.
+static void dump(Print& out){
+  Ring& r = ring();
+  __atomic_store_n(&r.frozen, (uint8_t)1, __ATOMIC_RELEASE);
+  const uint32_t head  = __atomic_load_n(&r.head, __ATOMIC_ACQUIRE);
+  const uint32_t fresh = head - r.shown;
+  const uint32_t count = fresh <= CAPACITY - IN_FLIGHT ? fresh : CAPACITY - IN_FLIGHT;
+  out.printf("#trace-begin %u %u\n", (unsigned)count, (unsigned)(fresh - count));
+  for (uint32_t i = head - count; i != head; ++i) {
+    const Event& e = r.ev[i & (CAPACITY - 1)];
+    if (e.id >= NUM_IDS) continue;
+    out.printf("%u %u %c %s %u\n", (unsigned)e.tUs, (unsigned)e.core, e.ph, NAMES[e.id], (unsigned)e.arg);
+  }
+  out.printf("#trace-end\n");
+  r.shown = __atomic_load_n(&r.head, __ATOMIC_RELAXED);   // writers that slipped in go uncounted, not twice
+  __atomic_store_n(&r.frozen, (uint8_t)0, __ATOMIC_RELEASE);
+}
+
+// Call once per frame with the measured frame time; dumps the ring when the frame stuttered.
+static void checkStutter(Print& out, uint32_t frameUs, uint32_t periodUs){
+  Ring& r = ring();
+  if (frameUs <= periodUs * STUTTER_FACTOR) return;
+  const uint32_t n = millis();
+  if (r.lastDumpMs && n - r.lastDumpMs < DUMP_COOLDOWN_MS) return;
+  r.lastDumpMs = n;
+  dump(out);
+}
+#endif // FACE_TRACE
+
+} // namespace Trace
+
+#ifdef FACE_TRACE
+  #define TRACE_CAT_(a, b) a##b
+  #define TRACE_CAT(a, b)  TRACE_CAT_(a, b)
+  #define TRACE_SCOPE(id)            Trace::Scope TRACE_CAT(_trace_, __LINE__)(id)
+  #define TRACE_SCOPE_ARG(id, arg)   Trace::Scope TRACE_CAT(_trace_, __LINE__)(id, (uint8_t)(arg))
+  #define TRACE_INSTANT(id, arg)     Trace::record(id, 'i', (uint8_t)(arg))
+  #define TRACE_STUTTER(out, us, period) Trace::checkStutter(out, us, period)
+#else
+  #define TRACE_SCOPE(id)            do {} while (0)
+  #define TRACE_SCOPE_ARG(id, arg)   do {} while (0)
+  #define TRACE_INSTANT(id, arg)     do {} while (0)
+  #define TRACE_STUTTER(out, us, period) do { (void)(us); } while (0)
+#endif
@@ -0,0 +1,199 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include "link.h"
+
+// ===== Udp: link frames in datagrams (Wi-Fi, no broker) =====
+// A datagram is MAGIC, epoch, fresh, total, then `total` records: seq (u16) and one whole link frame.
+// Records carry their own sequence, one per frame sent, so the receiver can put frames back in order
+// (a WINDOW of them held for up to HOLD_MS while a gap is open) and drop duplicates. Critical frames
+// (Msg::IS_CRITICAL) ride again, COPIES times, in the next datagrams, or in datagrams of their own
+// REPEAT_MS apart when nothing else goes out: records past `fresh` are such copies. A lost frame that
+// is not critical holds the frames behind it for HOLD_MS. The epoch changes at each start, so a receiver
+// resyncs to a restarted sender instead of taking its seqs as old. No sockets here: the firmware
+// and the host tools each hand datagrams to their own UDP stack.
+namespace Udp {
+
+// ---------- Tunables ----------
+static constexpr uint8_t  MAGIC     = 0xFC;   // first byte of a datagram (Link uses 0xFB)
+static constexpr uint16_t PORT      = 4210;   // the face listens here
+static constexpr int      MAX_DGRAM = 512;    // bytes; one Wi-Fi frame, unfragmented
+static constexpr int      HEADER    = 4;
+static constexpr int      WINDOW    = 16;     // reorder window, frames; power of two
+static constexpr uint32_t HOLD_MS   = 30;     // a gap is given up after this
+static constexpr uint8_t  COPIES    = 2;      // extra copies of a critical frame (Tx::copies)
+static constexpr uint32_t REPEAT_MS = 5;      // a pending copy goes out on its own after this
+static constexpr int      ECHOES    = 4;      // critical frames awaiting their copies
+
+// ---------- TX ----------
+struct Echo {
+  uint16_t seq;
+  uint8_t  n = 0, left = 0;
+  bool     fresh = false;   // in the datagram being built: its first copy goes in the next one
+  uint8_t  f[Link::MAX_FRAME];
+};
+
+struct Tx {
+  uint8_t  epoch = 1;             // set once per start, nonzero
+  uint8_t  copies = COPIES;       // 0: no redundancy
+  uint16_t seq = 0;
+  uint8_t  buf[MAX_DGRAM];
+  uint16_t len = HEADER;
+  uint8_t  fresh = 0;
+  Echo     echo[ECHOES];
+  uint8_t  echoNext = 0;
+  uint32_t lastMs = 0;
+  uint32_t datagrams = 0, frames = 0, copied = 0;
+};
+
+static void putRecord(Tx& t, uint16_t seq, const uint8_t* f, size_t n){
+  t.buf[t.len] = (uint8_t)seq; t.buf[t.len + 1] = (uint8_t)(seq >> 8);
+  memcpy(t.buf + t.len + 2, f, n);
+  t.len = (uint16_t)(t.len + 2 + n);
+}
+
+// Appends a frame to the datagram being built; false when it does not fit (send() first).
+static bool add(Tx& t, const uint8_t* f, size_t n, bool critical){
+  if (t.len + 2 + n > (size_t)MAX_DGRAM || t.fresh == 255) return false;
+  putRecord(t, t.seq, f, n);
+  ++t.fresh; ++t.frames;
+  if (critical && t.copies) {
+    Echo& e = t.echo[t.echoNext];   // oldest first, should they all be waiting
+    t.echoNext = (uint8_t)((t.echoNext + 1) % ECHOES);
+    e.seq = t.seq; e.n = (uint8_t)n; e.left = t.copies; e.fresh = true;
+    memcpy(e.f, f, n);
+  }
+  ++t.seq;
+  return true;
+}
+
+static bool echoing(const Tx& t){
+  for (const Echo& e : t.echo) if (e.left && !e.fresh) return true;
+  return false;
+}
+
+// Seals the datagram with the copies that fit and hands it to out(buf, len).
+template <class Out>
+static void send(Tx& t, uint32_t nowMs, Out out){
+  if (!t.fresh && !echoing(t)) return;
+  uint8_t total = t.fresh;
+  for (Echo& e : t.echo) {
+    if (e.fresh) { e.fresh = false; continue; }
+    if (!e.left || t.len + 2 + e.n > MAX_DGRAM || total == 255) continue;
+    putRecord(t, e.seq, e.f, e.n);
+    --e.left; ++total; ++t.copied;
+  }
+  t.buf[0] = MAGIC; t.buf[1] = t.epoch; t.buf[2] = t.fresh; t.buf[3] = total;
+  out(t.buf, (size_t)t.len);
+  ++t.datagrams;
+  t.len = HEADER; t.fresh = 0;
+  t.lastMs = nowMs;
+}
+
+// Once per loop: copies still owed go out on their own when no datagram has for REPEAT_MS.
+template <class Out>
+static void tick(Tx& t, uint32_t nowMs, Out out){
+  if (!t.fresh && nowMs - t.lastMs >= REPEAT_MS && echoing(t)) send(t, nowMs, out);
+}
+
+// Every whole frame waiting in a Link::Ring, in as few datagrams as they fit.
+template <class Out, int N>
+static void drain(Link::Ring& r, Tx& t, const uint8_t (&sizes)[N], const bool (&critical)[N], uint32_t nowMs, Out out){
+  const uint8_t* p;
+  for (size_t n; (n = Link::next(r, p, sizes)); Link::consume(r, n))
+    if (!add(t, p, n, critical[p[1]])) { send(t, nowMs, out); add(t, p, n, critical[p[1]]); }
+  send(t, nowMs, out);
+}
+
+// ---------- RX ----------
+struct Slot {
+  bool     full = false;
+  uint8_t  n = 0;
+  uint32_t atMs = 0;
+  uint8_t  f[Link::MAX_FRAME];
+};
+
+struct Rx {
+  uint8_t  epoch = 0;            // 0: not synced
+  uint16_t next = 0;             // seq delivered next
+  uint8_t  held = 0;
+  uint32_t gapMs = 0;            // since when `next` is missing, while frames are held
+  Slot     slot[WINDOW];
+  uint32_t datagrams = 0, frames = 0, bad = 0;
+  uint32_t dups = 0, early = 0, lost = 0, recovered = 0, resyncs = 0;   // recovered: first had as a copy
+};
+
+template <class Deliver>
+static void deliverHeld(Rx& r, Deliver deliver){
+  for (Slot* s; (s = &r.slot[r.next & (WINDOW - 1)])->full; ++r.next) {
+    s->full = false; --r.held; ++r.frames;
+    deliver((const uint8_t*)s->f, (size_t)s->n);
+  }
+}
+
+// Gives up on `next`: frames up to the first held one are lost.
+template <class Deliver>
+static void skipGap(Rx& r, uint32_t nowMs, Deliver deliver){
+  while (r.held && !r.slot[r.next & (WINDOW - 1)].full) { ++r.lost; ++r.next; }
+  deliverHeld(r, deliver);
+  r.gapMs = nowMs;
+  for (const Slot& s : r.slot) if (s.full && (int32_t)(s.atMs - r.gapMs) < 0) r.gapMs = s.atMs;
+}
+
+// One datagram; deliver(frame, n) gets each checked frame, in seq order, once.
+template <class Deliver, int N>
+static void receive(Rx& r, const uint8_t* d, size_t len, uint32_t nowMs, const uint8_t (&sizes)[N], Deliver deliver){
+  if (len < (size_t)HEADER || d[0] != MAGIC || !d[1]) { ++r.bad; return; }
+  ++r.datagrams;
+  const uint8_t fresh = d[2], total = d[3];
+  size_t at = HEADER;
+  for (int i = 0; i < total; ++i) {
+    if (at + 2 + sizeof(Link::Header) + 1 > len) { ++r.bad; return; }
+    const uint16_t seq = (uint16_t)(d[at] | d[at + 1] << 8);
+    const uint8_t* f = d + at + 2;
+    const size_t n = f[1] < N ? sizes[f[1]] : 0;
+    if (!n || at + 2 + n > len) { ++r.bad; return; }
+    at += 2 + n;
+    if (!Link::check(f, n, sizes)) { ++r.bad; continue; }
+    if (d[1] != r.epoch) {   // a sender we have not seen, or one that restarted
+      if (r.epoch) ++r.resyncs;
+      r.epoch = d[1]; r.next = seq; r.held = 0;
+      for (Slot& s : r.slot) s.full = false;
+    }
+    const bool copy = i >= fresh;   // past `fresh`: a critical frame sent again
+    int32_t ahead = (int16_t)(seq - r.next);
+    if (ahead >= WINDOW) {   // too far ahead to hold: the oldest frames are given up
+      while (ahead >= WINDOW) {
+        Slot& s = r.slot[r.next & (WINDOW - 1)];
+        if (s.full) { s.full = false; --r.held; ++r.frames; deliver((const uint8_t*)s.f, (size_t)s.n); }
+        else ++r.lost;
+        ++r.next; --ahead;
+      }
+      deliverHeld(r, deliver);
+      ahead = (int16_t)(seq - r.next);
+    }
+    if (ahead < 0) { ++r.dups; continue; }
+    if (ahead == 0) {
+      ++r.next; ++r.frames; r.recovered += copy;
+      deliver(f, n);
+      deliverHeld(r, deliver);
+      continue;
+    }
+    Slot& s = r.slot[seq & (WINDOW - 1)];
+    if (s.full) { ++r.dups; continue; }
+    if (!r.held) r.gapMs = nowMs;
+    s.full = true; s.n = (uint8_t)n; s.atMs = nowMs;
+    memcpy(s.f, f, n);
+    r.recovered += copy;
+    ++r.held; ++r.early;
+  }
+}
+
+// Once per loop: a gap open for HOLD_MS is given up on and the frames behind it delivered.
+template <class Deliver>
+static void tick(Rx& r, uint32_t nowMs, Deliver deliver){
+  if (r.held && nowMs - r.gapMs >= HOLD_MS) skipGap(r, nowMs, deliver);
+}
+
+} // namespace Udp
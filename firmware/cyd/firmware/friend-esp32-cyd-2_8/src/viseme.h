@@ -0,0 +1,267 @@
+#pragma once
+#include <Arduino.h>
+#include "mouth_patterns.h"
+
+// ===== Visemes: mouth shapes from text when only the text and a duration are known =====
+// A rule-based grapheme-to-viseme pass turns the utterance into cues, each with a weight in duration
+// units (vowels long, stops short, punctuation a rest), and the cues are spread across the given
+// duration in proportion. Lookups are constant time per character: one table entry per letter, and
+// for digraphs ("th", "oo", ...) a short per-letter list. The tables are plain const, so they stay in
+// flash.
+//
+// Playback corrects the timing against the audio envelope (Onset VOICED / UNVOICED events), with the
+// text's rests as anchors: the text waits for the first sound (a TTS start delay); a pause in the
+// audio holds it at the start of the next rest, if that is within reach; sound again moves it to
+// the rest's end. An estimated duration is re-estimated at each such anchor from the audio time it
+// took to get there. A given duration is trusted: the text keeps the command's clock unless the sound
+// starts more than RETIME_MS off it, moves at a pause or a word only when it is that far from the
+// audio, waits for the next word at the end of a rest rather than in it, and after waiting is paced
+// to end with the audio. Without any sound within WAIT_MS it runs open loop on the duration alone;
+// after END_QUIET_MS of silence the utterance is taken to be over.
+namespace Viseme {
+
+// ---------- Tunables ----------
+static constexpr int      MAX_CUES      = 128;
+static constexpr uint32_t WAIT_MS       = 1500;   // open loop if nothing is heard by then
+static constexpr uint32_t PAUSE_MS      = 100;    // quiet this long is a pause (stop closures are shorter) ...
+static constexpr uint32_t REACH_MS      = 400;    // ... that holds at a rest at most this far ahead
+static constexpr uint32_t SOUND_HOLD_MS = 40;     // sounding this long on a rest: the next word has begun
+static constexpr uint32_t VOICE_LAG_MS  = 15;     // Onset's voicing envelope reports sound this late
+static constexpr uint32_t RETIME_MS     = 80;     // with a given duration, text this close to the audio runs on
+static constexpr uint32_t END_QUIET_MS  = 700;    // quiet this long after sound was heard: the utterance is over
+static constexpr uint32_t MS_PER_UNIT   = 22;     // duration estimate when none is given (~14 chars/s)
+
+enum Vis : uint8_t { REST = 0, MBP, FV, TL, CONS, AI, E, O, UW, NUM_VIS };
+
+static const char* const VIS_NAMES[NUM_VIS] = { "rest", "mbp", "fv", "tl", "cons", "ai", "e", "o", "uw" };
+
+// TALK_FRAMES shown for each viseme.
+static const uint8_t VIS_FRAME[NUM_VIS] = {
+  8,   // rest: quiet breathy
+  9,   // m b p: small jaw, lips together
+  3,   // f v: lower lip chatter
+  4,   // t d n l th: upper chatter
+  5,   // k g s z ch sh r h: consonant snaps
+  1,   // a i: medium open
+  0,   // e: gentle vowel
+  2,   // o: wide open "O"
+  0,   // u w: gentle vowel
+};
+
+// Rule entry: viseme in the low nibble, weight in units in the high nibble; SKIP = silent, 0 = none.
+static constexpr uint8_t SKIP = 0xff;
+#define VR(v, u) (uint8_t)((v) | ((u) << 4))
+
+// Single characters, by ASCII (letters lower-cased first).
+static const uint8_t LETTER[128] = {
+  // 0x00 - 0x1f: controls
+  0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,
+  // ' ' ! " # $ % & ' ( ) * + , - . /
+  SKIP, VR(REST,8), SKIP, SKIP, SKIP, SKIP, SKIP, SKIP, SKIP, SKIP, SKIP, SKIP, VR(REST,6), VR(REST,2), VR(REST,8), SKIP,
+  // 0 - 9: a spoken number is a word or so
+  VR(E,6), VR(UW,6), VR(UW,6), VR(E,6), VR(O,6), VR(AI,6), VR(E,6), VR(E,6), VR(E,6), VR(AI,6),
+  // : ; < = > ? @
+  VR(REST,6), VR(REST,6), SKIP, SKIP, SKIP, VR(REST,8), SKIP,
+  // A - Z (unused: lower-cased)
+  0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+  // [ \ ] ^ _ `
+  SKIP, SKIP, SKIP, SKIP, SKIP, SKIP,
+  // a..z
+  VR(AI,4), VR(MBP,2), VR(CONS,2), VR(TL,2), VR(E,4), VR(FV,3), VR(CONS,2), VR(CONS,1), VR(E,3), VR(CONS,3),
+  VR(CONS,2), VR(TL,3), VR(MBP,3), VR(TL,3), VR(O,4), VR(MBP,2), VR(CONS,2), VR(CONS,3), VR(CONS,3), VR(TL,2),
+  VR(UW,4), VR(FV,3), VR(UW,3), VR(CONS,3), VR(E,3), VR(CONS,3),
+  // { | } ~ DEL
+  SKIP, SKIP, SKIP, SKIP, 0,
+};
+
+// Digraphs: for each first letter, its entries in DIGRAPHS (at most a handful, so a lookup is bounded).
+struct Digraph { char second; uint8_t rule; };
+static const Digraph DIGRAPHS[] = {
+  // a
+  {'i', VR(E,4)}, {'y', VR(E,4)}, {'u', VR(O,4)}, {'w', VR(O,4)},
+  // c
+  {'h', VR(CONS,3)}, {'k', VR(CONS,2)},
+  // e
+  {'e', VR(E,4)}, {'a', VR(E,4)}, {'i', VR(E,4)}, {'y', VR(E,4)}, {'w', VR(UW,4)},
+  // g
+  {'h', SKIP},
+  // i
+  {'e', VR(E,4)},
+  // n
+  {'g', VR(CONS,3)},
+  // o
+  {'o', VR(UW,4)}, {'u', VR(O,5)}, {'w', VR(O,5)}, {'i', VR(O,5)}, {'a', VR(O,4)},
+  // p
+  {'h', VR(FV,3)},
+  // s
+  {'h', VR(CONS,3)},
+  // t
+  {'h', VR(TL,3)},
+  // u
+  {'e', VR(UW,4)},
+  // w
+  {'h', VR(UW,3)},
+};
+// DIGRAPHS[DIGRAPH_AT[c - 'a'] .. DIGRAPH_AT[c - 'a' + 1])
+static const uint8_t DIGRAPH_AT[27] = {
+  0, 4, 4, 6, 6, 11, 11, 12, 12, 13, 13, 13, 13, 13, 14, 19, 20, 20, 20, 21, 22, 23, 23, 24, 24, 24, 24,
+};
+
+#undef VR
+
+static inline Vis visOf(uint8_t rule){ return (Vis)(rule & 15); }
+static inline uint8_t unitsOf(uint8_t rule){ return rule >> 4; }
+
+static inline char lower(char c){ return (c >= 'A' && c <= 'Z') ? (char)(c - 'A' + 'a') : c; }
+static inline bool isLetter(char c){ return c >= 'a' && c <= 'z'; }
+static inline bool isVowel(char c){ return c == 'a' || c == 'e' || c == 'i' || c == 'o' || c == 'u'; }
+
+// Rule for text[i] (and how many characters it covers): digraph, doubled consonant or letter.
+static uint8_t rule(const char* text, int i, int& len){
+  const char c = lower(text[i]), n = lower(text[i + 1]);
+  len = 1;
+  if ((uint8_t)c >= 128) return SKIP;
+  if (isLetter(c) && n) {
+    for (int k = DIGRAPH_AT[c - 'a']; k < DIGRAPH_AT[c - 'a' + 1]; ++k)
+      if (DIGRAPHS[k].second == n) { len = 2; return DIGRAPHS[k].rule; }
+    if (n == c && !isVowel(c)) { len = 2; return LETTER[(int)c]; }             // "ll", "ss": one sound
+  }
+  // "I" on its own says its name
+  if (c == 'i' && !isLetter(n) && (i == 0 || !isLetter(lower(text[i - 1])))) return LETTER['a'];
+  // a final silent e ("make"), but not in short words ("he", "the", "are")
+  if (c == 'e' && !isLetter(n) && i >= 3 && isLetter(lower(text[i - 1])) && isLetter(lower(text[i - 2])) && isLetter(lower(text[i - 3])))
+    return SKIP;
+  return LETTER[(int)c];
+}
+
+struct Cue { uint8_t vis; uint16_t end; };   // end: cumulative units
+
+struct Track {
+  Cue      cues[MAX_CUES];
+  int      n = 0, at = 0;
+  uint32_t units = 0;          // total
+  uint32_t durMs = 0;          // the utterance's duration
+  bool     estimated = false;  // ... guessed from the text
+  uint32_t pos = 0;            // position in units, Q16
+  uint32_t perMs = 0;          // ... advanced per ms, Q16
+  uint32_t startMs = 0, lastMs = 0, heardMs = 0;
+  uint32_t restMs = 0;         // the text entered the rest it is in
+  uint32_t endMs = 0;          // a given duration: when the audio ends
+  bool     active = false, heard = false, openLoop = false, started = false;
+  bool     sounding = false;
+  uint32_t soundSinceMs = 0;   // last voicing change
+};
+
+static void setDuration(Track& t, uint32_t durMs){
+  t.durMs = max<uint32_t>(durMs, 1);
+  t.perMs = (t.units << 16) / t.durMs;
+}
+
+// Builds the cues for `text`; durMs 0 estimates the duration from the text. Returns the cue count.
+static int begin(Track& t, const char* text, uint32_t durMs, uint32_t nowMs){
+  t.n = 0; t.units = 0; t.at = 0;
+  for (int i = 0; text[i] && t.n < MAX_CUES; ) {
+    int len;
+    const uint8_t r = rule(text, i, len);
+    i += len;
+    if (!r || r == SKIP) continue;
+    t.units += unitsOf(r);
+    if (t.n && t.cues[t.n - 1].vis == visOf(r)) t.cues[t.n - 1].end = (uint16_t)t.units;   // same shape: one cue
+    else t.cues[t.n++] = Cue{ (uint8_t)visOf(r), (uint16_t)t.units };
+  }
+  // the audio neither starts nor ends on a pause
+  if (t.n && t.cues[t.n - 1].vis == REST) { --t.n; t.units = t.n ? t.cues[t.n - 1].end : 0; }
+  if (t.n > 1 && t.cues[0].vis == REST) {
+    const uint16_t lead = t.cues[0].end;
+    for (int i = 1; i < t.n; ++i) t.cues[i - 1] = Cue{ t.cues[i].vis, (uint16_t)(t.cues[i].end - lead) };
+    --t.n; t.units -= lead;
+  }
+  t.estimated = !durMs;
+  setDuration(t, durMs ? durMs : t.units * MS_PER_UNIT);
+  t.startMs = t.lastMs = nowMs;
+  t.pos = 0;
+  t.active = t.n > 0;
+  t.heard = t.openLoop = t.started = false;   // voicing itself carries over: it is the audio's state
+  return t.n;
+}
+
+// VOICED / UNVOICED from the audio envelope, as it is heard.
+static void voiced(Track& t, bool on, uint32_t nowMs){
+  if (on == t.sounding) return;
+  t.sounding = on; t.soundSinceMs = nowMs;
+  if (on && !t.heard) { t.heard = true; t.heardMs = nowMs; }
+}
+
+static inline Vis current(const Track& t){ return t.active ? (Vis)t.cues[t.at].vis : REST; }
+static inline int frame(const Track& t){ return VIS_FRAME[current(t)]; }
+
+// Once per frame: advances text time and the cue under it. True when the viseme changed; the track
+// goes inactive at its end.
+static bool tick(Track& t, uint32_t nowMs){
+  if (!t.active) return false;
+  const uint32_t dt = nowMs - t.lastMs;
+  t.lastMs = nowMs;
+  if (!t.heard && !t.openLoop) {
+    if (nowMs - t.startMs < WAIT_MS) return false;   // waiting for the first sound
+    t.openLoop = true;
+  }
+  const Vis was = current(t);
+  const int wasAt = t.at;
+  bool hold = false;
+  if (!t.started) {
+    // the text starts with the sound, which began a little before it was reported; a given duration
+    // keeps the command's clock when the sound came on time (a stop closure is heard late)
+    t.started = true;
+    if (!t.openLoop) {
+      const uint32_t sound = (uint32_t)max<int32_t>(0, (int32_t)(nowMs - t.heardMs + VOICE_LAG_MS));
+      const uint32_t sent = nowMs - t.startMs;
+      t.pos = (!t.estimated && sent - sound <= RETIME_MS ? sent : sound) * t.perMs;
+      t.endMs = nowMs - (t.pos / t.perMs) + t.durMs;
+      hold = true;
+    }
+  } else if (!t.openLoop) {
+    const int32_t held = (int32_t)(nowMs - t.soundSinceMs);   // events are stamped up to half a frame ahead
+    const uint32_t tol = t.estimated ? 0 : RETIME_MS * t.perMs;
+    if (!t.sounding && held >= (int32_t)END_QUIET_MS) { t.active = false; return true; }
+    if (!t.sounding && held >= (int32_t)PAUSE_MS) {
+      // a pause: wait in the nearest rest within reach, behind (the text ran ahead) or ahead
+      const uint32_t reach = REACH_MS * t.perMs;
+      int back = t.at - 1, ahead = t.at + 1;
+      while (back >= 0 && t.cues[back].vis != REST) --back;
+      while (ahead < t.n && t.cues[ahead].vis != REST) ++ahead;
+      const uint32_t dBack  = back >= 0 ? t.pos - ((uint32_t)t.cues[back].end << 16) : UINT32_MAX;
+      const uint32_t dAhead = ahead < t.n ? ((uint32_t)t.cues[ahead - 1].end << 16) - t.pos : UINT32_MAX;
+      if (current(t) == REST) {
+        // a given duration runs on through the rest and waits at its end; an estimate waits in place
+        const uint32_t end = ((uint32_t)t.cues[t.at].end << 16) - 1;
+        hold = t.estimated || t.pos + dt * t.perMs >= end;
+        if (hold && !t.estimated) t.pos = end;
+      } else if (min(dBack, dAhead) <= reach && min(dBack, dAhead) > tol) {
+        t.at = dBack < dAhead ? back : ahead;
+        t.pos = t.at ? (uint32_t)t.cues[t.at - 1].end << 16 : 0;
+        hold = true;
+      }
+    } else if (t.sounding && current(t) == REST && min(held, (int32_t)(nowMs - t.restMs)) >= (int32_t)SOUND_HOLD_MS) {
+      // the next word has begun: on from the rest's end, and re-estimate the pace from the audio. Sound
+      // that ran on from before the rest (no pause where the text has one) counts from the rest.
+      const int32_t inRest = (int32_t)(nowMs - t.restMs), word = min(held, inRest);
+      const uint32_t spent = nowMs - t.heardMs - word;   // audio time up to the word (both reported late)
+      if (t.estimated && (int32_t)spent > 0) setDuration(t, (uint32_t)((uint64_t)t.units * spent / t.cues[t.at].end));
+      const uint32_t to = ((uint32_t)t.cues[t.at].end << 16) + (uint32_t)(word + (held <= inRest ? VOICE_LAG_MS : 0)) * t.perMs;
+      if ((to > t.pos ? to - t.pos : t.pos - to) > tol) { t.pos = to; hold = true; }
+    }
+  }
+  if (!hold) t.pos += dt * t.perMs;
+  else if (!t.estimated && !t.openLoop && (int32_t)(t.endMs - nowMs) > 0 && t.pos < t.units << 16) {
+    // the rest of the text still ends with the audio, at up to twice the given pace
+    t.perMs = min(((t.units << 16) - t.pos) / (t.endMs - nowMs), 2 * (t.units << 16) / t.durMs);
+  }
+
+  const uint32_t unit = t.pos >> 16;
+  while (t.at < t.n && unit >= t.cues[t.at].end) ++t.at;
+  if (t.at != wasAt && t.at < t.n && current(t) == REST) t.restMs = nowMs;
+  if (t.at >= t.n) { t.at = t.n - 1; t.active = false; return true; }
+  return current(t) != was;
+}
+
+} // namespace Viseme
@@ -0,0 +1,65 @@
+"""
+clip_dizzy.py — render the stock "dizzy" reaction (a spinning two-arm spiral) as a PNG sequence.
+
+  python tools/clip_dizzy.py /tmp/dizzy
+  python tools/clip_encode.py "/tmp/dizzy/dizzy_*.png" --fps 20 --name dizzy --header src/clips/dizzy.h
+
+Half a turn over the sequence, one period of the two arms, so the clip loops seamlessly. Hard-edged, few colours: the encoder
+keeps every distinct RGB565 value.
+"""
+
+import os
+import sys
+import math
+import argparse
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from clip_encode import write_png  # noqa: E402
+
+BG = (0, 0, 0)
+ARM = [(255, 255, 255), (120, 190, 255)]   # arm colours, alternating
+RING = (40, 60, 120)
+
+
+def frame(size, turns, phase):
+    c = (size - 1) / 2
+    r_max = size / 2 - 2
+
+    def pixel(x, y):
+        dx, dy = x - c, y - c
+        r = math.hypot(dx, dy)
+        if r > r_max:
+            return BG
+        if r > r_max - 2:
+            return RING
+        a = (math.atan2(dy, dx) + phase) % (2 * math.pi)
+        # two arms: angle offset grows with radius
+        t = (a / (2 * math.pi) * 2 - r / r_max * turns) % 2
+        if t < 0.35:
+            return ARM[0]
+        if 1 <= t < 1.35:
+            return ARM[1]
+        return BG
+
+    return pixel
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Render the dizzy spiral as PNG frames")
+    ap.add_argument("outdir")
+    ap.add_argument("--size", type=int, default=96)
+    ap.add_argument("--frames", type=int, default=24)
+    ap.add_argument("--turns", type=float, default=1.5, help="spiral turns from centre to rim")
+    args = ap.parse_args()
+
+    os.makedirs(args.outdir, exist_ok=True)
+    for n in range(args.frames):
+        # two arms: half a turn repeats the picture
+        phase = math.pi * n / args.frames
+        write_png(os.path.join(args.outdir, f"dizzy_{n:03d}.png"), args.size, args.size,
+                  frame(args.size, args.turns, phase))
+    print(f"wrote {args.frames} frames to {args.outdir}")
+
+
+if __name__ == "__main__":
+    main()
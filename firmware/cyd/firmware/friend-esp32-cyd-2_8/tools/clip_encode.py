@@ -0,0 +1,341 @@
+"""
+clip_encode.py — convert a PNG sequence into a face clip (src/clip.h) for playback from flash.
+
+Frames are quantised to RGB565 and a palette of at most 255 colours (index 0 is the background:
+the most common colour of the first frame, or --bg). Key frames store the non-background runs,
+every other frame only the runs that changed since the previous one. Writes the binary clip and/or
+a header with the clip as a const array, then prints bytes and runs per frame and checks that the
+clip decodes back to the source frames.
+
+  python tools/clip_encode.py frames/dizzy_*.png --fps 20 --name dizzy --header src/clips/dizzy.h
+  python tools/clip_encode.py a.png b.png c.png --key-every 8 -o reaction.clip
+
+Only the Python standard library is needed (8-bit, non-interlaced PNGs).
+"""
+
+import os
+import sys
+import glob
+import zlib
+import struct
+import argparse
+
+MAGIC = b"CLP1"
+KEY, DELTA = 0, 1
+
+
+# ---------- PNG ----------
+
+def read_png(path):
+    """Return (w, h, rows) with rows as lists of (r, g, b)."""
+    data = open(path, "rb").read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        sys.exit(f"{path}: not a PNG")
+    pos, idat, plte = 8, b"", None
+    while pos < len(data):
+        n, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + n]
+        pos += 12 + n
+        if kind == b"IHDR":
+            w, h, depth, ctype, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"PLTE":
+            plte = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}.get(ctype)
+    if depth != 8 or channels is None or interlace:
+        sys.exit(f"{path}: only 8-bit non-interlaced PNGs are supported")
+
+    raw, stride, bpp = zlib.decompress(idat), w * channels, channels
+    prev, rows, off = bytearray(stride), [], 0
+    for _ in range(h):
+        ftype, line = raw[off], bytearray(raw[off + 1:off + 1 + stride])
+        off += 1 + stride
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + (a + b) // 2) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                line[i] = (line[i] + (a if pa <= pb and pa <= pc else b if pb <= pc else c)) & 0xFF
+        prev = line
+        if ctype == 0 or ctype == 4:
+            rows.append([(line[x * bpp],) * 3 for x in range(w)])
+        elif ctype == 3:
+            rows.append([plte[line[x]] for x in range(w)])
+        else:
+            rows.append([tuple(line[x * bpp:x * bpp + 3]) for x in range(w)])
+    return w, h, rows
+
+
+def write_png(path, w, h, pixel):
+    """Write an 8-bit RGB PNG; pixel(x, y) -> (r, g, b)."""
+    raw = bytearray()
+    for y in range(h):
+        raw.append(0)
+        for x in range(w):
+            raw.extend(pixel(x, y))
+
+    def chunk(kind, body):
+        return struct.pack(">I", len(body)) + kind + body + struct.pack(">I", zlib.crc32(kind + body))
+
+    with open(path, "wb") as f:
+        f.write(b"\x89PNG\r\n\x1a\n")
+        f.write(chunk(b"IHDR", struct.pack(">IIBBBBB", w, h, 8, 2, 0, 0, 0)))
+        f.write(chunk(b"IDAT", zlib.compress(bytes(raw), 9)))
+        f.write(chunk(b"IEND", b""))
+
+
+def rgb565(rgb):
+    r, g, b = rgb
+    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
+
+
+# ---------- Encoder ----------
+
+def varint(v):
+    out = bytearray()
+    while True:
+        b = v & 0x7F
+        v >>= 7
+        out.append(b | (0x80 if v else 0))
+        if not v:
+            return bytes(out)
+
+
+def key_runs(row):
+    """Non-background runs of equal colour: [(x, len, colour)]."""
+    runs, x = [], 0
+    while x < len(row):
+        c = row[x]
+        if c == 0:
+            x += 1
+            continue
+        x0 = x
+        while x < len(row) and row[x] == c:
+            x += 1
+        runs.append((x0, x - x0, c))
+    return runs
+
+
+def delta_runs(row, prev):
+    """Runs covering every changed pixel. A run grows over unchanged pixels of its colour (redrawing
+    them is harmless and saves a run) but never ends on one."""
+    runs, x = [], 0
+    while x < len(row):
+        if row[x] == prev[x]:
+            x += 1
+            continue
+        c, x0, end = row[x], x, x + 1
+        while x < len(row) and row[x] == c:
+            if row[x] != prev[x]:
+                end = x + 1
+            x += 1
+        runs.append((x0, end - x0, c))
+        x = end
+    return runs
+
+
+def encode_frame(kind, rows_runs):
+    out, last_y, last_runs = bytearray([kind]), -1, None
+    for y, runs in enumerate(rows_runs):
+        if not runs:
+            continue
+        body, x = bytearray(), 0
+        for x0, n, c in runs:
+            body += varint(x0 - x) + varint(n - 1) + bytes([c])
+            x = x0 + n
+        out += varint(y - last_y)
+        if body == last_runs:
+            out += varint(0)
+        else:
+            out += varint(len(runs)) + body
+            last_runs = body
+        last_y = y
+    out += varint(0)
+    return bytes(out)
+
+
+def build_palette(frames, bg):
+    counts = {}
+    for f in frames:
+        for row in f:
+            for c in row:
+                counts[c] = counts.get(c, 0) + 1
+    if bg is None:
+        first = {}
+        for row in frames[0]:
+            for c in row:
+                first[c] = first.get(c, 0) + 1
+        bg = max(first, key=first.get)
+    rest = sorted((c for c in counts if c != bg), key=lambda c: -counts[c])
+    palette = [bg] + rest
+    if len(palette) > 255:
+        sys.exit(f"{len(palette)} colours after RGB565 quantisation; clips hold at most 255")
+    return palette
+
+
+def encode(frames, fps, key_every, bg=None):
+    """frames: lists of rows of RGB565. Returns (clip bytes, per-frame stats)."""
+    h, w = len(frames[0]), len(frames[0][0])
+    palette = build_palette(frames, bg)
+    index = {c: i for i, c in enumerate(palette)}
+    idx = [[[index[c] for c in row] for row in f] for f in frames]
+
+    blobs, stats = [], []
+    for n, f in enumerate(idx):
+        key = n == 0 or (key_every and n % key_every == 0)
+        runs = [key_runs(row) if key else delta_runs(row, idx[n - 1][y]) for y, row in enumerate(f)]
+        blob = encode_frame(KEY if key else DELTA, runs)
+        blobs.append(blob)
+        stats.append({"key": key, "bytes": len(blob), "runs": sum(len(r) for r in runs),
+                      "px": sum(n for r in runs for _, n, _ in r)})
+
+    head = MAGIC + struct.pack("<HHHBBHH", w, h, len(frames), fps, len(palette), key_every, 0)
+    head += b"".join(struct.pack("<H", c) for c in palette)
+    table_end = len(head) + 4 * (len(frames) + 1)
+    offsets, pos = [], table_end
+    for b in blobs:
+        offsets.append(pos)
+        pos += len(b)
+    offsets.append(pos)
+    return head + b"".join(struct.pack("<I", o) for o in offsets) + b"".join(blobs), stats
+
+
+# ---------- Decoder (mirror of Clip::drawFrame, for the self-check) ----------
+
+def read_var(data, p):
+    v, shift = 0, 0
+    while True:
+        b = data[p]
+        p += 1
+        v |= (b & 0x7F) << shift
+        shift += 7
+        if not b & 0x80:
+            return v, p
+
+
+def decode(clip):
+    w, h, frames, fps, colours, key_every, _ = struct.unpack("<HHHBBHH", clip[4:16])
+    palette = struct.unpack(f"<{colours}H", clip[16:16 + 2 * colours])
+    offsets = struct.unpack(f"<{frames + 1}I", clip[16 + 2 * colours:16 + 2 * colours + 4 * (frames + 1)])
+    fb = [[palette[0]] * w for _ in range(h)]
+    for f in range(frames):
+        p = offsets[f]
+        kind = clip[p]
+        p += 1
+        if kind == KEY:
+            fb = [[palette[0]] * w for _ in range(h)]
+        y, prev_row, prev_n = -1, 0, 0
+        while True:
+            dy, p = read_var(clip, p)
+            if not dy:
+                break
+            y += dy
+            n, p = read_var(clip, p)
+            repeat = n == 0
+            if repeat:
+                n = prev_n
+            else:
+                prev_row, prev_n = p, n
+            q, x = prev_row, 0
+            for _ in range(n):
+                gap, q = read_var(clip, q)
+                ln, q = read_var(clip, q)
+                x += gap
+                fb[y][x:x + ln + 1] = [palette[clip[q]]] * (ln + 1)
+                q += 1
+                x += ln + 1
+            if not repeat:
+                p = q
+        yield [row[:] for row in fb]
+
+
+# ---------- Output ----------
+
+def write_header(path, name, clip, summary, sources):
+    sym = "CLIP_" + "".join(ch if ch.isalnum() else "_" for ch in name.upper())
+    lines = [
+        "#pragma once",
+        "#include <Arduino.h>",
+        "",
+        f"// Generated by tools/clip_encode.py from {sources}; do not edit.",
+        f"// {summary}",
+        f"static const uint8_t {sym}[] = {{",
+    ]
+    for i in range(0, len(clip), 20):
+        lines.append("  " + ",".join(f"0x{b:02x}" for b in clip[i:i + 20]) + ",")
+    lines.append("};")
+    with open(path, "w", newline="\r\n") as f:
+        f.write("\n".join(lines) + "\n")
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Encode a PNG sequence as a face clip")
+    ap.add_argument("frames", nargs="+", help="PNG frames in order (globs are expanded and sorted)")
+    ap.add_argument("--fps", type=int, default=20, help="playback rate (default: 20)")
+    ap.add_argument("--key-every", type=int, default=0, help="key frame interval (default: 0, frame 0 only)")
+    ap.add_argument("--bg", help="background colour as RRGGBB (default: most common colour of frame 0)")
+    ap.add_argument("--name", default="clip", help="symbol name for --header (default: clip)")
+    ap.add_argument("-o", "--out", help="binary clip path")
+    ap.add_argument("--header", help="C header path with the clip as a const array")
+    args = ap.parse_args()
+
+    paths = []
+    for pat in args.frames:
+        paths += sorted(glob.glob(pat)) or [pat]
+    if not 1 <= args.fps <= 255:
+        sys.exit("--fps must be 1..255")
+
+    frames, size = [], None
+    for p in paths:
+        w, h, rows = read_png(p)
+        if size and size != (w, h):
+            sys.exit(f"{p}: {w}x{h}, expected {size[0]}x{size[1]}")
+        size = (w, h)
+        frames.append([[rgb565(px) for px in row] for row in rows])
+    if len(frames) > 0xFFFF:
+        sys.exit("too many frames")
+    bg = rgb565(bytes.fromhex(args.bg)) if args.bg else None
+
+    clip, stats = encode(frames, args.fps, args.key_every, bg)
+    for n, (got, want) in enumerate(zip(decode(clip), frames)):
+        if got != want:
+            sys.exit(f"self-check failed at frame {n}")
+
+    w, h = size
+    raw = w * h * 2
+    keys = [s for s in stats if s["key"]]
+    deltas = [s for s in stats if not s["key"]]
+    colours = clip[11]
+    summary = (f"{w}x{h}, {len(frames)} frames @ {args.fps} fps, {colours} colours, "
+               f"key every {args.key_every or len(frames)}: {len(clip)} bytes")
+    print(summary)
+    print(f"raw RGB565 {raw * len(frames)} bytes, ratio {raw * len(frames) / len(clip):.1f}x")
+    for label, group in (("key", keys), ("delta", deltas)):
+        if group:
+            b = [s["bytes"] for s in group]
+            r = [s["runs"] for s in group]
+            px = [s["px"] for s in group]
+            print(f"{label:5s} x{len(group):<4d} bytes mean {sum(b) / len(b):7.1f} max {max(b):5d}"
+                  f"  runs mean {sum(r) / len(r):6.1f} max {max(r):4d}  px mean {sum(px) / len(px):7.1f}")
+    print(f"all   bytes/frame {len(clip) / len(frames):.1f} (header + table included); self-check ok")
+
+    if args.out:
+        open(args.out, "wb").write(clip)
+    if args.header:
+        sources = os.path.basename(args.frames[0]) if len(args.frames) == 1 else f"{len(paths)} frames"
+        write_header(args.header, args.name, clip, summary, sources)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,144 @@
+"""
+face_stream.py — stream face state to the CYD over its serial port (src/remote.h).
+
+Reads one JSON object per line on stdin with any of the face parameters as floats (gaze_x, gaze_y,
+lid_ul, lid_ll, lid_ur, lid_lr, pupil, jaw, smile, pucker, asym; see Remote::Param for ranges, 1.0
+is full scale) and sends the latest state --hz times a second, each packet delta-encoded against the
+newest state the device acknowledged. Parameters not given keep their last value. --demo sends a
+wandering gaze, blinks and a talking jaw instead of reading stdin. Prints the device's link report
+every few seconds (the "face" command).
+
+  python tools/face_stream.py /dev/ttyUSB0 --demo
+  my_tracker | python tools/face_stream.py /dev/ttyUSB0 --hz 60
+
+Needs pyserial.
+"""
+
+import sys
+import json
+import math
+import time
+import argparse
+import threading
+
+import serial
+
+MAGIC = 0xFA
+ONE = 256
+HISTORY = 16
+PARAMS = ["gaze_x", "gaze_y", "lid_ul", "lid_ll", "lid_ur", "lid_lr", "pupil", "jaw", "smile", "pucker", "asym"]
+REST = {"lid_ul": 0.48, "lid_ll": 0.38, "lid_ur": 0.48, "lid_lr": 0.38}
+
+
+# ---------- codec (as Remote::encode) ----------
+
+def crc8(data):
+    c = 0
+    for b in data:
+        c ^= b
+        for _ in range(8):
+            c = ((c << 1) ^ 0x07) & 0xFF if c & 0x80 else (c << 1) & 0xFF
+    return c
+
+
+def var(v):
+    out = bytearray()
+    while v >= 0x80:
+        out.append((v & 0x7F) | 0x80)
+        v >>= 7
+    out.append(v)
+    return out
+
+
+def zigzag(v):
+    return v << 1 if v >= 0 else (-v << 1) - 1
+
+
+def encode(seq, cur, base, base_seq, t_ms):
+    """A framed packet of `cur` against `base` (None: a key packet)."""
+    b = base or [0] * len(PARAMS)
+    mask = sum(1 << i for i in range(len(PARAMS)) if cur[i] != b[i])
+    body = var(seq) + var(seq - base_seq if base else 0) + var(t_ms & 0xFFFF) + var(mask)
+    for i in range(len(PARAMS)):
+        if mask >> i & 1:
+            body += var(zigzag(cur[i] - b[i]))
+    return bytes([MAGIC, len(body)]) + bytes(body) + bytes([crc8(body)])
+
+
+# ---------- sources ----------
+
+def demo(t):
+    """Gaze wandering, a blink every few seconds, a talking jaw in bursts."""
+    blink = max(0.0, 1 - abs((t % 3.7) - 0.08) / 0.08)
+    talk = (t % 6) < 3.5
+    return {
+        "gaze_x": math.sin(t * 0.7) * 0.8, "gaze_y": math.sin(t * 0.45) * 0.3,
+        "lid_ul": 0.48 + blink * 0.52, "lid_ll": 0.38 + blink * 0.3,
+        "lid_ur": 0.48 + blink * 0.52, "lid_lr": 0.38 + blink * 0.3,
+        "jaw": (0.5 + 0.5 * math.sin(t * 28)) ** 2 if talk else 0.0,
+        "smile": 0.6 if (t % 20) > 12 else 0.0,
+    }
+
+
+def read_stdin(state, lock):
+    for line in sys.stdin:
+        try:
+            upd = json.loads(line)
+        except ValueError:
+            continue
+        with lock:
+            state.update({k: float(v) for k, v in upd.items() if k in PARAMS})
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    ap.add_argument("port")
+    ap.add_argument("--baud", type=int, default=115200)
+    ap.add_argument("--hz", type=float, default=60)
+    ap.add_argument("--demo", action="store_true")
+    ap.add_argument("--report-s", type=float, default=5)
+    args = ap.parse_args()
+
+    link = serial.Serial(args.port, args.baud, timeout=0)
+    state, lock = dict(REST), threading.Lock()
+    if not args.demo:
+        threading.Thread(target=read_stdin, args=(state, lock), daemon=True).start()
+
+    sent, seq, acked, rx = {}, 0, 0, b""
+    t0 = time.monotonic()
+    next_report = t0 + args.report_s
+    sent_bytes = 0
+    while True:
+        now = time.monotonic()
+        if args.demo:
+            state.update(demo(now - t0))
+        with lock:
+            cur = [int(round(state.get(p, 0.0) * ONE)) for p in PARAMS]
+        seq += 1
+        key = not acked or seq - acked >= HISTORY
+        pkt = encode(seq, cur, None if key else sent[acked], acked, int(now * 1000))
+        link.write(pkt)
+        sent_bytes += len(pkt)
+        sent[seq] = cur
+        sent.pop(seq - 4 * HISTORY, None)
+
+        rx += link.read(4096)
+        *lines, rx = rx.split(b"\n")
+        for line in lines:
+            try:
+                msg = json.loads(line)
+            except ValueError:
+                continue
+            if msg.get("ack") == "face" and acked < msg["seq"] <= seq and msg["seq"] in sent:
+                acked = msg["seq"]
+            elif "face_link" in msg:
+                print(json.dumps(msg), file=sys.stderr)
+        if now >= next_report:
+            link.write(b"face\n")
+            print(f"sent {sent_bytes / (now - t0):.0f} B/s, seq {seq}, acked {acked}", file=sys.stderr)
+            next_report = now + args.report_s
+        time.sleep(max(0.0, t0 + seq / args.hz - time.monotonic()))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,131 @@
+/*
+ * clip_bench.cpp — host benchmark of clip playback (src/clip.h).
+ *
+ * Decodes every frame of a clip (the built-in dizzy clip, or a .clip file from tools/clip_encode.py)
+ * into a framebuffer through Face::Meter and reports, for key and delta frames: clip bytes, runs,
+ * panel windows with their command and pixel bytes, and decode time (host ns and TSC cycles on x86).
+ * Checks that every frame decoded from its key frame onward matches sequential playback, and that a
+ * Clip::Player on a stalling clock ends on the same picture.
+ *
+ *   g++ -std=gnu++17 -O2 -Itools/host/shim -Isrc tools/host/clip_bench.cpp -o clip_bench
+ *   ./clip_bench [file.clip]
+ */
+#include <Arduino.h>
+#include <LovyanGFX.hpp>
+#include <chrono>
+#include <vector>
+#include <stdio.h>
+#include "face.h"
+#include "clip.h"
+#include "clips/dizzy.h"
+#if defined(__x86_64__) || defined(__i386__)
+  #include <x86intrin.h>
+  static inline uint64_t cycles(){ return __rdtsc(); }
+#else
+  static inline uint64_t cycles(){ return 0; }
+#endif
+
+static constexpr int REPS = 200;
+
+struct FrameBuffer {
+  int w, h;
+  std::vector<uint16_t> px;
+  FrameBuffer(int w_, int h_) : w(w_), h(h_), px(w_ * h_, 0x1234) {}
+  void fill(int x, int y, int fw, int fh, uint16_t c){
+    for (int j = y; j < y + fh; ++j)
+      for (int i = x; i < x + fw; ++i) px[j * w + i] = c;
+  }
+  void image(int, int, int, int, const uint16_t*){}
+  void scroll(int){}
+  bool operator==(const FrameBuffer& o) const { return px == o.px; }
+};
+
+// What a decode costs without the panel: folds each run into a sum the compiler must keep.
+struct SumSink {
+  uint32_t sum = 0;
+  inline void fill(int x, int y, int w, int, uint16_t c){ sum = sum * 31 + x + (y << 8) + (w << 16) + c; }
+};
+
+static double nowNs(){
+  using namespace std::chrono;
+  return duration<double, std::nano>(steady_clock::now().time_since_epoch()).count();
+}
+
+struct Acc {
+  int    frames = 0;
+  double bytes = 0, runs = 0, cmd = 0, px = 0, ns = 0, cyc = 0;
+  uint32_t maxBytes = 0, maxRuns = 0;
+};
+
+int main(int argc, char** argv){
+  std::vector<uint8_t> file;
+  const uint8_t* data = CLIP_DIZZY;
+  size_t size = sizeof(CLIP_DIZZY);
+  if (argc > 1) {
+    FILE* f = fopen(argv[1], "rb");
+    if (!f) { perror(argv[1]); return 1; }
+    uint8_t buf[4096]; size_t n;
+    while ((n = fread(buf, 1, sizeof(buf), f)) > 0) file.insert(file.end(), buf, buf + n);
+    fclose(f);
+    data = file.data(); size = file.size();
+  }
+  Clip::Info c;
+  if (!Clip::open(c, data, size)) { fprintf(stderr, "not a clip\n"); return 1; }
+  printf("clip %ux%u, %u frames @ %u fps, %u colours, key every %u, %zu bytes\n",
+         c.w, c.h, c.frames, c.fps, c.colours, c.keyEvery ? c.keyEvery : c.frames, size);
+
+  // Sequential playback, metered, with every frame kept for the checks.
+  FrameBuffer fb(c.w, c.h);
+  std::vector<FrameBuffer> seq;
+  Acc acc[2];
+  uint32_t sink = 0;
+  for (int f = 0; f < c.frames; ++f) {
+    Face::Meter<FrameBuffer> m{ fb };
+    const uint32_t runs = Clip::drawFrame(c, f, 0, 0, m);
+    SumSink sum;
+    const double t0 = nowNs(); const uint64_t c0 = cycles();
+    for (int k = 0; k < REPS; ++k) Clip::drawFrame(c, f, 0, 0, sum);
+    const double ns = (nowNs() - t0) / REPS; const double cyc = (double)(cycles() - c0) / REPS;
+    const uint32_t bytes = Clip::rd32(c.offsets + 4 * (f + 1)) - Clip::rd32(c.offsets + 4 * f);
+
+    Acc& a = acc[Clip::isKey(c, f) ? 0 : 1];
+    ++a.frames; a.bytes += bytes; a.runs += runs; a.ns += ns; a.cyc += cyc;
+    a.cmd += m.windows * Batch::WINDOW_CMD_BYTES; a.px += m.px * 2;
+    a.maxBytes = max(a.maxBytes, bytes); a.maxRuns = max(a.maxRuns, runs);
+    seq.push_back(fb);
+    sink += sum.sum;
+  }
+
+  printf("\n%-6s %6s %9s %9s %9s %9s %9s %8s %9s\n",
+         "frames", "count", "bytes", "max_bytes", "runs", "max_runs", "cmd+px_B", "ns", "cycles");
+  static const char* const NAMES[] = { "key", "delta" };
+  for (int i = 0; i < 2; ++i) {
+    const Acc& a = acc[i];
+    if (!a.frames) continue;
+    const double n = a.frames;
+    printf("%-6s %6d %9.1f %9u %9.1f %9u %9.0f %8.0f %9.0f\n", NAMES[i], a.frames, a.bytes / n, a.maxBytes,
+           a.runs / n, a.maxRuns, (a.cmd + a.px) / n, a.ns / n, a.cyc / n);
+  }
+  printf("raw RGB565 frame %u bytes (decode sum %08x)\n", 2u * c.w * c.h, (unsigned)sink);
+
+  // Seek check: decoding from each frame's key frame reaches the sequential picture.
+  int bad = 0;
+  for (int f = 0; f < c.frames; ++f) {
+    int k = f;
+    while (!Clip::isKey(c, k)) --k;
+    FrameBuffer s(c.w, c.h);
+    for (int j = k; j <= f; ++j) Clip::drawFrame(c, j, 0, 0, s);
+    bad += !(s == seq[f]);
+  }
+  printf("seek check: %d mismatching frames\n", bad);
+
+  // Player on a clock that stalls: catch-up and key-frame skips still end on the last frame.
+  FrameBuffer p(c.w, c.h);
+  Clip::Player pl;
+  Clip::start(pl, data, size, 0, 0, 0);
+  uint32_t t = 0; int ticks = 0;
+  while (Clip::tick(pl, t, p) && ticks < 100000) { t += (ticks % 7 == 3) ? 400 : 1000 / c.fps; ++ticks; }
+  const bool endOk = p == seq.back();
+  printf("player check: %d ticks, final frame %s\n", ticks, endOk ? "ok" : "MISMATCH");
+  return bad || !endOk;
+}
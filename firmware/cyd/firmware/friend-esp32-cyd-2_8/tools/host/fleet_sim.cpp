@@ -0,0 +1,250 @@
+/*
+ * fleet_sim.cpp — behaviour tuning: thousands of faces through days of virtual time on all cores.
+ *
+ * Each face runs the firmware's own Eyes::update (gaze FSM, blinks) and Speech::tick (talk/silence,
+ * mouth swaps) at 40 FPS with nothing drawn. The fleet lives in component arrays (gaze, blink,
+ * speech, RNG, trackers: one vector each); a pool of threads takes chunks of faces per epoch, loads
+ * each face into a per-thread Eyes::State, runs the epoch and stores it back. The shim's clock and
+ * RNG are per thread and reseeded per face, so a run is deterministic for any thread count.
+ *
+ * Prints distributions of blink intervals, fixation and pursuit durations, talk/silence durations
+ * and mouth swap intervals, event rates, and frames per second; --scaling repeats a short run with
+ * 1, 2, 4 ... threads, ending on --threads. --csv writes the histograms (10 ms bins) for plotting.
+ *
+ *   g++ -std=gnu++17 -O2 -pthread -Itools/host/shim -Isrc tools/host/fleet_sim.cpp -o fleet_sim
+ *   ./fleet_sim [--faces 1024] [--hours 6] [--threads N] [--seed 1] [--csv hist.csv] [--scaling]
+ */
+#include <Arduino.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <stdlib.h>
+#include "eyes.h"
+#include "speech.h"
+
+static constexpr int      FRAME_MS = 1000 / Eyes::FPS_DEFAULT;
+static constexpr uint32_t EPOCH_MS = 3600u * 1000u;   // virtual time between barriers / progress lines
+static constexpr int      CHUNK    = 32;              // faces per work item
+static constexpr int      BIN_MS   = 10;
+static constexpr int      BINS     = 6000;            // 60 s; longer samples land in the last bin
+static constexpr uint32_t NEVER    = UINT32_MAX;
+
+enum Metric { BLINK, FIXATION, PURSUIT, TALK, SILENCE, SWAP, NUM_METRICS };
+static const char* const METRIC_NAMES[NUM_METRICS] = {
+  "blink_interval", "fixation", "pursuit", "talk", "silence", "mouth_swap" };
+
+enum Counter { N_BLINKS, N_SACCADES, N_PURSUITS, N_SWAPS, TALK_MS, NUM_COUNTERS };
+
+struct Hist {
+  std::vector<uint64_t> bin = std::vector<uint64_t>(BINS, 0);
+  uint64_t n = 0, maxMs = 0; double sum = 0;
+  inline void add(uint32_t ms){
+    ++bin[min(ms / BIN_MS, (uint32_t)BINS - 1)]; ++n; sum += ms; maxMs = max<uint64_t>(maxMs, ms);
+  }
+  void merge(const Hist& o){
+    for (int i = 0; i < BINS; ++i) bin[i] += o.bin[i];
+    n += o.n; sum += o.sum; maxMs = max(maxMs, o.maxMs);
+  }
+  uint32_t pct(double p) const {
+    const uint64_t want = (uint64_t)(p * n);
+    uint64_t acc = 0;
+    for (int i = 0; i < BINS; ++i) if ((acc += bin[i]) > want) return i * BIN_MS;
+    return (BINS - 1) * BIN_MS;
+  }
+};
+
+// Per-face bookkeeping for the metrics.
+struct Track {
+  uint32_t lastBlinkMs = NEVER, lastSwapMs = NEVER, speechSinceMs = 0;
+};
+
+// The fleet, one array per component.
+struct Fleet {
+  int n = 0;
+  std::vector<Eyes::GazeCtl>  gaze;
+  std::vector<Eyes::BlinkCtl> blink;
+  std::vector<Speech::State>  speech;
+  std::vector<uint32_t>       rng;
+  std::vector<Track>          track;
+};
+
+// One per worker thread: a scratch face (tables built once, never drawn) and its own results. Each
+// starts on its own cache line, so neighbours in the vector do not share the counters written per frame.
+struct alignas(64) Worker {
+  std::unique_ptr<Eyes::State> eyes{ new Eyes::State() };
+  Hist     hist[NUM_METRICS];
+  uint64_t count[NUM_COUNTERS] = {};
+  uint64_t frames = 0;
+};
+
+static void initFleet(Fleet& f, int n, uint32_t seed){
+  f.n = n;
+  f.gaze.resize(n); f.blink.resize(n); f.speech.resize(n); f.rng.resize(n); f.track.assign(n, Track());
+  static Eyes::State proto;
+  Eyes::init(proto, Eyes::Layout());
+  for (int i = 0; i < n; ++i) {
+    Host::clockMs() = 0;
+    randomSeed((seed * 2654435761u) ^ (uint32_t)(i + 1) * 40503u);
+    Eyes::startBehaviour(proto);
+    Speech::enterSilent(f.speech[i], 0);
+    f.gaze[i] = proto.gaze; f.blink[i] = proto.blink; f.rng[i] = Host::rngState();
+  }
+}
+
+// Runs face i from t0 to t1 (virtual ms) in the worker's scratch state.
+static void runFace(Fleet& f, int i, uint32_t t0, uint32_t t1, Worker& w){
+  Eyes::State& s = *w.eyes;
+  s.gaze = f.gaze[i]; s.blink = f.blink[i];
+  Speech::State sp = f.speech[i];
+  Track tr = f.track[i];
+  Host::rngState() = f.rng[i];
+  Host::clockMs() = t0;
+
+  for (uint32_t t = t0 + FRAME_MS; t <= t1; t += FRAME_MS) {
+    Host::clockMs() = t;
+    const Eyes::GazeState was = s.gaze.state;
+    const uint32_t wasStart = s.gaze.stateStartMs;
+    const bool wasBlink = s.blink.activeL;
+    Eyes::update(s, FRAME_MS / 1000.f);
+
+    if (!wasBlink && s.blink.activeL) {
+      if (tr.lastBlinkMs != NEVER) w.hist[BLINK].add(t - tr.lastBlinkMs);
+      tr.lastBlinkMs = t; ++w.count[N_BLINKS];
+    }
+    if (s.gaze.stateStartMs != wasStart) {
+      if (was == Eyes::GazeState::FIXATE)  w.hist[FIXATION].add(t - wasStart);
+      if (was == Eyes::GazeState::PURSUIT) w.hist[PURSUIT].add(t - wasStart);
+      if (s.gaze.state == Eyes::GazeState::SACCADE) ++w.count[N_SACCADES];
+      if (s.gaze.state == Eyes::GazeState::PURSUIT) ++w.count[N_PURSUITS];
+    }
+
+    const bool talking = sp.phase == Speech::Phase::Talking;
+    switch (Speech::tick(sp, t)) {
+      case Speech::Event::Silent:
+        w.hist[TALK].add(t - tr.speechSinceMs); tr.speechSinceMs = t; tr.lastSwapMs = NEVER;
+        break;
+      case Speech::Event::Talking:
+        w.hist[SILENCE].add(t - tr.speechSinceMs); tr.speechSinceMs = t; tr.lastSwapMs = t;
+        break;
+      case Speech::Event::Swap:
+        if (tr.lastSwapMs != NEVER) w.hist[SWAP].add(t - tr.lastSwapMs);
+        tr.lastSwapMs = t; ++w.count[N_SWAPS];
+        break;
+      case Speech::Event::None:
+        break;
+    }
+    if (talking) w.count[TALK_MS] += FRAME_MS;
+    ++w.frames;
+  }
+
+  f.gaze[i] = s.gaze; f.blink[i] = s.blink; f.speech[i] = sp; f.track[i] = tr; f.rng[i] = Host::rngState();
+}
+
+static double nowS(){
+  using namespace std::chrono;
+  return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Whole run; returns wall seconds. Workers must be default-constructed and sized to `threads`.
+static double simulate(Fleet& f, uint64_t durationMs, std::vector<Worker>& workers, bool progress){
+  const int threads = (int)workers.size();
+  const int chunks = (f.n + CHUNK - 1) / CHUNK;
+  for (Worker& w : workers) Eyes::init(*w.eyes, Eyes::Layout());
+  const double t0 = nowS();
+  for (uint64_t e0 = 0; e0 < durationMs; e0 += EPOCH_MS) {
+    const uint32_t a = (uint32_t)e0, b = (uint32_t)min<uint64_t>(durationMs, e0 + EPOCH_MS);
+    std::atomic<int> next{ 0 };
+    std::vector<std::thread> pool;
+    for (int k = 0; k < threads; ++k) {
+      pool.emplace_back([&, k]{
+        for (int c; (c = next.fetch_add(1)) < chunks; )
+          for (int i = c * CHUNK; i < min(f.n, (c + 1) * CHUNK); ++i) runFace(f, i, a, b, workers[k]);
+      });
+    }
+    for (auto& t : pool) t.join();
+    if (progress) fprintf(stderr, "\r%.1f / %.1f h virtual, %.1f s", b / 3.6e6, durationMs / 3.6e6, nowS() - t0);
+  }
+  if (progress) fputc('\n', stderr);
+  return nowS() - t0;
+}
+
+int main(int argc, char** argv){
+  int faces = 1024, threads = (int)std::thread::hardware_concurrency();
+  double hours = 6;
+  uint32_t seed = 1;
+  const char* csv = nullptr;
+  bool scaling = false;
+  for (int i = 1; i < argc; ++i) {
+    const std::string a = argv[i];
+    const bool more = i + 1 < argc;
+    if (a == "--faces" && more) faces = atoi(argv[++i]);
+    else if (a == "--hours" && more) hours = atof(argv[++i]);
+    else if (a == "--threads" && more) threads = atoi(argv[++i]);
+    else if (a == "--seed" && more) seed = (uint32_t)strtoul(argv[++i], nullptr, 0);
+    else if (a == "--csv" && more) csv = argv[++i];
+    else if (a == "--scaling") scaling = true;
+    else { fprintf(stderr, "usage: %s [--faces N] [--hours H] [--threads N] [--seed S] [--csv path] [--scaling]\n", argv[0]); return 2; }
+  }
+  threads = max(threads, 1);
+  // millis() is 32-bit and the behaviour code compares it without wrap handling
+  if (faces < 1 || hours <= 0 || hours > 49 * 24) { fprintf(stderr, "need --faces >= 1 and 0 < --hours <= 1176\n"); return 2; }
+
+  if (scaling) {
+    printf("%7s %12s %8s\n", "threads", "frames/s", "speedup");
+    double base = 0;
+    std::vector<int> counts;   // 1, 2, 4 ... then the full count
+    for (int t = 1; t < threads; t *= 2) counts.push_back(t);
+    counts.push_back(threads);
+    for (int t : counts) {
+      Fleet f; initFleet(f, faces, seed);
+      std::vector<Worker> w(t);
+      const double s = simulate(f, (uint64_t)(0.25 * 3.6e6), w, false);
+      uint64_t frames = 0; for (auto& x : w) frames += x.frames;
+      if (t == 1) base = frames / s;
+      printf("%7d %12.0f %8.2f\n", t, frames / s, frames / s / base);
+    }
+    return 0;
+  }
+
+  Fleet f;
+  initFleet(f, faces, seed);
+  std::vector<Worker> workers(threads);
+  const uint64_t durationMs = (uint64_t)(hours * 3.6e6);
+  const double wall = simulate(f, durationMs, workers, true);
+
+  Worker all;
+  for (Worker& w : workers) {
+    for (int m = 0; m < NUM_METRICS; ++m) all.hist[m].merge(w.hist[m]);
+    for (int c = 0; c < NUM_COUNTERS; ++c) all.count[c] += w.count[c];
+    all.frames += w.frames;
+  }
+
+  printf("%d faces x %.1f h at %d FPS on %d threads: %llu frames in %.1f s (%.2f M frames/s)\n\n",
+         faces, hours, Eyes::FPS_DEFAULT, threads, (unsigned long long)all.frames, wall, all.frames / wall / 1e6);
+  printf("%-15s %10s %8s %7s %7s %7s %7s %7s %7s\n", "ms", "count", "mean", "p5", "p25", "p50", "p75", "p95", "max");
+  for (int m = 0; m < NUM_METRICS; ++m) {
+    const Hist& h = all.hist[m];
+    printf("%-15s %10llu %8.0f %7u %7u %7u %7u %7u %7llu\n", METRIC_NAMES[m], (unsigned long long)h.n,
+           h.n ? h.sum / h.n : 0.0, h.pct(0.05), h.pct(0.25), h.pct(0.5), h.pct(0.75), h.pct(0.95),
+           (unsigned long long)h.maxMs);
+  }
+  const double faceMin = faces * hours * 60.0;
+  const double talkS = all.count[TALK_MS] / 1000.0;
+  printf("\nper face-minute: %.2f blinks, %.2f saccades, %.2f pursuits; talking %.1f%% of the time, "
+         "%.2f mouth swaps/s while talking\n", all.count[N_BLINKS] / faceMin, all.count[N_SACCADES] / faceMin,
+         all.count[N_PURSUITS] / faceMin, 100.0 * talkS / (faces * hours * 3600.0), talkS > 0 ? all.count[N_SWAPS] / talkS : 0.0);
+
+  if (csv) {
+    FILE* out = fopen(csv, "w");
+    if (!out) { perror(csv); return 1; }
+    fprintf(out, "metric,bin_ms,count\n");
+    for (int m = 0; m < NUM_METRICS; ++m)
+      for (int i = 0; i < BINS; ++i)
+        if (all.hist[m].bin[i]) fprintf(out, "%s,%d,%llu\n", METRIC_NAMES[m], i * BIN_MS, (unsigned long long)all.hist[m].bin[i]);
+    fclose(out);
+  }
+  return 0;
+}
@@ -0,0 +1,224 @@
+/*
+ * golden_render.cpp — golden-image checks of the face draw paths (coverage edges, lids, pupils, SDF
+ * outlines, half-resolution eyes, mouth styles, themes) on the host.
+ *
+ * Each scene sets the eye/mouth state directly and renders it into a 320x240 RGB565 framebuffer
+ * three ways from a cleared panel: one window per diffed span, batched windows (src/batch.h) and
+ * tile hashes (src/tiles.h). All three must equal the display list composed directly. The scenes are
+ * then rendered again in sequence through one renderer per strategy, each diffed against the one
+ * before (rendered until no fade-budget rows or tiles are stale), and must land on the same frame. The
+ * frame's FNV-1a checksum is compared with tools/host/golden_render.txt; a draw change that moves
+ * pixels shows up as a named scene to look at (--ppm writes each frame as a binary PPM) before the
+ * file is regenerated with --update. Exits nonzero on any mismatch.
+ *
+ *   g++ -std=gnu++17 -O2 -Itools/host/shim -Isrc tools/host/golden_render.cpp -o golden_render
+ *   ./golden_render [--golden tools/host/golden_render.txt] [--update] [--ppm dir]
+ */
+#include <Arduino.h>
+#include <LovyanGFX.hpp>
+#include <string>
+#include <stdlib.h>
+#include "face.h"
+
+static constexpr int W = 320, H = 240;
+static constexpr int SETTLE_FRAMES = 200;   // bound on the renders that clear stale rows
+
+struct FrameBuffer {
+  uint16_t px[H][W];
+  void clear(uint16_t c){ for (auto& row : px) for (auto& p : row) p = c; }
+  bool operator==(const FrameBuffer& o) const { return !memcmp(px, o.px, sizeof(px)); }
+};
+
+// Panel memory as the renderer leaves it (no slides here: the start line stays 0).
+struct PanelSink {
+  FrameBuffer& fb;
+  void scroll(int){}
+  void fill(int x, int y, int w, int h, uint16_t c){
+    for (int j = y; j < y + h; ++j) for (int i = x; i < x + w; ++i) fb.px[j][i] = c;
+  }
+  void image(int x, int y, int w, int h, const uint16_t* p){
+    for (int j = 0; j < h; ++j) memcpy(&fb.px[y + j][x], p + j * w, w * 2);
+  }
+};
+
+struct Scene {
+  const char*            name;
+  const Theme::Colors*   colors;
+  Coverage::Quality      quality;
+  float                  lidU, lidL;        // closure, as Eye::lidU / lidL
+  int                    pdx, pdy;          // pupil offset from the eye centre, 1/Coverage::PHASES px
+  uint8_t                pupil;             // Edges::pupil: 0 at rest, 1 dilated
+  Sdf::Kind              shape;
+  int                    scale;             // 1 or Eyes::HALF_RES
+  int                    talk;              // TALK_FRAMES index, -1: the smile
+  uint8_t                lips;              // Face::Mouth::style
+};
+
+static const Theme::Colors DUSK = { 0x0008, 0xEF7F, 0x03BF, 0x0010, 0x05FF, 0xBEFF };   // coloured background
+
+using Q = Coverage::Quality;
+using K = Sdf::Kind;
+static constexpr float UL = Eyes::BASE_UPPER_LID, LL = Eyes::BASE_LOWER_LID;
+static constexpr uint8_t JOIN = Face::LIPS_JOIN, OPEN = Face::LIPS_JOIN | Face::LIPS_CAVITY | Face::LIPS_TEETH;
+
+static const Scene SCENES[] = {
+  { "mono_smooth",     &Theme::MONO,   Q::Smooth,  UL,   LL,    0,   0, 0, K::Circle,    1,             -1, JOIN },
+  { "mono_fast",       &Theme::MONO,   Q::Fast,    UL,   LL,    0,   0, 0, K::Circle,    1,             -1, JOIN },
+  { "mono_aliased",    &Theme::MONO,   Q::Aliased, UL,   LL,    0,   0, 0, K::Circle,    1,             -1, JOIN },
+  { "ocean_look_left", &Theme::OCEAN,  Q::Smooth,  UL,   LL,  -53,   6, 0, K::Circle,    1,             -1, JOIN },
+  { "ocean_subpixel",  &Theme::OCEAN,  Q::Smooth,  UL,   LL,   29, -11, 0, K::Circle,    1,             -1, JOIN },
+  { "ember_dilated",   &Theme::EMBER,  Q::Smooth,  UL,   LL,   66,   0, 1, K::Circle,    1,             -1, JOIN },
+  { "forest_blink",    &Theme::FOREST, Q::Smooth,  0.8f, 0.5f,  0,   0, 0, K::Circle,    1,             -1, JOIN },
+  { "mono_shut",       &Theme::MONO,   Q::Fast,    1.0f, 1.0f,  0,   0, 0, K::Circle,    1,             -1, JOIN },
+  { "mono_wide",       &Theme::MONO,   Q::Smooth,  0.0f, 0.0f, -20,  20, 0, K::Circle,    1,             -1, JOIN },
+  { "ocean_rrect",     &Theme::OCEAN,  Q::Smooth,  UL,   LL,    0,   0, 0, K::RoundRect, 1,             -1, JOIN },
+  { "ocean_squint",    &Theme::OCEAN,  Q::Smooth,  UL,   LL,    0,   0, 0, K::Squint,    1,             -1, JOIN },
+  { "ember_heart",     &Theme::EMBER,  Q::Fast,    UL,   LL,    0,   0, 0, K::Heart,     1,             -1, JOIN },
+  { "forest_star",     &Theme::FOREST, Q::Smooth,  UL,   LL,   17,  -9, 0, K::Star,      1,             -1, JOIN },
+  { "mono_half_res",   &Theme::MONO,   Q::Smooth,  UL,   LL,   24,   8, 0, K::Circle,    Eyes::HALF_RES, -1, JOIN },
+  { "mono_talk_open",  &Theme::MONO,   Q::Smooth,  UL,   LL,    0,   0, 0, K::Circle,    1,              3, OPEN },
+  { "ocean_talk_line", &Theme::OCEAN,  Q::Smooth,  UL,   LL,    0,   0, 0, K::Circle,    1,              5, 0    },
+  { "dusk_bg",         &DUSK,          Q::Smooth,  UL,   LL,  -12,   4, 0, K::Circle,    1,              2, OPEN },
+};
+static constexpr int NUM_SCENES = sizeof(SCENES) / sizeof(SCENES[0]);
+
+// Eye and mouth state of a scene, set directly (no behaviour runs); the outline raster runs to the end.
+static void setup(const Scene& sc, Eyes::State& s, Face::Mouth& m){
+  Host::clockMs() = 1000;
+  randomSeed(1);
+  Eyes::Layout lay;
+  Eyes::init(s, lay);
+  Theme::apply(*sc.colors);
+  Theme::setQuality(sc.quality);
+  Sdf::Shape shape; shape.kind = sc.shape;
+  Eyes::setShape(s, shape, 0);
+  while (s.shape.frames) Eyes::stepShape(s);
+  Eyes::setScale(s, sc.scale);
+  for (Eyes::Eye* e : { &s.L, &s.R }) {
+    e->lidU = sc.lidU; e->lidL = sc.lidL;
+    e->qx = e->cx * Coverage::PHASES + sc.pdx;
+    e->qy = e->cy * Coverage::PHASES + sc.pdy;
+  }
+  s.edges.pupil = sc.pupil;
+  m = Face::Mouth();
+  m.baseY = 214; m.w = 117;
+  m.frame = sc.talk < 0 ? &moodToFrame(MouthMood::Smile) : &TALK_FRAMES[sc.talk];
+  m.style = sc.lips;
+}
+
+static void composeList(const DList::List& dl, uint16_t bg, FrameBuffer& fb){
+  fb.clear(bg);
+  for (int y = 0; y < dl.rows; ++y)
+    for (const DList::Span* sp = dl.rowBegin(y); sp != dl.rowEnd(y); ++sp)
+      for (int x = max((int)sp->x0, 0); x <= min((int)sp->x1, W - 1); ++x) fb.px[y][x] = sp->c;
+}
+
+enum class Strategy { Spans, Batched, Tiles };
+static const char* const STRATEGY_NAMES[] = { "spans", "batch", "tiles" };
+
+static void useStrategy(Face::Renderer& r, Tiles::Shadow& sh, Strategy st){
+  r.batch = st == Strategy::Batched;
+  Face::useTiles(r, st == Strategy::Tiles ? &sh : nullptr);
+}
+
+// FNV-1a over the frame's bytes, little-endian pixels.
+static uint32_t checksum(const FrameBuffer& fb){
+  uint32_t h = 2166136261u;
+  for (const auto& row : fb.px)
+    for (uint16_t p : row) { h = (h ^ (p & 0xff)) * 16777619u; h = (h ^ (p >> 8)) * 16777619u; }
+  return h;
+}
+
+static bool writePpm(const std::string& path, const FrameBuffer& fb){
+  FILE* f = fopen(path.c_str(), "wb");
+  if (!f) return false;
+  fprintf(f, "P6\n%d %d\n255\n", W, H);
+  for (const auto& row : fb.px)
+    for (uint16_t p : row) {
+      const uint8_t rgb[3] = { (uint8_t)((p >> 11) * 255 / 31), (uint8_t)(((p >> 5) & 63) * 255 / 63), (uint8_t)((p & 31) * 255 / 31) };
+      fwrite(rgb, 1, 3, f);
+    }
+  fclose(f);
+  return true;
+}
+
+int main(int argc, char** argv){
+  std::string goldenPath = "tools/host/golden_render.txt", ppmDir;
+  bool update = false;
+  for (int i = 1; i < argc; ++i) {
+    const std::string a = argv[i];
+    if (a == "--golden" && i + 1 < argc) goldenPath = argv[++i];
+    else if (a == "--update") update = true;
+    else if (a == "--ppm" && i + 1 < argc) ppmDir = argv[++i];
+    else { fprintf(stderr, "usage: %s [--golden file] [--update] [--ppm dir]\n", argv[0]); return 2; }
+  }
+
+  static Eyes::State s;
+  static Face::Renderer r;
+  static Tiles::Shadow shadow;
+  static FrameBuffer ref, panel;
+  static uint32_t sums[NUM_SCENES];
+  Face::Mouth m;
+  int bad = 0;
+
+  // Fresh frames: every path from a cleared panel equals the composed list.
+  printf("%-16s %-10s %6s %6s %6s  %s\n", "scene", "checksum", "spans", "batch", "tiles", "golden");
+  for (int i = 0; i < NUM_SCENES; ++i) {
+    const Scene& sc = SCENES[i];
+    bool same[3];
+    for (int t = 0; t < 3; ++t) {
+      setup(sc, s, m);
+      useStrategy(r, shadow, (Strategy)t);
+      const uint16_t bg = Theme::palette().bg;
+      panel.clear(bg);
+      Face::reset(r);
+      PanelSink sink{ panel };
+      Face::render(r, s, m, nullptr, W, H, sink);
+      if (t == 0) composeList(r.list[r.shown], bg, ref);
+      same[t] = panel == ref;
+      bad += !same[t];
+    }
+    sums[i] = checksum(ref);
+    printf("%-16s %08x %6s %6s %6s", sc.name, (unsigned)sums[i], same[0] ? "ok" : "DIFF", same[1] ? "ok" : "DIFF", same[2] ? "ok" : "DIFF");
+    if (!ppmDir.empty() && !writePpm(ppmDir + "/" + sc.name + ".ppm", ref)) { fprintf(stderr, "cannot write to %s\n", ppmDir.c_str()); return 2; }
+
+    // the golden file: "<scene> <checksum>" per line
+    if (!update) {
+      FILE* f = fopen(goldenPath.c_str(), "r");
+      char name[64]; unsigned want = 0; bool found = false;
+      while (f && fscanf(f, "%63s %x", name, &want) == 2) if (!strcmp(name, sc.name)) { found = true; break; }
+      if (f) fclose(f);
+      const bool ok = found && want == sums[i];
+      printf("  %s\n", !found ? "MISSING" : ok ? "ok" : "CHANGED");
+      bad += !ok;
+    } else {
+      printf("\n");
+    }
+  }
+
+  // Incremental frames: each scene diffed against the previous one lands on its fresh frame.
+  printf("\n%-8s %8s %8s\n", "push", "scenes", "bad");
+  for (int t = 0; t < 3; ++t) {
+    int wrong = 0;
+    for (int i = 0; i < NUM_SCENES; ++i) {
+      setup(SCENES[i], s, m);   // the theme moves under the attached strategy, as it does on the face
+      PanelSink sink{ panel };
+      if (i == 0) { useStrategy(r, shadow, (Strategy)t); panel.clear(Theme::palette().bg); Face::reset(r); }
+      Face::render(r, s, m, nullptr, W, H, sink);
+      for (int k = 0; k < SETTLE_FRAMES && !Face::settled(r); ++k) Face::render(r, s, m, nullptr, W, H, sink);
+      wrong += checksum(panel) != sums[i];
+    }
+    printf("%-8s %8d %8d\n", STRATEGY_NAMES[t], NUM_SCENES, wrong);
+    bad += wrong;
+  }
+
+  if (update) {
+    FILE* f = fopen(goldenPath.c_str(), "w");
+    if (!f) { fprintf(stderr, "cannot write %s\n", goldenPath.c_str()); return 2; }
+    for (int i = 0; i < NUM_SCENES; ++i) fprintf(f, "%s %08x\n", SCENES[i].name, (unsigned)sums[i]);
+    fclose(f);
+    printf("\nwrote %s\n", goldenPath.c_str());
+  }
+  printf("\n%s\n", bad ? "FAIL" : "pass");
+  return bad ? 1 : 0;
+}
@@ -0,0 +1,191 @@
+/*
+ * link_bench.cpp — host checks and timings for the schema-generated link messages (src/link_msgs.h).
+ *
+ * 1. Stream: random messages are encoded into a Link::Ring, drained in whole frames as the firmware
+ *    does, interleaved with command lines and Remote packets, cut into random chunks and fed byte by
+ *    byte to a Link::Rx. Every frame must come out in order with the fields it was sent with, the
+ *    command lines intact; with --corrupt, bad frames must be counted and never delivered.
+ * 2. Threads: one thread encodes into a ring while another drains it, across many laps, checking the
+ *    sequence of frames (the SPSC ordering and the skipped lap tails).
+ * 3. Cost: ns per message to encode into the ring and read it back through Rx + view, against the
+ *    same fields as a JSON line built with snprintf and parsed with sscanf.
+ *
+ *   g++ -std=gnu++17 -O2 -pthread -Itools/host/shim -Isrc tools/host/link_bench.cpp -o link_bench
+ *   ./link_bench [--messages 200000] [--seed 1] [--corrupt 0.001]
+ */
+#include <Arduino.h>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include "link_msgs.h"
+#include "remote.h"
+
+static uint32_t g_rng = 1;
+static uint32_t rnd(){ g_rng ^= g_rng << 13; g_rng ^= g_rng >> 17; g_rng ^= g_rng << 5; return g_rng; }
+static double   rndf(){ return (rnd() & 0xffffff) / (double)0x1000000; }
+
+// A port with room for `room` bytes per drain, collecting what is written.
+struct Port {
+  std::vector<uint8_t> out;
+  size_t room = 64;
+  int availableForWrite(){ return (int)room; }
+  size_t write(const uint8_t* p, size_t n){ out.insert(out.end(), p, p + n); return n; }
+};
+
+// Encodes message k (its kind and fields follow from k) into the ring.
+static bool sendNth(Link::Ring& r, uint32_t k){
+  const uint16_t seq = (uint16_t)k;
+  switch (k % 6) {
+    case 0:  return Msg::sendPing(r, seq, k * 7);
+    case 1:  return Msg::sendPong(r, seq, k, ~k);
+    case 2:  return Msg::sendAck(r, seq, (uint8_t)k, Msg::ACK_OK, (uint16_t)(k >> 3));
+    case 3:  return Msg::sendMood(r, seq, (uint8_t)(k % 5));
+    case 4: { char t[24]; snprintf(t, sizeof(t), "line %u", k); return Msg::sendSay(r, seq, (uint16_t)k, t); }
+    default: return Msg::sendLinkStats(r, seq, k, k + 1, (uint16_t)k, (uint16_t)(k >> 16));
+  }
+}
+
+// The frame read in place must be message k.
+static bool isNth(const uint8_t* f, size_t n, uint32_t k){
+  const uint16_t seq = (uint16_t)k;
+  switch (k % 6) {
+    case 0: { const Msg::Ping* m = Msg::view<Msg::Ping>(f, n); return m && m->h.seq == seq && m->hostUs == k * 7; }
+    case 1: { const Msg::Pong* m = Msg::view<Msg::Pong>(f, n); return m && m->hostUs == k && m->deviceUs == ~k; }
+    case 2: { const Msg::Ack* m = Msg::view<Msg::Ack>(f, n); return m && m->cmd == (uint8_t)k && m->cmdSeq == (uint16_t)(k >> 3); }
+    case 3: { const Msg::Mood* m = Msg::view<Msg::Mood>(f, n); return m && m->mood == k % 5; }
+    case 4: {
+      const Msg::Say* m = Msg::view<Msg::Say>(f, n);
+      char t[24]; snprintf(t, sizeof(t), "line %u", k);
+      return m && m->durMs == (uint16_t)k && !strncmp(m->text, t, sizeof(m->text));
+    }
+    default: { const Msg::LinkStats* m = Msg::view<Msg::LinkStats>(f, n); return m && m->rxFrames == k && m->txFrames == k + 1; }
+  }
+}
+
+int main(int argc, char** argv){
+  uint32_t messages = 200000;
+  double corrupt = 0;
+  for (int i = 1; i < argc; ++i) {
+    const std::string a = argv[i];
+    if (a == "--messages" && i + 1 < argc) messages = (uint32_t)atoi(argv[++i]);
+    else if (a == "--seed" && i + 1 < argc) g_rng = (uint32_t)max(1, atoi(argv[++i]));
+    else if (a == "--corrupt" && i + 1 < argc) corrupt = atof(argv[++i]);
+    else { fprintf(stderr, "usage: %s [--messages N] [--seed S] [--corrupt P]\n", argv[0]); return 2; }
+  }
+  int failures = 0;
+
+  printf("schema 0x%04x, %d messages:", Msg::SCHEMA, (int)Msg::NUM_IDS - 1);
+  for (int id = 1; id < Msg::NUM_IDS; ++id) if (Msg::FRAME_SIZE[id]) printf(" %s %u", Msg::NAMES[id], Msg::FRAME_SIZE[id]);
+  printf(" bytes\n\n");
+
+  // 1. stream
+  {
+    static Link::Ring tx;
+    static Link::Rx rx;
+    static Remote::Link remote;
+    Port port;
+    uint32_t next = 0, sent = 0, got = 0, wrong = 0, lines = 0, linesOk = 0, packets = 0;
+    std::string line;
+    uint8_t pkt[Remote::MAX_PAYLOAD + 3];
+    Remote::Vec v;
+    const uint8_t* p;
+    while (sent < messages || Link::peek(tx, p)) {
+      while (sent < messages && rnd() % 4) { if (!sendNth(tx, sent)) break; ++sent; }
+      port.room = rnd() % 128;
+      Link::drain(tx, port, Msg::FRAME_SIZE);
+      if (rnd() % 8 == 0) { const char* t = "power\n"; port.out.insert(port.out.end(), t, t + 6); ++lines; }
+      if (rnd() % 8 == 0) {
+        v.v[rnd() % Remote::NUM_PARAMS] = (int16_t)(rnd() % 512 - 256);
+        const int n = Remote::encode(pkt, ++packets, v, nullptr, 0, 0);
+        port.out.insert(port.out.end(), pkt, pkt + n);
+      }
+      if (corrupt > 0)
+        for (uint8_t& b : port.out) if (rndf() < corrupt) b ^= (uint8_t)(1 << (rnd() & 7));
+      // receive in random chunks, as pollCommands does
+      for (size_t i = 0; i < port.out.size(); ) {
+        const size_t end = min(port.out.size(), i + 1 + rnd() % 40);
+        for (; i < end; ++i) {
+          const uint8_t b = port.out[i];
+          if (!Link::receiving(rx) && Remote::feed(remote, b, 0)) continue;
+          const Link::Fed fed = Link::feed(rx, b, Msg::FRAME_SIZE);
+          if (fed == Link::FRAME) {
+            // corrupted frames are dropped: skip to the one that arrived
+            const uint16_t seq = reinterpret_cast<const Link::Header*>(rx.buf)->seq;
+            while ((uint16_t)next != seq && next < sent) ++next;
+            if (!isNth(rx.buf, rx.need, next)) ++wrong;
+            ++next; ++got;
+          }
+          if (fed != Link::NOT_LINK) continue;
+          if (b != '\n') { line += (char)b; continue; }
+          linesOk += line == "power";
+          line.clear();
+        }
+      }
+      port.out.clear();
+    }
+    printf("stream: %u frames sent, %u delivered, %u wrong, %u bad (corrupt %.4f/byte); %u/%u command lines intact, %u Remote packets\n",
+           sent, got, wrong, rx.bad, corrupt, linesOk, lines, remote.stats.packets + remote.stats.stale);
+    if (wrong || (!corrupt && (got != sent || linesOk != lines))) ++failures;
+  }
+
+  // 2. threads
+  {
+    static Link::Ring ring;
+    std::atomic<bool> done{ false };
+    uint32_t n = 0, bad = 0, full = 0;
+    std::thread prod([&]{
+      for (uint32_t k = 0; k < messages; )
+        if (sendNth(ring, k)) ++k; else ++full;
+      done = true;
+    });
+    const uint8_t* p;
+    for (;;) {
+      const size_t run = Link::peek(ring, p);
+      if (!run) { if (done && !Link::peek(ring, p)) break; continue; }
+      const size_t size = Msg::FRAME_SIZE[p[1]];
+      if (!size || size > run || !Link::check(p, size, Msg::FRAME_SIZE) || !isNth(p, size, n)) { ++bad; break; }
+      Link::consume(ring, size);
+      ++n;
+    }
+    prod.join();
+    printf("threads: %u frames through a %d-byte ring (%u laps), %u out of order or damaged, producer found it full %u times\n",
+           n, Link::RING_LEN, (unsigned)(ring.head / Link::RING_LEN), bad, full);
+    if (bad || n != messages) ++failures;
+  }
+
+  // 3. cost
+  {
+    using namespace std::chrono;
+    static Link::Ring ring;
+    static Link::Rx rx;
+    uint64_t sink = 0;
+    const uint32_t N = messages * 5;
+    auto t0 = steady_clock::now();
+    for (uint32_t k = 0; k < N; ++k) {
+      Msg::sendPong(ring, (uint16_t)k, k, k ^ 0x5a5a);
+      const uint8_t* p;
+      const size_t run = Link::peek(ring, p);
+      for (size_t i = 0; i < sizeof(Msg::Pong) && i < run; ++i)
+        if (Link::feed(rx, p[i], Msg::FRAME_SIZE) == Link::FRAME)
+          if (const Msg::Pong* m = Msg::view<Msg::Pong>(rx.buf, rx.need)) sink += m->deviceUs;
+      Link::consume(ring, sizeof(Msg::Pong));
+    }
+    const double nsBin = duration<double, std::nano>(steady_clock::now() - t0).count() / N;
+
+    t0 = steady_clock::now();
+    char buf[96];
+    for (uint32_t k = 0; k < N; ++k) {
+      const int len = snprintf(buf, sizeof(buf), "{\"pong\":%u,\"host_us\":%u,\"device_us\":%u}\n", k & 0xffff, k, k ^ 0x5a5a);
+      unsigned seq, host, dev;
+      if (len > 0 && sscanf(buf, "{\"pong\":%u,\"host_us\":%u,\"device_us\":%u}", &seq, &host, &dev) == 3) sink += dev;
+    }
+    const double nsJson = duration<double, std::nano>(steady_clock::now() - t0).count() / N;
+    printf("cost per Pong (host): frame %.1f ns (%zu bytes), JSON line %.1f ns (~%zu bytes) [%u]\n", nsBin, sizeof(Msg::Pong),
+           nsJson, strlen("{\"pong\":12345,\"host_us\":123456789,\"device_us\":123456789}\n"), (unsigned)(sink & 1));
+  }
+  return failures;
+}
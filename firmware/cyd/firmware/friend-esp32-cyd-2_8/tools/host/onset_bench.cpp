@@ -0,0 +1,202 @@
+/*
+ * onset_bench.cpp — host test of the audio-reactive eyes (src/onset.h, Eyes::onset / Eyes::setLoud).
+ *
+ * Feeds a 16-bit PCM WAV (or, without one, a synthetic 30 s track with known drum hits, accents and a
+ * loud middle section) through Onset::feed in I2S-sized blocks, each produced AUDIO_LATENCY_MS ahead
+ * of being heard as on the firmware. A 40 FPS render loop drains the queue the way main_full does and
+ * drives the real Eyes::update. Reports onsets (against the known hits for the synthetic track: hits,
+ * misses, false alarms, timing), loud spans, how far from its audible time each reaction lands on a
+ * frame, pupil pulse / lid lift / blink counts, and detector cost per sample.
+ *
+ *   g++ -std=gnu++17 -O2 -Itools/host/shim -Isrc tools/host/onset_bench.cpp -o onset_bench
+ *   ./onset_bench [file.wav] [--block 512] [--list]
+ */
+#include <Arduino.h>
+#include <LovyanGFX.hpp>
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include "eyes.h"
+#include "onset.h"
+#if defined(__x86_64__) || defined(__i386__)
+  #include <x86intrin.h>
+  static inline uint64_t cycles(){ return __rdtsc(); }
+#else
+  static inline uint64_t cycles(){ return 0; }
+#endif
+
+static constexpr int      FRAME_MS         = 1000 / Eyes::FPS_DEFAULT;
+static constexpr uint32_t AUDIO_LATENCY_MS = 46;    // as main_full's AUDIO_OUT_LATENCY_MS
+static constexpr int      MATCH_MS         = 30;    // a detected onset within this of a known hit counts
+
+struct Pcm {
+  uint32_t rate = 44100;
+  int channels = 2;
+  std::vector<int16_t> s;       // interleaved
+  std::vector<int>     hitsMs;  // known onsets (synthetic only)
+  int frames() const { return (int)(s.size() / channels); }
+};
+
+static uint32_t rd32(const uint8_t* p){ return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); }
+static uint16_t rd16(const uint8_t* p){ return (uint16_t)(p[0] | (p[1] << 8)); }
+
+static bool readWav(const char* path, Pcm& out){
+  FILE* f = fopen(path, "rb");
+  if (!f) { perror(path); return false; }
+  std::vector<uint8_t> b;
+  uint8_t buf[65536];
+  for (size_t n; (n = fread(buf, 1, sizeof(buf), f)) > 0; ) b.insert(b.end(), buf, buf + n);
+  fclose(f);
+  if (b.size() < 12 || memcmp(&b[0], "RIFF", 4) || memcmp(&b[8], "WAVE", 4)) { fprintf(stderr, "%s: not a WAV\n", path); return false; }
+  bool fmt = false;
+  for (size_t p = 12; p + 8 <= b.size(); ) {
+    const uint32_t len = rd32(&b[p + 4]);
+    const uint8_t* d = &b[p + 8];
+    if (!memcmp(&b[p], "fmt ", 4) && len >= 16) {
+      if (rd16(d) != 1 || rd16(d + 14) != 16) { fprintf(stderr, "%s: need 16-bit PCM\n", path); return false; }
+      out.channels = rd16(d + 2); out.rate = rd32(d + 4); fmt = true;
+    } else if (!memcmp(&b[p], "data", 4) && fmt) {
+      const size_t n = min<size_t>(len, b.size() - p - 8) / 2;
+      out.s.resize(n);
+      for (size_t i = 0; i < n; ++i) out.s[i] = (int16_t)rd16(d + 2 * i);
+      return out.channels > 0;
+    }
+    p += 8 + len + (len & 1);
+  }
+  fprintf(stderr, "%s: no data chunk\n", path);
+  return false;
+}
+
+// 30 s at 120 BPM: a pad throughout (louder from 10 to 20 s), a kick every beat with accents on the
+// bar, and hats on some off-beats; every hit is listed in hitsMs.
+static void synth(Pcm& out){
+  const int rate = (int)out.rate, n = 30 * rate;
+  out.channels = 2;
+  out.s.assign(2 * (size_t)n, 0);
+  std::vector<float> mix(n, 0.f);
+  for (int i = 0; i < n; ++i) {
+    const float t = (float)i / rate;
+    const float padAmp = (t >= 10 && t < 20) ? 0.40f : 0.05f;
+    mix[i] = padAmp * (0.6f * sinf(2 * (float)M_PI * 110.f * t) + 0.4f * sinf(2 * (float)M_PI * 164.8f * t));
+  }
+  uint32_t noise = 12345;
+  auto hit = [&](int ms, float amp, bool hat){
+    const int i0 = ms * rate / 1000, len = rate / (hat ? 20 : 6);
+    for (int k = 0; k < len && i0 + k < n; ++k) {
+      const float t = (float)k / rate, env = expf(-t * (hat ? 60.f : 18.f));
+      noise ^= noise << 13; noise ^= noise >> 17; noise ^= noise << 5;
+      const float white = (float)(int32_t)noise / 2147483648.f;
+      const float body = hat ? white : 0.7f * sinf(2 * (float)M_PI * (50.f + 90.f * expf(-t * 30.f)) * t) + 0.3f * white;
+      mix[i0 + k] += amp * env * body;
+    }
+    out.hitsMs.push_back(ms);
+  };
+  for (int beat = 2; beat < 58; ++beat) {
+    const int ms = beat * 500;
+    hit(ms, beat % 4 == 0 ? 0.6f : 0.3f, false);
+    if (beat % 3 == 1) hit(ms + 250, 0.15f, true);
+  }
+  for (int i = 0; i < n; ++i) {
+    const int v = (int)lrintf(constrain(mix[i], -1.f, 1.f) * 32767.f);
+    out.s[2 * i] = out.s[2 * i + 1] = (int16_t)v;
+  }
+}
+
+int main(int argc, char** argv){
+  const char* path = nullptr;
+  int block = 512;
+  bool list = false;
+  for (int i = 1; i < argc; ++i) {
+    const std::string a = argv[i];
+    if (a == "--block" && i + 1 < argc) block = max(16, atoi(argv[++i]));
+    else if (a == "--list") list = true;
+    else if (a[0] != '-') path = argv[i];
+    else { fprintf(stderr, "usage: %s [file.wav] [--block N] [--list]\n", argv[0]); return 2; }
+  }
+
+  Pcm pcm;
+  if (path ? !readWav(path, pcm) : (synth(pcm), false)) return 1;
+  const int frames = pcm.frames();
+  printf("%s: %.1f s, %u Hz, %d ch; blocks of %d frames, heard %u ms after analysis\n", path ? path : "synthetic",
+         (double)frames / pcm.rate, pcm.rate, pcm.channels, block, AUDIO_LATENCY_MS);
+
+  static Eyes::State eyes;
+  Host::clockMs() = 0;
+  randomSeed(99);
+  Eyes::init(eyes, Eyes::Layout());
+  Onset::Detector det;
+  Onset::Queue q;
+  Onset::setRate(det, pcm.rate);
+
+  std::vector<Onset::Event> heard;
+  std::vector<int> landErr;              // frame time - audible time, per reaction
+  long pulseFrames = 0, liftFrames = 0, loudFrames = 0, blinksLoud = 0, blinksQuiet = 0, maxQueued = 0;
+  uint64_t feedCycles = 0;
+  bool loud = false, wasBlink = false;
+  int next = 0;                          // next frame of audio to analyse
+  const uint32_t endMs = (uint32_t)((uint64_t)frames * 1000 / pcm.rate) + 200;
+
+  for (uint32_t t = 0; t <= endMs; t += FRAME_MS) {
+    Host::clockMs() = t;
+    // the audio task has analysed everything due to be heard within AUDIO_LATENCY_MS
+    while (next < frames && (uint64_t)next * 1000 / pcm.rate <= t + AUDIO_LATENCY_MS) {
+      const int n = min(block, frames - next);
+      const uint32_t due = (uint32_t)((uint64_t)next * 1000 / pcm.rate);
+      const uint64_t c0 = cycles();
+      Onset::feed(det, &pcm.s[(size_t)next * pcm.channels], n, pcm.channels, due, q);
+      feedCycles += cycles() - c0;
+      next += n;
+    }
+    maxQueued = max(maxQueued, (long)(q.head - q.tail));
+    // main_full's reactToAudio
+    Onset::Event ev;
+    while (Onset::pop(q, t + 500 / Eyes::FPS_DEFAULT, ev)) {
+      landErr.push_back((int)(t - ev.dueMs));
+      if (ev.kind == Onset::ONSET) { Eyes::onset(eyes, ev.strength); heard.push_back(ev); }
+      else if (ev.kind == Onset::LOUD || ev.kind == Onset::QUIET) { loud = ev.kind == Onset::LOUD; Eyes::setLoud(eyes, loud); heard.push_back(ev); }
+    }
+    Eyes::update(eyes, FRAME_MS / 1000.f);
+    pulseFrames += eyes.edges.pupil;
+    liftFrames  += eyes.L.lidU < Eyes::BASE_UPPER_LID - 0.01f;
+    loudFrames  += loud;
+    if (eyes.blink.activeL && !wasBlink) (loud ? blinksLoud : blinksQuiet)++;
+    wasBlink = eyes.blink.activeL;
+  }
+
+  int onsets = 0, lo = INT_MAX, hi = INT_MIN;
+  for (int e : landErr) { lo = min(lo, e); hi = max(hi, e); }
+  printf("\nevents: ");
+  int strong = 0;
+  for (const auto& e : heard) if (e.kind == Onset::ONSET) { ++onsets; strong += e.strength >= Eyes::EMPHASIS_STRENGTH; }
+  printf("%d onsets (%d strong enough to lift the lids), %zu loud/quiet changes, %u dropped, queue peak %ld\n",
+         onsets, strong, heard.size() - onsets, q.dropped, maxQueued);
+  printf("reaction lands %+d..%+d ms from the sound (frame is %d ms)\n", lo, hi, FRAME_MS);
+
+  if (!pcm.hitsMs.empty()) {
+    int hits = 0, falseAlarms = 0; double err = 0;
+    std::vector<bool> used(pcm.hitsMs.size(), false);
+    for (const auto& e : heard) {
+      if (e.kind != Onset::ONSET) continue;
+      int best = -1;
+      for (size_t k = 0; k < pcm.hitsMs.size(); ++k)
+        if (!used[k] && abs((int)e.dueMs - pcm.hitsMs[k]) <= MATCH_MS && (best < 0 || abs((int)e.dueMs - pcm.hitsMs[k]) < abs((int)e.dueMs - pcm.hitsMs[best]))) best = (int)k;
+      if (best < 0) { ++falseAlarms; continue; }
+      used[best] = true; ++hits; err += (int)e.dueMs - pcm.hitsMs[best];
+    }
+    printf("known hits %zu: detected %d, missed %zu, false %d, mean timing %+.1f ms (end of the 5 ms hop)\n",
+           pcm.hitsMs.size(), hits, pcm.hitsMs.size() - hits, falseAlarms, hits ? err / hits : 0.0);
+  }
+
+  const long total = endMs / FRAME_MS + 1;
+  printf("eyes over %ld frames: pupils dilated %.1f%%, lids lifted %.1f%%, loud %.1f%%; blinks %ld quiet, %ld loud\n",
+         total, 100.0 * pulseFrames / total, 100.0 * liftFrames / total, 100.0 * loudFrames / total, blinksQuiet, blinksLoud);
+  if (feedCycles) printf("detector: %.1f cycles per frame of audio (host TSC)\n", (double)feedCycles / frames);
+
+  if (list) {
+    printf("\n%8s %-6s %s\n", "ms", "kind", "strength");
+    for (const auto& e : heard)
+      printf("%8u %-6s %u\n", e.dueMs, e.kind == Onset::ONSET ? "onset" : e.kind == Onset::LOUD ? "loud" : "quiet", e.strength);
+  }
+  return 0;
+}
@@ -0,0 +1,291 @@
+#pragma once
+// Host pixel kernels for the simulator tools: RGB565 fills, 4bpp ink expansion, run-length decode,
+// frame diffing and RGB565 -> RGB888 for image output. Each has a scalar reference; on x86 there are
+// SSE2 and AVX2 versions (compiled per function with target attributes, so no -m flags) picked at
+// runtime. All versions must give bit-identical results; tools/host/session_render.cpp checks that.
+#include <stdint.h>
+#include <string.h>
+#if defined(__x86_64__) || defined(__i386__)
+  #define PIX_X86 1
+  #include <immintrin.h>
+#else
+  #define PIX_X86 0
+#endif
+
+namespace Pix {
+
+enum class Isa : uint8_t { Scalar = 0, Sse2, Avx2 };
+static const char* const ISA_NAMES[] = { "scalar", "sse2", "avx2" };
+static constexpr int NUM_ISAS = 3;
+
+// 16 inks for 4bpp pixels (two per byte, even x in the low nibble, as Tiles::Shadow stores them),
+// with the tables each version looks them up through. Build with prepare().
+struct Inks4 {
+  uint16_t rgb[16];
+  uint32_t pair[256];            // byte -> its two pixels, first in the low half
+  alignas(16) uint8_t lo[16];    // rgb low / high bytes, for byte shuffles
+  alignas(16) uint8_t hi[16];
+};
+
+static void prepare(Inks4& k, const uint16_t* rgb16){
+  memcpy(k.rgb, rgb16, sizeof(k.rgb));
+  for (int b = 0; b < 256; ++b) k.pair[b] = k.rgb[b & 0x0f] | ((uint32_t)k.rgb[b >> 4] << 16);
+  for (int i = 0; i < 16; ++i) { k.lo[i] = (uint8_t)k.rgb[i]; k.hi[i] = (uint8_t)(k.rgb[i] >> 8); }
+}
+
+// Run-length rows: runs of varint (len - 1) and a u8 palette index, as Clip rows store them (src/clip.h)
+// but without gaps, so the runs of a row cover it exactly.
+static inline uint32_t readVar(const uint8_t*& p){
+  uint32_t v = 0; int shift = 0;
+  uint8_t b;
+  do { b = *p++; v |= (uint32_t)(b & 0x7f) << shift; shift += 7; } while (b & 0x80);
+  return v;
+}
+
+// The next run's length, cut at `left`.
+static inline int runLen(const uint8_t*& p, int left){
+  const uint32_t len = readVar(p) + 1;
+  return len < (uint32_t)left ? (int)len : left;
+}
+
+// Where two pixel runs differ.
+struct Diff {
+  int count = 0;
+  int first = -1, last = -1;     // -1 when equal
+};
+
+struct Kernels {
+  Isa  isa;
+  void (*fill)(uint16_t* dst, int n, uint16_t c);
+  void (*expand4)(uint16_t* dst, const uint8_t* src, int n, const Inks4& k);   // n pixels, even
+  const uint8_t* (*rle)(uint16_t* dst, int n, const uint8_t* src, const uint16_t* pal);   // returns the end of the runs
+  Diff (*diff)(const uint16_t* a, const uint16_t* b, int n);
+  void (*rgb888)(uint8_t* dst, const uint16_t* src, int n);                    // 3n bytes, R G B
+};
+
+// ---------- Scalar reference ----------
+namespace ref {
+
+static void fill(uint16_t* dst, int n, uint16_t c){
+  for (int i = 0; i < n; ++i) dst[i] = c;
+}
+
+static void expand4(uint16_t* dst, const uint8_t* src, int n, const Inks4& k){
+  for (int i = 0; i < n / 2; ++i) { dst[2 * i] = k.rgb[src[i] & 0x0f]; dst[2 * i + 1] = k.rgb[src[i] >> 4]; }
+}
+
+// n pixels from runs that cover them (a last run reaching past n is cut).
+static const uint8_t* rle(uint16_t* dst, int n, const uint8_t* src, const uint16_t* pal){
+  for (int x = 0; x < n; ) {
+    const int len = runLen(src, n - x);
+    const uint16_t c = pal[*src++];
+    for (int i = 0; i < len; ++i) dst[x + i] = c;
+    x += len;
+  }
+  return src;
+}
+
+static Diff diff(const uint16_t* a, const uint16_t* b, int n){
+  Diff d;
+  for (int i = 0; i < n; ++i) {
+    if (a[i] == b[i]) continue;
+    if (d.first < 0) d.first = i;
+    d.last = i; ++d.count;
+  }
+  return d;
+}
+
+// 5/6-bit channels widened by bit replication, so white stays 255.
+static inline void rgb888px(uint8_t* d, uint16_t c){
+  const uint8_t r = c >> 11, g = (c >> 5) & 0x3f, b = c & 0x1f;
+  d[0] = (uint8_t)((r << 3) | (r >> 2)); d[1] = (uint8_t)((g << 2) | (g >> 4)); d[2] = (uint8_t)((b << 3) | (b >> 2));
+}
+
+static void rgb888(uint8_t* dst, const uint16_t* src, int n){
+  for (int i = 0; i < n; ++i) rgb888px(dst + 3 * i, src[i]);
+}
+
+} // namespace ref
+
+#if PIX_X86
+// ---------- SSE2 ----------
+namespace sse2 {
+
+__attribute__((target("sse2"))) static void fill(uint16_t* dst, int n, uint16_t c){
+  const __m128i v = _mm_set1_epi16((short)c);
+  int i = 0;
+  for (; i + 8 <= n; i += 8) _mm_storeu_si128((__m128i*)(dst + i), v);
+  for (; i < n; ++i) dst[i] = c;
+}
+
+// No byte shuffle before SSSE3: pixel pairs come from the 256-entry table, four bytes per store.
+__attribute__((target("sse2"))) static void expand4(uint16_t* dst, const uint8_t* src, int n, const Inks4& k){
+  const int bytes = n / 2;
+  int i = 0;
+  for (; i + 4 <= bytes; i += 4)
+    _mm_storeu_si128((__m128i*)(dst + 2 * i),
+                     _mm_set_epi32((int)k.pair[src[i + 3]], (int)k.pair[src[i + 2]], (int)k.pair[src[i + 1]], (int)k.pair[src[i]]));
+  for (; i < bytes; ++i) memcpy(dst + 2 * i, &k.pair[src[i]], 4);
+}
+
+// Whole vectors per run, the last one running on into pixels the following runs overwrite; only a
+// store that would pass the row's end is done pixel by pixel.
+__attribute__((target("sse2"))) static const uint8_t* rle(uint16_t* dst, int n, const uint8_t* src, const uint16_t* pal){
+  for (int x = 0; x < n; ) {
+    const int len = runLen(src, n - x);
+    const uint16_t c = pal[*src++];
+    const __m128i v = _mm_set1_epi16((short)c);
+    int i = 0;
+    for (; i < len && x + i + 8 <= n; i += 8) _mm_storeu_si128((__m128i*)(dst + x + i), v);
+    for (; i < len; ++i) dst[x + i] = c;
+    x += len;
+  }
+  return src;
+}
+
+__attribute__((target("sse2"))) static Diff diff(const uint16_t* a, const uint16_t* b, int n){
+  Diff d;
+  int i = 0;
+  for (; i + 8 <= n; i += 8) {
+    const __m128i eq = _mm_cmpeq_epi16(_mm_loadu_si128((const __m128i*)(a + i)), _mm_loadu_si128((const __m128i*)(b + i)));
+    const uint32_t ne = ~(uint32_t)_mm_movemask_epi8(eq) & 0xffff;   // two bits per pixel
+    if (!ne) continue;
+    if (d.first < 0) d.first = i + __builtin_ctz(ne) / 2;
+    d.last = i + (31 - __builtin_clz(ne)) / 2;
+    d.count += __builtin_popcount(ne) / 2;
+  }
+  for (; i < n; ++i) {
+    if (a[i] == b[i]) continue;
+    if (d.first < 0) d.first = i;
+    d.last = i; ++d.count;
+  }
+  return d;
+}
+
+} // namespace sse2
+
+// ---------- AVX2 ----------
+namespace avx2 {
+
+__attribute__((target("avx2"))) static void fill(uint16_t* dst, int n, uint16_t c){
+  const __m256i v = _mm256_set1_epi16((short)c);
+  int i = 0;
+  for (; i + 16 <= n; i += 16) _mm256_storeu_si256((__m256i*)(dst + i), v);
+  if (i + 8 <= n) { _mm_storeu_si128((__m128i*)(dst + i), _mm256_castsi256_si128(v)); i += 8; }
+  for (; i < n; ++i) dst[i] = c;
+}
+
+// 16 bytes (32 pixels) per step: split nibbles, look both colour bytes up with a shuffle, interleave.
+__attribute__((target("avx2"))) static void expand4(uint16_t* dst, const uint8_t* src, int n, const Inks4& k){
+  const __m256i lo = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)k.lo));
+  const __m256i hi = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)k.hi));
+  const __m128i nib = _mm_set1_epi8(0x0f);
+  const int bytes = n / 2;
+  int i = 0;
+  for (; i + 16 <= bytes; i += 16) {
+    const __m128i b = _mm_loadu_si128((const __m128i*)(src + i));
+    const __m128i even = _mm_and_si128(b, nib), odd = _mm_and_si128(_mm_srli_epi16(b, 4), nib);
+    const __m256i idx = _mm256_set_m128i(_mm_unpackhi_epi8(even, odd), _mm_unpacklo_epi8(even, odd));
+    const __m256i l = _mm256_shuffle_epi8(lo, idx), h = _mm256_shuffle_epi8(hi, idx);
+    const __m256i p0 = _mm256_unpacklo_epi8(l, h), p1 = _mm256_unpackhi_epi8(l, h);   // per lane: px 0-7 | 8-15
+    _mm256_storeu_si256((__m256i*)(dst + 2 * i),      _mm256_permute2x128_si256(p0, p1, 0x20));
+    _mm256_storeu_si256((__m256i*)(dst + 2 * i + 16), _mm256_permute2x128_si256(p0, p1, 0x31));
+  }
+  for (; i < bytes; ++i) memcpy(dst + 2 * i, &k.pair[src[i]], 4);
+}
+
+// As sse2::rle, 16 pixels per store, then 8 near the row's end.
+__attribute__((target("avx2"))) static const uint8_t* rle(uint16_t* dst, int n, const uint8_t* src, const uint16_t* pal){
+  for (int x = 0; x < n; ) {
+    const int len = runLen(src, n - x);
+    const uint16_t c = pal[*src++];
+    const __m256i v = _mm256_set1_epi16((short)c);
+    int i = 0;
+    for (; i < len && x + i + 16 <= n; i += 16) _mm256_storeu_si256((__m256i*)(dst + x + i), v);
+    for (; i < len && x + i + 8 <= n; i += 8) _mm_storeu_si128((__m128i*)(dst + x + i), _mm256_castsi256_si128(v));
+    for (; i < len; ++i) dst[x + i] = c;
+    x += len;
+  }
+  return src;
+}
+
+__attribute__((target("avx2"))) static Diff diff(const uint16_t* a, const uint16_t* b, int n){
+  Diff d;
+  int i = 0;
+  for (; i + 16 <= n; i += 16) {
+    const __m256i eq = _mm256_cmpeq_epi16(_mm256_loadu_si256((const __m256i*)(a + i)), _mm256_loadu_si256((const __m256i*)(b + i)));
+    const uint32_t ne = ~(uint32_t)_mm256_movemask_epi8(eq);
+    if (!ne) continue;
+    if (d.first < 0) d.first = i + __builtin_ctz(ne) / 2;
+    d.last = i + (31 - __builtin_clz(ne)) / 2;
+    d.count += __builtin_popcount(ne) / 2;
+  }
+  const Diff t = sse2::diff(a + i, b + i, n - i);
+  if (t.count) {
+    if (d.first < 0) d.first = i + t.first;
+    d.last = i + t.last; d.count += t.count;
+  }
+  return d;
+}
+
+// 16 pixels per step: channels widened in 16-bit lanes, paired into R G B 0 words, then each
+// 4-pixel quarter squeezed to 12 bytes. Stores are 16 bytes wide and overlap the next quarter, so
+// the loop stops while at least two pixels remain behind it.
+__attribute__((target("avx2"))) static void rgb888(uint8_t* dst, const uint16_t* src, int n){
+  const __m256i m6 = _mm256_set1_epi16(0x3f), m5 = _mm256_set1_epi16(0x1f);
+  const __m128i pack = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+  int i = 0;
+  for (; i + 18 <= n; i += 16) {
+    const __m256i v = _mm256_loadu_si256((const __m256i*)(src + i));
+    const __m256i r = _mm256_srli_epi16(v, 11);
+    const __m256i g = _mm256_and_si256(_mm256_srli_epi16(v, 5), m6);
+    const __m256i b = _mm256_and_si256(v, m5);
+    const __m256i r8 = _mm256_or_si256(_mm256_slli_epi16(r, 3), _mm256_srli_epi16(r, 2));
+    const __m256i g8 = _mm256_or_si256(_mm256_slli_epi16(g, 2), _mm256_srli_epi16(g, 4));
+    const __m256i b8 = _mm256_or_si256(_mm256_slli_epi16(b, 3), _mm256_srli_epi16(b, 2));
+    const __m256i rg = _mm256_or_si256(r8, _mm256_slli_epi16(g8, 8));
+    const __m256i q0 = _mm256_unpacklo_epi16(rg, b8), q1 = _mm256_unpackhi_epi16(rg, b8);   // per lane: px 0-3 | 4-7
+    uint8_t* d = dst + 3 * i;
+    _mm_storeu_si128((__m128i*)(d),      _mm_shuffle_epi8(_mm256_castsi256_si128(q0), pack));
+    _mm_storeu_si128((__m128i*)(d + 12), _mm_shuffle_epi8(_mm256_castsi256_si128(q1), pack));
+    _mm_storeu_si128((__m128i*)(d + 24), _mm_shuffle_epi8(_mm256_extracti128_si256(q0, 1), pack));
+    _mm_storeu_si128((__m128i*)(d + 36), _mm_shuffle_epi8(_mm256_extracti128_si256(q1, 1), pack));
+  }
+  ref::rgb888(dst + 3 * i, src + i, n - i);
+}
+
+} // namespace avx2
+#endif
+
+// SSE2 has no byte shuffle to pack 24-bit pixels, so its rgb888 is the scalar one.
+static const Kernels KERNELS[NUM_ISAS] = {
+  { Isa::Scalar, ref::fill, ref::expand4, ref::rle, ref::diff, ref::rgb888 },
+#if PIX_X86
+  { Isa::Sse2, sse2::fill, sse2::expand4, sse2::rle, sse2::diff, ref::rgb888 },
+  { Isa::Avx2, avx2::fill, avx2::expand4, avx2::rle, avx2::diff, avx2::rgb888 },
+#else
+  { Isa::Sse2, ref::fill, ref::expand4, ref::rle, ref::diff, ref::rgb888 },
+  { Isa::Avx2, ref::fill, ref::expand4, ref::rle, ref::diff, ref::rgb888 },
+#endif
+};
+
+static bool supported(Isa isa){
+#if PIX_X86
+  __builtin_cpu_init();
+  if (isa == Isa::Avx2) return __builtin_cpu_supports("avx2");
+  if (isa == Isa::Sse2) return __builtin_cpu_supports("sse2");
+  return true;
+#else
+  return isa == Isa::Scalar;
+#endif
+}
+
+static const Kernels& kernels(Isa isa){ return KERNELS[(int)isa]; }
+
+// The widest version this CPU runs.
+static const Kernels& best(){
+  for (int i = NUM_ISAS - 1; i > 0; --i) if (supported((Isa)i)) return KERNELS[i];
+  return KERNELS[0];
+}
+
+} // namespace Pix
@@ -0,0 +1,203 @@
+/*
+ * remote_bench.cpp — host simulation of the streamed face state (src/remote.h).
+ *
+ * A synthetic camera-mirrored face at 60 Hz: saccades, blinks, talking bursts moving the jaw at
+ * syllable rate, slow smiles and puckers, plus tracker noise on every continuous parameter. The
+ * host encodes each state against the last acked one (Remote::encode) and writes it to a 115200 baud
+ * UART behind a USB bridge with a few ms of jittery latency; bytes can be corrupted (--corrupt). The
+ * device polls the port at the start of each 40 FPS frame, as pollCommands does, and applies at the
+ * frame boundary; its acks travel back the same way. Reports link bytes/s both ways, packets applied /
+ * stale / lost, send-to-apply latency (mean, p50, p95, max), the device's own report line, whether every
+ * applied vector equals what the host sent under that seq, and what the same trace costs sent whole
+ * each time or as JSON text lines.
+ *
+ *   g++ -std=gnu++17 -O2 -Itools/host/shim -Isrc tools/host/remote_bench.cpp -o remote_bench
+ *   ./remote_bench [--minutes 10] [--seed 1] [--noise 1] [--hz 60] [--fps 40] [--corrupt 0.0001]
+ */
+#include <Arduino.h>
+#include <algorithm>
+#include <deque>
+#include <string>
+#include <vector>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "remote.h"
+
+static constexpr double BYTE_MS   = 10.0 / 115200 * 1000;   // 8N1
+static constexpr double USB_MS    = 2.0;                    // bridge latency, plus up to as much jitter
+
+static uint32_t g_rng = 1;
+static uint32_t rnd(){ g_rng ^= g_rng << 13; g_rng ^= g_rng >> 17; g_rng ^= g_rng << 5; return g_rng; }
+static double   rndf(){ return (rnd() & 0xffffff) / (double)0x1000000; }
+static double   rndIn(double lo, double hi){ return lo + (hi - lo) * rndf(); }
+
+// A byte stream with serial timing: each byte lands BYTE_MS after the previous one, plus the bridge.
+struct Wire {
+  std::deque<std::pair<double, uint8_t>> q;
+  double freeAt = 0;
+  uint64_t bytes = 0;
+  double corrupt = 0;
+  void send(double t, const uint8_t* p, int n){
+    const double usb = USB_MS + rndIn(0, USB_MS);
+    for (int i = 0; i < n; ++i) {
+      freeAt = std::max(freeAt, t) + BYTE_MS;
+      const uint8_t b = corrupt > 0 && rndf() < corrupt ? (uint8_t)(p[i] ^ (1 << (rnd() & 7))) : p[i];
+      q.push_back({ std::max(q.empty() ? 0 : q.back().first, freeAt + usb), b });
+    }
+    bytes += n;
+  }
+  bool pop(double t, uint8_t& b){
+    if (q.empty() || q.front().first > t) return false;
+    b = q.front().second; q.pop_front();
+    return true;
+  }
+};
+
+// The face being mirrored: smooth targets, blinks and speech, then tracker noise and quantisation.
+struct Mirror {
+  double gx = 0, gy = 0, gx0 = 0, gy0 = 0, gx1 = 0, gy1 = 0, gazeT = 0, gazeDur = 1;
+  double nextSaccade = 500, nextBlink = 2000, blinkT = -1;
+  double talkUntil = 0, nextTalk = 1500, syllable = 0;
+  double smile = 0, smileTo = 0, pucker = 0, puckerTo = 0, asym = 0, asymTo = 0, nextMood = 3000;
+  bool   pupil = false; double nextPupil = 8000;
+  double noise = 1;
+
+  Remote::Vec at(double t, double dt){
+    using namespace Remote;
+    if (t >= nextSaccade) {
+      gx0 = gx; gy0 = gy; gx1 = rndIn(-1, 1); gy1 = rndIn(-0.5, 0.5);
+      gazeT = t; gazeDur = rndIn(30, 60); nextSaccade = t + rndIn(300, 2500);
+    }
+    const double u = std::min(1.0, (t - gazeT) / gazeDur), e = u * u * (3 - 2 * u);
+    gx = gx0 + (gx1 - gx0) * e; gy = gy0 + (gy1 - gy0) * e;
+
+    double blink = 0;
+    if (t >= nextBlink) { blinkT = t; nextBlink = t + rndIn(2000, 6000); }
+    if (blinkT >= 0 && t - blinkT < 160) blink = 1 - fabs((t - blinkT) / 80 - 1);
+
+    if (t >= nextTalk) { talkUntil = t + rndIn(1000, 6000); nextTalk = talkUntil + rndIn(500, 8000); }
+    double jaw = 0;
+    if (t < talkUntil) { syllable += dt / 1000 * rndIn(3.5, 5.5) * 2 * M_PI; jaw = 0.5 + 0.5 * sin(syllable); jaw *= jaw; }
+
+    if (t >= nextMood) {
+      smileTo = rndf() < 0.3 ? rndIn(0.3, 1) : rndf() < 0.2 ? -rndIn(0.2, 0.8) : 0;
+      puckerTo = rndf() < 0.15 ? rndIn(0.4, 1) : 0;
+      asymTo = rndIn(-0.2, 0.2); nextMood = t + rndIn(1000, 5000);
+    }
+    const double k = 1 - exp(-dt / 150);
+    smile += (smileTo - smile) * k; pucker += (puckerTo - pucker) * k; asym += (asymTo - asym) * k;
+    if (t >= nextPupil) { pupil = !pupil; nextPupil = t + rndIn(2000, 15000); }
+
+    const double squint = std::max(0.0, smile) * 0.15;
+    const double f[NUM_PARAMS] = { gx, gy, 0.45 + squint + blink * 0.55, 0.38 + squint + blink * 0.3,
+                                   0.45 + squint + blink * 0.55, 0.38 + squint + blink * 0.3, pupil ? 1.0 : 0.0,
+                                   jaw, smile, pucker, asym };
+    Vec v;
+    for (int i = 0; i < NUM_PARAMS; ++i) {
+      const double n = i == PUPIL ? 0 : noise * (rndf() + rndf() - 1);   // tracker noise, in parameter units
+      v.v[i] = (int16_t)lrint(f[i] * ONE + n);
+    }
+    return v;
+  }
+};
+
+// JSON text line a host might otherwise send: {"gaze_x":12,...}
+static int jsonBytes(const Remote::Vec& v){
+  char buf[256]; int n = 1;
+  for (int i = 0; i < Remote::NUM_PARAMS; ++i) n += snprintf(buf, sizeof(buf), "\"%s\":%d,", Remote::PARAM_NAMES[i], v.v[i]);
+  return n + 1;   // "}" replaces the last comma, plus the newline
+}
+
+static double pct(std::vector<double> v, double p){
+  if (v.empty()) return 0;
+  std::sort(v.begin(), v.end());
+  return v[std::min(v.size() - 1, (size_t)(p * v.size()))];
+}
+
+int main(int argc, char** argv){
+  double minutes = 10, hz = 60, fps = 40;
+  Mirror face;
+  Wire down, up;
+  for (int i = 1; i < argc; ++i) {
+    const std::string a = argv[i];
+    if (a == "--minutes" && i + 1 < argc) minutes = atof(argv[++i]);
+    else if (a == "--seed" && i + 1 < argc) g_rng = (uint32_t)std::max(1, atoi(argv[++i]));
+    else if (a == "--noise" && i + 1 < argc) face.noise = atof(argv[++i]);
+    else if (a == "--hz" && i + 1 < argc) hz = atof(argv[++i]);
+    else if (a == "--fps" && i + 1 < argc) fps = atof(argv[++i]);
+    else if (a == "--corrupt" && i + 1 < argc) down.corrupt = up.corrupt = atof(argv[++i]);
+    else { fprintf(stderr, "usage: %s [--minutes N] [--seed S] [--noise UNITS] [--hz HZ] [--fps FPS] [--corrupt P]\n", argv[0]); return 2; }
+  }
+
+  static Remote::Link dev;
+  const double endMs = minutes * 60000, sendMs = 1000 / hz, frameMs = 1000 / fps;
+  std::vector<Remote::Vec> sent(1);              // by seq
+  std::vector<double> sentAt(1), lat;
+  uint32_t seq = 0, ackSeq = 0, keys = 0, mismatches = 0, wholeBytes = 0, jsonTotal = 0;
+  std::string ackLine;
+  double nextSend = 0, nextFrame = 0;
+  uint8_t pkt[Remote::MAX_PAYLOAD + 3];
+
+  // Acks from the device: a Print that puts the line on the up wire at the current time
+  struct AckOut : Print {
+    Wire* w = nullptr; double t = 0;
+    size_t write(const uint8_t* p, size_t n) override { w->send(t, p, (int)n); return n; }
+  } ackOut;
+  ackOut.w = &up;
+
+  for (double t = 0; t < endMs; t += 0.25) {
+    Host::clockMs() = (uint32_t)t;
+    // host: a state every sendMs, against the newest acked base it can use
+    if (t >= nextSend) {
+      const Remote::Vec v = face.at(t, sendMs);
+      ++seq; sent.push_back(v); sentAt.push_back(t);
+      const bool key = !ackSeq || seq - ackSeq >= (uint32_t)Remote::HISTORY;
+      keys += key;
+      const int n = Remote::encode(pkt, seq, v, key ? nullptr : &sent[ackSeq], ackSeq, (uint16_t)t);
+      down.send(t, pkt, n);
+      wholeBytes += Remote::encode(pkt, seq, v, nullptr, 0, (uint16_t)t);
+      jsonTotal += jsonBytes(v);
+      nextSend += sendMs;
+    }
+    // host: ack lines
+    uint8_t b;
+    while (up.pop(t, b)) {
+      if (b != '\n') { ackLine += (char)b; continue; }
+      unsigned s = 0, ts = 0;
+      if (sscanf(ackLine.c_str(), "{\"ack\":\"face\",\"seq\":%u,\"t\":%u}", &s, &ts) == 2 && s > ackSeq && s <= seq) ackSeq = s;
+      ackLine.clear();
+    }
+    // device: poll at the frame start, apply at the frame boundary
+    if (t >= nextFrame) {
+      while (down.pop(t, b)) Remote::feed(dev, b, (uint32_t)t);
+      Remote::Vec v;
+      if (Remote::take(dev, v, (uint32_t)t)) {
+        lat.push_back(t - sentAt[dev.seq]);
+        if (memcmp(&v, &sent[dev.seq], sizeof(v))) ++mismatches;
+      }
+      ackOut.t = t;
+      Remote::ack(dev, (uint32_t)t, ackOut);
+      nextFrame += frameMs;
+    }
+  }
+
+  const double s = endMs / 1000;
+  double mean = 0;
+  for (double v : lat) mean += v;
+  printf("%.0f min, host %.0f Hz, device %.0f FPS, 115200 baud + %.0f..%.0f ms USB, tracker noise %.1f units of %d, corrupt %.5f/byte\n\n",
+         minutes, hz, fps, USB_MS, 2 * USB_MS, face.noise, Remote::ONE, down.corrupt);
+  printf("link down   %7.0f B/s  (%.1f B/packet, %u key packets)\n", down.bytes / s, (double)down.bytes / seq, keys);
+  printf("  whole     %7.0f B/s  every state as a key packet\n", wholeBytes / s);
+  printf("  json      %7.0f B/s  every state as a JSON line\n", jsonTotal / s);
+  printf("acks up     %7.0f B/s\n", up.bytes / s);
+  printf("packets %u sent, %u applied (%.1f/s), %u stale, %u bad, %u no base\n", seq, dev.stats.applied, dev.stats.applied / s,
+         dev.stats.stale, dev.stats.bad, dev.stats.noBase);
+  printf("send-to-apply ms: mean %.1f  p50 %.1f  p95 %.1f  max %.1f  (frame %.1f ms)\n", lat.empty() ? 0 : mean / lat.size(),
+         pct(lat, 0.5), pct(lat, 0.95), pct(lat, 1.0), frameMs);
+  printf("applied vectors differing from the host's: %u\n", mismatches);
+  printf("device report: ");
+  Print out;
+  Remote::report(dev, (uint32_t)endMs, out);
+  return mismatches != 0;
+}
@@ -0,0 +1,125 @@
+/*
+ * scale_bench.cpp — host benchmark of half-resolution eyes (Eyes::HALF_RES) against native ones.
+ *
+ * Two eye states run in lockstep on a simulated 40 FPS clock (same gaze, blinks and outline morphs),
+ * one native and one at half resolution, for the stock 2.8" layout and a large-eye layout like the
+ * 3.5" board's. Per scale: list build time, SDF samples spent on morphs, spans per frame and the
+ * panel bytes of the batched diff. Quality is the half-resolution picture against the native one
+ * over the eye pixels: how many differ, and the mean colour error in 8-bit steps.
+ *
+ *   g++ -std=gnu++17 -O2 -Itools/host/shim -Isrc tools/host/scale_bench.cpp -o scale_bench
+ *   ./scale_bench [frames]
+ */
+#include <Arduino.h>
+#include <LovyanGFX.hpp>
+#include <chrono>
+#include <stdlib.h>
+#include "face.h"
+
+static constexpr int W = 320, H = 240;
+static constexpr int FRAME_MS    = 1000 / Eyes::FPS_DEFAULT;
+static constexpr int MORPH_EVERY = 120;   // frames between outline morphs
+
+struct NullSink {
+  void fill(int, int, int, int, uint16_t){}
+  void image(int, int, int, int, const uint16_t*){}
+  void scroll(int){}
+};
+
+struct Acc {
+  double buildUs = 0, spans = 0, bytes = 0, samples = 0;
+  long   frames = 0, overflows = 0;
+};
+
+static double nowUs(){
+  using namespace std::chrono;
+  return duration<double, std::micro>(steady_clock::now().time_since_epoch()).count();
+}
+
+static void rgb8(uint16_t c, int& r, int& g, int& b){
+  r = (c >> 11) * 255 / 31; g = ((c >> 5) & 63) * 255 / 63; b = (c & 31) * 255 / 31;
+}
+
+static void run(const char* name, Eyes::Layout lay, int frames){
+  static Eyes::State s[2];
+  static Face::Renderer r[2];
+  static uint16_t fb[2][W * H];
+  static const Sdf::Kind SHAPES[] = { Sdf::Kind::RoundRect, Sdf::Kind::Heart, Sdf::Kind::Circle, Sdf::Kind::Star };
+  Acc acc[2];
+  long eyePx = 0, diffPx = 0; double err = 0;
+
+  Host::clockMs() = 1000;
+  randomSeed(4242);
+  Theme::apply(Theme::OCEAN);
+  const Face::Mouth noMouth;
+  NullSink sink;
+  for (int k = 0; k < 2; ++k) {
+    lay.scale = k ? Eyes::HALF_RES : 1;
+    const uint32_t seed = Host::rngState();
+    Eyes::init(s[k], lay);
+    if (k) Host::rngState() = seed;
+    Face::reset(r[k]);
+    Face::render(r[k], s[k], noMouth, nullptr, W, H, sink);   // first frame draws everything; not counted
+  }
+  const int initSamples[2] = { (int)s[0].shape.job.evals, (int)s[1].shape.job.evals };
+
+  for (int f = 0; f < frames; ++f) {
+    Host::advanceMs(FRAME_MS);
+    if (f % MORPH_EVERY == 0) {
+      Sdf::Shape to; to.kind = SHAPES[(f / MORPH_EVERY) % 4];
+      for (auto& st : s) Eyes::setShape(st, to);
+    }
+    const uint32_t seed = Host::rngState();
+    for (int k = 0; k < 2; ++k) {
+      Host::rngState() = seed;                       // both states draw the same random gaze/blinks
+      const uint8_t front = s[k].edges.front;
+      Eyes::update(s[k], FRAME_MS / 1000.f);
+      Acc& a = acc[k];
+      a.samples += s[k].shape.job.busy || s[k].edges.front != front ? s[k].shape.job.evalsLast : 0;
+
+      DList::List& scratch = r[k].list[r[k].shown ^ 1];
+      const double t0 = nowUs();
+      Face::build(scratch, s[k], noMouth, nullptr, W, H);
+      a.buildUs += nowUs() - t0;
+
+      const DList::Stats& st = Face::render(r[k], s[k], noMouth, nullptr, W, H, sink);
+      a.frames++; a.spans += r[k].list[r[k].shown].n; a.bytes += r[k].cmdBytes + r[k].pxBytes;
+      a.overflows += st.overflow;
+      Batch::compose(r[k].list[r[k].shown], Theme::palette().bg, 0, W - 1, 0, H - 1, fb[k]);
+    }
+    const uint16_t bg = Theme::palette().bg;
+    for (int i = 0; i < W * H; ++i) {
+      if (fb[0][i] == bg && fb[1][i] == bg) continue;
+      ++eyePx;
+      if (fb[0][i] == fb[1][i]) continue;
+      ++diffPx;
+      int r0, g0, b0, r1, g1, b1;
+      rgb8(fb[0][i], r0, g0, b0); rgb8(fb[1][i], r1, g1, b1);
+      err += (abs(r0 - r1) + abs(g0 - g1) + abs(b0 - b1)) / 3.0;
+    }
+  }
+
+  for (int k = 0; k < 2; ++k) {
+    const Acc& a = acc[k];
+    const double n = a.frames ? (double)a.frames : 1.0;
+    printf("%-6s %3d %6d %6s %8.2f %8.1f %9.0f %9.1f %8.1f %6.2f%s\n", name, lay.rWhite, k ? 2 : 1,
+           k ? "half" : "native", a.buildUs / n, a.spans / n, (double)initSamples[k], a.samples / n, a.bytes / n,
+           k ? 100.0 * diffPx / max(eyePx, 1L) : 0.0, a.overflows ? "  (list overflow)" : "");
+  }
+  printf("%-6s half vs native: %.2f%% of eye pixels differ; mean error %.1f over eye pixels, %.1f where they differ"
+         " (8-bit)\n\n", name, 100.0 * diffPx / max(eyePx, 1L), err / max(eyePx, 1L), diffPx ? err / diffPx : 0.0);
+}
+
+int main(int argc, char** argv){
+  const int frames = argc > 1 ? atoi(argv[1]) : 2000;
+  printf("%-6s %3s %6s %6s %8s %8s %9s %9s %8s %6s\n",
+         "layout", "r", "scale", "", "build_us", "spans", "tbl_smpl", "morph_smp", "push_B", "diff%");
+
+  run("stock", Eyes::Layout(), frames);
+
+  Eyes::Layout big;   // 3.5"-like eyes, the largest the native tables hold (Coverage::MAX_R)
+  big.cxL = 84; big.cxR = 236; big.rWhite = 46; big.rPupil = 14; big.maxOffset = 40;
+  big.targetLidTopMargin = 10; big.eyeNudgeDownPx = 10;
+  run("large", big, frames);
+  return 0;
+}
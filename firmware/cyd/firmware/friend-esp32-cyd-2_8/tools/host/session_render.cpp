@@ -0,0 +1,348 @@
+/*
+ * session_render.cpp — renders long face sessions to RGB frames on the host, through tools/host/pixels.h.
+ *
+ * First checks every SIMD kernel against the scalar reference on random runs (lengths, misalignment,
+ * sparse differences, run-length rows; bytes past the end must stay untouched) and times each kernel per ISA. Then runs
+ * the firmware's face (Eyes::update, the speech machine, the dizzy clip every few minutes) at 60 FPS:
+ * each frame's display list is composed into a 320x240 RGB565 frame (span fills, or with --indexed
+ * through a 4bpp Tiles::Shadow and ink expansion), clip frames are decoded over it, the frame is diffed
+ * against the previous one and only the changed range is converted to RGB888. --out writes the frames
+ * as raw rgb24 (ffmpeg -f rawvideo -pix_fmt rgb24 -s 320x240 -r 60 -i file.rgb out.mp4); --all runs
+ * the session once per ISA and path and checks the frames are identical.
+ *
+ *   g++ -std=gnu++17 -O2 -Itools/host/shim -Isrc tools/host/session_render.cpp -o session_render
+ *   ./session_render [--minutes 60] [--fps 60] [--isa scalar|sse2|avx2] [--indexed] [--out file.rgb] [--all]
+ */
+#include <Arduino.h>
+#include <LovyanGFX.hpp>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <stdlib.h>
+#include "face.h"
+#include "clip.h"
+#include "clips/dizzy.h"
+#include "speech.h"
+#include "pixels.h"
+
+static constexpr int      W = 320, H = 240;
+static constexpr uint32_t CLIP_EVERY_MS = 5 * 60 * 1000;   // a dizzy reaction this often
+static constexpr uint32_t CLIP_HOLD_MS  = 3000;            // as the firmware's "clip dizzy"
+static constexpr int      VERIFY_CASES  = 4000;
+
+static double nowS(){
+  using namespace std::chrono;
+  return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+static uint32_t rnd(uint32_t& s){ s ^= s << 13; s ^= s >> 17; s ^= s << 5; return s; }
+
+// Runs covering n pixels into `out` (Pix::rle's format): mostly short, some long enough for two-byte
+// varints, and a last run that may reach past n. Returns the bytes written.
+static int encodeRuns(uint8_t* out, int n, uint32_t& s){
+  uint8_t* p = out;
+  for (int x = 0; x < n; ) {
+    uint32_t len = rnd(s) % 8 ? 1 + rnd(s) % 12 : 1 + rnd(s) % 300;
+    if (x + (int)len > n && rnd(s) % 2) len = (uint32_t)(n - x);
+    for (uint32_t v = len - 1; ; v >>= 7) { *p++ = (uint8_t)((v & 0x7f) | (v > 0x7f ? 0x80 : 0)); if (v <= 0x7f) break; }
+    *p++ = (uint8_t)(rnd(s) % 16);
+    x += (int)len;
+  }
+  return (int)(p - out);
+}
+
+// ===== Kernel checks =====
+// Buffers carry a guard band on both sides; the checked range starts at a random misalignment.
+static int verify(const Pix::Kernels& k){
+  static constexpr int MAXN = 700, PAD = 64;
+  static uint16_t a[MAXN + 2 * PAD], b[MAXN + 2 * PAD], outR[MAXN + 2 * PAD], outK[MAXN + 2 * PAD];
+  static uint8_t  nib[MAXN / 2 + 2 * PAD], rgbR[3 * MAXN + 2 * PAD], rgbK[3 * MAXN + 2 * PAD], runs[3 * MAXN];
+  uint32_t s = 0x9e3779b9u;
+  int bad = 0;
+  uint16_t inks[16];
+  for (int c = 0; c < VERIFY_CASES; ++c) {
+    const int n = (int)(rnd(s) % MAXN) & ~(c & 1);   // odd cases keep n even for expand4
+    const int off = (int)(rnd(s) % 16);
+    for (auto& v : a) v = (uint16_t)rnd(s);
+    memcpy(b, a, sizeof(b));
+    const int flips = (int)(rnd(s) % 4 == 0 ? 0 : rnd(s) % 24);
+    for (int i = 0; i < flips && n; ++i) b[PAD + off + rnd(s) % n] ^= (uint16_t)(1u << (rnd(s) % 16));
+    if (n && c % 7 == 0) b[PAD + off + n - 1] ^= 1;   // differences at the very end too
+    for (auto& v : nib) v = (uint8_t)rnd(s);
+    for (auto& v : inks) v = (uint16_t)rnd(s);
+    Pix::Inks4 k4; Pix::prepare(k4, inks);
+    const uint16_t col = (uint16_t)rnd(s);
+
+    memcpy(outR, a, sizeof(outR)); memcpy(outK, a, sizeof(outK));
+    Pix::ref::fill(outR + PAD + off, n, col); k.fill(outK + PAD + off, n, col);
+    bad += memcmp(outR, outK, sizeof(outR)) != 0;
+
+    const int ne = n & ~1;
+    Pix::ref::expand4(outR + PAD + off, nib + PAD + off, ne, k4); k.expand4(outK + PAD + off, nib + PAD + off, ne, k4);
+    bad += memcmp(outR, outK, sizeof(outR)) != 0;
+
+    const int used = encodeRuns(runs, n, s);
+    bad += Pix::ref::rle(outR + PAD + off, n, runs, inks) != runs + used;
+    bad += k.rle(outK + PAD + off, n, runs, inks) != runs + used;
+    bad += memcmp(outR, outK, sizeof(outR)) != 0;
+
+    const Pix::Diff dr = Pix::ref::diff(a + PAD + off, b + PAD + off, n), dk = k.diff(a + PAD + off, b + PAD + off, n);
+    bad += dr.count != dk.count || dr.first != dk.first || dr.last != dk.last;
+
+    memset(rgbR, 0xa5, sizeof(rgbR)); memset(rgbK, 0xa5, sizeof(rgbK));
+    Pix::ref::rgb888(rgbR + PAD + off, a + PAD + off, n); k.rgb888(rgbK + PAD + off, a + PAD + off, n);
+    bad += memcmp(rgbR, rgbK, sizeof(rgbR)) != 0;
+  }
+  return bad;
+}
+
+// Frame-sized throughput of each kernel, in Mpx/s.
+static void timeKernels(const Pix::Kernels& k){
+  static uint16_t a[W * H], b[W * H];
+  static uint8_t  nib[W * H / 2], rgb[3 * W * H], runs[3 * W * H];
+  static int      rowAt[H + 1];
+  static constexpr int REPS = 400;
+  uint32_t s = 7;
+  for (int i = 0; i < W * H; ++i) a[i] = b[i] = (uint16_t)rnd(s);
+  for (auto& v : nib) v = (uint8_t)rnd(s);
+  for (int i = 0; i < W * H; i += 997) b[i] ^= 1;
+  uint16_t inks[16]; for (auto& v : inks) v = (uint16_t)rnd(s);
+  Pix::Inks4 k4; Pix::prepare(k4, inks);
+  for (int y = 0; y < H; ++y) rowAt[y + 1] = rowAt[y] + encodeRuns(runs + rowAt[y], W, s);
+
+  double t[5];
+  long check = 0;   // keeps the results live
+  double t0 = nowS();
+  for (int r = 0; r < REPS; ++r) for (int y = 0; y < H; ++y) k.fill(a + y * W, W, (uint16_t)(r + y));
+  t[0] = nowS() - t0; check += a[W * H / 2];
+  t0 = nowS();
+  for (int r = 0; r < REPS; ++r) for (int y = 0; y < H; ++y) k.expand4(a + y * W, nib + y * W / 2, W, k4);
+  t[1] = nowS() - t0; check += a[W * H / 2];
+  t0 = nowS();
+  for (int r = 0; r < REPS; ++r) for (int y = 0; y < H; ++y) k.rle(a + y * W, W, runs + rowAt[y], inks);
+  t[2] = nowS() - t0; check += a[W * H / 2];
+  t0 = nowS();
+  for (int r = 0; r < REPS; ++r) check += k.diff(a, b, W * H).count;
+  t[3] = nowS() - t0;
+  t0 = nowS();
+  for (int r = 0; r < REPS; ++r) { a[r] ^= 1; k.rgb888(rgb, a, W * H); check += rgb[3 * r]; }
+  t[4] = nowS() - t0;
+
+  const double px = (double)REPS * W * H / 1e6;
+  printf("%-7s %10.0f %10.0f %10.0f %10.0f %10.0f   (%ld)\n", Pix::ISA_NAMES[(int)k.isa], px / t[0], px / t[1], px / t[2],
+         px / t[3], px / t[4], check & 0xff);
+}
+
+// ===== Session =====
+struct Run {
+  Pix::Isa isa = Pix::Isa::Scalar;
+  bool     indexed = false;
+  double   minutes = 60;
+  int      fps = 60;
+  FILE*    out = nullptr;
+  bool     hash = false;
+};
+
+struct Result {
+  long     frames = 0, changed = 0, clipFrames = 0;
+  double   wall = 0, tBuild = 0, tCompose = 0, tDiff = 0, tRgb = 0, tWrite = 0;
+  uint64_t changedPx = 0;
+  uint64_t hash = 0;          // over every output frame, with Run::hash
+};
+
+// Panel stand-in for clip playback: fill(x, y, w, h, c) through the kernels.
+struct FrameSink {
+  const Pix::Kernels& k;
+  uint16_t* fb;
+  void fill(int x, int y, int w, int h, uint16_t c){
+    const int x0 = max(x, 0), x1 = min(x + w, W);
+    if (x0 >= x1) return;
+    for (int j = max(y, 0); j < min(y + h, H); ++j) k.fill(fb + j * W + x0, x1 - x0, c);
+  }
+};
+
+// The display list as RGB565: background, then each row's spans.
+static void composeSpans(const Pix::Kernels& k, const DList::List& dl, uint16_t bg, uint16_t* fb){
+  for (int y = 0; y < H; ++y) {
+    uint16_t* row = fb + y * W;
+    k.fill(row, W, bg);
+    for (const DList::Span* s = dl.rowBegin(y); s != dl.rowEnd(y); ++s) {
+      const int x0 = max((int)s->x0, 0), x1 = min((int)s->x1, W - 1);
+      if (x0 <= x1) k.fill(row + x0, x1 - x0 + 1, s->c);
+    }
+  }
+}
+
+// The same through the 4bpp shadow the tile renderer keeps: paint inks, expand each row.
+static void composeIndexed(const Pix::Kernels& k, const DList::List& dl, Tiles::Shadow& sh, Pix::Inks4& k4, uint16_t* fb){
+  Tiles::Inks inks;
+  Tiles::inksFromPalette(inks, Theme::palette());
+  if (memcmp(inks.rgb, sh.inks.rgb, sizeof(inks.rgb)) || inks.n != sh.inks.n) { sh.inks = inks; Pix::prepare(k4, inks.rgb); }
+  for (int y = 0; y < H; ++y) {
+    Tiles::paintRow(sh, dl, y);
+    k.expand4(fb + y * W, sh.px[y], W, k4);
+  }
+}
+
+static uint64_t fnv(uint64_t h, const uint8_t* p, size_t n){
+  const uint64_t* w = (const uint64_t*)p;
+  for (size_t i = 0; i < n / 8; ++i) h = (h ^ w[i]) * 1099511628211ull;
+  return h;
+}
+
+static Result session(const Run& run){
+  static Eyes::State eyes;
+  static DList::List list;
+  static Tiles::Shadow shadow;
+  static uint16_t fb[2][W * H];
+  static uint8_t rgb[3 * W * H];
+  const Pix::Kernels& k = Pix::kernels(run.isa);
+  Pix::Inks4 k4;
+  Result res;
+
+  Host::clockMs() = 0;
+  randomSeed(2024);
+  Theme::apply(Theme::OCEAN);
+  Eyes::init(eyes, Eyes::Layout());
+  Face::Mouth mouth;
+  mouth.baseY = 214; mouth.w = 117;
+  Speech::State speech;
+  Speech::enterSilent(speech, 0);
+  Clip::Player clip[2];
+  uint32_t clipUntilMs = 0, nextClipMs = CLIP_EVERY_MS;
+  shadow.inks = Tiles::Inks();
+  memset(fb, 0, sizeof(fb));
+  memset(rgb, 0, sizeof(rgb));
+  int cur = 0;
+
+  const long frames = (long)(run.minutes * 60 * run.fps);
+  const double start = nowS();
+  for (long f = 0; f < frames; ++f) {
+    const uint32_t now = (uint32_t)((uint64_t)f * 1000 / run.fps);
+    Host::clockMs() = now;
+
+    // mouth as the firmware's showSpeech sets it
+    switch (Speech::tick(speech, now)) {
+      case Speech::Event::Silent:
+        mouth.frame = &moodToFrame(speech.mood); mouth.style = Face::LIPS_JOIN; break;
+      case Speech::Event::Talking:
+      case Speech::Event::Swap:
+        mouth.frame = &TALK_FRAMES[speech.talkIdx];
+        mouth.style = Face::LIPS_JOIN | Face::LIPS_CAVITY | Face::LIPS_TEETH;
+        break;
+      case Speech::Event::None: break;
+    }
+    Eyes::update(eyes, 1.f / run.fps);
+    if (now >= nextClipMs) {
+      const Eyes::Eye* e[2] = { &eyes.L, &eyes.R };
+      for (int i = 0; i < 2; ++i) {
+        Clip::start(clip[i], CLIP_DIZZY, sizeof(CLIP_DIZZY), 0, 0, now, true);
+        clip[i].ox = (int16_t)(e[i]->cx - clip[i].clip.w / 2);
+        clip[i].oy = (int16_t)(e[i]->cy - clip[i].clip.h / 2);
+      }
+      clipUntilMs = now + CLIP_HOLD_MS;
+      nextClipMs += CLIP_EVERY_MS;
+    }
+
+    uint16_t* frame = fb[cur];
+    const uint16_t* prev = fb[cur ^ 1];
+    double t0 = nowS(), t1;
+    if (clip[0].active) {
+      // clips draw over what the panel showed, like the firmware
+      memcpy(frame, prev, sizeof(fb[0]));
+      t1 = nowS(); res.tBuild += t1 - t0; t0 = t1;
+      FrameSink sink{ k, frame };
+      for (auto& pl : clip) Clip::tick(pl, now, sink);
+      if (now >= clipUntilMs) for (auto& pl : clip) pl.active = false;
+      ++res.clipFrames;
+    } else {
+      Face::build(list, eyes, mouth, nullptr, W, H);
+      t1 = nowS(); res.tBuild += t1 - t0; t0 = t1;
+      if (run.indexed) composeIndexed(k, list, shadow, k4, frame);
+      else composeSpans(k, list, Theme::palette().bg, frame);
+    }
+    t1 = nowS(); res.tCompose += t1 - t0; t0 = t1;
+
+    const Pix::Diff d = k.diff(frame, prev, W * H);
+    t1 = nowS(); res.tDiff += t1 - t0; t0 = t1;
+    if (d.count || f == 0) {
+      const int a = f ? d.first : 0, b = f ? d.last : W * H - 1;
+      k.rgb888(rgb + 3 * a, frame + a, b - a + 1);
+      ++res.changed; res.changedPx += d.count;
+    }
+    t1 = nowS(); res.tRgb += t1 - t0; t0 = t1;
+    if (run.out) fwrite(rgb, sizeof(rgb), 1, run.out);
+    if (run.hash) res.hash = fnv(res.hash ^ (uint64_t)f, rgb, sizeof(rgb));
+    res.tWrite += nowS() - t0;
+    cur ^= 1;
+    ++res.frames;
+  }
+  res.wall = nowS() - start;
+  return res;
+}
+
+static void report(const Run& run, const Result& r){
+  printf("%-7s %-7s %8ld %8ld %7.1f%% %8.2f %8.2f %8.2f %8.2f %8.2f %8.2f\n", Pix::ISA_NAMES[(int)run.isa],
+         run.indexed ? "indexed" : "spans", r.frames, r.changed, 100.0 * r.changed / max(r.frames, 1L), r.wall,
+         r.tBuild, r.tCompose, r.tDiff, r.tRgb, r.tWrite);
+}
+
+static const char* const SESSION_HEADER = "%-7s %-7s %8s %8s %8s %8s %8s %8s %8s %8s %8s\n";
+
+int main(int argc, char** argv){
+  Run run;
+  run.isa = Pix::best().isa;
+  const char* outPath = nullptr;
+  bool all = false;
+  for (int i = 1; i < argc; ++i) {
+    const std::string a = argv[i];
+    const bool more = i + 1 < argc;
+    if (a == "--minutes" && more) run.minutes = atof(argv[++i]);
+    else if (a == "--fps" && more) run.fps = atoi(argv[++i]);
+    else if (a == "--indexed") run.indexed = true;
+    else if (a == "--out" && more) outPath = argv[++i];
+    else if (a == "--all") all = true;
+    else if (a == "--isa" && more) {
+      const std::string n = argv[++i];
+      int k = 0;
+      while (k < Pix::NUM_ISAS && n != Pix::ISA_NAMES[k]) ++k;
+      if (k == Pix::NUM_ISAS || !Pix::supported((Pix::Isa)k)) { fprintf(stderr, "isa %s not available\n", n.c_str()); return 2; }
+      run.isa = (Pix::Isa)k;
+    }
+    else { fprintf(stderr, "usage: %s [--minutes M] [--fps N] [--isa scalar|sse2|avx2] [--indexed] [--out file.rgb] [--all]\n", argv[0]); return 2; }
+  }
+  if (run.fps < 1 || run.minutes <= 0 || run.minutes > 24 * 60) { fprintf(stderr, "need --fps >= 1 and 0 < --minutes <= 1440\n"); return 2; }
+
+  printf("kernel check against scalar, %d random cases each:\n", VERIFY_CASES);
+  int failures = 0;
+  for (int i = 1; i < Pix::NUM_ISAS; ++i) {
+    if (!Pix::supported((Pix::Isa)i)) { printf("  %-7s not supported here\n", Pix::ISA_NAMES[i]); continue; }
+    const int bad = verify(Pix::kernels((Pix::Isa)i));
+    printf("  %-7s %s\n", Pix::ISA_NAMES[i], bad ? "MISMATCH" : "bit-exact");
+    failures += bad;
+  }
+  printf("\nMpx/s   %10s %10s %10s %10s %10s\n", "fill", "expand4", "rle", "diff", "rgb888");
+  for (int i = 0; i < Pix::NUM_ISAS; ++i) if (Pix::supported((Pix::Isa)i)) timeKernels(Pix::kernels((Pix::Isa)i));
+
+  printf("\n%.0f min at %d FPS; seconds per stage:\n", run.minutes, run.fps);
+  printf(SESSION_HEADER, "isa", "path", "frames", "changed", "%", "wall", "build", "compose", "diff", "rgb888", "write");
+  if (all) {
+    uint64_t want = 0;
+    for (int i = 0; i < Pix::NUM_ISAS; ++i) {
+      if (!Pix::supported((Pix::Isa)i)) continue;
+      for (int idx = 0; idx < 2; ++idx) {
+        Run r = run; r.isa = (Pix::Isa)i; r.indexed = idx; r.hash = true;
+        const Result res = session(r);
+        report(r, res);
+        if (!want) want = res.hash;
+        else if (res.hash != want) { printf("  frames differ from the first run\n"); ++failures; }
+      }
+    }
+    if (!failures) printf("all runs produced identical frames\n");
+  } else {
+    if (outPath && !(run.out = fopen(outPath, "wb"))) { perror(outPath); return 1; }
+    report(run, session(run));
+    if (run.out) fclose(run.out);
+  }
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,99 @@
+/*
+ * shape_bench.cpp — host benchmark of the SDF eye outlines (src/sdf.h).
+ *
+ * For each shape: samples, table edge storage and host time of a full raster at the stock eye
+ * radius, and how far its table is from the float disc builder (circle only). For each pair of
+ * shapes: a full morph driven through Eyes::update at 40 FPS, reporting samples per frame (bounded
+ * by Sdf::EVAL_BUDGET plus one row) and how many blends reached the screen.
+ *
+ *   g++ -std=gnu++17 -O2 -Itools/host/shim -Isrc tools/host/shape_bench.cpp -o shape_bench
+ *   ./shape_bench [show <kind 0-4>]
+ */
+#include <Arduino.h>
+#include <LovyanGFX.hpp>
+#include <chrono>
+#include <stdlib.h>
+#include "eyes.h"
+
+static const char* const KIND_NAMES[Sdf::NUM_KINDS] = { "circle", "rrect", "squint", "heart", "star" };
+static constexpr int FRAME_MS = 1000 / Eyes::FPS_DEFAULT;
+
+static double nowUs(){
+  using namespace std::chrono;
+  return duration<double, std::micro>(steady_clock::now().time_since_epoch()).count();
+}
+
+static void show(const Coverage::Table& tb){
+  static const char SHADES[] = " .:-=+*#%@";
+  for (int i = 0; i < tb.rows; ++i) {
+    const Coverage::Row& r = tb.row[i];
+    for (int dx = -tb.half; dx <= tb.half; ++dx) {
+      const int t = (r.x0 <= r.x1) ? tb.t(r, dx) : 0;
+      putchar(SHADES[t * 9 / Coverage::FULL]); putchar(SHADES[t * 9 / Coverage::FULL]);
+    }
+    putchar('\n');
+  }
+}
+
+int main(int argc, char** argv){
+  const Eyes::Layout lay;
+  static Coverage::Table tb, ref;
+
+  if (argc > 2 && !strcmp(argv[1], "show")) {
+    Sdf::Raster j; Sdf::Morph m;
+    m.from.kind = m.to.kind = (Sdf::Kind)constrain(atoi(argv[2]), 0, Sdf::NUM_KINDS - 1);
+    Sdf::start(j, tb, m, lay.rWhite); Sdf::step(j, UINT32_MAX);
+    show(tb);
+    return 0;
+  }
+
+  printf("%-8s %8s %6s %8s %9s\n", "shape", "samples", "edge", "host_us", "vs_disc");
+  for (int k = 0; k < Sdf::NUM_KINDS; ++k) {
+    Sdf::Raster j; Sdf::Morph m;
+    m.from.kind = m.to.kind = (Sdf::Kind)k;
+    const double t0 = nowUs();
+    Sdf::start(j, tb, m, lay.rWhite); Sdf::step(j, UINT32_MAX);
+    const double us = nowUs() - t0;
+    int diff = -1;
+    if (k == 0) {
+      Coverage::build(ref, lay.rWhite + 0.5f, lay.rWhite - 0.5f);
+      diff = 0;
+      for (int dy = -tb.half; dy <= tb.half; ++dy)
+        for (int dx = -tb.half; dx <= tb.half; ++dx) {
+          const Coverage::Row* a = tb.at(dy); const Coverage::Row* b = ref.at(dy);
+          const int ta = (a && a->x0 <= a->x1) ? tb.t(*a, dx) : 0, tr = (b && b->x0 <= b->x1) ? ref.t(*b, dx) : 0;
+          diff += abs(ta - tr) > 1;
+        }
+    }
+    printf("%-8s %8u %6d %8.0f %9d\n", KIND_NAMES[k], (unsigned)j.evals, tb.used, us, diff);
+  }
+
+  printf("\n%-15s %7s %9s %9s %7s\n", "morph", "frames", "max_smpl", "mean_smpl", "blends");
+  static Eyes::State s;
+  for (int a = 0; a < Sdf::NUM_KINDS; ++a) {
+    for (int b = 0; b < Sdf::NUM_KINDS; ++b) {
+      if (a == b) continue;
+      Host::clockMs() = 1000;
+      randomSeed(7);
+      Eyes::init(s, lay);
+      Sdf::Shape from; from.kind = (Sdf::Kind)a;
+      Sdf::Shape to;   to.kind   = (Sdf::Kind)b;
+      Eyes::setShape(s, from, 0);
+      for (int f = 0; f < 8; ++f) { Host::advanceMs(FRAME_MS); Eyes::update(s, FRAME_MS / 1000.f); }
+      Eyes::setShape(s, to);
+      uint32_t maxS = 0, sumS = 0; int frames = 0, blends = 0;
+      while (s.shape.frames && frames < 200) {
+        const uint8_t front = s.edges.front;
+        Host::advanceMs(FRAME_MS);
+        Eyes::update(s, FRAME_MS / 1000.f);
+        const uint32_t n = s.shape.job.busy || s.edges.front != front ? s.shape.job.evalsLast : 0;
+        maxS = max(maxS, n); sumS += n; ++frames;
+        blends += s.edges.front != front;
+      }
+      char name[32];
+      snprintf(name, sizeof(name), "%s>%s", KIND_NAMES[a], KIND_NAMES[b]);
+      printf("%-15s %7d %9u %9u %7d\n", name, frames, (unsigned)maxS, (unsigned)(frames ? sumS / frames : 0), blends);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,46 @@
+#pragma once
+// Host stand-in for the Arduino core: just what the header-only face modules use, with a clock the
+// host program advances itself so runs are deterministic.
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+
+using std::min;
+using std::max;
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+// Per thread, so simulators can run independent faces on a thread pool.
+namespace Host {
+inline uint32_t& clockMs(){ static thread_local uint32_t t = 0; return t; }
+inline uint32_t& rngState(){ static thread_local uint32_t s = 1; return s; }
+inline void advanceMs(uint32_t ms){ clockMs() += ms; }
+} // namespace Host
+
+inline uint32_t millis(){ return Host::clockMs(); }
+inline uint32_t micros(){ return Host::clockMs() * 1000u; }
+inline void randomSeed(uint32_t seed){ Host::rngState() = seed ? seed : 1; }
+inline long random(long hi){
+  uint32_t& s = Host::rngState();
+  s ^= s << 13; s ^= s >> 17; s ^= s << 5;   // xorshift32
+  return hi > 0 ? (long)(s % (uint32_t)hi) : 0;
+}
+inline long random(long lo, long hi){ return hi > lo ? lo + random(hi - lo) : lo; }
+inline int xPortGetCoreID(){ return 1; }
+
+class Print {
+public:
+  virtual ~Print() = default;
+  virtual size_t write(const uint8_t* p, size_t n){ return fwrite(p, 1, n, stdout); }   // stdout, unless overridden
+  void printf(const char* fmt, ...){
+    char buf[512];
+    va_list ap; va_start(ap, fmt); const int n = vsnprintf(buf, sizeof(buf), fmt, ap); va_end(ap);
+    if (n > 0) write((const uint8_t*)buf, min((size_t)n, sizeof(buf) - 1));
+  }
+};
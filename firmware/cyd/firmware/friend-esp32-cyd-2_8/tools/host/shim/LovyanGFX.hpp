@@ -0,0 +1,23 @@
+#pragma once
+// Host stand-in for LovyanGFX: colour constants and a panel that accepts and discards drawing.
+#include <stdint.h>
+
+#define TFT_BLACK    0x0000
+#define TFT_WHITE    0xFFFF
+#define TFT_DARKGREY 0x7BEF
+
+namespace lgfx { struct rgb565_t { uint16_t raw; }; }
+
+class LGFX {
+public:
+  int  width()  const { return 320; }
+  int  height() const { return 240; }
+  void startWrite(){}
+  void endWrite(){}
+  void waitDMA(){}
+  void drawFastHLine(int, int, int, uint16_t){}
+  void fillRect(int, int, int, int, uint16_t){}
+  void pushImage(int, int, int, int, const lgfx::rgb565_t*){}
+  void writeCommand(uint8_t){}
+  void writeData16(uint16_t){}
+};
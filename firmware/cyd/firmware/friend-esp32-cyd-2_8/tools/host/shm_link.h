@@ -0,0 +1,80 @@
+#pragma once
+// Host only: the face link over POSIX shared memory instead of a serial port. A segment holds two
+// Link::Rings, one each way; each side encodes frames in place in its TX ring with the Msg::send*
+// helpers and reads the other side's frames in place with Msg::view, exactly as on the wire, minus
+// the byte stream (no Link::Rx, no UART). The rings are SPSC and already publish with acquire/release,
+// so two processes can share them as they are.
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <new>
+#include "link_msgs.h"
+
+namespace Shm {
+
+static constexpr uint32_t MAGIC = 0x4b4e4c46;   // "FLNK", written last by create()
+
+struct Segment {
+  uint32_t   magic = 0;
+  uint16_t   schema = 0;                 // Msg::SCHEMA of the creator
+  uint32_t   faceUp = 0, stop = 0;       // set by the face when it polls / by the host when it is done
+  Link::Ring toFace, toHost;
+};
+
+static Segment* map(int fd){
+  void* p = mmap(nullptr, sizeof(Segment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  close(fd);
+  return p == MAP_FAILED ? nullptr : static_cast<Segment*>(p);
+}
+
+// A fresh segment named `name` ("/face-link"); an old one by that name is replaced.
+static Segment* create(const char* name){
+  shm_unlink(name);
+  const int fd = shm_open(name, O_CREAT | O_EXCL | O_RDWR, 0600);
+  if (fd < 0) return nullptr;
+  if (ftruncate(fd, sizeof(Segment))) { close(fd); return nullptr; }
+  Segment* s = map(fd);
+  if (!s) return nullptr;
+  new (s) Segment();
+  s->schema = Msg::SCHEMA;
+  __atomic_store_n(&s->magic, MAGIC, __ATOMIC_RELEASE);
+  return s;
+}
+
+// The segment another process created, once it is ready; nullptr if it does not show up within
+// waitMs or was built from another schema.
+static Segment* attach(const char* name, uint32_t waitMs){
+  for (uint32_t t = 0; ; t += 10) {
+    const int fd = shm_open(name, O_RDWR, 0);
+    struct stat st;
+    if (fd >= 0 && !fstat(fd, &st) && (size_t)st.st_size >= sizeof(Segment)) {
+      Segment* s = map(fd);
+      if (!s) return nullptr;
+      while (__atomic_load_n(&s->magic, __ATOMIC_ACQUIRE) != MAGIC && t < waitMs) { usleep(10000); t += 10; }
+      if (s->magic == MAGIC && s->schema == Msg::SCHEMA) return s;
+      munmap(s, sizeof(Segment));
+      return nullptr;
+    }
+    if (fd >= 0) close(fd);
+    if (t >= waitMs) return nullptr;
+    usleep(10000);
+  }
+}
+
+static void detach(Segment* s){ if (s) munmap(s, sizeof(Segment)); }
+
+// Every whole frame waiting in `rx`, read in place: onFrame(p, n) for good ones. Returns frames read.
+template <class F>
+static int poll(Link::Ring& rx, F&& onFrame, uint32_t* bad = nullptr){
+  const uint8_t* p;
+  int k = 0;
+  for (size_t n; (n = Link::next(rx, p, Msg::FRAME_SIZE)); ++k) {
+    if (Link::check(p, n, Msg::FRAME_SIZE)) onFrame(p, n);
+    else if (bad) ++*bad;
+    Link::consume(rx, n);
+  }
+  return k;
+}
+
+} // namespace Shm
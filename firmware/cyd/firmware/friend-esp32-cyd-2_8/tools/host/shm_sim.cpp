@@ -0,0 +1,341 @@
+/*
+ * shm_sim.cpp — scripted conversations between a host and a simulated face over shared memory
+ * (tools/host/shm_link.h), with the link messages of src/link_msgs.h and none of the UART/USB timing.
+ *
+ * The face runs the firmware's pieces at 40 FPS: at the start of each frame it reads the host's frames
+ * in place and answers them as main_full's onLinkFrame does (Ping -> Pong, and Hello for seq 0; Mood,
+ * Sleep and Say -> Ack, with Mood refused during lip sync), then Viseme / Speech, Eyes::update and
+ * Face::build, then Shown for the last command once its frame is built. With --fast (the default) the
+ * frames run back to back on a virtual clock; --realtime paces them at 25 ms.
+ *
+ * The host runs conversations from a seeded script: a Ping with seq 0 (the Hello must carry this
+ * build's Msg::SCHEMA), then turns of Mood and Say, pinging until the face's clock says the speech is
+ * over, then Sleep and wake. Every command must be acked OK and shown, with nothing dropped. Reports
+ * conversations per minute and, as wall-clock percentiles, protocol latency (Ping -> Pong) and
+ * application latency (command -> Ack, command -> Shown). Exits nonzero on any failure.
+ *
+ * By default one process creates the segment and forks the face; --face / --host run one side each
+ * (start the host first, it creates the segment).
+ *
+ *   g++ -std=gnu++17 -O2 -Itools/host/shim -Isrc tools/host/shm_sim.cpp -o shm_sim -lrt
+ *   ./shm_sim [--conversations 500] [--seed 1] [--realtime] [--timeout 2000] [--face|--host] [--name /face-link]
+ */
+#include <Arduino.h>
+#include <LovyanGFX.hpp>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include <signal.h>
+#include <stdlib.h>
+#include <sys/wait.h>
+#include "face.h"
+#include "speech.h"
+#include "viseme.h"
+#include "shm_link.h"
+
+static constexpr int      W = 320, H = 240;
+static constexpr uint32_t FRAME_MS = 1000 / Eyes::FPS_DEFAULT;
+static constexpr uint32_t MS_PER_CHAR = 60;   // the host's speech length for a line
+
+static const char* const LINES[] = {
+  "Hello there!", "What would you like to do today?", "It is sunny and twenty one degrees.",
+  "Your timer is set for ten minutes.", "I did not catch that, could you say it again?",
+  "Playing some quiet music.", "Good night, sleep well.", "The kettle should be ready by now.",
+};
+static constexpr int NUM_LINES = sizeof(LINES) / sizeof(LINES[0]);
+
+static uint64_t wallUs(){
+  using namespace std::chrono;
+  return (uint64_t)duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+static uint32_t g_rng = 1;
+static uint32_t rnd(){ g_rng ^= g_rng << 13; g_rng ^= g_rng >> 17; g_rng ^= g_rng << 5; return g_rng; }
+
+// ===== Face =====
+struct FaceSim {
+  Link::Ring*  rx;
+  Link::Ring*  tx;
+  uint16_t     seq = 0;
+  Eyes::State  eyes;
+  Face::Mouth  mouth;
+  Speech::State speech;
+  Viseme::Track lips;
+  bool         asleep = false;
+  uint8_t      shownId = 0;
+  uint16_t     shownSeq = 0;
+  uint32_t     frames = 0, bad = 0;
+};
+
+static void mouthMood(FaceSim& f){ f.mouth.frame = &moodToFrame(f.speech.mood); f.mouth.style = Face::LIPS_JOIN; }
+static void mouthTalk(FaceSim& f, int idx){
+  f.mouth.frame = &TALK_FRAMES[(idx % NUM_TALK_FRAMES + NUM_TALK_FRAMES) % NUM_TALK_FRAMES];
+  f.mouth.style = Face::LIPS_JOIN | Face::LIPS_CAVITY | Face::LIPS_TEETH;
+}
+
+// As main_full's onLinkFrame.
+static void onFrame(FaceSim& f, const uint8_t* p, size_t n){
+  const Link::Header& h = *reinterpret_cast<const Link::Header*>(p);
+  uint8_t status = Msg::ACK_OK;
+  if (const Msg::Ping* m = Msg::view<Msg::Ping>(p, n)) {
+    if (!h.seq) Msg::sendHello(*f.tx, f.seq++, Msg::APP_FACE, Msg::SCHEMA, Link::MAX_FRAME);
+    Msg::sendPong(*f.tx, h.seq, m->hostUs, micros());
+    return;
+  } else if (const Msg::Mood* m = Msg::view<Msg::Mood>(p, n)) {
+    if (m->mood <= (uint8_t)MouthMood::Oooh && !f.lips.active) {
+      Speech::enterSilent(f.speech, millis());
+      f.speech.mood = (MouthMood)m->mood;
+      mouthMood(f);
+    } else status = Msg::ACK_REFUSED;
+  } else if (const Msg::Sleep* m = Msg::view<Msg::Sleep>(p, n)) {
+    f.asleep = m->on;
+  } else if (const Msg::Say* m = Msg::view<Msg::Say>(p, n)) {
+    char text[sizeof(m->text) + 1];
+    memcpy(text, m->text, sizeof(m->text)); text[sizeof(m->text)] = 0;
+    if (Viseme::begin(f.lips, text, m->durMs, millis())) mouthTalk(f, Viseme::frame(f.lips));
+  } else {
+    status = Msg::ACK_UNSUPPORTED;
+  }
+  Msg::sendAck(*f.tx, f.seq++, h.id, status, h.seq);
+  if (status == Msg::ACK_OK) { f.shownId = h.id; f.shownSeq = h.seq; }
+}
+
+static void faceFrame(FaceSim& f, DList::List& list){
+  Shm::poll(*f.rx, [&](const uint8_t* p, size_t n){ onFrame(f, p, n); }, &f.bad);
+  ++f.frames;
+  if (!f.asleep) {
+    const uint32_t now = millis();
+    if (f.lips.active) {
+      if (Viseme::tick(f.lips, now)) {
+        if (f.lips.active) mouthTalk(f, Viseme::frame(f.lips));
+        else { Speech::enterSilent(f.speech, now); mouthMood(f); }
+      }
+    } else {
+      switch (Speech::tick(f.speech, now)) {
+        case Speech::Event::Silent: mouthMood(f); break;
+        case Speech::Event::Talking:
+        case Speech::Event::Swap: mouthTalk(f, f.speech.talkIdx); break;
+        case Speech::Event::None: break;
+      }
+    }
+    Eyes::update(f.eyes, FRAME_MS / 1000.f);
+    Face::build(list, f.eyes, f.mouth, nullptr, W, H);
+  }
+  if (f.shownId) {
+    Msg::sendShown(*f.tx, f.seq++, f.shownId, f.shownSeq, micros());
+    f.shownId = 0;
+  }
+}
+
+// Until the host sets stop. Returns the frames run.
+static uint32_t runFace(Shm::Segment* s, bool realtime){
+  static FaceSim f;
+  static DList::List list;
+  f.rx = &s->toFace; f.tx = &s->toHost;
+  Host::clockMs() = 0;
+  randomSeed(2024);
+  Theme::apply(Theme::OCEAN);
+  Eyes::init(f.eyes, Eyes::Layout());
+  f.mouth.baseY = 214; f.mouth.w = 117;
+  Speech::enterSilent(f.speech, 0);
+  mouthMood(f);
+  __atomic_store_n(&s->faceUp, 1, __ATOMIC_RELEASE);
+  const auto start = std::chrono::steady_clock::now();
+  while (!__atomic_load_n(&s->stop, __ATOMIC_ACQUIRE)) {
+    faceFrame(f, list);
+    Host::advanceMs(FRAME_MS);
+    if (realtime) std::this_thread::sleep_until(start + std::chrono::milliseconds(Host::clockMs()));
+    else std::this_thread::yield();   // one core: lets the host in after every frame
+  }
+  if (f.bad) fprintf(stderr, "face: %u bad frames\n", f.bad);
+  return f.frames;
+}
+
+// ===== Host =====
+struct Stats {
+  std::vector<double> rtt, ack, shown;   // us
+  uint32_t conversations = 0, commands = 0, pings = 0, failures = 0;
+};
+
+struct HostSim {
+  Link::Ring* tx;
+  Link::Ring* rx;
+  uint32_t    timeoutMs;
+  uint16_t    seq = 0;
+  // what came back for the request in flight
+  bool        gotHello, gotPong, gotAck, gotShown;
+  uint16_t    helloSchema;
+  uint8_t     ackStatus;
+  uint32_t    rttUs, pongDeviceUs, shownDeviceUs;
+  uint64_t    ackUs, shownUs;
+  uint32_t    bad = 0;
+};
+
+static void fail(Stats& st, const char* what, uint16_t seq){
+  if (st.failures++ < 10) fprintf(stderr, "conversation %u: %s (seq %u)\n", st.conversations, what, seq);
+}
+
+// Reads replies until `done` holds or the timeout passes; false on timeout.
+template <class Done>
+static bool await(HostSim& h, uint16_t seq, uint8_t cmd, Done done){
+  const uint64_t until = wallUs() + (uint64_t)h.timeoutMs * 1000;
+  for (uint32_t spins = 0; !done(); ++spins) {
+    Shm::poll(*h.rx, [&](const uint8_t* p, size_t n){
+      const uint64_t now = wallUs();
+      if (const Msg::Hello* m = Msg::view<Msg::Hello>(p, n)) { h.gotHello = true; h.helloSchema = m->schema; }
+      else if (const Msg::Pong* m = Msg::view<Msg::Pong>(p, n)) {
+        if (m->h.seq == seq) { h.gotPong = true; h.pongDeviceUs = m->deviceUs; h.rttUs = (uint32_t)now - m->hostUs; }
+      } else if (const Msg::Ack* m = Msg::view<Msg::Ack>(p, n)) {
+        if (m->cmd == cmd && m->cmdSeq == seq) { h.gotAck = true; h.ackStatus = m->status; h.ackUs = now; }
+      } else if (const Msg::Shown* m = Msg::view<Msg::Shown>(p, n)) {
+        if (m->cmd == cmd && m->cmdSeq == seq) { h.gotShown = true; h.shownDeviceUs = m->deviceUs; h.shownUs = now; }
+      }
+    }, &h.bad);
+    if (done()) break;
+    if (wallUs() > until) return false;
+    if (spins > 16) std::this_thread::yield();
+  }
+  return true;
+}
+
+static void clearReplies(HostSim& h){ h.gotHello = h.gotPong = h.gotAck = h.gotShown = false; }
+
+// Seq 0 is kept for the hello ping.
+static uint16_t nextSeq(HostSim& h){ if (!++h.seq) ++h.seq; return h.seq; }
+
+// A Ping; returns the face's clock from the Pong (0 on failure).
+static uint32_t ping(HostSim& h, Stats& st, bool hello){
+  clearReplies(h);
+  const uint16_t seq = hello ? 0 : nextSeq(h);
+  if (!Msg::sendPing(*h.tx, seq, (uint32_t)wallUs())) { fail(st, "toFace ring full", seq); return 0; }
+  ++st.pings;
+  if (!await(h, seq, Msg::PING, [&]{ return h.gotPong && (!hello || h.gotHello); })) { fail(st, "no Pong", seq); return 0; }
+  st.rtt.push_back((double)h.rttUs);
+  if (hello && h.helloSchema != Msg::SCHEMA) { fail(st, "Hello from another schema", seq); return 0; }
+  return max<uint32_t>(h.pongDeviceUs, 1);
+}
+
+// Sends one command (built by `send` with the given seq); it must be acked OK and shown.
+template <class Send>
+static uint32_t command(HostSim& h, Stats& st, uint8_t cmd, Send send){
+  clearReplies(h);
+  const uint16_t seq = nextSeq(h);
+  const uint64_t t0 = wallUs();
+  if (!send(seq)) { fail(st, "toFace ring full", seq); return 0; }
+  ++st.commands;
+  if (!await(h, seq, cmd, [&]{ return h.gotAck && (h.ackStatus != Msg::ACK_OK || h.gotShown); })) {
+    fail(st, h.gotAck ? "not shown" : "no Ack", seq); return 0;
+  }
+  if (h.ackStatus != Msg::ACK_OK) { fail(st, Msg::NAMES[cmd], seq); return 0; }
+  st.ack.push_back((double)(h.ackUs - t0));
+  st.shown.push_back((double)(h.shownUs - t0));
+  return h.shownDeviceUs;
+}
+
+static void conversation(HostSim& h, Stats& st){
+  const uint32_t failures = st.failures;
+  if (!ping(h, st, true)) return;
+  const int turns = 2 + (int)(rnd() % 4);
+  for (int t = 0; t < turns && st.failures == failures; ++t) {
+    const uint8_t mood = (uint8_t)(rnd() % 5);
+    if (!command(h, st, Msg::MOOD, [&](uint16_t seq){ return Msg::sendMood(*h.tx, seq, mood); })) return;
+    const char* line = LINES[rnd() % NUM_LINES];
+    const uint16_t durMs = (uint16_t)(strlen(line) * MS_PER_CHAR);
+    const uint32_t shownUs = command(h, st, Msg::SAY, [&](uint16_t seq){ return Msg::sendSay(*h.tx, seq, durMs, line); });
+    if (!shownUs) return;
+    // the host plays the audio meanwhile; nothing is heard by the face, so its lips run open loop
+    const uint32_t endUs = shownUs + (Viseme::WAIT_MS + durMs + 2 * FRAME_MS) * 1000u;
+    for (uint32_t dev; (int32_t)((dev = ping(h, st, false)) - endUs) < 0; ) if (!dev) return;
+  }
+  if (st.failures != failures) return;
+  if (!command(h, st, Msg::SLEEP, [&](uint16_t seq){ return Msg::sendSleep(*h.tx, seq, 1); })) return;
+  if (!command(h, st, Msg::SLEEP, [&](uint16_t seq){ return Msg::sendSleep(*h.tx, seq, 0); })) return;
+}
+
+static double pct(std::vector<double>& v, double p){
+  if (v.empty()) return 0;
+  const size_t i = min(v.size() - 1, (size_t)(p * v.size()));
+  std::nth_element(v.begin(), v.begin() + i, v.end());
+  return v[i];
+}
+
+static void latency(const char* what, std::vector<double>& v){
+  if (v.empty()) { printf("%-24s -\n", what); return; }
+  double sum = 0; for (double x : v) sum += x;
+  printf("%-24s n %7zu  mean %7.1f  p50 %7.1f  p95 %7.1f  p99 %7.1f  max %8.1f us\n", what, v.size(), sum / v.size(),
+         pct(v, 0.50), pct(v, 0.95), pct(v, 0.99), *std::max_element(v.begin(), v.end()));
+}
+
+static int runHost(Shm::Segment* s, uint32_t conversations, uint32_t timeoutMs){
+  HostSim h;
+  h.tx = &s->toFace; h.rx = &s->toHost; h.timeoutMs = timeoutMs;
+  Stats st;
+  for (uint32_t t = 0; !__atomic_load_n(&s->faceUp, __ATOMIC_ACQUIRE); t += 10) {
+    if (t > timeoutMs) { fprintf(stderr, "no face on the segment\n"); return 1; }
+    usleep(10000);
+  }
+  const uint64_t t0 = wallUs();
+  for (; st.conversations < conversations; ++st.conversations) conversation(h, st);
+  const double secs = (wallUs() - t0) / 1e6;
+  __atomic_store_n(&s->stop, 1, __ATOMIC_RELEASE);
+
+  printf("%u conversations in %.2f s (%.0f per minute): %u commands, %u pings, %u failures\n",
+         st.conversations, secs, st.conversations * 60.0 / secs, st.commands, st.pings, st.failures);
+  latency("protocol Ping->Pong", st.rtt);
+  latency("command->Ack", st.ack);
+  latency("command->Shown", st.shown);
+  printf("rings: to face %u frames, %u dropped; to host %u frames, %u dropped, %u bad\n",
+         s->toFace.frames, s->toFace.dropped, s->toHost.frames, s->toHost.dropped, h.bad);
+  return st.failures || s->toFace.dropped || s->toHost.dropped || h.bad ? 1 : 0;
+}
+
+int main(int argc, char** argv){
+  uint32_t conversations = 500, timeoutMs = 2000;
+  bool realtime = false, faceOnly = false, hostOnly = false;
+  std::string name = "/face-link";
+  for (int i = 1; i < argc; ++i) {
+    const std::string a = argv[i];
+    if (a == "--conversations" && i + 1 < argc) conversations = (uint32_t)atoi(argv[++i]);
+    else if (a == "--seed" && i + 1 < argc) g_rng = (uint32_t)max(1, atoi(argv[++i]));
+    else if (a == "--timeout" && i + 1 < argc) timeoutMs = (uint32_t)atoi(argv[++i]);
+    else if (a == "--name" && i + 1 < argc) name = argv[++i];
+    else if (a == "--realtime") realtime = true;
+    else if (a == "--fast") realtime = false;
+    else if (a == "--face") faceOnly = true;
+    else if (a == "--host") hostOnly = true;
+    else {
+      fprintf(stderr, "usage: %s [--conversations N] [--seed S] [--realtime] [--timeout MS] [--face|--host] [--name /shm]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  if (faceOnly) {
+    Shm::Segment* s = Shm::attach(name.c_str(), timeoutMs);
+    if (!s) { fprintf(stderr, "no segment %s from this schema (0x%04x)\n", name.c_str(), Msg::SCHEMA); return 1; }
+    printf("face: %u frames\n", runFace(s, realtime));
+    Shm::detach(s);
+    return 0;
+  }
+
+  Shm::Segment* s = Shm::create(name.c_str());
+  if (!s) { perror("shm"); return 1; }
+  printf("schema 0x%04x, segment %s: %zu bytes, two %d-byte rings; face at %u FPS, %s\n\n", Msg::SCHEMA, name.c_str(),
+         sizeof(Shm::Segment), Link::RING_LEN, (unsigned)Eyes::FPS_DEFAULT, realtime ? "real time" : "fast (virtual clock)");
+  pid_t face = 0;
+  if (!hostOnly) {
+    face = fork();
+    if (face < 0) { perror("fork"); return 1; }
+    if (face == 0) { runFace(s, realtime); _exit(0); }   // the child shares the mapping
+  }
+  const int rc = runHost(s, conversations, timeoutMs);
+  if (face > 0) {
+    int status = 0;
+    waitpid(face, &status, 0);
+    if (!WIFEXITED(status) || WEXITSTATUS(status)) { fprintf(stderr, "face process failed\n"); Shm::detach(s); shm_unlink(name.c_str()); return 1; }
+  }
+  Shm::detach(s);
+  shm_unlink(name.c_str());
+  return rc;
+}
@@ -0,0 +1,161 @@
+/*
+ * sound_bench.cpp — host simulation of the sound-event scheduler (src/sound.h).
+ *
+ * Runs Sound::tick / Sound::apply against a simulated decoder: the audio task pumps every 2 ms, and a
+ * playing sound hands over a 1152-frame block whenever the I2S queue has room, heard
+ * AUDIO_LATENCY_MS later, as on the firmware. Starting a sound costs a decoder start delay (a TTS
+ * request goes to the network, a file opens from SD). Over a virtual session the render loop posts
+ * speech, reactions and looping ambient sounds at random, with occasional cancels and flushes.
+ * Reports per priority class: sounds started / stopped / dropped, event-to-audible latency (mean, p50,
+ * p95, max), how long a lower class stayed at full gain with a higher one waiting, the largest gain
+ * step between adjacent frames, and the cost of the heap operations.
+ *
+ *   g++ -std=gnu++17 -O2 -Itools/host/shim -Isrc tools/host/sound_bench.cpp -o sound_bench
+ *   ./sound_bench [--minutes 30] [--seed 1] [--tts-ms 400] [--file-ms 25] [--log]
+ */
+#include <Arduino.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include "sound.h"
+
+static constexpr uint32_t RATE             = 44100;
+static constexpr int      BLOCK            = 1152;
+static constexpr uint32_t AUDIO_LATENCY_MS = 46;     // as main_full's AUDIO_OUT_LATENCY_MS
+static constexpr uint32_t PUMP_MS          = 2;      // audio task loop period
+
+static uint32_t g_rng = 1;
+static uint32_t rnd(){ g_rng ^= g_rng << 13; g_rng ^= g_rng >> 17; g_rng ^= g_rng << 5; return g_rng; }
+static uint32_t rndMs(uint32_t lo, uint32_t hi){ return lo + rnd() % (hi - lo + 1); }
+
+// Requests carry their length in src ("<ms>"); the decoder needs a start delay before the first block.
+struct SimPlayer {
+  uint32_t now = 0, startDelayTts = 400, startDelayFile = 25;
+  bool     on = false;
+  uint32_t firstMs = 0, lenMs = 0, playedMs = 0;
+  uint32_t starts = 0;
+  bool start(const Sound::Request& r){
+    on = true; ++starts;
+    firstMs = now + (r.kind == Sound::TTS ? startDelayTts : startDelayFile);
+    lenMs = (uint32_t)atoi(r.src); playedMs = r.resume;
+    return true;
+  }
+  uint32_t stop(){ on = false; return playedMs; }   // the "file position" is ms played
+  bool running(){ return on; }
+};
+
+static double pct(std::vector<uint32_t> v, double p){
+  if (v.empty()) return 0;
+  std::sort(v.begin(), v.end());
+  return v[std::min(v.size() - 1, (size_t)(p * v.size()))];
+}
+
+int main(int argc, char** argv){
+  uint32_t minutes = 30;
+  bool log = false;
+  SimPlayer pl;
+  for (int i = 1; i < argc; ++i) {
+    const std::string a = argv[i];
+    if (a == "--minutes" && i + 1 < argc) minutes = (uint32_t)max(1, atoi(argv[++i]));
+    else if (a == "--seed" && i + 1 < argc) g_rng = (uint32_t)max(1, atoi(argv[++i]));
+    else if (a == "--tts-ms" && i + 1 < argc) pl.startDelayTts = (uint32_t)atoi(argv[++i]);
+    else if (a == "--file-ms" && i + 1 < argc) pl.startDelayFile = (uint32_t)atoi(argv[++i]);
+    else if (a == "--log") log = true;
+    else { fprintf(stderr, "usage: %s [--minutes N] [--seed S] [--tts-ms MS] [--file-ms MS] [--log]\n", argv[0]); return 2; }
+  }
+
+  static Sound::Scheduler sc;
+  const uint32_t endMs = minutes * 60000;
+  const uint32_t blockMs = BLOCK * 1000 / RATE;
+  std::vector<int16_t> pcm(2 * BLOCK);
+  std::vector<uint32_t> lat[Sound::NUM_PRIO];
+  uint32_t latSeen[Sound::NUM_PRIO] = {}, latSum[Sound::NUM_PRIO] = {}, posted[Sound::NUM_PRIO] = {}, refused = 0, cancels = 0, flushes = 0;
+  uint32_t inversionMs = 0, inversionMax = 0, inversionRun = 0;
+  int32_t maxStep = 0, prevGain = 0;
+  uint32_t i2sFreeMs = 0;   // when the I2S queue has room for another block
+  uint32_t nextSpeech = 5000, nextReaction = 1000, nextAmbient = 0, nextCancel = 60000;
+  char src[16];
+
+  for (uint32_t t = 0; t < endMs; t += PUMP_MS) {
+    pl.now = t;
+    // render loop: post events
+    auto post = [&](Sound::Prio p, Sound::Kind k, uint32_t lenMs, uint16_t tag){
+      snprintf(src, sizeof(src), "%u", lenMs);
+      if (Sound::play(sc, p, k, src, tag, t)) ++posted[p]; else ++refused;
+    };
+    if (t >= nextSpeech)   { post(Sound::SPEECH, Sound::TTS, rndMs(800, 4000), 1); nextSpeech = t + rndMs(5000, 40000); }
+    if (t >= nextReaction) { post(Sound::REACTION, Sound::FILE, rndMs(150, 600), 2); nextReaction = t + rndMs(500, 6000); }
+    bool ambient = sc.playing && sc.cur.prio == Sound::AMBIENT;      // a loop: posted again once it ends
+    for (int i = 0; i < sc.n; ++i) ambient |= sc.heap[i].prio == Sound::AMBIENT;
+    if (t >= nextAmbient && !ambient) post(Sound::AMBIENT, Sound::FILE, 30000, 3);
+    if (t >= nextCancel) {
+      if (rnd() & 1) { Sound::cancel(sc, 2); ++cancels; } else { Sound::flush(sc); ++flushes; nextAmbient = t + 5000; }
+      nextCancel = t + rndMs(30000, 120000);
+    }
+
+    // audio task
+    const uint32_t startsBefore = pl.starts;
+    Sound::tick(sc, pl);
+    if (pl.starts != startsBefore) prevGain = 0;    // a new sound: steps are measured within one
+    if (log && pl.starts != startsBefore)
+      printf("%9.3f start %-8s (%s ms), %d queued\n", t / 1000.0, Sound::PRIO_NAMES[sc.cur.prio], sc.cur.src, sc.n);
+    if (pl.on && t >= pl.firstMs && t >= i2sFreeMs) {
+      for (int i = 0; i < BLOCK; ++i) pcm[2 * i] = pcm[2 * i + 1] = 30000;   // DC, so the gain is the sample
+      Sound::apply(sc, pcm.data(), BLOCK, 2, RATE, t + AUDIO_LATENCY_MS);
+      for (int i = 0; i < BLOCK; ++i) {
+        const int32_t g = pcm[2 * i];
+        maxStep = max(maxStep, abs(g - prevGain)); prevGain = g;
+      }
+      i2sFreeMs = max(i2sFreeMs, t) + blockMs;
+      pl.playedMs += blockMs;
+      if (pl.playedMs >= pl.lenMs) pl.on = false;
+    }
+    // per-class latencies: the scheduler keeps sums, the bench each one
+    for (int p = 0; p < Sound::NUM_PRIO; ++p)
+      if (sc.stats[p].latN != latSeen[p]) {
+        lat[p].push_back(sc.stats[p].latSumMs - latSum[p]);
+        latSeen[p] = sc.stats[p].latN; latSum[p] = sc.stats[p].latSumMs;
+      }
+
+    // inversion: a lower class still at full gain while a higher one waits
+    const bool inverted = sc.playing && !sc.ducking && sc.n && sc.heap[0].prio < sc.cur.prio;
+    if (inverted) { inversionMs += PUMP_MS; inversionRun += PUMP_MS; inversionMax = max(inversionMax, inversionRun); }
+    else inversionRun = 0;
+  }
+  printf("%u min, pump every %u ms, blocks of %d frames (%u ms) heard %u ms later; decoder start: TTS %u ms, file %u ms\n\n",
+         minutes, PUMP_MS, BLOCK, blockMs, AUDIO_LATENCY_MS, pl.startDelayTts, pl.startDelayFile);
+  printf("%-9s %7s %8s %8s %8s %9s %8s %8s %8s\n", "class", "posted", "started", "stopped", "dropped", "lat_mean", "lat_p50", "lat_p95", "lat_max");
+  for (int p = 0; p < Sound::NUM_PRIO; ++p) {
+    const Sound::Stats& s = sc.stats[p];
+    double mean = 0;
+    for (uint32_t v : lat[p]) mean += v;
+    printf("%-9s %7u %8u %8u %8u %9.0f %8.0f %8.0f %8u\n", Sound::PRIO_NAMES[p], posted[p], s.started, s.stopped, s.dropped,
+           lat[p].empty() ? 0 : mean / lat[p].size(), pct(lat[p], 0.5), pct(lat[p], 0.95), s.latMaxMs);
+  }
+  printf("\nrefused posts (ring full) %u, cancels %u, flushes %u\n", refused, cancels, flushes);
+  printf("lower class at full gain with a higher one waiting: %u ms total, %u ms at most (pump is %u ms)\n",
+         inversionMs, inversionMax, PUMP_MS);
+  printf("largest gain step between frames: %.5f of full scale (a %u ms duck is %.5f per frame linear)\n",
+         maxStep / 30000.0, Sound::DUCK_MS, 1.0 / (RATE * Sound::DUCK_MS / 1000));
+
+  // heap cost at capacity
+  {
+    static Sound::Scheduler h;
+    Sound::Request r;
+    const int N = 2000000;
+    using namespace std::chrono;
+    const auto t0 = steady_clock::now();
+    uint32_t sink = 0;
+    for (int i = 0; i < N; ++i) {
+      if (h.n == Sound::QUEUE_LEN) { Sound::dequeue(h, r); sink += r.seq; }
+      r.prio = (uint8_t)(rnd() % Sound::NUM_PRIO); r.seq = (uint32_t)i;
+      Sound::enqueue(h, r);
+    }
+    const double ns = duration<double, std::nano>(steady_clock::now() - t0).count() / N;
+    printf("heap at %d requests: %.1f ns per enqueue + dequeue (host) [%u]\n", Sound::QUEUE_LEN, ns, sink & 1);
+  }
+  return 0;
+}
@@ -0,0 +1,193 @@
+/*
+ * span_bench.cpp — host benchmark of the face renderers (src/face.h).
+ *
+ * Runs the real eye/mouth state machines on a simulated 40 FPS clock and reports, per scenario and
+ * strategy, how many spans each frame's list holds and what reaches the panel: one window per diffed
+ * span, diffed spans packed into windows (src/batch.h), or 16x16 tiles of the 4bpp shadow
+ * (src/tiles.h). Windows, their command bytes and pixel bytes are counted per frame. Every frame is
+ * also checked: a framebuffer fed only the pushed windows must equal a full redraw (mid-slide: the
+ * incoming columns on screen, and the scroll start line; mid-fade: the rows or tiles not left stale
+ * by the Theme::FADE_PX_PER_FRAME budget). The fade scenario cross-fades through the presets and a
+ * theme with a coloured background; "settle" is the most frames a fade's last rows stayed stale after
+ * it, and "fade_B_max" the most pixel bytes a frame under the budget pushed. Exits nonzero on a
+ * mismatch, or when the tiles go over the budget.
+ *
+ *   g++ -std=gnu++17 -O2 -Itools/host/shim -Isrc tools/host/span_bench.cpp -o span_bench
+ *   ./span_bench [frames]
+ */
+#include <Arduino.h>
+#include <LovyanGFX.hpp>
+#include <stdlib.h>
+#include "face.h"
+
+static constexpr int W = 320, H = 240;
+static constexpr int FRAME_MS = 1000 / Eyes::FPS_DEFAULT;
+
+struct FrameBuffer {
+  uint16_t px[H][W];
+  void clear(uint16_t c){ for (auto& row : px) for (auto& p : row) p = c; }
+  void span(int y, int x0, int x1, uint16_t c){
+    for (int x = max(x0, 0); x <= min(x1, W - 1); ++x) px[y][x] = c;
+  }
+};
+
+// Panel as the renderer leaves it. fb holds panel memory; `start` is the scroll start line.
+struct BenchSink {
+  FrameBuffer& fb;
+  int start = 0;
+  void scroll(int line){ start = line; }
+  void fill(int x, int y, int w, int h, uint16_t c){
+    for (int j = 0; j < h; ++j) fb.span(y + j, x, x + w - 1, c);
+  }
+  void image(int x, int y, int w, int h, const uint16_t* px){
+    for (int j = 0; j < h; ++j) memcpy(&fb.px[y + j][x], px + j * w, w * 2);
+  }
+};
+
+enum class Strategy { Spans, Batched, Tiles };
+static const char* const STRATEGY_NAMES[] = { "spans", "batch", "tiles" };
+
+enum class Scenario { Idle, Blink, Saccade, Talking, Slide, Fade };
+static const char* const SCENARIO_NAMES[] = { "idle", "blink", "saccade", "talking", "slide", "fade" };
+static constexpr int NUM_SCENARIOS = 6;
+static constexpr int SLIDE_EVERY   = 40;   // frames between face switches in the slide scenario
+static constexpr int FADE_EVERY    = 64;   // frames between theme fades in the fade scenario
+
+// OCEAN on a navy background: every fade to or from it moves the background.
+static const Theme::Colors DUSK = { 0x0008, 0xEF7F, 0x03BF, 0x0010, 0x05FF, 0xBEFF };
+static const Theme::Colors* const FADES[] = { &Theme::OCEAN, &DUSK, &Theme::EMBER, &Theme::MONO, &DUSK, &Theme::FOREST };
+static constexpr int NUM_FADES = sizeof(FADES) / sizeof(FADES[0]);
+
+struct Acc {
+  long   frames = 0, mismatches = 0, overflows = 0;
+  double spans = 0, ops = 0, cmd = 0, px = 0;
+  int    maxSpans = 0, maxOps = 0, settle = 0;
+  uint32_t maxPx = 0, maxFadePx = 0;   // maxFadePx: frames under Theme::FADE_PX_PER_FRAME
+};
+
+// Steers the state machines so each scenario isolates one kind of motion.
+static void steer(Scenario sc, Eyes::State& s, Face::Mouth& m, Face::Renderer& r, int frame, uint32_t& nextSwapMs){
+  const uint32_t now = millis();
+  switch (sc) {
+    case Scenario::Idle:      // fixation + micro-drift only
+      s.gaze.state = Eyes::GazeState::FIXATE; s.gaze.stateStartMs = now;
+      s.blink.nextTriggerMsL = s.blink.nextTriggerMsR = UINT32_MAX;
+      break;
+    case Scenario::Blink:     // back-to-back blinks, gaze held
+      s.gaze.state = Eyes::GazeState::FIXATE; s.gaze.stateStartMs = now;
+      if (!s.blink.activeL) s.blink.nextTriggerMsL = now;
+      if (!s.blink.activeR) s.blink.nextTriggerMsR = now + Eyes::BLINK_EYE_OFFSET_MS;
+      break;
+    case Scenario::Saccade:   // a saccade every ~200 ms, no blinks
+      if (s.gaze.state != Eyes::GazeState::SACCADE && now - s.gaze.stateStartMs >= 200)
+        Eyes::enterSaccade(s, s.L.maxOffset);
+      s.blink.nextTriggerMsL = s.blink.nextTriggerMsR = UINT32_MAX;
+      break;
+    case Scenario::Talking:   // free-running eyes, mouth frames swapped at the firmware cadence
+      if (now >= nextSwapMs) {
+        m.frame = &TALK_FRAMES[random(NUM_TALK_FRAMES)];
+        m.style = Face::LIPS_JOIN | Face::LIPS_CAVITY | Face::LIPS_TEETH;
+        nextSwapMs = now + 160;
+      }
+      break;
+    case Scenario::Slide:     // free-running eyes, a new theme slid in every SLIDE_EVERY frames
+      if (frame % SLIDE_EVERY == 0) {
+        const int k = frame / SLIDE_EVERY;
+        Theme::fadeTo(*Theme::PRESETS[(k + 1) % Theme::NUM_PRESETS], 0);
+        Face::slide(r, (k & 1) ? Scroll::Dir::Right : Scroll::Dir::Left);
+      }
+      break;
+    case Scenario::Fade:      // free-running eyes, a theme fade every FADE_EVERY frames
+      if (frame % FADE_EVERY == 0) Theme::fadeTo(*FADES[(frame / FADE_EVERY) % NUM_FADES]);
+      break;
+  }
+}
+
+static Acc run(Scenario sc, Strategy strat, int frames){
+  static Eyes::State s;
+  static Face::Renderer r;
+  static Tiles::Shadow shadow;
+  static FrameBuffer panel, ref;
+  Acc acc;
+
+  Host::clockMs() = 1000;
+  randomSeed(12345);
+  Theme::apply(Theme::MONO);
+  Eyes::init(s, Eyes::Layout());
+  Face::Mouth m;
+  m.baseY = 214; m.w = 117; m.frame = &moodToFrame(MouthMood::Smile);
+  uint32_t nextSwapMs = 0;
+
+  panel.clear(Theme::palette().bg);
+  r.batch = strat == Strategy::Batched;
+  Face::useTiles(r, strat == Strategy::Tiles ? &shadow : nullptr);
+  Face::reset(r);
+  BenchSink sink{ panel };
+  Face::render(r, s, m, nullptr, W, H, sink);   // first frame draws everything; not counted
+
+  int settle = 0;
+  for (int f = 0; f < frames; ++f) {
+    Host::advanceMs(FRAME_MS);
+    steer(sc, s, m, r, f, nextSwapMs);
+    Eyes::update(s, FRAME_MS / 1000.f);
+    Theme::tick();
+    const bool budgeted = (Theme::version() != r.palette && !r.slide.active()) || !Face::settled(r);
+    const DList::Stats& st = Face::render(r, s, m, nullptr, W, H, sink);
+
+    acc.frames++;
+    acc.spans += r.list[r.shown].n; acc.ops += r.pushOps; acc.cmd += r.cmdBytes; acc.px += r.pxBytes;
+    acc.maxSpans = max(acc.maxSpans, r.list[r.shown].n);
+    acc.maxOps = max(acc.maxOps, (int)r.pushOps);
+    acc.maxPx = max(acc.maxPx, r.pxBytes);
+    if (budgeted) acc.maxFadePx = max(acc.maxFadePx, r.pxBytes);
+    acc.overflows += st.overflow;
+    settle = Theme::fading() || Face::settled(r) ? 0 : settle + 1;
+    acc.settle = max(acc.settle, settle);
+
+    const DList::List& shown = r.list[r.shown];
+    ref.clear(Theme::palette().bg);
+    for (int y = 0; y < shown.rows; ++y)
+      for (const DList::Span* sp = shown.rowBegin(y); sp != shown.rowEnd(y); ++sp) ref.span(y, sp->x0, sp->x1, sp->c);
+    if (!r.slide.active()) {
+      bool bad = sink.start != 0;
+      for (int y = 0; y < H && !bad; ++y) {
+        if (Face::isStale(r, y)) continue;
+        for (int tx = 0; tx < Tiles::COLS && !bad; ++tx)
+          bad = !(r.shadow && Tiles::isStale(*r.shadow, tx, y / Tiles::TILE)) &&
+                memcmp(&panel.px[y][tx * Tiles::TILE], &ref.px[y][tx * Tiles::TILE], Tiles::TILE * 2);
+      }
+      acc.mismatches += bad;
+    } else {
+      int lo, hi;
+      Scroll::revealed(r.slide, lo, hi);
+      bool bad = sink.start != Scroll::startLine(r.slide);
+      for (int y = 0; y < H && !bad; ++y) bad = memcmp(&panel.px[y][lo], &ref.px[y][lo], (hi - lo) * 2) != 0;
+      acc.mismatches += bad;
+    }
+  }
+  return acc;
+}
+
+int main(int argc, char** argv){
+  const int frames = argc > 1 ? atoi(argv[1]) : 4000;
+  int failed = 0;
+  printf("%-8s %-6s %7s %7s %8s %7s %7s %8s %8s %8s %8s %10s %6s %5s\n",
+         "scenario", "push", "frames", "list", "list_max", "windows", "win_max", "cmd_B", "px_B", "total_B", "px_B_max",
+         "fade_B_max", "settle", "bad");
+  for (int i = 0; i < NUM_SCENARIOS; ++i) {
+    for (int t = 0; t < 3; ++t) {
+      const Acc a = run((Scenario)i, (Strategy)t, frames);
+      const double n = a.frames ? (double)a.frames : 1.0;
+      printf("%-8s %-6s %7ld %7.1f %8d %7.1f %7d %8.1f %8.1f %8.1f %8u %10u %6d %5ld%s\n",
+             SCENARIO_NAMES[i], STRATEGY_NAMES[t], a.frames, a.spans / n, a.maxSpans, a.ops / n, a.maxOps,
+             a.cmd / n, a.px / n, (a.cmd + a.px) / n, (unsigned)a.maxPx, (unsigned)a.maxFadePx, a.settle, a.mismatches,
+             a.overflows ? "  (list overflow)" : "");
+      failed += a.mismatches > 0;
+      if ((Strategy)t == Strategy::Tiles && a.maxFadePx > Theme::FADE_PX_PER_FRAME * 2) {
+        printf("  tiles pushed %u B in one fade frame, over the %u B budget\n", (unsigned)a.maxFadePx, (unsigned)Theme::FADE_PX_PER_FRAME * 2);
+        ++failed;
+      }
+    }
+  }
+  return failed ? 1 : 0;
+}
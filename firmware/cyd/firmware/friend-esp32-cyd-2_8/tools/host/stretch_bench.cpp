@@ -0,0 +1,279 @@
+/*
+ * stretch_bench.cpp — host quality and CPU benchmark of the WSOLA time-stretch (src/stretch.h).
+ *
+ * Runs a speech clip (a 16-bit PCM WAV, or a synthetic one: voiced syllables with gliding pitch
+ * through vowel formants, fricatives and pauses, with its pitch track known) through Stretch::push /
+ * pull in 1152-frame blocks, as the firmware's audio hook does, at fixed rates from 0.75x to 1.5x and
+ * with the rate changed live every 100 ms (1x included, so the bypass hand-over is exercised too).
+ * Per run: output duration against the rate integral; pitch kept (autocorrelation pitch of voiced output
+ * frames against the source pitch at the position Stretch::sourceAt reports); periodicity of voiced
+ * frames against the input's (splices that break a pitch period lower it); the A/V clock, i.e. how far
+ * sourceAt strays from the rate integral; correlation multiply-adds per second of audio and host time.
+ *
+ *   g++ -std=gnu++17 -O2 -Itools/host/shim -Isrc tools/host/stretch_bench.cpp -o stretch_bench
+ *   ./stretch_bench [speech.wav] [--out prefix]   (writes prefix_<rate>.wav per run)
+ */
+#include <Arduino.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include "stretch.h"
+
+static constexpr int BLOCK      = 1152;   // an MP3 frame, as the decoder hands them over
+static constexpr int FRAME_MS   = 40;     // pitch analysis frame
+static constexpr int F0_MIN     = 70, F0_MAX = 400;
+static constexpr float VOICED   = 0.6f;   // normalised autocorrelation peak that counts as voiced
+
+struct Clip {
+  uint32_t rate = 24000;
+  int ch = 1;
+  std::vector<int16_t> s;          // interleaved
+  std::vector<float>   f0;         // per frame; synthetic only (0 = unvoiced)
+  int frames() const { return (int)(s.size() / ch); }
+};
+
+static double nowS(){
+  using namespace std::chrono;
+  return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+static uint32_t rd32(const uint8_t* p){ return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); }
+static uint16_t rd16(const uint8_t* p){ return (uint16_t)(p[0] | (p[1] << 8)); }
+
+static bool readWav(const char* path, Clip& out){
+  FILE* f = fopen(path, "rb");
+  if (!f) { perror(path); return false; }
+  std::vector<uint8_t> b;
+  uint8_t buf[65536];
+  for (size_t n; (n = fread(buf, 1, sizeof(buf), f)) > 0; ) b.insert(b.end(), buf, buf + n);
+  fclose(f);
+  if (b.size() < 12 || memcmp(&b[0], "RIFF", 4) || memcmp(&b[8], "WAVE", 4)) { fprintf(stderr, "%s: not a WAV\n", path); return false; }
+  bool fmt = false;
+  for (size_t p = 12; p + 8 <= b.size(); ) {
+    const uint32_t len = rd32(&b[p + 4]);
+    const uint8_t* d = &b[p + 8];
+    if (!memcmp(&b[p], "fmt ", 4) && len >= 16) {
+      if (rd16(d) != 1 || rd16(d + 14) != 16) { fprintf(stderr, "%s: need 16-bit PCM\n", path); return false; }
+      out.ch = rd16(d + 2); out.rate = rd32(d + 4); fmt = true;
+    } else if (!memcmp(&b[p], "data", 4) && fmt) {
+      const size_t n = min<size_t>(len, b.size() - p - 8) / 2;
+      out.s.resize(n);
+      for (size_t i = 0; i < n; ++i) out.s[i] = (int16_t)rd16(d + 2 * i);
+      return out.ch >= 1 && out.ch <= Stretch::MAX_CH;
+    }
+    p += 8 + len + (len & 1);
+  }
+  fprintf(stderr, "%s: no data chunk\n", path);
+  return false;
+}
+
+static void writeWav(const std::string& path, const std::vector<int16_t>& s, uint32_t rate, int ch){
+  FILE* f = fopen(path.c_str(), "wb");
+  if (!f) { perror(path.c_str()); return; }
+  const uint32_t data = (uint32_t)s.size() * 2;
+  auto w32 = [&](uint32_t v){ fputc(v & 255, f); fputc((v >> 8) & 255, f); fputc((v >> 16) & 255, f); fputc(v >> 24, f); };
+  auto w16 = [&](uint16_t v){ fputc(v & 255, f); fputc(v >> 8, f); };
+  fwrite("RIFF", 1, 4, f); w32(36 + data); fwrite("WAVEfmt ", 1, 8, f); w32(16); w16(1); w16((uint16_t)ch);
+  w32(rate); w32(rate * ch * 2); w16((uint16_t)(ch * 2)); w16(16); fwrite("data", 1, 4, f); w32(data);
+  fwrite(s.data(), 2, s.size(), f);
+  fclose(f);
+}
+
+// Two-pole resonator at `hz` with bandwidth `bw`.
+struct Reson {
+  float a1 = 0, a2 = 0, g = 0, y1 = 0, y2 = 0;
+  void set(float hz, float bw, float rate){
+    const float r = expf(-(float)M_PI * bw / rate);
+    a1 = 2 * r * cosf(2 * (float)M_PI * hz / rate); a2 = -r * r; g = 1 - r;
+  }
+  float run(float x){ const float y = g * x + a1 * y1 + a2 * y2; y2 = y1; y1 = y; return y; }
+};
+
+// ~12 s of "speech" at 24 kHz mono: syllables of 120-320 ms on a gliding pitch, fricatives, pauses.
+static void synth(Clip& c){
+  static const float VOWELS[][3] = { {730, 1090, 2440}, {270, 2290, 3010}, {530, 1840, 2480}, {570, 840, 2410}, {300, 870, 2240} };
+  const float rate = (float)c.rate;
+  uint32_t rng = 777;
+  auto rnd = [&](){ rng ^= rng << 13; rng ^= rng >> 17; rng ^= rng << 5; return (float)(rng % 10000) / 10000.f; };
+  std::vector<float> f0s;   // per sample
+  std::vector<float> x;
+  Reson f[3];
+  float phase = 0;
+  while (x.size() < 12 * c.rate) {
+    const float kind = rnd();
+    const int len = (int)((0.12f + 0.2f * rnd()) * rate);
+    if (kind < 0.12f) {           // pause
+      for (int i = 0; i < len / 2; ++i) { x.push_back(0); f0s.push_back(0); }
+    } else if (kind < 0.3f) {     // fricative
+      for (int i = 0; i < len / 2; ++i) {
+        const float env = sinf((float)M_PI * i / (len / 2));
+        x.push_back(0.15f * env * (rnd() * 2 - 1)); f0s.push_back(0);
+      }
+    } else {                      // voiced syllable
+      const float* v = VOWELS[(int)(rnd() * 5) % 5];
+      const float p0 = 110 + 60 * rnd(), p1 = 110 + 60 * rnd();
+      for (int k = 0; k < 3; ++k) f[k].set(v[k], 60 + 40 * k, rate);
+      for (int i = 0; i < len; ++i) {
+        const float t = (float)i / len, hz = p0 + (p1 - p0) * t;
+        phase += hz / rate;
+        float src = 0;
+        if (phase >= 1) { phase -= 1; src = 1; }   // glottal pulse
+        float y = 0;
+        for (auto& r : f) y += r.run(src);
+        x.push_back(y * sinf((float)M_PI * t)); f0s.push_back(hz);
+      }
+    }
+  }
+  float peak = 1e-6f;
+  for (float v : x) peak = max(peak, fabsf(v));
+  c.ch = 1;
+  c.s.resize(x.size());
+  for (size_t i = 0; i < x.size(); ++i) c.s[i] = (int16_t)lrintf(x[i] / peak * 0.8f * 32767);
+  const int fl = (int)c.rate * FRAME_MS / 1000;
+  for (size_t i = 0; i + fl <= f0s.size(); i += fl) {
+    int voiced = 0; float sum = 0;
+    for (int k = 0; k < fl; ++k) if (f0s[i + k] > 0) { ++voiced; sum += f0s[i + k]; }
+    c.f0.push_back(voiced == fl ? sum / fl : 0);
+  }
+}
+
+// Autocorrelation pitch of a mono frame; peak <= VOICED means unvoiced (returns 0).
+static float pitch(const int16_t* s, int n, int ch, uint32_t rate, float* peakOut = nullptr){
+  std::vector<float> x(n);
+  double e = 0;
+  for (int i = 0; i < n; ++i) { x[i] = s[i * ch]; e += x[i] * x[i]; }
+  if (e < 1e3 * n) { if (peakOut) *peakOut = 0; return 0; }
+  float best = 0; int lag = 0;
+  for (int l = (int)rate / F0_MAX; l <= (int)rate / F0_MIN && l < n / 2; ++l) {
+    double c = 0, e0 = 0, e1 = 0;
+    for (int i = 0; i + l < n; ++i) { c += x[i] * x[i + l]; e0 += x[i] * x[i]; e1 += x[i + l] * x[i + l]; }
+    const float r = (float)(c / sqrt(e0 * e1 + 1e-9));
+    if (r > best) { best = r; lag = l; }
+  }
+  if (peakOut) *peakOut = best;
+  return best > VOICED ? (float)rate / lag : 0;
+}
+
+struct Result {
+  double durRatio = 0, f0Med = 0, f0Bad = 0, period = 0, clockMaxMs = 0, macsPerS = 0, hostMsPerS = 0;
+  int voiced = 0;
+};
+
+// Live rate schedule: a walk through these, changing every 100 ms of input.
+static const float LIVE[] = { 1.0f, 1.1f, 1.25f, 1.5f, 1.3f, 1.0f, 0.9f, 0.75f, 0.85f, 1.0f, 1.2f, 0.8f };
+
+static Result run(const Clip& in, float fixed, bool live, std::vector<int16_t>& out){
+  static Stretch::State st;
+  st = Stretch::State();
+  Stretch::begin(st, in.rate, in.ch);
+  Stretch::setRate(st, (uint32_t)lrintf(fixed * Stretch::ONE));
+  out.clear();
+  std::vector<uint32_t> srcOfOut;     // sourceAt for each output frame
+  std::vector<float>    rateOfOut;    // the rate in force when it was made
+  std::vector<int16_t> chunk(256 * in.ch);
+  const int n = in.frames();
+  const double t0 = nowS();
+  for (int pos = 0; pos < n; ) {
+    float r = fixed;
+    if (live) {
+      r = LIVE[(pos / (in.rate / 10)) % (sizeof(LIVE) / sizeof(LIVE[0]))];
+      Stretch::setRate(st, (uint32_t)lrintf(r * Stretch::ONE));
+    }
+    const int m = min(BLOCK, n - pos);
+    if (Stretch::bypassed(st)) {
+      // the firmware leaves this block to the library
+      Stretch::passed(st, m);
+      out.insert(out.end(), in.s.begin() + (size_t)pos * in.ch, in.s.begin() + (size_t)(pos + m) * in.ch);
+      for (int i = 0; i < m; ++i) { srcOfOut.push_back(Stretch::sourceAt(st, (uint32_t)srcOfOut.size())); rateOfOut.push_back(1.f); }
+      pos += m;
+      continue;
+    }
+    for (int done = 0; done < m; ) {
+      done += Stretch::push(st, &in.s[(size_t)(pos + done) * in.ch], m - done);
+      for (int got; (got = Stretch::pull(st, chunk.data(), 256)) > 0; ) {
+        out.insert(out.end(), chunk.begin(), chunk.begin() + got * in.ch);
+        const float used = (float)Stretch::rate(st) / Stretch::ONE;
+        for (int i = 0; i < got; ++i) { srcOfOut.push_back(Stretch::sourceAt(st, (uint32_t)srcOfOut.size())); rateOfOut.push_back(used); }
+      }
+    }
+    pos += m;
+  }
+  const double host = nowS() - t0;
+
+  // A/V clock: the source position reported for output frame k against the integral of the rate
+  // in force over frames 0..k; the same integral over the whole output should cover the input
+  Result res;
+  double ideal = 0, clockErr = 0;
+  for (size_t i = 0; i < srcOfOut.size(); ++i) {
+    clockErr = max(clockErr, fabs((double)srcOfOut[i] - ideal));
+    ideal += rateOfOut[i];
+  }
+  const int outFrames = (int)(out.size() / in.ch);
+  res.durRatio = n / max(ideal, 1.0);
+  res.clockMaxMs = clockErr * 1000.0 / in.rate;
+  res.macsPerS = (double)st.macs / ((double)n / in.rate);
+  res.hostMsPerS = host * 1000.0 / ((double)n / in.rate);
+
+  // pitch and periodicity of voiced output frames against the source at the mapped position
+  const int fl = (int)in.rate * FRAME_MS / 1000;
+  std::vector<float> ratios;
+  double per = 0, perIn = 0; int perN = 0;
+  for (int f = 0; f + fl <= outFrames; f += fl) {
+    float peak;
+    const float p = pitch(&out[(size_t)f * in.ch], fl, in.ch, in.rate, &peak);
+    const uint32_t src = srcOfOut[f + fl / 2] - fl / 2;
+    if ((int)src < 0 || (int)src + fl > n) continue;
+    float peakIn;
+    const float ref = !in.f0.empty() ? (src / fl + 1 < in.f0.size() && in.f0[src / fl] > 0 && in.f0[src / fl + 1] > 0 ? in.f0[src / fl] : 0)
+                                     : pitch(&in.s[(size_t)src * in.ch], fl, in.ch, in.rate, &peakIn);
+    if (!in.f0.empty()) pitch(&in.s[(size_t)src * in.ch], fl, in.ch, in.rate, &peakIn);
+    if (ref <= 0 || p <= 0) continue;
+    ratios.push_back(p / ref);
+    per += peak; perIn += peakIn; ++perN;
+  }
+  std::sort(ratios.begin(), ratios.end());
+  res.voiced = (int)ratios.size();
+  if (!ratios.empty()) {
+    res.f0Med = ratios[ratios.size() / 2];
+    int bad = 0; for (float q : ratios) bad += fabsf(q - 1) > 0.05f;
+    res.f0Bad = 100.0 * bad / ratios.size();
+    res.period = per / max(perIn, 1e-9);
+  }
+  return res;
+}
+
+int main(int argc, char** argv){
+  const char* path = nullptr;
+  std::string prefix;
+  for (int i = 1; i < argc; ++i) {
+    const std::string a = argv[i];
+    if (a == "--out" && i + 1 < argc) prefix = argv[++i];
+    else if (a[0] != '-') path = argv[i];
+    else { fprintf(stderr, "usage: %s [speech.wav] [--out prefix]\n", argv[0]); return 2; }
+  }
+  Clip in;
+  if (path) { if (!readWav(path, in)) return 1; }
+  else synth(in);
+  printf("%s: %.1f s, %u Hz, %d ch; hop %d ms, seek +-%d ms, blocks of %d frames\n\n", path ? path : "synthetic speech",
+         (double)in.frames() / in.rate, in.rate, in.ch, Stretch::WINDOW_MS / 2, Stretch::SEEK_MS, BLOCK);
+  printf("%-6s %8s %8s %8s %8s %8s %10s %10s %9s\n", "rate", "dur", "voiced", "f0_med", "f0>5%", "period",
+         "clock_ms", "MAC/s", "host_ms/s");
+  static const float RATES[] = { 0.75f, 0.9f, 1.0f, 1.25f, 1.5f };
+  std::vector<int16_t> out;
+  for (int k = 0; k <= 5; ++k) {
+    const bool live = k == 5;
+    const float r = live ? 1.f : RATES[k];
+    const Result res = run(in, r, live, out);
+    char name[16]; snprintf(name, sizeof(name), live ? "live" : "%.2f", r);
+    printf("%-6s %8.3f %8d %8.3f %7.1f%% %8.3f %10.1f %10.0f %9.2f\n", name, res.durRatio, res.voiced, res.f0Med,
+           res.f0Bad, res.period, res.clockMaxMs, res.macsPerS, res.hostMsPerS);
+    if (!prefix.empty()) writeWav(prefix + "_" + name + ".wav", out, in.rate, in.ch);
+  }
+  printf("\ndur: input length / source covered by the rate integral over the output; f0_med: median output / source pitch over voiced frames;\n"
+         "f0>5%%: frames off by more than 5%%; period: output periodicity / input's; clock_ms: worst distance of\n"
+         "Stretch::sourceAt from the rate integral.\n");
+  return 0;
+}
@@ -0,0 +1,84 @@
+#pragma once
+// Host only: one end of the UDP face link (src/udp_link.h) on a POSIX socket. Frames are built in
+// `out` with the Msg::send* helpers, as on the serial link; flush() packs them into datagrams for the
+// peer and poll() hands every received frame, checked and in seq order, to a callback that reads it in
+// place with Msg::view. An endpoint opened with learnPeer answers whoever sent to it last, as the face
+// does.
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+#include "link_msgs.h"
+#include "udp_link.h"
+
+namespace UdpEnd {
+
+struct Endpoint {
+  int         fd = -1;
+  sockaddr_in self{}, peer{};
+  bool        havePeer = false, learnPeer = false;
+  Udp::Rx     rx;
+  Udp::Tx     tx;
+  Link::Ring  out;                 // frames to send, built in place
+  uint32_t    sendErrors = 0;
+};
+
+// Binds 127.0.0.1 (or any address with `any`) on `port`, 0 for any free one; false on error.
+static bool open(Endpoint& e, uint16_t port, bool any = false){
+  e.fd = socket(AF_INET, SOCK_DGRAM, 0);
+  if (e.fd < 0) return false;
+  fcntl(e.fd, F_SETFL, fcntl(e.fd, F_GETFL) | O_NONBLOCK);
+  e.self.sin_family = AF_INET;
+  e.self.sin_port = htons(port);
+  e.self.sin_addr.s_addr = htonl(any ? INADDR_ANY : INADDR_LOOPBACK);
+  socklen_t len = sizeof(e.self);
+  if (bind(e.fd, (sockaddr*)&e.self, sizeof(e.self)) || getsockname(e.fd, (sockaddr*)&e.self, &len)) { ::close(e.fd); e.fd = -1; return false; }
+  e.tx.epoch = (uint8_t)(((uint32_t)getpid() ^ (uint32_t)time(nullptr)) % 255 + 1);
+  return true;
+}
+
+static bool connect(Endpoint& e, const char* ip, uint16_t port){
+  e.peer.sin_family = AF_INET;
+  e.peer.sin_port = htons(port);
+  e.havePeer = inet_pton(AF_INET, ip, &e.peer.sin_addr) == 1;
+  return e.havePeer;
+}
+
+static void close(Endpoint& e){ if (e.fd >= 0) ::close(e.fd); e.fd = -1; }
+
+// A datagram straight to the peer.
+static void sendRaw(Endpoint& e, const uint8_t* p, size_t n){
+  if (!e.havePeer || sendto(e.fd, p, n, 0, (const sockaddr*)&e.peer, sizeof(e.peer)) != (ssize_t)n) ++e.sendErrors;
+}
+
+// Everything in `out`, then copies still owed; each datagram goes to wire(p, n) (sendRaw, or a
+// lossy stand-in for tests).
+template <class Wire>
+static void flush(Endpoint& e, uint32_t nowMs, Wire wire){
+  if (!e.havePeer) return;
+  Udp::drain(e.out, e.tx, Msg::FRAME_SIZE, Msg::IS_CRITICAL, nowMs, wire);
+  Udp::tick(e.tx, nowMs, wire);
+}
+static void flush(Endpoint& e, uint32_t nowMs){ flush(e, nowMs, [&](const uint8_t* p, size_t n){ sendRaw(e, p, n); }); }
+
+// Reads every waiting datagram; onFrame(p, n) for each frame, once, in order. Returns datagrams read.
+template <class F>
+static int poll(Endpoint& e, uint32_t nowMs, F onFrame){
+  uint8_t d[Udp::MAX_DGRAM];
+  int k = 0;
+  for (;;) {
+    sockaddr_in from{};
+    socklen_t len = sizeof(from);
+    const ssize_t n = recvfrom(e.fd, d, sizeof(d), 0, (sockaddr*)&from, &len);
+    if (n < 0) break;
+    if (e.learnPeer) { e.peer = from; e.havePeer = true; }
+    Udp::receive(e.rx, d, (size_t)n, nowMs, Msg::FRAME_SIZE, onFrame);
+    ++k;
+  }
+  Udp::tick(e.rx, nowMs, onFrame);
+  return k;
+}
+
+} // namespace UdpEnd
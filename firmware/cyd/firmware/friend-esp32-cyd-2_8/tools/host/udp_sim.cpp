@@ -0,0 +1,222 @@
+/*
+ * udp_sim.cpp — the UDP face link (src/udp_link.h) end to end on Linux, through tools/host/udp_endpoint.h.
+ *
+ * Loopback (the default): a host endpoint and a face endpoint on 127.0.0.1 in one process. The host
+ * sends a frame every --interval ms, one in four a critical command (Mood, Sleep, Say) and the rest
+ * Pings; the face answers as onLinkFrame does (Pong, Ack) to whoever wrote last. Every datagram, both
+ * ways, goes through an injected network: lost with --loss probability (in bursts of --burst on
+ * average, Gilbert-Elliott) and delayed by up to --jitter ms, which reorders them. Both ends are polled
+ * back to back, so what is measured is the transport, not the face's 40 FPS polling.
+ *
+ * Each run is swept over loss rates with and without copies of the critical frames, printing per row:
+ * critical and other frames delivered, host-to-face delivery latency (p50, p95, p99, max), and the
+ * receiver's counts (early: held for reordering, lost: gaps given up, recovered: first had as a copy,
+ * dups). Exits nonzero if the face ever gets a frame twice or out of order, or misses one at 0 loss.
+ *
+ * --to IP sends the same traffic to a real face (FACE_UDP firmware) instead, with no injected loss,
+ * and reports Ping round trips and Acks.
+ *
+ *   g++ -std=gnu++17 -O2 -Itools/host/shim -Isrc tools/host/udp_sim.cpp -o udp_sim
+ *   ./udp_sim [--seconds 3] [--interval 2] [--loss 0.05] [--burst 1] [--jitter 3] [--seed 1] [--to 192.168.1.50]
+ */
+#include <Arduino.h>
+#include <algorithm>
+#include <chrono>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include "udp_endpoint.h"
+
+static uint32_t g_rng = 1;
+static uint32_t rnd(){ g_rng ^= g_rng << 13; g_rng ^= g_rng >> 17; g_rng ^= g_rng << 5; return g_rng; }
+static double   rndf(){ return (rnd() & 0xffffff) / (double)0x1000000; }
+
+static uint64_t wallUs(){
+  using namespace std::chrono;
+  return (uint64_t)duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+// ===== Injected network =====
+// Gilbert-Elliott loss: bursts of `burst` datagrams on average, `loss` of them overall; then a
+// uniform delay up to `jitter` ms. Datagrams are released to the real socket when due.
+struct Net {
+  double loss = 0, burst = 1, jitterMs = 0;
+  bool   bad = false;
+  uint32_t sent = 0, dropped = 0;
+  struct Held { uint64_t dueUs; uint32_t order; std::vector<uint8_t> d; };
+  struct Later { bool operator()(const Held& a, const Held& b) const { return a.dueUs != b.dueUs ? a.dueUs > b.dueUs : a.order > b.order; } };
+  std::priority_queue<Held, std::vector<Held>, Later> q;
+
+  bool lose(){
+    if (loss <= 0) return false;
+    // stay in a burst with 1 - 1/burst; enter one so that the loss rate comes out right
+    const double leave = 1 / std::max(1.0, burst), enter = leave * loss / std::max(1e-9, 1 - loss);
+    bad = bad ? rndf() >= leave : rndf() < enter;
+    return bad;
+  }
+  void send(const uint8_t* p, size_t n){
+    ++sent;
+    if (lose()) { ++dropped; return; }
+    q.push(Held{ wallUs() + (uint64_t)(rndf() * jitterMs * 1000), sent, std::vector<uint8_t>(p, p + n) });
+  }
+  void release(UdpEnd::Endpoint& from){
+    while (!q.empty() && q.top().dueUs <= wallUs()) {
+      UdpEnd::sendRaw(from, q.top().d.data(), q.top().d.size());
+      q.pop();
+    }
+  }
+};
+
+// ===== One run =====
+struct Result {
+  uint32_t crit = 0, critGot = 0, other = 0, otherGot = 0, misordered = 0, twice = 0;
+  std::vector<double> lat, rtt;   // ms
+  Udp::Rx rx;                      // the face's receiver counts
+};
+
+static bool isCommand(uint32_t k){ return k % 4 == 1; }
+
+static bool sendNth(Link::Ring& r, uint32_t k){
+  const uint16_t seq = (uint16_t)k;
+  if (!isCommand(k)) return Msg::sendPing(r, seq, (uint32_t)wallUs());
+  switch ((k / 4) % 3) {
+    case 0:  return Msg::sendMood(r, seq, (uint8_t)(k % 5));
+    case 1:  return Msg::sendSleep(r, seq, (uint8_t)(k / 12 % 2));
+    default: return Msg::sendSay(r, seq, 800, "Good morning, it is a bright day.");
+  }
+}
+
+static void pct(const char* tag, std::vector<double>& v){
+  if (v.empty()) { printf("  %s -", tag); return; }
+  std::sort(v.begin(), v.end());
+  auto at = [&](double p){ return v[std::min(v.size() - 1, (size_t)(p * v.size()))]; };
+  printf("  %s %5.2f %6.2f %6.2f %6.2f", tag, at(0.5), at(0.95), at(0.99), v.back());
+}
+
+// Host and face on loopback, through Net both ways.
+static Result loopback(double seconds, double intervalMs, double loss, double burst, double jitterMs, uint8_t copies){
+  Result res;
+  UdpEnd::Endpoint host, face;
+  if (!UdpEnd::open(host, 0) || !UdpEnd::open(face, 0)) { perror("socket"); exit(1); }
+  face.learnPeer = true;
+  face.tx.epoch = (uint8_t)(host.tx.epoch % 255 + 1);
+  UdpEnd::connect(host, "127.0.0.1", ntohs(face.self.sin_port));
+  host.tx.copies = face.tx.copies = copies;
+  Net down, up;
+  down.loss = up.loss = loss; down.burst = up.burst = burst; down.jitterMs = up.jitterMs = jitterMs;
+
+  const uint32_t frames = (uint32_t)(seconds * 1000 / intervalMs);
+  std::vector<uint64_t> sentAt(frames);
+  std::vector<bool> got(frames);
+  int32_t last = -1;
+  uint16_t faceSeq = 0;
+  const uint64_t t0 = wallUs();
+  const uint64_t endUs = t0 + (uint64_t)(seconds * 1e6) + 200000;   // tail: copies, holds, jitter
+  for (uint32_t k = 0; wallUs() < endUs; ) {
+    const uint64_t now = wallUs();
+    const uint32_t ms = (uint32_t)(now / 1000);
+    if (k < frames && now >= t0 + (uint64_t)(k * intervalMs * 1000)) {
+      sendNth(host.out, k);
+      sentAt[k] = now;
+      (isCommand(k) ? res.crit : res.other)++;
+      ++k;
+    }
+    UdpEnd::flush(host, ms, [&](const uint8_t* p, size_t n){ down.send(p, n); });
+    down.release(host);
+    UdpEnd::poll(face, ms, [&](const uint8_t* f, size_t n){
+      const Link::Header& h = *reinterpret_cast<const Link::Header*>(f);
+      const uint32_t i = h.seq;   // runs stay under 65536 frames
+      if (i >= frames) return;
+      if (got[i]) ++res.twice;
+      if ((int32_t)i <= last) ++res.misordered;
+      last = std::max(last, (int32_t)i);
+      got[i] = true;
+      (isCommand(i) ? res.critGot : res.otherGot)++;
+      res.lat.push_back((wallUs() - sentAt[i]) / 1000.0);
+      if (const Msg::Ping* m = Msg::view<Msg::Ping>(f, n)) Msg::sendPong(face.out, h.seq, m->hostUs, (uint32_t)wallUs());
+      else Msg::sendAck(face.out, faceSeq++, h.id, Msg::ACK_OK, h.seq);
+    });
+    UdpEnd::flush(face, ms, [&](const uint8_t* p, size_t n){ up.send(p, n); });
+    up.release(face);
+    UdpEnd::poll(host, ms, [&](const uint8_t* f, size_t n){
+      if (const Msg::Pong* m = Msg::view<Msg::Pong>(f, n)) res.rtt.push_back(((uint32_t)wallUs() - m->hostUs) / 1000.0);
+    });
+    std::this_thread::sleep_for(std::chrono::microseconds(50));
+  }
+  res.rx = face.rx;
+  UdpEnd::close(host); UdpEnd::close(face);
+  return res;
+}
+
+// The same traffic to a real face; nothing injected.
+static int remote(const char* ip, double seconds, double intervalMs){
+  UdpEnd::Endpoint host;
+  if (!UdpEnd::open(host, 0, true) || !UdpEnd::connect(host, ip, Udp::PORT)) { fprintf(stderr, "cannot reach %s\n", ip); return 1; }
+  const uint32_t frames = (uint32_t)(seconds * 1000 / intervalMs);
+  std::vector<double> rtt;
+  uint32_t acks = 0, commands = 0;
+  const uint64_t t0 = wallUs(), endUs = t0 + (uint64_t)(seconds * 1e6) + 500000;
+  for (uint32_t k = 0; wallUs() < endUs; ) {
+    const uint64_t now = wallUs();
+    if (k < frames && now >= t0 + (uint64_t)(k * intervalMs * 1000)) { commands += isCommand(k); sendNth(host.out, k++); }
+    UdpEnd::flush(host, (uint32_t)(now / 1000));
+    UdpEnd::poll(host, (uint32_t)(now / 1000), [&](const uint8_t* f, size_t n){
+      if (const Msg::Pong* m = Msg::view<Msg::Pong>(f, n)) rtt.push_back(((uint32_t)wallUs() - m->hostUs) / 1000.0);
+      else if (Msg::view<Msg::Ack>(f, n)) ++acks;
+    });
+    std::this_thread::sleep_for(std::chrono::microseconds(200));
+  }
+  printf("%s:%u: %u frames sent (%u commands), %zu Pongs, %u Acks; rx %u dgrams, %u lost, %u dups\n",
+         ip, Udp::PORT, frames, commands, rtt.size(), acks, host.rx.datagrams, host.rx.lost, host.rx.dups);
+  pct("Ping->Pong ms p50/95/99/max", rtt);
+  printf("\n");
+  UdpEnd::close(host);
+  return rtt.empty();
+}
+
+int main(int argc, char** argv){
+  double seconds = 3, intervalMs = 2, burst = 1, jitterMs = 3, loss = -1;
+  std::string to;
+  for (int i = 1; i < argc; ++i) {
+    const std::string a = argv[i];
+    if (a == "--seconds" && i + 1 < argc) seconds = atof(argv[++i]);
+    else if (a == "--interval" && i + 1 < argc) intervalMs = std::max(0.1, atof(argv[++i]));
+    else if (a == "--loss" && i + 1 < argc) loss = atof(argv[++i]);
+    else if (a == "--burst" && i + 1 < argc) burst = atof(argv[++i]);
+    else if (a == "--jitter" && i + 1 < argc) jitterMs = atof(argv[++i]);
+    else if (a == "--seed" && i + 1 < argc) g_rng = (uint32_t)std::max(1, atoi(argv[++i]));
+    else if (a == "--to" && i + 1 < argc) to = argv[++i];
+    else {
+      fprintf(stderr, "usage: %s [--seconds S] [--interval MS] [--loss P] [--burst N] [--jitter MS] [--seed S] [--to IP]\n", argv[0]);
+      return 2;
+    }
+  }
+  if (seconds * 1000 / intervalMs > 60000) { fprintf(stderr, "at most 60000 frames per run\n"); return 2; }
+  if (!to.empty()) return remote(to.c_str(), seconds, intervalMs);
+
+  printf("loopback: a frame every %.1f ms for %.0f s, 1 in 4 critical; jitter up to %.1f ms, loss bursts of %.1f; "
+         "window %d frames, hold %u ms, %u copies %u ms apart\n\n",
+         intervalMs, seconds, jitterMs, burst, Udp::WINDOW, (unsigned)Udp::HOLD_MS, (unsigned)Udp::COPIES, (unsigned)Udp::REPEAT_MS);
+  printf(" loss copies | critical   other  | latency ms p50    p95    p99    max | early   lost recovered  dups | RTT p50\n");
+  std::vector<double> losses = { 0, 0.01, 0.05, 0.1, 0.2 };
+  if (loss >= 0) losses = { loss };
+  int failures = 0;
+  for (double l : losses) {
+    for (uint8_t copies : { (uint8_t)0, Udp::COPIES }) {
+      Result r = loopback(seconds, intervalMs, l, burst, jitterMs, copies);
+      printf(" %4.2f %6u | %7.3f%% %7.3f%% |", l, copies, 100.0 * r.critGot / std::max(1u, r.crit), 100.0 * r.otherGot / std::max(1u, r.other));
+      pct("          ", r.lat);
+      printf(" | %5u %6u %9u %5u |", r.rx.early, r.rx.lost, r.rx.recovered, r.rx.dups);
+      std::sort(r.rtt.begin(), r.rtt.end());
+      printf(" %5.2f\n", r.rtt.empty() ? 0 : r.rtt[r.rtt.size() / 2]);
+      if (r.twice || r.misordered || (l == 0 && (r.critGot != r.crit || r.otherGot != r.other))) {
+        fprintf(stderr, "  %u delivered twice, %u out of order\n", r.twice, r.misordered);
+        ++failures;
+      }
+    }
+  }
+  return failures;
+}
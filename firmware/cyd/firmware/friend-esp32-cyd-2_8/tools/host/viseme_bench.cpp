@@ -0,0 +1,265 @@
+/*
+ * viseme_bench.cpp — host evaluation of the text-to-viseme fallback (src/viseme.h) against reference
+ * phone alignments.
+ *
+ * Reference: each utterance's phones (ARPAbet) with start / end times, mapped to the same viseme
+ * classes. Built in: a dozen short sentences of the kind the face says, transcribed by hand and timed
+ * with per-phone average durations jittered +-25% and a per-utterance speaking rate (0.85..1.2x).
+ * With --align FILE, real forced alignments instead, one utterance per block:
+ *     # text of the utterance
+ *     <start_s> <end_s> <phone>        (per phone; sil / sp / spn / empty = pause)
+ * (Montreal Forced Aligner output exported from its TextGrids fits, stress digits are ignored.)
+ *
+ * Per utterance the face runs Viseme::begin / tick at 40 FPS with voicing events from the reference
+ * (as Onset would report them: on 15 ms after sound starts, off 30 ms after it stops, stop closures
+ * quiet), drained half a frame ahead as main_full does. Two cases: "lips" (the host sends the exact
+ * duration; audio starts with the command, or --delay ms later) and "say" (TTS: duration estimated
+ * from the text, audio starts --delay ms later). Each runs open loop (duration only) and corrected
+ * (envelope). Reports viseme error rate of the sequence (edit distance / reference length), frame
+ * accuracy (exact, and within one frame either side), and how far the mouth's end is from the audio's.
+ * Exits nonzero when the correction does worse than open loop with the duration given and the audio
+ * on time, the device's usual case.
+ *
+ *   g++ -std=gnu++17 -O2 -Itools/host/shim -Isrc tools/host/viseme_bench.cpp -o viseme_bench
+ *   ./viseme_bench [--align FILE] [--delay 350] [--seed 1] [--list]
+ */
+#include <Arduino.h>
+#include <string>
+#include <vector>
+#include <stdio.h>
+#include <stdlib.h>
+#include "viseme.h"
+
+static constexpr uint32_t FRAME_MS    = 25;   // 40 FPS, as Eyes::FPS_DEFAULT
+static constexpr uint32_t VOICE_ON_MS = 15;   // Onset voicing envelope lag, rising ...
+static constexpr uint32_t VOICE_OFF_MS = 30;  // ... and falling
+
+struct Phone { uint32_t startMs, endMs; uint8_t vis; bool stop; };
+struct Utt { std::string text; std::vector<Phone> ph; uint32_t endMs() const { return ph.empty() ? 0 : ph.back().endMs; } };
+
+struct PhoneInfo { const char* name; uint8_t vis; uint16_t ms; };
+static const PhoneInfo PHONES[] = {
+  {"AA", Viseme::AI, 120}, {"AE", Viseme::AI, 130}, {"AH", Viseme::AI, 70},  {"AY", Viseme::AI, 140},
+  {"AO", Viseme::O, 120},  {"AW", Viseme::O, 150},  {"OW", Viseme::O, 130},  {"OY", Viseme::O, 160},
+  {"EH", Viseme::E, 100},  {"EY", Viseme::E, 130},  {"IH", Viseme::E, 70},   {"IY", Viseme::E, 100},
+  {"ER", Viseme::E, 110},  {"Y", Viseme::E, 55},
+  {"UH", Viseme::UW, 80},  {"UW", Viseme::UW, 110}, {"W", Viseme::UW, 65},
+  {"B", Viseme::MBP, 65},  {"P", Viseme::MBP, 80},  {"M", Viseme::MBP, 70},
+  {"F", Viseme::FV, 90},   {"V", Viseme::FV, 60},
+  {"T", Viseme::TL, 70},   {"D", Viseme::TL, 60},   {"N", Viseme::TL, 60},   {"L", Viseme::TL, 65},
+  {"TH", Viseme::TL, 80},  {"DH", Viseme::TL, 40},
+  {"K", Viseme::CONS, 80}, {"G", Viseme::CONS, 65}, {"NG", Viseme::CONS, 70}, {"S", Viseme::CONS, 100},
+  {"Z", Viseme::CONS, 80}, {"SH", Viseme::CONS, 110}, {"ZH", Viseme::CONS, 80}, {"CH", Viseme::CONS, 100},
+  {"JH", Viseme::CONS, 80}, {"R", Viseme::CONS, 65}, {"HH", Viseme::CONS, 60},
+};
+
+static const PhoneInfo* phone(std::string p){
+  while (!p.empty() && isdigit((unsigned char)p.back())) p.pop_back();   // stress
+  for (auto& c : p) c = (char)toupper((unsigned char)c);
+  for (const auto& i : PHONES) if (p == i.name) return &i;
+  return nullptr;
+}
+static bool isStop(const char* n){ return strchr("BPTDKG", n[0]) && !n[1]; }
+
+// text | phones, words separated by spaces; , . ? ! are pauses
+static const char* const BUILTIN[] = {
+  "Hello there, how are you today?|HH AH L OW DH EH R , HH AW AA R Y UW T AH D EY",
+  "I am happy to see you.|AY AE M HH AE P IY T UW S IY Y UW",
+  "Please wait a moment while I think.|P L IY Z W EY T AH M OW M AH N T W AY L AY TH IH NG K",
+  "The weather looks nice this morning.|DH AH W EH DH ER L UH K S N AY S DH IH S M AO R N IH NG",
+  "Could you open the window, please?|K UH D Y UW OW P AH N DH AH W IH N D OW , P L IY Z",
+  "My battery is getting low.|M AY B AE T ER IY IH Z G EH T IH NG L OW",
+  "Good morning! Did you sleep well?|G UH D M AO R N IH NG ! D IH D Y UW S L IY P W EH L",
+  "That was a funny joke.|DH AE T W AA Z AH F AH N IY JH OW K",
+  "Look over there, by the big blue box.|L UH K OW V ER DH EH R , B AY DH AH B IH G B L UW B AA K S",
+  "We should go outside and play.|W IY SH UH D G OW AW T S AY D AE N D P L EY",
+  "Thank you very much for your help.|TH AE NG K Y UW V EH R IY M AH CH F AO R Y AO R HH EH L P",
+  "Time for bed, sleep tight.|T AY M F AO R B EH D , S L IY P T AY T",
+};
+
+static uint32_t g_rng = 1;
+static float frand(){ g_rng ^= g_rng << 13; g_rng ^= g_rng >> 17; g_rng ^= g_rng << 5; return (g_rng % 10000) / 10000.f; }
+
+static void builtin(std::vector<Utt>& out){
+  for (const char* line : BUILTIN) {
+    Utt u;
+    const char* bar = strchr(line, '|');
+    u.text.assign(line, bar);
+    const float rate = 0.85f + 0.35f * frand();
+    uint32_t t = 0;
+    char buf[256];
+    snprintf(buf, sizeof(buf), "%s", bar + 1);
+    for (char* tok = strtok(buf, " "); tok; tok = strtok(nullptr, " ")) {
+      if (strchr(",.?!", tok[0])) {
+        const uint32_t ms = (uint32_t)((tok[0] == ',' ? 250 : 350) * (0.75f + 0.5f * frand()));
+        u.ph.push_back(Phone{ t, t + ms, Viseme::REST, false }); t += ms;
+        continue;
+      }
+      const PhoneInfo* p = phone(tok);
+      if (!p) { fprintf(stderr, "unknown phone %s\n", tok); exit(1); }
+      const uint32_t ms = (uint32_t)(p->ms * (0.75f + 0.5f * frand()) / rate);
+      u.ph.push_back(Phone{ t, t + ms, p->vis, isStop(p->name) }); t += ms;
+    }
+    out.push_back(u);
+  }
+}
+
+static bool readAlign(const char* path, std::vector<Utt>& out){
+  FILE* f = fopen(path, "r");
+  if (!f) { perror(path); return false; }
+  char line[512];
+  Utt u;
+  auto flush = [&](){ if (!u.ph.empty()) out.push_back(u); u = Utt(); };
+  while (fgets(line, sizeof(line), f)) {
+    line[strcspn(line, "\r\n")] = 0;
+    if (line[0] == '#') { flush(); const char* s = line + 1; while (*s == ' ') ++s; u.text = s; continue; }
+    double a, b; char name[32] = "";
+    const int got = sscanf(line, "%lf %lf %31s", &a, &b, name);
+    if (got < 2) continue;
+    const PhoneInfo* p = got == 3 ? phone(name) : nullptr;
+    u.ph.push_back(Phone{ (uint32_t)lround(a * 1000), (uint32_t)lround(b * 1000), p ? p->vis : (uint8_t)Viseme::REST, p && isStop(p->name) });
+  }
+  flush();
+  fclose(f);
+  // utterances start at their first sound
+  for (auto& x : out) {
+    while (!x.ph.empty() && x.ph.front().vis == Viseme::REST) x.ph.erase(x.ph.begin());
+    while (!x.ph.empty() && x.ph.back().vis == Viseme::REST) x.ph.pop_back();
+    if (x.ph.empty()) continue;
+    const uint32_t t0 = x.ph.front().startMs;
+    for (auto& p : x.ph) { p.startMs -= t0; p.endMs -= t0; }
+  }
+  return !out.empty();
+}
+
+static uint8_t refAt(const Utt& u, uint32_t ms){
+  for (const auto& p : u.ph) if (ms >= p.startMs && ms < p.endMs) return p.vis;
+  return Viseme::REST;
+}
+static bool soundAt(const Utt& u, uint32_t ms){
+  for (const auto& p : u.ph)
+    if (ms >= p.startMs && ms < p.endMs) return p.vis != Viseme::REST && !(p.stop && ms < p.startMs + (p.endMs - p.startMs) / 2);
+  return false;
+}
+
+static std::vector<uint8_t> collapse(const std::vector<uint8_t>& v){
+  std::vector<uint8_t> o;
+  for (uint8_t x : v) if (o.empty() || o.back() != x) o.push_back(x);
+  return o;
+}
+static int editDistance(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b){
+  std::vector<int> d(b.size() + 1);
+  for (size_t j = 0; j <= b.size(); ++j) d[j] = (int)j;
+  for (size_t i = 1; i <= a.size(); ++i) {
+    int diag = d[0]; d[0] = (int)i;
+    for (size_t j = 1; j <= b.size(); ++j) {
+      const int up = d[j];
+      d[j] = std::min({ d[j] + 1, d[j - 1] + 1, diag + (a[i - 1] != b[j - 1]) });
+      diag = up;
+    }
+  }
+  return d[b.size()];
+}
+
+struct Score { long frames = 0, exact = 0, near = 0; double endErr = 0; int n = 0; };
+
+// One utterance: the command at t = 0, audio from `delayMs`; returns the mouth's viseme per frame.
+static void run(const Utt& u, uint32_t durMs, uint32_t delayMs, bool corrected, Score& sc, bool list){
+  static Viseme::Track t;
+  const uint32_t audioEnd = delayMs + u.endMs();
+  t.sounding = false; t.soundSinceMs = 0;
+  Viseme::begin(t, u.text.c_str(), durMs, 0);
+  if (!corrected) t.openLoop = true;
+  std::vector<uint8_t> shown, ref;
+  uint32_t endMs = 0;
+  bool was = false;
+  uint32_t changedMs = 0;
+  for (uint32_t now = 0; now < audioEnd + 2000; now += FRAME_MS) {
+    // voicing as heard by the middle of this frame, with the envelope's lag
+    const uint32_t by = now + FRAME_MS / 2;
+    for (uint32_t ms = changedMs; ms <= by; ++ms) {
+      const bool s = ms >= delayMs && ms < audioEnd && soundAt(u, ms - delayMs);
+      if (s != was) { was = s; changedMs = ms; }
+      const uint32_t lag = was ? VOICE_ON_MS : VOICE_OFF_MS;
+      if (corrected && ms == changedMs + lag) Viseme::voiced(t, was, ms);
+    }
+    const bool active = t.active;
+    Viseme::tick(t, now);
+    if (active && !t.active) endMs = now;
+    shown.push_back(t.active ? (uint8_t)Viseme::current(t) : (uint8_t)Viseme::REST);
+    ref.push_back(now >= delayMs && now < audioEnd ? refAt(u, now - delayMs) : (uint8_t)Viseme::REST);
+  }
+  if (!endMs) endMs = audioEnd + 2000;
+  for (size_t i = 0; i < shown.size(); ++i) {
+    const uint32_t now = (uint32_t)i * FRAME_MS;
+    if (now < delayMs || now >= audioEnd) continue;
+    ++sc.frames;
+    sc.exact += shown[i] == ref[i];
+    bool near = false;
+    for (int k = -1; k <= 1; ++k) near |= i + k < shown.size() && shown[i + k] == ref[i];
+    sc.near += near;
+  }
+  sc.endErr += fabs((double)endMs - audioEnd); ++sc.n;
+  if (list) {
+    printf("  shown ");
+    for (size_t i = delayMs / FRAME_MS; i < audioEnd / FRAME_MS; ++i) putchar("-mftkaeou"[shown[i]]);
+    printf("\n  ref   ");
+    for (size_t i = delayMs / FRAME_MS; i < audioEnd / FRAME_MS; ++i) putchar("-mftkaeou"[ref[i]]);
+    printf("\n");
+  }
+}
+
+int main(int argc, char** argv){
+  const char* align = nullptr;
+  uint32_t delay = 350;
+  bool list = false;
+  for (int i = 1; i < argc; ++i) {
+    const std::string a = argv[i];
+    if (a == "--align" && i + 1 < argc) align = argv[++i];
+    else if (a == "--delay" && i + 1 < argc) delay = (uint32_t)atoi(argv[++i]);
+    else if (a == "--seed" && i + 1 < argc) g_rng = (uint32_t)max(1, atoi(argv[++i]));
+    else if (a == "--list") list = true;
+    else { fprintf(stderr, "usage: %s [--align FILE] [--delay MS] [--seed S] [--list]\n", argv[0]); return 2; }
+  }
+  std::vector<Utt> utts;
+  if (align ? !readAlign(align, utts) : (builtin(utts), false)) return 1;
+
+  long editSum = 0, refLen = 0;
+  uint32_t cueMax = 0;
+  Score s[6];   // open loop / corrected: lips, lips late, say
+  for (const auto& u : utts) {
+    static Viseme::Track t;
+    Viseme::begin(t, u.text.c_str(), 0, 0);
+    cueMax = max<uint32_t>(cueMax, (uint32_t)t.n);
+    std::vector<uint8_t> g2v, ref;
+    for (int i = 0; i < t.n; ++i) if (t.cues[i].vis != Viseme::REST) g2v.push_back(t.cues[i].vis);
+    for (const auto& p : u.ph) if (p.vis != Viseme::REST) ref.push_back(p.vis);
+    g2v = collapse(g2v); ref = collapse(ref);
+    editSum += editDistance(g2v, ref); refLen += (long)ref.size();
+    const uint32_t estimate = t.durMs;
+    if (list) printf("\"%s\": %zu visemes (ref %zu), %u ms (estimate %u ms)\n", u.text.c_str(), g2v.size(), ref.size(), u.endMs(), estimate);
+    run(u, u.endMs(), 0, false, s[0], false);
+    run(u, u.endMs(), 0, true, s[1], list);
+    run(u, u.endMs(), delay, false, s[2], false);
+    run(u, u.endMs(), delay, true, s[3], false);
+    run(u, 0, delay, false, s[4], false);
+    run(u, 0, delay, true, s[5], list);
+  }
+
+  printf("%zu utterances (%s); %d frames per second; largest utterance %u cues of %d\n", utts.size(),
+         align ? align : "built in", 1000 / (int)FRAME_MS, cueMax, Viseme::MAX_CUES);
+  printf("viseme error rate (sequence, edit distance / reference): %.1f%%\n\n", 100.0 * editSum / max(refLen, 1L));
+  printf("%-34s %8s %8s %10s\n", "case", "exact", "+-1 fr", "end_err_ms");
+  const char* names[6] = { "lips: duration, open loop", "lips: duration, corrected",
+                           "lips: duration + delay, open loop", "lips: duration + delay, corrected",
+                           "say: estimate + delay, open loop", "say: estimate + delay, corrected" };
+  for (int k = 0; k < 6; ++k)
+    printf("%-34s %7.1f%% %7.1f%% %10.0f\n", names[k], 100.0 * s[k].exact / max(s[k].frames, 1L),
+           100.0 * s[k].near / max(s[k].frames, 1L), s[k].endErr / max(s[k].n, 1));
+  printf("\n(delay: audio starts %u ms after the command)\n", delay);
+  if (s[1].exact < s[0].exact || s[1].near < s[0].near || s[1].endErr > s[0].endErr) {
+    printf("corrected does worse than open loop with the duration given and no delay\n");
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,92 @@
+"""
+iram_report.py — per-module IRAM usage from the linker map.
+
+Functions tagged FACE_IRAM(module) (src/iram.h) land in `.iram1.face.<module>` sections; everything
+else in IRAM (FreeRTOS, drivers, IDF) is grouped by the archive/object it came from.
+
+Runs automatically after every PlatformIO build as an extra_script (see platformio.ini), or by hand:
+
+  python tools/iram_report.py .pio/build/cyd-28-full/firmware.map
+"""
+
+import os
+import re
+import sys
+from collections import defaultdict
+
+SEG_RE = re.compile(r"^(iram0_0_seg|iram0_2_seg|dram0_0_seg)\s+(0x[0-9a-fA-F]+)\s+(0x[0-9a-fA-F]+)")
+OUT_RE = re.compile(r"^(\.iram0\.text|\.iram0\.vectors)\s+(0x[0-9a-fA-F]+)\s+(0x[0-9a-fA-F]+)")
+IN_RE = re.compile(r"^ (\.iram1(?:\.\S*)?)(?:\s+(0x[0-9a-fA-F]+)\s+(0x[0-9a-fA-F]+)\s+(\S+))?\s*$")
+CONT_RE = re.compile(r"^\s+(0x[0-9a-fA-F]+)\s+(0x[0-9a-fA-F]+)\s+(\S+)\s*$")
+
+
+def module_of(section, obj):
+    if section.startswith(".iram1.face."):
+        return "face:" + section[len(".iram1.face."):].split(".")[0]
+    # "libfreertos.a(tasks.c.obj)" -> "libfreertos.a"
+    base = os.path.basename(obj)
+    return base.split("(")[0]
+
+
+def parse(map_path):
+    segs, outs, mods = {}, {}, defaultdict(int)
+    pending = None
+    with open(map_path, "r", errors="replace") as f:
+        for line in f:
+            line = line.rstrip("\n")
+            m = SEG_RE.match(line)
+            if m:
+                segs[m.group(1)] = int(m.group(3), 16)
+                continue
+            m = OUT_RE.match(line)
+            if m:
+                outs[m.group(1)] = int(m.group(3), 16)
+                continue
+            if pending:
+                m = CONT_RE.match(line)
+                if m:
+                    mods[module_of(pending, m.group(3))] += int(m.group(2), 16)
+                pending = None
+                continue
+            m = IN_RE.match(line)
+            if m:
+                if m.group(2):
+                    mods[module_of(m.group(1), m.group(4))] += int(m.group(3), 16)
+                else:
+                    pending = m.group(1)  # long section names put addr/size on the next line
+    return segs, outs, mods
+
+
+def report(map_path, out=sys.stdout):
+    segs, outs, mods = parse(map_path)
+    used = sum(outs.values())
+    total = segs.get("iram0_0_seg", 0)
+    face = sum(v for k, v in mods.items() if k.startswith("face:"))
+
+    print("==== IRAM usage ({}) ====".format(os.path.basename(map_path)), file=out)
+    for name, size in sorted(mods.items(), key=lambda kv: (not kv[0].startswith("face:"), -kv[1])):
+        if size:
+            print("  {:<32} {:>7} B".format(name, size), file=out)
+    print("  {:<32} {:>7} B".format("face total", face), file=out)
+    if total:
+        print("  {:<32} {:>7} B / {} B ({:.1f}%)".format("IRAM used", used, total, 100.0 * used / total), file=out)
+    return used, total
+
+
+try:
+    Import("env")  # noqa: F821 — defined when run as a PlatformIO extra_script
+
+    def _after_build(source, target, env):
+        map_path = os.path.join(env.subst("$BUILD_DIR"), env.subst("${PROGNAME}.map"))
+        if os.path.exists(map_path):
+            report(map_path)
+        else:
+            print("iram_report: no map file at " + map_path)
+
+    env.Append(LINKFLAGS=["-Wl,-Map," + os.path.join("$BUILD_DIR", "${PROGNAME}.map")])  # noqa: F821
+    env.AddPostAction("$BUILD_DIR/${PROGNAME}.elf", _after_build)  # noqa: F821
+except NameError:
+    if __name__ == "__main__":
+        if len(sys.argv) != 2:
+            sys.exit("usage: iram_report.py <firmware.map>")
+        report(sys.argv[1])
@@ -0,0 +1,235 @@
+"""
+linkgen.py — generate src/link_msgs.h from tools/link.schema.
+
+Each message becomes a packed little-endian struct that is the whole frame (Link::Header, the fields,
+the crc), with static_asserts on its size and every field offset, so the firmware and host tools that
+include the header agree on the layout at compile time. Also emitted: the message ids, the frame size
+by id (what Link::feed needs to cut frames from a stream), Msg::view<M>() to read a received frame in
+place, and a send<Name>() per message that builds the frame in place in a Link::Ring. Msg::SCHEMA is a
+crc16 of the schema without comments, carried in Hello so both ends can tell they match.
+
+  python tools/linkgen.py                    # writes src/link_msgs.h
+  python tools/linkgen.py --check            # fails if src/link_msgs.h is out of date
+
+Only the Python standard library is needed.
+"""
+
+import os
+import re
+import sys
+import argparse
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+SCHEMA = os.path.join(HERE, "link.schema")
+OUT = os.path.join(HERE, "..", "src", "link_msgs.h")
+
+TYPES = {"u8": ("uint8_t", 1), "i8": ("int8_t", 1), "u16": ("uint16_t", 2), "i16": ("int16_t", 2),
+         "u32": ("uint32_t", 4), "i32": ("int32_t", 4), "char": ("char", 1)}
+HEADER_SIZE = 4      # Link::Header
+MAX_FRAME = 72       # Link::MAX_FRAME
+
+MSG_RE = re.compile(r"^message\s+([A-Z][A-Za-z0-9]*)\s+(\d+)(\s+critical)?$")
+CONST_RE = re.compile(r"^const\s+([A-Z][A-Z0-9_]*)\s+(\d+)$")
+FIELD_RE = re.compile(r"^(\w+)\s+([a-z][A-Za-z0-9]*)(?:\[(\d+)\])?$")
+
+
+def die(path, n, msg):
+    sys.exit(f"{path}:{n}: {msg}")
+
+
+def parse(path):
+    """Return (messages, constants, canonical text); messages are dicts: name, id, critical, doc, fields."""
+    msgs, consts, canon = [], [], []
+    for n, raw in enumerate(open(path, encoding="utf-8"), 1):
+        code, _, doc = raw.partition("#")
+        code, doc = code.strip(), doc.strip()
+        if not code:
+            continue
+        canon.append(" ".join(code.split()))
+        c = CONST_RE.match(code)
+        if c:
+            if any(x[0] == c.group(1) for x in consts):
+                die(path, n, f"constant {c.group(1)} defined twice")
+            consts.append((c.group(1), int(c.group(2)), doc))
+            continue
+        m = MSG_RE.match(code)
+        if m:
+            name, mid = m.group(1), int(m.group(2))
+            if not 1 <= mid <= 255:
+                die(path, n, f"id {mid} out of range 1..255")
+            if any(x["id"] == mid for x in msgs):
+                die(path, n, f"id {mid} used twice")
+            if any(x["name"] == name for x in msgs):
+                die(path, n, f"message {name} defined twice")
+            msgs.append({"name": name, "id": mid, "critical": bool(m.group(3)), "doc": doc, "fields": []})
+            continue
+        f = FIELD_RE.match(code)
+        if not f or not msgs:
+            die(path, n, f"expected 'message <Name> <id> [critical]', '<type> <name>[<n>]' or 'const <NAME> <n>', got '{code}'")
+        kind, name, count = f.group(1), f.group(2), f.group(3)
+        if kind not in TYPES:
+            die(path, n, f"unknown type '{kind}' (one of {', '.join(TYPES)})")
+        if kind == "char" and not count:
+            die(path, n, "char needs a length: char name[n]")
+        if name in ("h", "crc", "seq", "r", "m") or any(x["name"] == name for x in msgs[-1]["fields"]):
+            die(path, n, f"field name '{name}' taken")
+        msgs[-1]["fields"].append({"type": kind, "name": name, "count": int(count) if count else 0, "doc": doc})
+    for m in msgs:
+        off = HEADER_SIZE
+        for f in m["fields"]:
+            f["offset"] = off
+            off += TYPES[f["type"]][1] * max(1, f["count"])
+        m["size"] = off + 1
+        if m["size"] > MAX_FRAME:
+            sys.exit(f"{path}: {m['name']} is {m['size']} bytes, over Link::MAX_FRAME ({MAX_FRAME})")
+    return msgs, consts, "\n".join(canon) + "\n"
+
+
+def crc16(data):
+    """CRC-16/CCITT-FALSE."""
+    c = 0xFFFF
+    for b in data:
+        c ^= b << 8
+        for _ in range(8):
+            c = ((c << 1) ^ 0x1021) & 0xFFFF if c & 0x8000 else (c << 1) & 0xFFFF
+    return c
+
+
+def upper(name):
+    return re.sub(r"(?<=[a-z0-9])([A-Z])", r"_\1", name).upper()
+
+
+def emit(msgs, consts, canon):
+    out = []
+    w = out.append
+    n_ids = max(m["id"] for m in msgs) + 1
+    w("#pragma once")
+    w("// Generated by tools/linkgen.py from tools/link.schema; edit the schema and regenerate.")
+    w("#include <stddef.h>")
+    w("#include <stdint.h>")
+    w("#include <string.h>")
+    w('#include "link.h"')
+    w("")
+    w("// ===== Msg: the face link messages =====")
+    w("// Each struct is a whole frame (Link::Header, fields, crc8), read in place with view<M>() and built")
+    w("// in place in a TX ring with send<Name>().")
+    w("namespace Msg {")
+    w("")
+    w(f"static constexpr uint16_t SCHEMA = 0x{crc16(canon.encode()):04x};   // crc16 of the schema, in Hello")
+    w("")
+    width = max((len(f"static constexpr uint8_t {c[0]} = {c[1]};") for c in consts), default=0) + 2
+    for name, value, doc in consts:
+        decl = f"static constexpr uint8_t {name} = {value};"
+        w(f"{decl:<{width}}// {doc}" if doc else decl)
+    if consts:
+        w("")
+    w("enum Id : uint8_t {")
+    for m in msgs:
+        w(f"  {upper(m['name'])} = {m['id']},")
+    w(f"  NUM_IDS = {n_ids}")
+    w("};")
+    w("")
+    w("#pragma pack(push, 1)")
+    for m in msgs:
+        w("")
+        if m["doc"]:
+            w(f"// {m['doc']}")
+        w(f"struct {m['name']} {{")
+        w(f"  static constexpr Id   ID = {upper(m['name'])};")
+        w(f"  static constexpr bool CRITICAL = {'true' if m['critical'] else 'false'};")
+        w("  Link::Header h;")
+        for f in m["fields"]:
+            decl = f"  {TYPES[f['type']][0]:<9}{f['name']}" + (f"[{f['count']}]" if f["count"] else "") + ";"
+            w(f"{decl:<34}// {f['doc']}" if f["doc"] else decl)
+        w("  uint8_t  crc;")
+        w("};")
+    w("#pragma pack(pop)")
+    w("")
+    for m in msgs:
+        w(f"static_assert(sizeof({m['name']}) == {m['size']}, \"{m['name']} layout\");")
+        for f in m["fields"]:
+            w(f"static_assert(offsetof({m['name']}, {f['name']}) == {f['offset']}, \"{m['name']}::{f['name']} offset\");")
+        w(f"static_assert(sizeof({m['name']}) <= Link::MAX_FRAME, \"{m['name']} too large\");")
+    w("")
+    sizes = [0] * n_ids
+    names = ['""'] * n_ids
+    crit = [False] * n_ids
+    for m in msgs:
+        sizes[m["id"]] = m["size"]
+        names[m["id"]] = f'"{m["name"]}"'
+        crit[m["id"]] = m["critical"]
+    w("// Frame bytes by id, crc included (0: no such message): what Link::feed cuts a stream with.")
+    w(f"static constexpr uint8_t FRAME_SIZE[NUM_IDS] = {{ {', '.join(map(str, sizes))} }};")
+    w("// Critical messages by id: what a lossy transport sends more than once (udp_link.h).")
+    w(f"static constexpr bool IS_CRITICAL[NUM_IDS] = {{ {', '.join('true' if c else 'false' for c in crit)} }};")
+    w(f"static const char* const NAMES[NUM_IDS] = {{ {', '.join(names)} }};")
+    w("")
+    w("// The checked frame at p (n bytes) as an M, without copying; nullptr when it is another message.")
+    w("template <class M>")
+    w("static inline const M* view(const uint8_t* p, size_t n){")
+    w("  return n == sizeof(M) && p[1] == M::ID ? reinterpret_cast<const M*>(p) : nullptr;")
+    w("}")
+    w("")
+    w("// Encoders: each builds its frame in place in the ring; false when the ring is full.")
+    for m in msgs:
+        params = ["Link::Ring& r", "uint16_t seq"]
+        for f in m["fields"]:
+            if f["type"] == "char":
+                params.append(f"const char* {f['name']}")
+            elif f["count"]:
+                params.append(f"const {TYPES[f['type']][0]} (&{f['name']})[{f['count']}]")
+            else:
+                params.append(f"{TYPES[f['type']][0]} {f['name']}")
+        w(f"static inline bool send{m['name']}({', '.join(params)}){{")
+        w(f"  {m['name']}* m = reinterpret_cast<{m['name']}*>(Link::reserve(r, sizeof({m['name']})));")
+        w("  if (!m) return false;")
+        w(f"  m->h = {{ Link::MAGIC, {m['name']}::ID, seq }};")
+        for f in m["fields"]:
+            if f["type"] == "char":
+                # bounded copy + zero fill: strncpy trips -Wstringop-truncation, and strnlen
+                # -Wstringop-overread when the caller's buffer is shorter than the field
+                n = f['name']
+                w(f"  if (!{n}) {n} = \"\";")
+                w(f"  size_t {n}Len = 0;")
+                w(f"  while ({n}Len < sizeof(m->{n}) && {n}[{n}Len]) ++{n}Len;")
+                w(f"  memcpy(m->{n}, {n}, {n}Len);")
+                w(f"  memset(m->{n} + {n}Len, 0, sizeof(m->{n}) - {n}Len);")
+            elif f["count"]:
+                w(f"  memcpy(m->{f['name']}, {f['name']}, sizeof(m->{f['name']}));")
+            else:
+                w(f"  m->{f['name']} = {f['name']};")
+        w(f"  Link::commit(r, sizeof({m['name']}));")
+        w("  return true;")
+        w("}")
+    w("")
+    w("} // namespace Msg")
+    return "\n".join(out) + "\n"
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    ap.add_argument("--schema", default=SCHEMA)
+    ap.add_argument("-o", "--out", default=OUT)
+    ap.add_argument("--check", action="store_true", help="compare with the header on disk instead of writing it")
+    args = ap.parse_args()
+
+    msgs, consts, canon = parse(args.schema)
+    text = emit(msgs, consts, canon)
+    if args.check:
+        try:
+            old = open(args.out, encoding="utf-8", newline="").read().replace("\r\n", "\n")
+        except OSError:
+            old = ""
+        if old != text:
+            sys.exit(f"{os.path.relpath(args.out)} is out of date: run tools/linkgen.py")
+        print(f"{os.path.relpath(args.out)} is up to date")
+        return
+    with open(args.out, "w", encoding="utf-8", newline="\r\n") as f:
+        f.write(text)
+    for m in msgs:
+        print(f"{m['id']:3}  {m['name']:<10} {m['size']:3} bytes{'  critical' if m['critical'] else ''}")
+    print(f"schema 0x{crc16(canon.encode()):04x} -> {os.path.relpath(args.out)}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,104 @@
+"""
+trace2chrome.py — convert a firmware trace dump (src/trace.h) into Chrome trace JSON.
+
+The firmware prints the trace ring over serial when a frame stutters (build with -D FACE_TRACE)
+or on the `trace` command of the USB link firmware. Capture the serial log, then:
+
+  python tools/trace2chrome.py serial.log -o face_trace.json
+  python tools/trace2chrome.py serial.log --dump 2      # pick the 3rd dump in the log
+
+Open the JSON in chrome://tracing or https://ui.perfetto.dev. Each ESP32 core is a thread
+row, so audio pumps (core 0) and render stages (core 1) line up on one timeline.
+"""
+
+import sys
+import json
+import argparse
+
+CORE_NAMES = {0: "core0 (PRO / audio, wifi)", 1: "core1 (APP / loop, render)"}
+
+
+def parse_dumps(lines):
+    """Yield lists of (t_us, core, ph, name, arg) for every #trace-begin ... #trace-end block."""
+    cur = None
+    for raw in lines:
+        line = raw.strip()
+        if line.startswith("#trace-begin"):
+            cur = []
+        elif line.startswith("#trace-end"):
+            if cur is not None:
+                yield cur
+            cur = None
+        elif cur is not None and line:
+            parts = line.split()
+            if len(parts) != 5:
+                continue  # serial noise interleaved with the dump
+            try:
+                cur.append((int(parts[0]), int(parts[1]), parts[2], parts[3], int(parts[4])))
+            except ValueError:
+                continue
+
+
+def unwrap(events):
+    """micros() is 32-bit and wraps every ~71 minutes; make timestamps monotonic."""
+    out, base, prev = [], 0, None
+    for t, core, ph, name, arg in events:
+        if prev is not None and t < prev and prev - t > (1 << 31):
+            base += 1 << 32
+        prev = t
+        out.append((t + base, core, ph, name, arg))
+    return out
+
+
+def to_chrome(events):
+    events = unwrap(events)
+    t0 = events[0][0] if events else 0
+    trace = [{"name": "process_name", "ph": "M", "pid": 0, "args": {"name": "face"}}]
+    for core, label in CORE_NAMES.items():
+        trace.append({"name": "thread_name", "ph": "M", "pid": 0, "tid": core, "args": {"name": label}})
+
+    # The ring drops its oldest events, so an 'E' may arrive without its 'B'. Skip those.
+    open_spans = {}
+    for t, core, ph, name, arg in events:
+        ev = {"name": name, "ph": ph, "ts": t - t0, "pid": 0, "tid": core}
+        key = (core, name)
+        if ph == "B":
+            open_spans[key] = open_spans.get(key, 0) + 1
+            ev["args"] = {"arg": arg}
+        elif ph == "E":
+            if not open_spans.get(key):
+                continue
+            open_spans[key] -= 1
+        elif ph == "i":
+            ev["s"] = "t"
+            ev["args"] = {"arg": arg}
+        else:
+            continue
+        trace.append(ev)
+    return {"traceEvents": trace, "displayTimeUnit": "ms"}
+
+
+def main():
+    ap = argparse.ArgumentParser(description="Convert a face trace dump to Chrome trace JSON")
+    ap.add_argument("log", help="serial log containing #trace-begin/#trace-end blocks ('-' for stdin)")
+    ap.add_argument("-o", "--out", default="-", help="output JSON path (default: stdout)")
+    ap.add_argument("--dump", type=int, default=-1, help="which dump to convert (default: last)")
+    args = ap.parse_args()
+
+    src = sys.stdin if args.log == "-" else open(args.log, "r", errors="replace")
+    with src:
+        dumps = list(parse_dumps(src))
+    if not dumps:
+        sys.exit("no #trace-begin/#trace-end block found")
+
+    data = to_chrome(dumps[args.dump])
+    if args.out == "-":
+        json.dump(data, sys.stdout)
+    else:
+        with open(args.out, "w") as f:
+            json.dump(data, f)
+        print(f"wrote {len(data['traceEvents'])} events to {args.out}", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()